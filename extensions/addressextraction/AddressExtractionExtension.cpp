@@ -24,12 +24,17 @@
 #include "src/AddressExtractor.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/extensions/RootedService.h"
+#include "catapult/thread/MultiServicePool.h"
 
 namespace catapult { namespace addressextraction {
 
 	namespace {
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
-			auto pAddressExtractor = std::make_shared<AddressExtractor>(bootstrapper.pluginManager().createNotificationPublisher());
+			// cache addresses of (at most) all unconfirmed transactions so that they are not extracted again when confirmed
+			auto pAddressExtractor = std::make_shared<AddressExtractor>(
+					bootstrapper.pluginManager().createNotificationPublisher(),
+					bootstrapper.config().Node.UnconfirmedTransactionsCacheMaxSize,
+					*bootstrapper.pool().pushIsolatedPool("addressextraction"));
 
 			// add a dummy service for extending service lifetimes
 			bootstrapper.extensionManager().addServiceRegistrar(extensions::CreateRootedServiceRegistrar(
@@ -39,7 +39,8 @@ namespace catapult { namespace addressextraction {
 			}
 
 			void notifyRemovePartials(const TransactionInfos& transactionInfos) override {
-				m_extractor.extract(const_cast<TransactionInfos&>(transactionInfos));
+				// removed transactions (e.g. completed or pruned) should not be (re)added to the address cache
+				m_extractor.extractWithoutCaching(const_cast<TransactionInfos&>(transactionInfos));
 			}
 
 			void flush() override {
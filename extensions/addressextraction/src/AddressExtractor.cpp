@@ -21,36 +21,142 @@
 #include "AddressExtractor.h"
 #include "catapult/model/Elements.h"
 #include "catapult/model/TransactionUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace addressextraction {
 
+	namespace {
+		// extracting addresses of fewer transactions is not worth the cost of dispatching work to the pool
+		constexpr size_t Min_Transactions_For_Parallel_Extraction = 16;
+	}
+
 	AddressExtractor::AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher)
 			: m_pPublisher(std::move(pPublisher))
+			, m_maxCachedTransactions(0)
+			, m_pPool(nullptr)
 	{}
 
-	void AddressExtractor::extract(model::TransactionInfo& transactionInfo) const {
-		if (transactionInfo.OptionalExtractedAddresses)
-			return;
+	AddressExtractor::AddressExtractor(
+			std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+			size_t maxCachedTransactions,
+			thread::IoThreadPool& pool)
+			: m_pPublisher(std::move(pPublisher))
+			, m_maxCachedTransactions(maxCachedTransactions)
+			, m_pPool(&pool)
+	{}
+
+	size_t AddressExtractor::numCachedTransactions() const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		return m_cachedAddresses.size();
+	}
 
-		auto addresses = model::ExtractAddresses(*transactionInfo.pEntity, *m_pPublisher);
-		transactionInfo.OptionalExtractedAddresses = std::make_shared<model::UnresolvedAddressSet>(std::move(addresses));
+	void AddressExtractor::extract(model::TransactionInfo& transactionInfo) const {
+		extract(transactionInfo, true);
 	}
 
 	void AddressExtractor::extract(model::TransactionInfosSet& transactionInfos) const {
 		for (auto& transactionInfo : transactionInfos)
-			extract(const_cast<model::TransactionInfo&>(transactionInfo));
+			extract(const_cast<model::TransactionInfo&>(transactionInfo), true);
+	}
+
+	void AddressExtractor::extractWithoutCaching(model::TransactionInfosSet& transactionInfos) const {
+		for (auto& transactionInfo : transactionInfos)
+			extract(const_cast<model::TransactionInfo&>(transactionInfo), false);
 	}
 
 	void AddressExtractor::extract(model::TransactionElement& transactionElement) const {
 		if (transactionElement.OptionalExtractedAddresses)
 			return;
 
-		auto addresses = model::ExtractAddresses(transactionElement.Transaction, *m_pPublisher);
-		transactionElement.OptionalExtractedAddresses = std::make_shared<model::UnresolvedAddressSet>(std::move(addresses));
+		// a confirmed transaction is not expected to be extracted again, so its cached addresses can be released
+		auto pAddresses = remove(transactionElement.EntityHash);
+		transactionElement.OptionalExtractedAddresses = pAddresses ? pAddresses : extractUncached(transactionElement.Transaction);
 	}
 
 	void AddressExtractor::extract(model::BlockElement& blockElement) const {
-		for (auto& transactionElement : blockElement.Transactions)
-			extract(transactionElement);
+		std::vector<model::TransactionElement*> uncachedTransactionElements;
+		for (auto& transactionElement : blockElement.Transactions) {
+			if (transactionElement.OptionalExtractedAddresses)
+				continue;
+
+			transactionElement.OptionalExtractedAddresses = remove(transactionElement.EntityHash);
+			if (!transactionElement.OptionalExtractedAddresses)
+				uncachedTransactionElements.push_back(&transactionElement);
+		}
+
+		auto extractElement = [this](auto* pTransactionElement, auto) {
+			pTransactionElement->OptionalExtractedAddresses = extractUncached(pTransactionElement->Transaction);
+			return true;
+		};
+
+		if (!m_pPool || uncachedTransactionElements.size() < Min_Transactions_For_Parallel_Extraction) {
+			for (auto* pTransactionElement : uncachedTransactionElements)
+				extractElement(pTransactionElement, 0);
+
+			return;
+		}
+
+		auto& ioContext = m_pPool->ioContext();
+		thread::ParallelFor(ioContext, uncachedTransactionElements, m_pPool->numWorkerThreads(), extractElement).get();
+	}
+
+	void AddressExtractor::extract(model::TransactionInfo& transactionInfo, bool shouldCache) const {
+		if (!transactionInfo.OptionalExtractedAddresses) {
+			// transactions moving between the unconfirmed and partial caches are extracted multiple times
+			auto pAddresses = find(transactionInfo.EntityHash);
+			transactionInfo.OptionalExtractedAddresses = pAddresses ? pAddresses : extractUncached(*transactionInfo.pEntity);
+		}
+
+		if (shouldCache)
+			add(transactionInfo.EntityHash, transactionInfo.OptionalExtractedAddresses);
+	}
+
+	AddressExtractor::AddressesPointer AddressExtractor::extractUncached(const model::Transaction& transaction) const {
+		return std::make_shared<model::UnresolvedAddressSet>(model::ExtractAddresses(transaction, *m_pPublisher));
+	}
+
+	AddressExtractor::AddressesPointer AddressExtractor::find(const Hash256& hash) const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto iter = m_cachedAddresses.find(hash);
+		return m_cachedAddresses.cend() == iter ? nullptr : iter->second;
+	}
+
+	AddressExtractor::AddressesPointer AddressExtractor::remove(const Hash256& hash) const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto iter = m_cachedAddresses.find(hash);
+		if (m_cachedAddresses.cend() == iter)
+			return nullptr;
+
+		auto pAddresses = iter->second;
+		m_cachedAddresses.erase(iter);
+		return pAddresses;
+	}
+
+	void AddressExtractor::add(const Hash256& hash, const AddressesPointer& pAddresses) const {
+		if (0 == m_maxCachedTransactions)
+			return;
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		if (!m_cachedAddresses.emplace(hash, pAddresses).second)
+			return;
+
+		// evict oldest entries first (hashes of entries that were already removed are skipped)
+		m_cachedHashes.push_back(hash);
+		while (m_cachedAddresses.size() > m_maxCachedTransactions) {
+			m_cachedAddresses.erase(m_cachedHashes.front());
+			m_cachedHashes.pop_front();
+		}
+
+		// hashes of removed entries accumulate when transactions are confirmed, so periodically drop them
+		if (m_cachedHashes.size() > 2 * m_maxCachedTransactions) {
+			std::deque<Hash256> cachedHashes;
+			for (const auto& cachedHash : m_cachedHashes) {
+				if (m_cachedAddresses.cend() != m_cachedAddresses.find(cachedHash))
+					cachedHashes.push_back(cachedHash);
+			}
+
+			m_cachedHashes = std::move(cachedHashes);
+		}
 	}
 }}
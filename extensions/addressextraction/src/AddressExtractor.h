@@ -21,22 +21,40 @@
 #pragma once
 #include "catapult/model/ContainerTypes.h"
 #include "catapult/model/NotificationPublisher.h"
+#include "catapult/utils/Hashers.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 
 namespace catapult {
 	namespace model {
 		struct BlockElement;
 		struct TransactionElement;
 	}
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace addressextraction {
 
 	/// Utility class for extracting addresses.
+	/// \note Addresses extracted from transaction infos are cached by entity hash so that they can be reused
+	///       when the same transactions are later confirmed in a block.
 	class AddressExtractor {
 	public:
 		/// Creates an extractor around \a pPublisher.
 		explicit AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher);
 
+		/// Creates an extractor around \a pPublisher that caches addresses of at most \a maxCachedTransactions transactions
+		/// and uses \a pool to extract addresses of block transactions in parallel.
+		AddressExtractor(
+				std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+				size_t maxCachedTransactions,
+				thread::IoThreadPool& pool);
+
+	public:
+		/// Gets the number of transactions with cached addresses.
+		size_t numCachedTransactions() const;
+
 	public:
 		/// Extracts transaction addresses into \a transactionInfo.
 		void extract(model::TransactionInfo& transactionInfo) const;
@@ -44,13 +62,33 @@ namespace catapult { namespace addressextraction {
 		/// Extracts transaction addresses into \a transactionInfos.
 		void extract(model::TransactionInfosSet& transactionInfos) const;
 
+		/// Extracts transaction addresses into \a transactionInfos without caching them.
+		/// \note This is intended for transactions that are being removed, which are typically not extracted again.
+		void extractWithoutCaching(model::TransactionInfosSet& transactionInfos) const;
+
 		/// Extracts transaction addresses into \a transactionElement.
 		void extract(model::TransactionElement& transactionElement) const;
 
 		/// Extracts transaction addresses into \a blockElement.
 		void extract(model::BlockElement& blockElement) const;
 
+	private:
+		using AddressesPointer = std::shared_ptr<const model::UnresolvedAddressSet>;
+
+		void extract(model::TransactionInfo& transactionInfo, bool shouldCache) const;
+		AddressesPointer extractUncached(const model::Transaction& transaction) const;
+		AddressesPointer find(const Hash256& hash) const;
+		AddressesPointer remove(const Hash256& hash) const;
+		void add(const Hash256& hash, const AddressesPointer& pAddresses) const;
+
 	private:
 		std::unique_ptr<const model::NotificationPublisher> m_pPublisher;
+		size_t m_maxCachedTransactions;
+		thread::IoThreadPool* m_pPool;
+
+		// cache is mutable because extraction is logically const
+		mutable std::unordered_map<Hash256, AddressesPointer, utils::ArrayHasher<Hash256>> m_cachedAddresses;
+		mutable std::deque<Hash256> m_cachedHashes;
+		mutable std::mutex m_mutex;
 	};
 }}
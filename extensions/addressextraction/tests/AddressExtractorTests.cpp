@@ -20,6 +20,8 @@
 
 #include "addressextraction/src/AddressExtractor.h"
 #include "catapult/model/Elements.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/test/core/mocks/MockNotificationPublisher.h"
@@ -198,5 +200,226 @@ namespace catapult { namespace addressextraction {
 		EXPECT_EQ(pAddresses3, blockElement.Transactions[3].OptionalExtractedAddresses);
 	}
 
+	// endregion
+	// region caching
+
+	namespace {
+		class CountingNotificationPublisher : public model::NotificationPublisher {
+		public:
+			CountingNotificationPublisher() : m_numPublishCalls(0)
+			{}
+
+		public:
+			size_t numPublishCalls() const {
+				return m_numPublishCalls;
+			}
+
+		public:
+			void publish(const model::WeakEntityInfo&, model::NotificationSubscriber&) const override {
+				++m_numPublishCalls;
+			}
+
+		private:
+			mutable std::atomic<size_t> m_numPublishCalls;
+		};
+
+		class CachingTestContext {
+		public:
+			explicit CachingTestContext(size_t maxCachedTransactions)
+					: m_pPool(test::CreateStartedIoThreadPool())
+					, m_pNotificationPublisher(std::make_unique<CountingNotificationPublisher>())
+					, m_notificationPublisher(*m_pNotificationPublisher)
+					, m_extractor(std::move(m_pNotificationPublisher), maxCachedTransactions, *m_pPool)
+			{}
+
+		public:
+			const auto& publisher() const {
+				return m_notificationPublisher;
+			}
+
+			const auto& extractor() const {
+				return m_extractor;
+			}
+
+		private:
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			std::unique_ptr<CountingNotificationPublisher> m_pNotificationPublisher; // moved into m_extractor
+			CountingNotificationPublisher& m_notificationPublisher;
+			AddressExtractor m_extractor;
+		};
+
+		model::TransactionInfo CreateTransactionInfoWithoutAddresses() {
+			auto transactionInfo = test::CreateRandomTransactionInfo();
+			transactionInfo.OptionalExtractedAddresses = nullptr;
+			return transactionInfo;
+		}
+
+		model::TransactionInfosSet ToTransactionInfosSet(const model::TransactionInfo& transactionInfo) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			transactionInfos.push_back(transactionInfo.copy());
+			return test::CopyTransactionInfosToSet(transactionInfos);
+		}
+
+		model::TransactionElement ToTransactionElement(const model::TransactionInfo& transactionInfo) {
+			model::TransactionElement transactionElement(*transactionInfo.pEntity);
+			transactionElement.EntityHash = transactionInfo.EntityHash;
+			return transactionElement;
+		}
+	}
+
+	TEST(TEST_CLASS, ExtractCachesAddressesOfTransactionInfo) {
+		// Arrange:
+		CachingTestContext context(10);
+		auto transactionInfo = CreateTransactionInfoWithoutAddresses();
+
+		// Act:
+		context.extractor().extract(transactionInfo);
+
+		// Assert:
+		EXPECT_EQ(1u, context.publisher().numPublishCalls());
+		EXPECT_EQ(1u, context.extractor().numCachedTransactions());
+	}
+
+	TEST(TEST_CLASS, ExtractReusesCachedAddresses_TransactionInfo) {
+		// Arrange:
+		CachingTestContext context(10);
+		auto transactionInfo1 = CreateTransactionInfoWithoutAddresses();
+		auto transactionInfo2 = transactionInfo1.copy();
+		context.extractor().extract(transactionInfo1);
+
+		// Act:
+		context.extractor().extract(transactionInfo2);
+
+		// Assert:
+		EXPECT_EQ(1u, context.publisher().numPublishCalls());
+		EXPECT_EQ(transactionInfo1.OptionalExtractedAddresses, transactionInfo2.OptionalExtractedAddresses);
+		EXPECT_EQ(1u, context.extractor().numCachedTransactions());
+	}
+
+	TEST(TEST_CLASS, ExtractWithoutCachingDoesNotCacheAddressesOfTransactionInfos) {
+		// Arrange:
+		CachingTestContext context(10);
+		auto transactionInfos = ToTransactionInfosSet(CreateTransactionInfoWithoutAddresses());
+
+		// Act:
+		context.extractor().extractWithoutCaching(transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(1u, context.publisher().numPublishCalls());
+		EXPECT_TRUE(!!transactionInfos.cbegin()->OptionalExtractedAddresses);
+		EXPECT_EQ(0u, context.extractor().numCachedTransactions());
+	}
+
+	TEST(TEST_CLASS, ExtractWithoutCachingReusesCachedAddresses) {
+		// Arrange:
+		CachingTestContext context(10);
+		auto transactionInfo = CreateTransactionInfoWithoutAddresses();
+		auto transactionInfos = ToTransactionInfosSet(transactionInfo);
+		context.extractor().extract(transactionInfo);
+
+		// Act:
+		context.extractor().extractWithoutCaching(transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(1u, context.publisher().numPublishCalls());
+		EXPECT_EQ(transactionInfo.OptionalExtractedAddresses, transactionInfos.cbegin()->OptionalExtractedAddresses);
+		EXPECT_EQ(1u, context.extractor().numCachedTransactions());
+	}
+
+	TEST(TEST_CLASS, ExtractWithoutCachingDoesNotReaddReleasedAddresses) {
+		// Arrange: cache and then release addresses (via confirmation)
+		CachingTestContext context(10);
+		auto transactionInfo = CreateTransactionInfoWithoutAddresses();
+		auto transactionElement = ToTransactionElement(transactionInfo);
+		auto transactionInfos = ToTransactionInfosSet(transactionInfo);
+		context.extractor().extract(transactionInfo);
+		context.extractor().extract(transactionElement);
+
+		// Act: remove confirmed transaction
+		context.extractor().extractWithoutCaching(transactionInfos);
+
+		// Assert:
+		EXPECT_EQ(2u, context.publisher().numPublishCalls());
+		EXPECT_EQ(0u, context.extractor().numCachedTransactions());
+	}
+
+	TEST(TEST_CLASS, ExtractReusesAndReleasesCachedAddresses_TransactionElement) {
+		// Arrange:
+		CachingTestContext context(10);
+		auto transactionInfo = CreateTransactionInfoWithoutAddresses();
+		auto transactionElement = ToTransactionElement(transactionInfo);
+		context.extractor().extract(transactionInfo);
+
+		// Act:
+		context.extractor().extract(transactionElement);
+
+		// Assert:
+		EXPECT_EQ(1u, context.publisher().numPublishCalls());
+		EXPECT_EQ(transactionInfo.OptionalExtractedAddresses, transactionElement.OptionalExtractedAddresses);
+		EXPECT_EQ(0u, context.extractor().numCachedTransactions());
+	}
+
+	TEST(TEST_CLASS, ExtractEvictsOldestCachedAddressesWhenCacheIsFull) {
+		// Arrange:
+		CachingTestContext context(2);
+		std::vector<model::TransactionInfo> transactionInfos;
+		for (auto i = 0u; i < 3; ++i) {
+			transactionInfos.push_back(CreateTransactionInfoWithoutAddresses());
+			context.extractor().extract(transactionInfos.back());
+		}
+
+		auto transactionElement1 = ToTransactionElement(transactionInfos[0]);
+		auto transactionElement3 = ToTransactionElement(transactionInfos[2]);
+
+		// Act:
+		context.extractor().extract(transactionElement1);
+		context.extractor().extract(transactionElement3);
+
+		// Assert: only the first transaction was evicted and needed to be extracted again
+		EXPECT_EQ(4u, context.publisher().numPublishCalls());
+		EXPECT_NE(transactionInfos[0].OptionalExtractedAddresses, transactionElement1.OptionalExtractedAddresses);
+		EXPECT_EQ(transactionInfos[2].OptionalExtractedAddresses, transactionElement3.OptionalExtractedAddresses);
+		EXPECT_EQ(1u, context.extractor().numCachedTransactions());
+	}
+
+	namespace {
+		void AssertCanExtractBlockWithCachedAddresses(size_t numTransactions) {
+			// Arrange: cache addresses of every other transaction
+			CachingTestContext context(numTransactions);
+			model::Block block;
+			model::BlockElement blockElement(block);
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < numTransactions; ++i) {
+				transactionInfos.push_back(CreateTransactionInfoWithoutAddresses());
+				blockElement.Transactions.push_back(ToTransactionElement(transactionInfos.back()));
+				if (0 == i % 2)
+					context.extractor().extract(transactionInfos.back());
+			}
+
+			// Act:
+			context.extractor().extract(blockElement);
+
+			// Assert: each transaction was extracted exactly once
+			EXPECT_EQ(numTransactions, context.publisher().numPublishCalls());
+			EXPECT_EQ(0u, context.extractor().numCachedTransactions());
+
+			for (auto i = 0u; i < numTransactions; ++i) {
+				const auto& pAddresses = blockElement.Transactions[i].OptionalExtractedAddresses;
+				EXPECT_TRUE(!!pAddresses) << i;
+
+				if (0 == i % 2)
+					EXPECT_EQ(transactionInfos[i].OptionalExtractedAddresses, pAddresses) << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, ExtractReusesCachedAddresses_BlockElement) {
+		AssertCanExtractBlockWithCachedAddresses(7);
+	}
+
+	TEST(TEST_CLASS, ExtractReusesCachedAddresses_BlockElementExtractedInParallel) {
+		AssertCanExtractBlockWithCachedAddresses(100);
+	}
+
 	// endregion
 }}
@@ -48,6 +48,7 @@ namespace catapult { namespace diagnostics {
 			handlers::RegisterDiagnosticCountersHandler(handlers, counters);
 			handlers::RegisterDiagnosticNodesHandler(handlers, state.nodes());
 			handlers::RegisterDiagnosticBlockStatementHandler(handlers, state.storage());
+			handlers::RegisterDiagnosticPacketStatisticsHandlers(handlers);
 			state.pluginManager().addDiagnosticHandlers(handlers, state.cache());
 
 			handlers.setAllowedHosts({});
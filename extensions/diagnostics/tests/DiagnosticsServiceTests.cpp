@@ -68,11 +68,13 @@ namespace catapult { namespace diagnostics {
 		context.boot();
 		const auto& packetHandlers = context.testState().state().packetHandlers();
 
-		// Assert: three default handlers were added
-		EXPECT_EQ(4u, packetHandlers.size());
+		// Assert: five default handlers were added
+		EXPECT_EQ(6u, packetHandlers.size());
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Diagnostic_Counters)); // the default (counters) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Active_Node_Infos)); // the default (nodes) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Block_Statement)); // the default (statements) diagnostic handler
+		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Packet_Type_Statistics)); // the default (statistics) diagnostic handler
+		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Peer_Packet_Statistics)); // the default (statistics) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Chain_Statistics)); // the diagnostic handler hook registered above
 
 		// - correct params were forwarded to callback
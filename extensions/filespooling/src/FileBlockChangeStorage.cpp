@@ -52,6 +52,10 @@ namespace catapult { namespace filespooling {
 				m_pOutputStream->flush();
 			}
 
+			void flush() override {
+				// output stream is flushed after every change
+			}
+
 		private:
 			std::unique_ptr<io::OutputStream> m_pOutputStream;
 		};
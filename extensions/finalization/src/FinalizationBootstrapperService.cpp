@@ -20,12 +20,18 @@
 
 #include "FinalizationBootstrapperService.h"
 #include "FinalizationContextFactory.h"
+#include "finalization/src/api/RemoteProofApi.h"
+#include "finalization/src/chain/FinalizationProofVerifier.h"
 #include "finalization/src/chain/MultiRoundMessageAggregator.h"
+#include "finalization/src/chain/RemoteFinalizedHeightVerifier.h"
 #include "finalization/src/io/ProofStorageCache.h"
+#include "catapult/config/CatapultConfiguration.h"
 #include "catapult/extensions/ConfigurationUtils.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
+#include "catapult/io/BlockStorageCache.h"
 #include "catapult/subscribers/FinalizationSubscriber.h"
+#include "catapult/utils/MemoryUtils.h"
 
 namespace catapult { namespace finalization {
 
@@ -33,15 +39,14 @@ namespace catapult { namespace finalization {
 		constexpr auto Hooks_Service_Name = "fin.hooks";
 		constexpr auto Storage_Service_Name = "fin.proof.storage";
 		constexpr auto Aggregator_Service_Name = "fin.aggregator.multiround";
+		constexpr auto Context_Factory_Service_Name = "fin.context.factory";
 
 		// region CreateMultiRoundMessageAggregator
 
 		auto CreateMultiRoundMessageAggregator(
 				const FinalizationConfiguration& config,
 				const io::ProofStorageCache& proofStorage,
-				extensions::ServiceState& state) {
-			FinalizationContextFactory finalizationContextFactory(config, state);
-
+				const FinalizationContextFactory& finalizationContextFactory) {
 			auto proofStorageView = proofStorage.view();
 			auto finalizationStatistics = proofStorageView.statistics();
 			return std::make_shared<chain::MultiRoundMessageAggregator>(
@@ -49,7 +54,48 @@ namespace catapult { namespace finalization {
 					finalizationStatistics.Point,
 					model::HeightHashPair{ finalizationStatistics.Height, finalizationStatistics.Hash },
 					[finalizationContextFactory](auto roundPoint, auto height) {
-						return chain::CreateRoundMessageAggregator(finalizationContextFactory.create(roundPoint, height));
+						// message signatures are batch verified by the message range consumer before being aggregated
+						return chain::CreateVerifiedRoundMessageAggregator(finalizationContextFactory.create(roundPoint, height));
+					});
+		}
+
+		// endregion
+
+		// region CreateRemoteFinalizedHeightVerifier
+
+		auto CreateRemoteFinalizedHeightVerifier(
+				const FinalizationConfiguration& config,
+				extensions::ServiceState& state,
+				const FinalizationContextFactory& finalizationContextFactory) {
+			// proofs are retrieved from voting nodes because only their connections are guaranteed to serve proofs
+			auto proofRetriever = [&packetIoPickers = state.packetIoPickers(), timeout = state.config().Node.SyncTimeout](auto height) {
+				auto packetIoPairs = packetIoPickers.pickMatching(timeout, ionet::NodeRoles::Voting);
+				if (packetIoPairs.empty())
+					return thread::make_ready_future(std::shared_ptr<const model::FinalizationProof>());
+
+				auto packetIoPair = packetIoPairs.front();
+				auto pProofApi = utils::UniqueToShared(api::CreateRemoteProofApi(*packetIoPair.io(), packetIoPair.node().identity()));
+
+				// extend the lifetimes of pProofApi and packetIoPair until the proof is received
+				return pProofApi->proofAt(height).then([pProofApi, packetIoPair](auto&& proofFuture) {
+					return proofFuture.get();
+				});
+			};
+
+			return chain::CreateRemoteFinalizedHeightVerifier(
+					config.VotingSetGrouping,
+					[&storage = state.storage()]() { return storage.view().chainHeight(); },
+					proofRetriever,
+					[finalizationContextFactory](const auto& proof) {
+						auto result = chain::VerifyFinalizationProof(proof, finalizationContextFactory.create(proof.Point, proof.Height));
+						if (chain::VerifyFinalizationProofResult::Success != result) {
+							CATAPULT_LOG(warning)
+									<< "proof for point " << proof.Point << " at height " << proof.Height
+									<< " failed verification with " << result;
+							return false;
+						}
+
+						return true;
 					});
 		}
 
@@ -70,7 +116,7 @@ namespace catapult { namespace finalization {
 					const FinalizationConfiguration& config,
 					std::unique_ptr<io::ProofStorage>&& pProofStorage)
 					: m_config(config)
-					, m_pProofStorageCache(std::make_unique<io::ProofStorageCache>(std::move(pProofStorage)))
+					, m_pProofStorageCache(std::make_unique<io::ProofStorageCache>(std::move(pProofStorage), m_config.MaxCachedProofs))
 			{}
 
 		public:
@@ -93,6 +139,17 @@ namespace catapult { namespace finalization {
 				locator.registerServiceCounter<AggregatorType>(Aggregator_Service_Name, "FIN CUR EST", [](const auto& aggregator) {
 					return GetEstimateHeight(aggregator, FinalizationPoint(0)).unwrap();
 				});
+
+				using FactoryType = FinalizationContextFactory;
+
+				locator.registerServiceCounter<FactoryType>(Context_Factory_Service_Name, "FIN VOTERS", [](const auto& factory) {
+					auto pVoterTable = factory.voterTable();
+					return pVoterTable ? pVoterTable->size() : 0;
+				});
+				locator.registerServiceCounter<FactoryType>(Context_Factory_Service_Name, "FIN WEIGHT", [](const auto& factory) {
+					auto pVoterTable = factory.voterTable();
+					return pVoterTable ? pVoterTable->weight().unwrap() : 0;
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
@@ -101,12 +158,23 @@ namespace catapult { namespace finalization {
 					return proofStorage.view().statistics().Height;
 				});
 
+				auto pFinalizationContextFactory = std::make_shared<FinalizationContextFactory>(m_config, state);
+				state.hooks().setRemoteFinalizedHeightVerifier(CreateRemoteFinalizedHeightVerifier(
+						m_config,
+						state,
+						*pFinalizationContextFactory));
+
 				// register services
 				locator.registerRootedService(Hooks_Service_Name, std::make_shared<FinalizationServerHooks>());
 
 				locator.registerRootedService(Storage_Service_Name, m_pProofStorageCache);
 
-				auto pMultiRoundMessageAggregator = CreateMultiRoundMessageAggregator(m_config, *m_pProofStorageCache, state);
+				locator.registerRootedService(Context_Factory_Service_Name, pFinalizationContextFactory);
+
+				auto pMultiRoundMessageAggregator = CreateMultiRoundMessageAggregator(
+						m_config,
+						*m_pProofStorageCache,
+						*pFinalizationContextFactory);
 				locator.registerRootedService(Aggregator_Service_Name, pMultiRoundMessageAggregator);
 			}
 
@@ -135,4 +203,8 @@ namespace catapult { namespace finalization {
 	io::ProofStorageCache& GetProofStorageCache(const extensions::ServiceLocator& locator) {
 		return *locator.service<io::ProofStorageCache>(Storage_Service_Name);
 	}
+
+	const FinalizationContextFactory& GetFinalizationContextFactory(const extensions::ServiceLocator& locator) {
+		return *locator.service<FinalizationContextFactory>(Context_Factory_Service_Name);
+	}
 }}
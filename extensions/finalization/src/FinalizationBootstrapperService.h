@@ -27,7 +27,10 @@
 
 namespace catapult {
 	namespace chain { class MultiRoundMessageAggregator; }
-	namespace finalization { struct FinalizationConfiguration; }
+	namespace finalization {
+		class FinalizationContextFactory;
+		struct FinalizationConfiguration;
+	}
 	namespace io { class ProofStorageCache; }
 }
 
@@ -69,4 +72,7 @@ namespace catapult { namespace finalization {
 
 	/// Gets the proof storage cache stored in \a locator.
 	io::ProofStorageCache& GetProofStorageCache(const extensions::ServiceLocator& locator);
+
+	/// Gets the finalization context factory stored in \a locator.
+	const FinalizationContextFactory& GetFinalizationContextFactory(const extensions::ServiceLocator& locator);
 }}
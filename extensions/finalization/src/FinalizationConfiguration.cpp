@@ -48,7 +48,9 @@ namespace catapult { namespace finalization {
 		LOAD_PROPERTY(PrevoteBlocksMultiple);
 		LOAD_PROPERTY(OtsKeyDilution);
 
-		utils::VerifyBagSizeExact(bag, 9);
+		LOAD_PROPERTY(MaxCachedProofs);
+
+		utils::VerifyBagSizeExact(bag, 10);
 		return config;
 	}
 
@@ -57,6 +57,9 @@ namespace catapult { namespace finalization {
 		/// Ots key dilution.
 		uint16_t OtsKeyDilution;
 
+		/// Maximum number of recently loaded finalization proofs to keep in memory.
+		uint32_t MaxCachedProofs;
+
 		/// Number of blocks that should be treated as a group for voting set purposes.
 		/// \note This is copied from BlockChainConfiguration for easy access.
 		uint64_t VotingSetGrouping;
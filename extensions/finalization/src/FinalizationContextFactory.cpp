@@ -23,22 +23,49 @@
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/utils/SpinLock.h"
 
 namespace catapult { namespace finalization {
 
+	struct FinalizationContextFactory::VotingSetCache {
+		utils::SpinLock Lock;
+		VotingSet LastVotingSet;
+	};
+
 	FinalizationContextFactory::FinalizationContextFactory(const FinalizationConfiguration& config, const extensions::ServiceState& state)
 			: m_config(config)
 			, m_accountStateCache(state.cache().sub<cache::AccountStateCache>())
 			, m_blockStorage(state.storage())
+			, m_pVotingSetCache(std::make_shared<VotingSetCache>())
 	{}
 
+	std::shared_ptr<const model::FinalizationVoterTable> FinalizationContextFactory::voterTable() const {
+		std::lock_guard<utils::SpinLock> guard(m_pVotingSetCache->Lock);
+		return m_pVotingSetCache->LastVotingSet.pVoterTable;
+	}
+
 	model::FinalizationContext FinalizationContextFactory::create(FinalizationPoint point, Height height) const {
 		auto votingSetHeight = model::CalculateGroupedHeight<Height>(height, m_config.VotingSetGrouping);
-		return model::FinalizationContext(
-				point,
-				votingSetHeight,
-				m_blockStorage.view().loadBlockElement(votingSetHeight)->GenerationHash,
-				m_config,
-				*m_accountStateCache.createView());
+		auto votingSet = getVotingSet(votingSetHeight);
+		return model::FinalizationContext(point, votingSet.Hash, m_config, votingSet.pVoterTable);
+	}
+
+	FinalizationContextFactory::VotingSet FinalizationContextFactory::getVotingSet(Height votingSetHeight) const {
+		// generation hash identifies the chain ending at the voting set block, so a matching voter table can be reused
+		VotingSet votingSet;
+		votingSet.Hash = m_blockStorage.view().loadBlockElement(votingSetHeight)->GenerationHash;
+
+		{
+			std::lock_guard<utils::SpinLock> guard(m_pVotingSetCache->Lock);
+			const auto& lastVotingSet = m_pVotingSetCache->LastVotingSet;
+			if (lastVotingSet.pVoterTable && votingSetHeight == lastVotingSet.pVoterTable->height() && votingSet.Hash == lastVotingSet.Hash)
+				return lastVotingSet;
+		}
+
+		votingSet.pVoterTable = std::make_shared<const model::FinalizationVoterTable>(votingSetHeight, *m_accountStateCache.createView());
+
+		std::lock_guard<utils::SpinLock> guard(m_pVotingSetCache->Lock);
+		m_pVotingSetCache->LastVotingSet = votingSet;
+		return votingSet;
 	}
 }}
@@ -21,6 +21,7 @@
 #pragma once
 #include "FinalizationConfiguration.h"
 #include "finalization/src/model/FinalizationContext.h"
+#include <memory>
 
 namespace catapult {
 	namespace cache { class AccountStateCache; }
@@ -31,18 +32,34 @@ namespace catapult {
 namespace catapult { namespace finalization {
 
 	/// Factory for creating finalization contexts.
+	/// \note Voter tables are built once per voting set and shared by all contexts (and factory copies) using that voting set.
 	class FinalizationContextFactory {
 	public:
 		/// Creates a factory given \a config and \a state.
 		FinalizationContextFactory(const FinalizationConfiguration& config, const extensions::ServiceState& state);
 
+	public:
+		/// Gets the most recently used voter table, if any.
+		std::shared_ptr<const model::FinalizationVoterTable> voterTable() const;
+
 	public:
 		/// Creates a finalization context for \a point at \a height.
 		model::FinalizationContext create(FinalizationPoint point, Height height) const;
 
+	private:
+		struct VotingSet {
+			GenerationHash Hash;
+			std::shared_ptr<const model::FinalizationVoterTable> pVoterTable;
+		};
+
+		VotingSet getVotingSet(Height votingSetHeight) const;
+
 	private:
 		FinalizationConfiguration m_config;
 		const cache::AccountStateCache& m_accountStateCache;
 		const io::BlockStorageCache& m_blockStorage;
+
+		struct VotingSetCache;
+		std::shared_ptr<VotingSetCache> m_pVotingSetCache;
 	};
 }}
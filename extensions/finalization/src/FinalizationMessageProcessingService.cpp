@@ -23,7 +23,9 @@
 #include "finalization/src/FinalizationConfiguration.h"
 #include "finalization/src/chain/MultiRoundMessageAggregator.h"
 #include "finalization/src/ionet/FinalizationMessagePacketUtils.h"
+#include "finalization/src/model/FinalizationContext.h"
 #include "catapult/consumers/RecentHashCache.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
 #include "catapult/extensions/DispatcherUtils.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/extensions/ServiceUtils.h"
@@ -40,24 +42,45 @@ namespace catapult { namespace finalization {
 			return extensions::CreatePushEntitySink<MessagesSink>(locator, Writers_Service_Name);
 		}
 
-		class FinalizationPointChecker {
+		class MessageEligibilityChecker {
 		public:
-			explicit FinalizationPointChecker(const chain::MultiRoundMessageAggregator& messageAggregator) {
-				auto view = messageAggregator.view();
-				m_minPoint = view.minFinalizationPoint();
-				m_maxPoint = view.maxFinalizationPoint();
-			}
+			explicit MessageEligibilityChecker(const chain::MultiRoundMessageAggregator& messageAggregator)
+					: m_view(messageAggregator.view())
+					, m_minPoint(m_view.minFinalizationPoint())
+					, m_maxPoint(m_view.maxFinalizationPoint())
+			{}
 
 		public:
-			bool isInRange(FinalizationPoint point) const {
-				return m_minPoint <= point && point <= m_maxPoint;
+			bool isEligible(const model::FinalizationMessage& message) const {
+				// ignore messages associated with an out of range finalization point or an unknown stage
+				const auto& stepIdentifier = message.StepIdentifier;
+				if (m_minPoint > stepIdentifier.Point || stepIdentifier.Point > m_maxPoint)
+					return false;
+
+				if (stepIdentifier.Stage >= model::FinalizationStage::Count)
+					return false;
+
+				// ignore messages from accounts that are not eligible to vote in a known round
+				// (messages for rounds without an aggregator are checked by the aggregator when the round is created)
+				const auto* pFinalizationContext = m_view.tryGetFinalizationContext(stepIdentifier.Point);
+				if (!pFinalizationContext)
+					return true;
+
+				auto accountView = pFinalizationContext->lookup(message.Signature.Root.ParentPublicKey.copyTo<VotingKey>());
+				return Amount() != accountView.Weight;
 			}
 
 		private:
+			chain::MultiRoundMessageAggregatorView m_view;
 			FinalizationPoint m_minPoint;
 			FinalizationPoint m_maxPoint;
 		};
 
+		struct CandidateMessages {
+			std::vector<std::shared_ptr<model::FinalizationMessage>> Messages;
+			std::vector<Hash256> MessageHashes;
+		};
+
 		class FinalizationMessageProcessingServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			explicit FinalizationMessageProcessingServiceRegistrar(const FinalizationConfiguration& config) : m_config(config)
@@ -82,32 +105,66 @@ namespace catapult { namespace finalization {
 						extensions::CreateHashCheckOptions(m_config.ShortLivedCacheMessageDuration, state.config().Node));
 
 				auto messagesSink = CreateNewMessagesSink(locator);
+				auto otsKeyDilution = m_config.OtsKeyDilution;
+				auto randomFiller = crypto::CreateSecureRandomFiller();
+				auto verifier = [&messageProcessingPool, otsKeyDilution, randomFiller](const auto& messages) {
+					return model::VerifyMessageSignatures(messages, otsKeyDilution, randomFiller, messageProcessingPool);
+				};
+
 				auto& hooks = GetFinalizationServerHooks(locator);
-				hooks.setMessageRangeConsumer([&messageAggregator, &messageProcessingPool, pRecentHashCache, messagesSink](
+				hooks.setMessageRangeConsumer([&messageAggregator, &messageProcessingPool, pRecentHashCache, messagesSink, verifier](
 						auto&& messages) {
-					auto newMessages = ionet::FinalizationMessages();
+					auto pCandidates = std::make_shared<CandidateMessages>();
 					auto extractedMessages = model::FinalizationMessageRange::ExtractEntitiesFromRange(std::move(messages.Range));
 
-					FinalizationPointChecker finalizationPointChecker(messageAggregator);
-					for (const auto& pMessage : extractedMessages) {
-						// ignore messages associated with an out of range finalization point
-						if (!finalizationPointChecker.isInRange(pMessage->StepIdentifier.Point))
-							continue;
+					// filter out messages that can be rejected cheaply before (expensive) signature verification
+					auto eligibleMessages = std::vector<std::shared_ptr<model::FinalizationMessage>>();
+					{
+						MessageEligibilityChecker eligibilityChecker(messageAggregator);
+						for (const auto& pMessage : extractedMessages) {
+							if (eligibilityChecker.isEligible(*pMessage))
+								eligibleMessages.push_back(pMessage);
+						}
+					}
 
+					for (const auto& pMessage : eligibleMessages) {
 						auto messageHash = model::CalculateMessageHash(*pMessage);
 						if (!pRecentHashCache->add(messageHash))
 							continue;
 
-						messageProcessingPool.ioContext().dispatch([&messageAggregator, pMessage, messageHash]() {
-							auto addResult = messageAggregator.modifier().add(pMessage);
-							if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant)
-								CATAPULT_LOG(warning) << "finalization message " << messageHash << " rejected due to " << addResult;
-						});
-						newMessages.push_back(pMessage);
+						pCandidates->Messages.push_back(pMessage);
+						pCandidates->MessageHashes.push_back(messageHash);
 					}
 
-					if (!newMessages.empty())
-						messagesSink(newMessages);
+					if (pCandidates->Messages.empty())
+						return;
+
+					// batch verify all signatures up front so that the aggregator only needs to accumulate weights;
+					// complete asynchronously in order to not block the calling (packet handling) thread
+					verifier(pCandidates->Messages).then([&messageAggregator, &messageProcessingPool, messagesSink, pCandidates](
+							auto&& verifyResultsFuture) {
+						auto verifyResults = verifyResultsFuture.get();
+
+						auto newMessages = ionet::FinalizationMessages();
+						for (auto i = 0u; i < pCandidates->Messages.size(); ++i) {
+							const auto& pMessage = pCandidates->Messages[i];
+							const auto& messageHash = pCandidates->MessageHashes[i];
+							if (!verifyResults[i]) {
+								CATAPULT_LOG(warning) << "finalization message " << messageHash << " rejected due to invalid signature";
+								continue;
+							}
+
+							messageProcessingPool.ioContext().dispatch([&messageAggregator, pMessage, messageHash]() {
+								auto addResult = messageAggregator.modifier().add(pMessage);
+								if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant)
+									CATAPULT_LOG(warning) << "finalization message " << messageHash << " rejected due to " << addResult;
+							});
+							newMessages.push_back(pMessage);
+						}
+
+						if (!newMessages.empty())
+							messagesSink(newMessages);
+					});
 				});
 			}
 
@@ -28,6 +28,7 @@
 #include "finalization/src/chain/FinalizationProofVerifier.h"
 #include "finalization/src/chain/MultiRoundMessageAggregator.h"
 #include "catapult/config/CatapultKeys.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
 #include "catapult/extensions/NetworkUtils.h"
 #include "catapult/extensions/PeersConnectionTasks.h"
 #include "catapult/extensions/ServiceLocator.h"
@@ -100,17 +101,22 @@ namespace catapult { namespace finalization {
 		}
 
 		thread::Task CreatePullProofTask(
-				const FinalizationConfiguration& config,
 				extensions::ServiceLocator& locator,
 				const extensions::ServiceState& state,
-				net::PacketWriters& packetWriters) {
-			FinalizationContextFactory finalizationContextFactory(config, state);
+				net::PacketWriters& packetWriters,
+				thread::IoThreadPool& proofVerificationPool) {
+			auto finalizationContextFactory = GetFinalizationContextFactory(locator);
+			auto randomFiller = crypto::CreateSecureRandomFiller();
 			auto finalizationProofSynchronizer = chain::CreateFinalizationProofSynchronizer(
 					state.config().BlockChain.VotingSetGrouping,
 					state.storage(),
 					GetProofStorageCache(locator),
-					[finalizationContextFactory](const auto& proof) {
-						auto result = chain::VerifyFinalizationProof(proof, finalizationContextFactory.create(proof.Point, proof.Height));
+					[finalizationContextFactory, &proofVerificationPool, randomFiller](const auto& proof) {
+						auto result = chain::VerifyFinalizationProof(
+								proof,
+								finalizationContextFactory.create(proof.Point, proof.Height),
+								randomFiller,
+								proofVerificationPool);
 						if (chain::VerifyFinalizationProofResult::Success != result) {
 							CATAPULT_LOG(warning)
 									<< "proof for point " << proof.Point << " at height " << proof.Height
@@ -151,7 +157,7 @@ namespace catapult { namespace finalization {
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				auto connectionSettings = extensions::GetConnectionSettings(state);
 				auto pServiceGroup = state.pool().pushServiceGroup("finalization");
 				auto pWriters = pServiceGroup->pushService(net::CreatePacketWriters, locator.keys().caPublicKey(), connectionSettings);
 
@@ -163,7 +169,8 @@ namespace catapult { namespace finalization {
 
 				// add tasks
 				state.tasks().push_back(CreateConnectPeersTask(state, *pWriters));
-				state.tasks().push_back(CreatePullProofTask(m_config, locator, state, *pWriters));
+				auto& proofVerificationPool = *state.pool().pushIsolatedPool("proofVerification");
+				state.tasks().push_back(CreatePullProofTask(locator, state, *pWriters, proofVerificationPool));
 
 				if (m_config.EnableVoting)
 					state.tasks().push_back(CreatePullMessagesTask(locator, state, *pWriters));
@@ -35,55 +35,103 @@ namespace catapult { namespace chain {
 #undef DEFINE_ENUM
 
 	namespace {
-		std::shared_ptr<model::FinalizationMessage> CreateTemplateMessage(
+		using FinalizationMessages = std::vector<std::shared_ptr<model::FinalizationMessage>>;
+
+		std::shared_ptr<model::FinalizationMessage> CreateMessage(
 				FinalizationPoint point,
-				const model::FinalizationMessageGroup& messageGroup) {
+				const model::FinalizationMessageGroup& messageGroup,
+				const crypto::OtsTreeSignature& signature) {
 			uint32_t hashesPayloadSize = static_cast<uint32_t>(messageGroup.HashesCount * Hash256::Size);
 			uint32_t size = SizeOf32<model::FinalizationMessage>() + hashesPayloadSize;
 
 			auto pMessage = utils::MakeSharedWithSize<model::FinalizationMessage>(size);
 			pMessage->Size = size;
 			pMessage->HashesCount = messageGroup.HashesCount;
+			pMessage->Signature = signature;
 			pMessage->StepIdentifier = { point, messageGroup.Stage };
 			pMessage->Height = messageGroup.Height;
 
 			std::memcpy(reinterpret_cast<void*>(pMessage->HashesPtr()), messageGroup.HashesPtr(), hashesPayloadSize);
 			return pMessage;
 		}
-	}
 
-	VerifyFinalizationProofResult VerifyFinalizationProof(
-			const model::FinalizationProof& proof,
-			const model::FinalizationContext& context) {
-		if (model::FinalizationProofHeader::Current_Version != proof.Version)
-			return VerifyFinalizationProofResult::Failure_Invalid_Version;
+		FinalizationMessages ExtractMessages(const model::FinalizationProof& proof) {
+			FinalizationMessages messages;
+			for (const auto& messageGroup : proof.MessageGroups()) {
+				for (auto i = 0u; i < messageGroup.SignaturesCount; ++i)
+					messages.push_back(CreateMessage(proof.Point, messageGroup, messageGroup.SignaturesPtr()[i]));
+			}
+
+			return messages;
+		}
 
-		if (proof.Point != context.point())
-			return VerifyFinalizationProofResult::Failure_Invalid_Point;
+		VerifyFinalizationProofResult CheckHeader(const model::FinalizationProof& proof, const model::FinalizationContext& context) {
+			if (model::FinalizationProofHeader::Current_Version != proof.Version)
+				return VerifyFinalizationProofResult::Failure_Invalid_Version;
 
-		auto pMessageAggregator = CreateRoundMessageAggregator(context);
-		for (const auto& messageGroup : proof.MessageGroups()) {
-			auto pTemplateMessage = CreateTemplateMessage(proof.Point, messageGroup);
-			for (auto i = 0u; i < messageGroup.SignaturesCount; ++i) {
-				pTemplateMessage->Signature = messageGroup.SignaturesPtr()[i];
-				auto addResult = pMessageAggregator->add(pTemplateMessage);
+			if (proof.Point != context.point())
+				return VerifyFinalizationProofResult::Failure_Invalid_Point;
+
+			return VerifyFinalizationProofResult::Success;
+		}
+
+		VerifyFinalizationProofResult AggregateMessages(
+				const model::FinalizationProof& proof,
+				const FinalizationMessages& messages,
+				RoundMessageAggregator& messageAggregator) {
+			for (const auto& pMessage : messages) {
+				auto addResult = messageAggregator.add(pMessage);
 				if (addResult <= chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
 					CATAPULT_LOG(warning) << "finalization message for proof " << proof.Hash << " rejected due to " << addResult;
 					return VerifyFinalizationProofResult::Failure_Invalid_Messsage;
 				}
 			}
+
+			auto bestPrecommitResultPair = messageAggregator.roundContext().tryFindBestPrecommit();
+			if (!bestPrecommitResultPair.second)
+				return VerifyFinalizationProofResult::Failure_No_Precommit;
+
+			if (bestPrecommitResultPair.first.Height != proof.Height)
+				return VerifyFinalizationProofResult::Failure_Invalid_Height;
+
+			if (bestPrecommitResultPair.first.Hash != proof.Hash)
+				return VerifyFinalizationProofResult::Failure_Invalid_Hash;
+
+			return VerifyFinalizationProofResult::Success;
 		}
+	}
 
-		auto bestPrecommitResultPair = pMessageAggregator->roundContext().tryFindBestPrecommit();
-		if (!bestPrecommitResultPair.second)
-			return VerifyFinalizationProofResult::Failure_No_Precommit;
+	VerifyFinalizationProofResult VerifyFinalizationProof(
+			const model::FinalizationProof& proof,
+			const model::FinalizationContext& context) {
+		auto result = CheckHeader(proof, context);
+		if (VerifyFinalizationProofResult::Success != result)
+			return result;
 
-		if (bestPrecommitResultPair.first.Height != proof.Height)
-			return VerifyFinalizationProofResult::Failure_Invalid_Height;
+		auto pMessageAggregator = CreateRoundMessageAggregator(context);
+		return AggregateMessages(proof, ExtractMessages(proof), *pMessageAggregator);
+	}
+
+	VerifyFinalizationProofResult VerifyFinalizationProof(
+			const model::FinalizationProof& proof,
+			const model::FinalizationContext& context,
+			const crypto::RandomFiller& randomFiller,
+			thread::IoThreadPool& pool) {
+		auto result = CheckHeader(proof, context);
+		if (VerifyFinalizationProofResult::Success != result)
+			return result;
 
-		if (bestPrecommitResultPair.first.Hash != proof.Hash)
-			return VerifyFinalizationProofResult::Failure_Invalid_Hash;
+		// verify all signatures up front so that the aggregator only needs to accumulate weights
+		auto messages = ExtractMessages(proof);
+		auto verifyResults = model::VerifyMessageSignatures(messages, context.config().OtsKeyDilution, randomFiller, pool).get();
+		for (auto i = 0u; i < messages.size(); ++i) {
+			if (!verifyResults[i]) {
+				CATAPULT_LOG(warning) << "finalization message for proof " << proof.Hash << " has invalid signature";
+				return VerifyFinalizationProofResult::Failure_Invalid_Messsage;
+			}
+		}
 
-		return VerifyFinalizationProofResult::Success;
+		auto pMessageAggregator = CreateVerifiedRoundMessageAggregator(context);
+		return AggregateMessages(proof, messages, *pMessageAggregator);
 	}
 }}
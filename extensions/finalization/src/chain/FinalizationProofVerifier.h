@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/crypto/Signer.h"
 #include <iosfwd>
 
 namespace catapult {
@@ -26,6 +27,7 @@ namespace catapult {
 		class FinalizationContext;
 		struct FinalizationProof;
 	}
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace chain {
@@ -70,4 +72,12 @@ namespace catapult { namespace chain {
 	VerifyFinalizationProofResult VerifyFinalizationProof(
 			const model::FinalizationProof& proof,
 			const model::FinalizationContext& context);
+
+	/// Verifies \a proof given \a context by batch verifying all message signatures in parallel using \a pool.
+	/// \a randomFiller is used to generate random bytes.
+	VerifyFinalizationProofResult VerifyFinalizationProof(
+			const model::FinalizationProof& proof,
+			const model::FinalizationContext& context,
+			const crypto::RandomFiller& randomFiller,
+			thread::IoThreadPool& pool);
 }}
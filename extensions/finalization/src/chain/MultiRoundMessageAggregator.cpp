@@ -77,6 +77,11 @@ namespace catapult { namespace chain {
 		return m_state.RoundMessageAggregators.cend() == iter ? nullptr : &iter->second->roundContext();
 	}
 
+	const model::FinalizationContext* MultiRoundMessageAggregatorView::tryGetFinalizationContext(FinalizationPoint point) const {
+		auto iter = m_state.RoundMessageAggregators.find(point);
+		return m_state.RoundMessageAggregators.cend() == iter ? nullptr : &iter->second->finalizationContext();
+	}
+
 	model::HeightHashPair MultiRoundMessageAggregatorView::findEstimate(FinalizationPoint point) const {
 		const auto& roundMessageAggregators = m_state.RoundMessageAggregators;
 		for (auto iter = roundMessageAggregators.crbegin(); roundMessageAggregators.crend() != iter; ++iter) {
@@ -66,6 +66,9 @@ namespace catapult { namespace chain {
 		/// Tries to get the round context for the round specified by \a point.
 		const RoundContext* tryGetRoundContext(FinalizationPoint point) const;
 
+		/// Tries to get the finalization context for the round specified by \a point.
+		const model::FinalizationContext* tryGetFinalizationContext(FinalizationPoint point) const;
+
 		/// Finds the estimate for the round specified by \a point.
 		model::HeightHashPair findEstimate(FinalizationPoint point) const;
 
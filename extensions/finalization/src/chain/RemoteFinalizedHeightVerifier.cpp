@@ -0,0 +1,61 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "RemoteFinalizedHeightVerifier.h"
+#include "finalization/src/model/FinalizationProof.h"
+#include "catapult/model/HeightGrouping.h"
+
+namespace catapult { namespace chain {
+
+	RemoteFinalizedHeightVerifier CreateRemoteFinalizedHeightVerifier(
+			uint64_t votingSetGrouping,
+			const supplier<Height>& localChainHeightSupplier,
+			const RemoteProofRetriever& proofRetriever,
+			const predicate<const model::FinalizationProof&>& proofValidator) {
+		return [votingSetGrouping, localChainHeightSupplier, proofRetriever, proofValidator](const auto&, auto height) {
+			// proof can't be validated without the voting set, which is calculated from the local chain
+			auto votingSetHeight = model::CalculateGroupedHeight<Height>(height, votingSetGrouping);
+			if (votingSetHeight > localChainHeightSupplier()) {
+				CATAPULT_LOG(debug) << "cannot verify finalized height " << height << " with voting set at height " << votingSetHeight;
+				return thread::make_ready_future(false);
+			}
+
+			return proofRetriever(height).then([proofValidator, height](auto&& proofFuture) {
+				try {
+					auto pProof = proofFuture.get();
+					if (!pProof) {
+						CATAPULT_LOG(debug) << "peer did not return proof for finalized height " << height;
+						return false;
+					}
+
+					if (height != pProof->Height) {
+						CATAPULT_LOG(warning) << "peer returned proof with wrong height " << pProof->Height;
+						return false;
+					}
+
+					return proofValidator(*pProof);
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while requesting proof for finalized height " << height << ": " << e.what();
+					return false;
+				}
+			});
+		};
+	}
+}}
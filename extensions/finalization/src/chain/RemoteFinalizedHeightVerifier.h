@@ -0,0 +1,39 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/chain/ChainSynchronizer.h"
+
+namespace catapult { namespace model { struct FinalizationProof; } }
+
+namespace catapult { namespace chain {
+
+	/// Function signature for retrieving the finalization proof at a height from a remote node.
+	using RemoteProofRetriever = std::function<thread::future<std::shared_ptr<const model::FinalizationProof>> (Height)>;
+
+	/// Creates a remote finalized height verifier that retrieves proofs with \a proofRetriever and validates them with
+	/// \a proofValidator given \a votingSetGrouping and a local chain height supplier (\a localChainHeightSupplier).
+	/// \note A height is only verified when the block determining its voting set is part of the local chain.
+	RemoteFinalizedHeightVerifier CreateRemoteFinalizedHeightVerifier(
+			uint64_t votingSetGrouping,
+			const supplier<Height>& localChainHeightSupplier,
+			const RemoteProofRetriever& proofRetriever,
+			const predicate<const model::FinalizationProof&>& proofValidator);
+}}
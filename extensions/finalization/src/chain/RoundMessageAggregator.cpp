@@ -23,6 +23,7 @@
 #include "finalization/src/model/FinalizationContext.h"
 #include "finalization/src/model/FinalizationMessage.h"
 #include "catapult/model/HeightGrouping.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/utils/MacroBasedEnumIncludes.h"
 #include <unordered_map>
 
@@ -72,9 +73,15 @@ namespace catapult { namespace chain {
 		// region DefaultRoundMessageAggregator
 
 		class DefaultRoundMessageAggregator : public RoundMessageAggregator {
+		private:
+			using MessageProcessor = std::pair<model::ProcessMessageResult, size_t> (*)(
+					const model::FinalizationMessage&,
+					const model::FinalizationContext&);
+
 		public:
-			explicit DefaultRoundMessageAggregator(const model::FinalizationContext& finalizationContext)
+			DefaultRoundMessageAggregator(const model::FinalizationContext& finalizationContext, MessageProcessor messageProcessor)
 					: m_finalizationContext(finalizationContext)
+					, m_messageProcessor(messageProcessor)
 					, m_maxResponseSize(m_finalizationContext.config().MessageSynchronizationMaxResponseSize.bytes())
 					, m_roundContext(m_finalizationContext.weight().unwrap(), CalculateWeightedThreshold(m_finalizationContext))
 			{}
@@ -152,7 +159,7 @@ namespace catapult { namespace chain {
 							: RoundMessageAggregatorAddResult::Failure_Conflicting;
 				}
 
-				auto processResultPair = model::ProcessMessage(*pMessage, m_finalizationContext);
+				auto processResultPair = m_messageProcessor(*pMessage, m_finalizationContext);
 				if (model::ProcessMessageResult::Success != processResultPair.first) {
 					CATAPULT_LOG(warning) << "rejecting finalization message with result " << processResultPair.first;
 					return RoundMessageAggregatorAddResult::Failure_Processing;
@@ -171,6 +178,7 @@ namespace catapult { namespace chain {
 
 		private:
 			model::FinalizationContext m_finalizationContext;
+			MessageProcessor m_messageProcessor;
 			uint64_t m_maxResponseSize;
 			chain::RoundContext m_roundContext;
 			std::unordered_map<MessageKey, MessageDescriptor, MessageKeyHasher> m_messages;
@@ -180,6 +188,11 @@ namespace catapult { namespace chain {
 	}
 
 	std::unique_ptr<RoundMessageAggregator> CreateRoundMessageAggregator(const model::FinalizationContext& finalizationContext) {
-		return std::make_unique<DefaultRoundMessageAggregator>(finalizationContext);
+		return std::make_unique<DefaultRoundMessageAggregator>(finalizationContext, model::ProcessMessage);
+	}
+
+	std::unique_ptr<RoundMessageAggregator> CreateVerifiedRoundMessageAggregator(
+			const model::FinalizationContext& finalizationContext) {
+		return std::make_unique<DefaultRoundMessageAggregator>(finalizationContext, model::ProcessVerifiedMessage);
 	}
 }}
@@ -67,4 +67,9 @@ namespace catapult { namespace chain {
 
 	/// Creates a round message aggregator around \a finalizationContext.
 	std::unique_ptr<RoundMessageAggregator> CreateRoundMessageAggregator(const model::FinalizationContext& finalizationContext);
+
+	/// Creates a round message aggregator around \a finalizationContext that does not verify message signatures.
+	/// \note All added messages are expected to have been verified (e.g. by model::VerifyMessageSignatures).
+	std::unique_ptr<RoundMessageAggregator> CreateVerifiedRoundMessageAggregator(
+			const model::FinalizationContext& finalizationContext);
 }}
@@ -64,13 +64,12 @@ namespace catapult { namespace io {
 			: m_dataDirectory(dataDirectory)
 			, m_pointHeightMapping(m_dataDirectory, "proof.heights")
 			, m_indexFile((boost::filesystem::path(m_dataDirectory) / "proof.index.dat").generic_string())
-	{}
+			, m_statistics(m_indexFile.exists() ? m_indexFile.get() : model::FinalizationStatistics()) {
+		loadPointHeights();
+	}
 
 	model::FinalizationStatistics FileProofStorage::statistics() const {
-		if (!m_indexFile.exists())
-			return model::FinalizationStatistics();
-
-		return m_indexFile.get();
+		return m_statistics;
 	}
 
 	namespace {
@@ -150,34 +149,33 @@ namespace catapult { namespace io {
 		}
 
 		// fill gaps in mapping file - this works because loadProof(Height) returns latest proof with matching height
-		for (auto point = currentStatistics.Point + FinalizationPoint(1); point <= proof.Point; point = point + FinalizationPoint(1))
+		for (auto point = currentStatistics.Point + FinalizationPoint(1); point <= proof.Point; point = point + FinalizationPoint(1)) {
 			m_pointHeightMapping.save(point, proof.Height);
+			m_pointHeights.push_back(proof.Height);
+		}
 
-		m_indexFile.set({ proof.Point, proof.Height, proof.Hash });
+		auto statistics = model::FinalizationStatistics{ proof.Point, proof.Height, proof.Hash };
+		m_indexFile.set(statistics);
+		m_statistics = statistics;
 	}
 
-	FinalizationPoint FileProofStorage::findPointForHeight(Height height) const {
-		constexpr auto Max_Points_In_Batch = FinalizationPoint(100);
-		auto currentPoint = statistics().Point;
-
-		while (true) {
-			auto rangeBeginPoint = currentPoint > Max_Points_In_Batch ? (currentPoint - Max_Points_In_Batch) : FinalizationPoint(1);
-			auto numHeights = currentPoint > Max_Points_In_Batch ? Max_Points_In_Batch.unwrap() : currentPoint.unwrap();
-			auto heights = m_pointHeightMapping.loadRangeFrom(rangeBeginPoint, numHeights);
+	void FileProofStorage::loadPointHeights() {
+		auto numPoints = m_statistics.Point.unwrap();
+		if (0 == numPoints)
+			return;
 
-			// heights are in ascending order, so if height is not present in this 'batch', load next one
-			if (!heights.empty() && *heights.cbegin() > height) {
-				currentPoint = rangeBeginPoint;
-				continue;
-			}
+		auto heights = m_pointHeightMapping.loadRangeFrom(FinalizationPoint(1), numPoints);
+		m_pointHeights.assign(heights.cbegin(), heights.cend());
+	}
 
-			auto iter = std::upper_bound(heights.cbegin(), heights.cend(), height);
-			if (height == *--iter)
-				return rangeBeginPoint + FinalizationPoint(static_cast<uint64_t>(std::distance(heights.cbegin(), iter)));
+	FinalizationPoint FileProofStorage::findPointForHeight(Height height) const {
+		// heights are in ascending order, so the last point with a matching height is the most recent one
+		auto iter = std::upper_bound(m_pointHeights.cbegin(), m_pointHeights.cend(), height);
+		if (m_pointHeights.cbegin() != iter && height == *--iter)
+			return FinalizationPoint(static_cast<uint64_t>(std::distance(m_pointHeights.cbegin(), iter)) + 1);
 
-			CATAPULT_LOG(debug) << "element not found, was looking for " << height;
-			return FinalizationPoint();
-		}
+		CATAPULT_LOG(debug) << "element not found, was looking for " << height;
+		return FinalizationPoint();
 	}
 
 	// endregion
@@ -23,10 +23,12 @@
 #include "catapult/io/FixedSizeValueStorage.h"
 #include "catapult/io/IndexFile.h"
 #include <string>
+#include <vector>
 
 namespace catapult { namespace io {
 
 	/// File-based proof storage.
+	/// \note Statistics and the dense point to height index are kept in memory, so this must be the only writer of the data directory.
 	class FileProofStorage final : public ProofStorage {
 	public:
 		/// Creates a file-based proof storage, where proofs will be stored inside \a dataDirectory.
@@ -39,6 +41,7 @@ namespace catapult { namespace io {
 		void saveProof(const model::FinalizationProof& proof) override;
 
 	private:
+		void loadPointHeights();
 		FinalizationPoint findPointForHeight(Height height) const;
 
 	private:
@@ -66,5 +69,8 @@ namespace catapult { namespace io {
 		std::string m_dataDirectory;
 		FinalizationPointHeightFile m_pointHeightMapping;
 		FinalizationIndexFile m_indexFile;
+
+		model::FinalizationStatistics m_statistics;
+		std::vector<Height> m_pointHeights; // height of point (index + 1)
 	};
 }}
@@ -19,14 +19,100 @@
 **/
 
 #include "ProofStorageCache.h"
+#include "catapult/utils/SpinLock.h"
+#include <list>
 
 namespace catapult { namespace io {
 
+	// region CachedProofs
+
+	class CachedProofs {
+	private:
+		using ProofPointer = std::shared_ptr<const model::FinalizationProof>;
+
+		struct Entry {
+			ProofPointer pProof;
+
+			// true if proof is the most recent proof at its height
+			bool IsLatestAtHeight;
+		};
+
+	public:
+		explicit CachedProofs(size_t maxProofs) : m_maxProofs(maxProofs)
+		{}
+
+	public:
+		ProofPointer find(FinalizationPoint point) {
+			return find([point](const auto& entry) { return point == entry.pProof->Point; });
+		}
+
+		ProofPointer find(Height height) {
+			return find([height](const auto& entry) { return entry.IsLatestAtHeight && height == entry.pProof->Height; });
+		}
+
+		void add(const ProofPointer& pProof, bool isLatestAtHeight) {
+			if (!pProof || 0 == m_maxProofs)
+				return;
+
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = std::find_if(m_entries.begin(), m_entries.end(), [&pProof](const auto& entry) {
+				return pProof->Point == entry.pProof->Point;
+			});
+
+			if (m_entries.end() != iter) {
+				iter->IsLatestAtHeight = iter->IsLatestAtHeight || isLatestAtHeight;
+				m_entries.splice(m_entries.begin(), m_entries, iter);
+				return;
+			}
+
+			m_entries.push_front(Entry{ pProof, isLatestAtHeight });
+			if (m_entries.size() > m_maxProofs)
+				m_entries.pop_back();
+		}
+
+		void remove(FinalizationPoint point) {
+			utils::SpinLockGuard guard(m_lock);
+			m_entries.remove_if([point](const auto& entry) { return point == entry.pProof->Point; });
+		}
+
+		void supersede(Height height) {
+			utils::SpinLockGuard guard(m_lock);
+			for (auto& entry : m_entries) {
+				if (height <= entry.pProof->Height)
+					entry.IsLatestAtHeight = false;
+			}
+		}
+
+	private:
+		template<typename TPredicate>
+		ProofPointer find(TPredicate predicate) {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = std::find_if(m_entries.begin(), m_entries.end(), predicate);
+			if (m_entries.end() == iter)
+				return nullptr;
+
+			// move the entry to the front so that the least recently used proof is evicted first
+			m_entries.splice(m_entries.begin(), m_entries, iter);
+			return m_entries.front().pProof;
+		}
+
+	private:
+		size_t m_maxProofs;
+		std::list<Entry> m_entries;
+		utils::SpinLock m_lock;
+	};
+
+	// endregion
+
 	// region ProofStorageView
 
-	ProofStorageView::ProofStorageView(const ProofStorage& storage, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+	ProofStorageView::ProofStorageView(
+			const ProofStorage& storage,
+			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
+			CachedProofs& cachedProofs)
 			: m_storage(storage)
 			, m_readLock(std::move(readLock))
+			, m_cachedProofs(cachedProofs)
 	{}
 
 	model::FinalizationStatistics ProofStorageView::statistics() const {
@@ -34,43 +120,70 @@ namespace catapult { namespace io {
 	}
 
 	std::shared_ptr<const model::FinalizationProof> ProofStorageView::loadProof(FinalizationPoint point) const {
-		return m_storage.loadProof(point);
+		auto pProof = m_cachedProofs.find(point);
+		if (pProof)
+			return pProof;
+
+		pProof = m_storage.loadProof(point);
+		m_cachedProofs.add(pProof, false);
+		return pProof;
 	}
 
 	std::shared_ptr<const model::FinalizationProof> ProofStorageView::loadProof(Height height) const {
-		return m_storage.loadProof(height);
+		auto pProof = m_cachedProofs.find(height);
+		if (pProof)
+			return pProof;
+
+		pProof = m_storage.loadProof(height);
+		m_cachedProofs.add(pProof, true);
+		return pProof;
 	}
 
 	// endregion
 
 	// region ProofStorageModifier
 
-	ProofStorageModifier::ProofStorageModifier(ProofStorage& storage, utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
+	ProofStorageModifier::ProofStorageModifier(
+			ProofStorage& storage,
+			utils::SpinReaderWriterLock::WriterLockGuard&& writeLock,
+			CachedProofs& cachedProofs)
 			: m_storage(storage)
 			, m_writeLock(std::move(writeLock))
+			, m_cachedProofs(cachedProofs)
 	{}
 
 	void ProofStorageModifier::saveProof(const model::FinalizationProof& proof) {
 		m_storage.saveProof(proof);
+
+		// proof at the saved point has been replaced
+		m_cachedProofs.remove(proof.Point);
+
+		// proof at any height not less than the saved proof height might have changed
+		m_cachedProofs.supersede(proof.Height);
 	}
 
 	// endregion
 
 	// region ProofStorageCache
 
-	ProofStorageCache::ProofStorageCache(std::unique_ptr<ProofStorage>&& pStorage) : m_pStorage(std::move(pStorage))
+	ProofStorageCache::ProofStorageCache(std::unique_ptr<ProofStorage>&& pStorage) : ProofStorageCache(std::move(pStorage), 0)
+	{}
+
+	ProofStorageCache::ProofStorageCache(std::unique_ptr<ProofStorage>&& pStorage, size_t maxCachedProofs)
+			: m_pStorage(std::move(pStorage))
+			, m_pCachedProofs(std::make_unique<CachedProofs>(maxCachedProofs))
 	{}
 
 	ProofStorageCache::~ProofStorageCache() = default;
 
 	ProofStorageView ProofStorageCache::view() const {
 		auto readLock = m_lock.acquireReader();
-		return ProofStorageView(*m_pStorage, std::move(readLock));
+		return ProofStorageView(*m_pStorage, std::move(readLock), *m_pCachedProofs);
 	}
 
 	ProofStorageModifier ProofStorageCache::modifier() {
 		auto writeLock = m_lock.acquireWriter();
-		return ProofStorageModifier(*m_pStorage, std::move(writeLock));
+		return ProofStorageModifier(*m_pStorage, std::move(writeLock), *m_pCachedProofs);
 	}
 
 	// endregion
@@ -22,13 +22,18 @@
 #include "ProofStorage.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 
+namespace catapult { namespace io { class CachedProofs; } }
+
 namespace catapult { namespace io {
 
 	/// Read only view on top of proof storage.
 	class ProofStorageView : utils::MoveOnly {
 	public:
-		/// Creates a view around \a storage with lock context \a readLock.
-		ProofStorageView(const ProofStorage& storage, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+		/// Creates a view around \a storage with lock context \a readLock and recently loaded proofs \a cachedProofs.
+		ProofStorageView(
+				const ProofStorage& storage,
+				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
+				CachedProofs& cachedProofs);
 
 	public:
 		/// Gets the statistics of the last finalized block.
@@ -43,13 +48,17 @@ namespace catapult { namespace io {
 	private:
 		const ProofStorage& m_storage;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		CachedProofs& m_cachedProofs;
 	};
 
 	/// Write only view on top of proof storage.
 	class ProofStorageModifier : utils::MoveOnly {
 	public:
-		/// Creates a view around \a storage with lock context \a writeLock.
-		ProofStorageModifier(ProofStorage& storage, utils::SpinReaderWriterLock::WriterLockGuard&& writeLock);
+		/// Creates a view around \a storage with lock context \a writeLock and recently loaded proofs \a cachedProofs.
+		ProofStorageModifier(
+				ProofStorage& storage,
+				utils::SpinReaderWriterLock::WriterLockGuard&& writeLock,
+				CachedProofs& cachedProofs);
 
 	public:
 		/// Saves finalization \a proof.
@@ -58,15 +67,19 @@ namespace catapult { namespace io {
 	private:
 		ProofStorage& m_storage;
 		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+		CachedProofs& m_cachedProofs;
 	};
 
 	/// Cache around a ProofStorage.
-	/// \note Currently this "cache" provides synchronization.
+	/// \note This cache provides synchronization and keeps the most recently loaded proofs in memory.
 	class ProofStorageCache {
 	public:
-		/// Creates a new cache around \a pStorage.
+		/// Creates a new cache around \a pStorage that does not keep any loaded proofs.
 		explicit ProofStorageCache(std::unique_ptr<ProofStorage>&& pStorage);
 
+		/// Creates a new cache around \a pStorage that keeps up to \a maxCachedProofs most recently loaded proofs.
+		ProofStorageCache(std::unique_ptr<ProofStorage>&& pStorage, size_t maxCachedProofs);
+
 		/// Destroys the cache.
 		~ProofStorageCache();
 
@@ -79,6 +92,7 @@ namespace catapult { namespace io {
 
 	private:
 		std::unique_ptr<ProofStorage> m_pStorage;
+		std::unique_ptr<CachedProofs> m_pCachedProofs;
 		mutable utils::SpinReaderWriterLock m_lock;
 	};
 }}
@@ -19,50 +19,39 @@
 **/
 
 #include "FinalizationContext.h"
-#include "catapult/cache_core/AccountStateCache.h"
 
 namespace catapult { namespace model {
 
-	namespace {
-		VotingKey Find(const std::vector<PinnedVotingKey>& pinnedPublicKeys, FinalizationPoint point) {
-			auto iter = std::find_if(pinnedPublicKeys.cbegin(), pinnedPublicKeys.cend(), [point](const auto& pinnedPublicKey) {
-				return pinnedPublicKey.StartPoint <= point && point <= pinnedPublicKey.EndPoint;
-			});
-			return pinnedPublicKeys.cend() != iter ? iter->VotingKey : VotingKey();
-		}
-	}
-
 	FinalizationContext::FinalizationContext(
 			FinalizationPoint point,
 			Height height,
 			const GenerationHash& generationHash,
 			const finalization::FinalizationConfiguration& config,
 			const cache::AccountStateCacheView& accountStateCacheView)
+			: FinalizationContext(
+					point,
+					generationHash,
+					config,
+					std::make_shared<const FinalizationVoterTable>(height, accountStateCacheView))
+	{}
+
+	FinalizationContext::FinalizationContext(
+			FinalizationPoint point,
+			const GenerationHash& generationHash,
+			const finalization::FinalizationConfiguration& config,
+			const std::shared_ptr<const FinalizationVoterTable>& pVoterTable)
 			: m_point(point)
-			, m_height(height)
 			, m_generationHash(generationHash)
-			, m_config(config) {
-		const auto& highValueAccounts = accountStateCacheView.highValueAccounts();
-		for (const auto& accountHistoryPair : highValueAccounts.accountHistories()) {
-			const auto& accountHistory = accountHistoryPair.second;
-			auto balance = accountHistory.balance().get(m_height);
-			if (Amount() == balance)
-				continue;
-
-			auto accountView = FinalizationAccountView();
-			accountView.Weight = balance;
-
-			m_accounts.emplace(Find(accountHistory.votingPublicKeys().get(m_height), m_point), accountView);
-			m_weight = m_weight + balance;
-		}
-	}
+			, m_config(config)
+			, m_pVoterTable(pVoterTable)
+	{}
 
 	FinalizationPoint FinalizationContext::point() const {
 		return m_point;
 	}
 
 	Height FinalizationContext::height() const {
-		return m_height;
+		return m_pVoterTable->height();
 	}
 
 	const GenerationHash& FinalizationContext::generationHash() const {
@@ -74,11 +63,14 @@ namespace catapult { namespace model {
 	}
 
 	Amount FinalizationContext::weight() const {
-		return m_weight;
+		return m_pVoterTable->weight();
 	}
 
 	FinalizationAccountView FinalizationContext::lookup(const VotingKey& votingPublicKey) const {
-		auto iter = m_accounts.find(votingPublicKey);
-		return m_accounts.cend() == iter ? FinalizationAccountView() : iter->second;
+		return m_pVoterTable->lookup(votingPublicKey, m_point);
+	}
+
+	const FinalizationVoterTable& FinalizationContext::voterTable() const {
+		return *m_pVoterTable;
 	}
 }}
@@ -19,21 +19,15 @@
 **/
 
 #pragma once
+#include "FinalizationVoterTable.h"
 #include "finalization/src/FinalizationConfiguration.h"
-#include "catapult/utils/Hashers.h"
 #include "catapult/types.h"
-#include <unordered_map>
+#include <memory>
 
 namespace catapult { namespace cache { class AccountStateCacheView; } }
 
 namespace catapult { namespace model {
 
-	/// Account data relevant to finalization.
-	struct FinalizationAccountView {
-		/// Finalization weight.
-		Amount Weight;
-	};
-
 	/// Contextual information for finalizing blocks.
 	class FinalizationContext {
 	public:
@@ -46,6 +40,15 @@ namespace catapult { namespace model {
 				const finalization::FinalizationConfiguration& config,
 				const cache::AccountStateCacheView& accountStateCacheView);
 
+		/// Creates a finalization context from \a config, \a pVoterTable, the generation hash of the last finalized block
+		/// (\a generationHash) and the finalization \a point that is currently being finalized.
+		/// \note The height of the last finalized block is the voter table height.
+		FinalizationContext(
+				FinalizationPoint point,
+				const GenerationHash& generationHash,
+				const finalization::FinalizationConfiguration& config,
+				const std::shared_ptr<const FinalizationVoterTable>& pVoterTable);
+
 	public:
 		/// Gets the finalization point.
 		FinalizationPoint point() const;
@@ -65,12 +68,13 @@ namespace catapult { namespace model {
 		/// Gets the finalization account view associated with \a votingPublicKey.
 		FinalizationAccountView lookup(const VotingKey& votingPublicKey) const;
 
+		/// Gets the voter table.
+		const FinalizationVoterTable& voterTable() const;
+
 	private:
 		FinalizationPoint m_point;
-		Height m_height;
 		GenerationHash m_generationHash;
 		finalization::FinalizationConfiguration m_config;
-		Amount m_weight;
-		std::unordered_map<VotingKey, FinalizationAccountView, utils::ArrayHasher<VotingKey>> m_accounts;
+		std::shared_ptr<const FinalizationVoterTable> m_pVoterTable; // immutable and shared, so lookups do not require locks
 	};
 }}
@@ -22,6 +22,8 @@
 #include "FinalizationContext.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto_voting/OtsTree.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/MacroBasedEnumIncludes.h"
 #include "catapult/utils/MemoryUtils.h"
 
@@ -80,18 +82,75 @@ namespace catapult { namespace model {
 		return pMessage;
 	}
 
+	namespace {
+		std::pair<ProcessMessageResult, size_t> ProcessMessage(
+				const FinalizationMessage& message,
+				const FinalizationContext& context,
+				bool shouldVerifySignature) {
+			if (message.StepIdentifier.Stage >= FinalizationStage::Count)
+				return std::make_pair(ProcessMessageResult::Failure_Stage, 0);
+
+			auto accountView = context.lookup(message.Signature.Root.ParentPublicKey.copyTo<VotingKey>());
+			if (Amount() == accountView.Weight)
+				return std::make_pair(ProcessMessageResult::Failure_Voter, 0);
+
+			if (shouldVerifySignature) {
+				auto keyIdentifier = StepIdentifierToOtsKeyIdentifier(message.StepIdentifier, context.config().OtsKeyDilution);
+				if (!crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message)))
+					return std::make_pair(ProcessMessageResult::Failure_Message_Signature, 0);
+			}
+
+			return std::make_pair(ProcessMessageResult::Success, accountView.Weight.unwrap());
+		}
+	}
+
 	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context) {
-		if (message.StepIdentifier.Stage >= FinalizationStage::Count)
-			return std::make_pair(ProcessMessageResult::Failure_Stage, 0);
+		return ProcessMessage(message, context, true);
+	}
+
+	std::pair<ProcessMessageResult, size_t> ProcessVerifiedMessage(
+			const FinalizationMessage& message,
+			const FinalizationContext& context) {
+		return ProcessMessage(message, context, false);
+	}
+
+	thread::future<std::vector<bool>> VerifyMessageSignatures(
+			const std::vector<std::shared_ptr<FinalizationMessage>>& messages,
+			uint64_t dilution,
+			const crypto::RandomFiller& randomFiller,
+			thread::IoThreadPool& pool) {
+		// keep messages and inputs alive until all partitions have been verified
+		struct VerifyContext {
+			std::vector<std::shared_ptr<FinalizationMessage>> Messages;
+			std::vector<crypto::OtsTreeSignatureInput> Inputs;
+
+			// note: store results as bytes (not bools) because each partition writes its results from a different thread
+			std::vector<uint8_t> Results;
+		};
+
+		auto pContext = std::make_shared<VerifyContext>();
+		pContext->Messages = messages;
+		pContext->Inputs.reserve(messages.size());
+		for (const auto& pMessage : messages) {
+			auto keyIdentifier = StepIdentifierToOtsKeyIdentifier(pMessage->StepIdentifier, dilution);
+			pContext->Inputs.push_back({ pMessage->Signature, keyIdentifier, ToBuffer(*pMessage) });
+		}
 
-		auto accountView = context.lookup(message.Signature.Root.ParentPublicKey.copyTo<VotingKey>());
-		if (Amount() == accountView.Weight)
-			return std::make_pair(ProcessMessageResult::Failure_Voter, 0);
+		pContext->Results.resize(messages.size(), 1);
+		auto partitionCallback = [randomFiller, pContext](auto itBegin, auto itEnd, auto startIndex, auto) {
+			auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+			auto partitionResultsPair = crypto::VerifyMulti(randomFiller, &*itBegin, count);
+			if (partitionResultsPair.second)
+				return;
 
-		auto keyIdentifier = StepIdentifierToOtsKeyIdentifier(message.StepIdentifier, context.config().OtsKeyDilution);
-		if (!crypto::Verify(message.Signature, keyIdentifier, ToBuffer(message)))
-			return std::make_pair(ProcessMessageResult::Failure_Message_Signature, 0);
+			auto index = startIndex;
+			for (auto result : partitionResultsPair.first)
+				pContext->Results[index++] = result ? 1 : 0;
+		};
 
-		return std::make_pair(ProcessMessageResult::Success, accountView.Weight.unwrap());
+		auto future = thread::ParallelForPartition(pool.ioContext(), pContext->Inputs, pool.numWorkerThreads(), partitionCallback);
+		return future.then([pContext](auto&&) {
+			return std::vector<bool>(pContext->Results.cbegin(), pContext->Results.cend());
+		});
 	}
 }}
@@ -20,12 +20,17 @@
 
 #pragma once
 #include "StepIdentifier.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/TrailingVariableDataLayout.h"
+#include "catapult/thread/Future.h"
+#include <memory>
+#include <vector>
 
 namespace catapult {
 	namespace crypto { class OtsTree; }
 	namespace model { class FinalizationContext; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace model {
@@ -120,5 +125,24 @@ namespace catapult { namespace model {
 	/// Processes a finalization \a message using \a context.
 	std::pair<ProcessMessageResult, size_t> ProcessMessage(const FinalizationMessage& message, const FinalizationContext& context);
 
+	/// Processes a finalization \a message with a previously verified signature using \a context.
+	/// \note This is identical to ProcessMessage except that the message signature is not verified.
+	std::pair<ProcessMessageResult, size_t> ProcessVerifiedMessage(
+			const FinalizationMessage& message,
+			const FinalizationContext& context);
+
+	// endregion
+
+	// region VerifyMessageSignatures
+
+	/// Verifies the signatures of all finalization \a messages using ots key \a dilution.
+	/// Signatures are batch verified in parallel using \a pool and \a randomFiller is used to generate random bytes.
+	/// Returns a future that is resolved with a vector of bools that indicates the verification result for each message.
+	thread::future<std::vector<bool>> VerifyMessageSignatures(
+			const std::vector<std::shared_ptr<FinalizationMessage>>& messages,
+			uint64_t dilution,
+			const crypto::RandomFiller& randomFiller,
+			thread::IoThreadPool& pool);
+
 	// endregion
 }}
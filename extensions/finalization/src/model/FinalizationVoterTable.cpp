@@ -0,0 +1,97 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "FinalizationVoterTable.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include <algorithm>
+
+namespace catapult { namespace model {
+
+	namespace {
+		struct VotingKeyComparer {
+			template<typename TVoter>
+			bool operator()(const TVoter& lhs, const VotingKey& rhs) const {
+				return lhs.VotingPublicKey.VotingKey < rhs;
+			}
+
+			template<typename TVoter>
+			bool operator()(const VotingKey& lhs, const TVoter& rhs) const {
+				return lhs < rhs.VotingPublicKey.VotingKey;
+			}
+		};
+	}
+
+	FinalizationVoterTable::FinalizationVoterTable(Height height, const cache::AccountStateCacheView& accountStateCacheView)
+			: m_height(height)
+			, m_size(0) {
+		const auto& highValueAccounts = accountStateCacheView.highValueAccounts();
+		for (const auto& accountHistoryPair : highValueAccounts.accountHistories()) {
+			const auto& accountHistory = accountHistoryPair.second;
+			auto balance = accountHistory.balance().get(m_height);
+			if (Amount() == balance)
+				continue;
+
+			auto accountView = FinalizationAccountView();
+			accountView.Weight = balance;
+			accountView.Address = accountHistoryPair.first;
+
+			for (const auto& pinnedPublicKey : accountHistory.votingPublicKeys().get(m_height))
+				m_voters.push_back(Voter{ pinnedPublicKey, accountView });
+
+			++m_size;
+			m_weight = m_weight + balance;
+		}
+
+		// sort by (key, start point) so that lookups can use binary search
+		// (break ties by (end point, address) so that lookups are deterministic when accounts share a voting key)
+		std::sort(m_voters.begin(), m_voters.end(), [](const auto& lhs, const auto& rhs) {
+			if (lhs.VotingPublicKey.VotingKey != rhs.VotingPublicKey.VotingKey)
+				return lhs.VotingPublicKey.VotingKey < rhs.VotingPublicKey.VotingKey;
+
+			if (lhs.VotingPublicKey.StartPoint != rhs.VotingPublicKey.StartPoint)
+				return lhs.VotingPublicKey.StartPoint < rhs.VotingPublicKey.StartPoint;
+
+			if (lhs.VotingPublicKey.EndPoint != rhs.VotingPublicKey.EndPoint)
+				return lhs.VotingPublicKey.EndPoint < rhs.VotingPublicKey.EndPoint;
+
+			return lhs.AccountView.Address < rhs.AccountView.Address;
+		});
+	}
+
+	Height FinalizationVoterTable::height() const {
+		return m_height;
+	}
+
+	size_t FinalizationVoterTable::size() const {
+		return m_size;
+	}
+
+	Amount FinalizationVoterTable::weight() const {
+		return m_weight;
+	}
+
+	FinalizationAccountView FinalizationVoterTable::lookup(const VotingKey& votingPublicKey, FinalizationPoint point) const {
+		auto range = std::equal_range(m_voters.cbegin(), m_voters.cend(), votingPublicKey, VotingKeyComparer());
+		auto iter = std::find_if(range.first, range.second, [point](const auto& voter) {
+			return voter.VotingPublicKey.StartPoint <= point && point <= voter.VotingPublicKey.EndPoint;
+		});
+		return range.second == iter ? FinalizationAccountView() : iter->AccountView;
+	}
+}}
@@ -0,0 +1,71 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/PinnedVotingKey.h"
+#include "catapult/types.h"
+#include <vector>
+
+namespace catapult { namespace cache { class AccountStateCacheView; } }
+
+namespace catapult { namespace model {
+
+	/// Account data relevant to finalization.
+	struct FinalizationAccountView {
+		/// Finalization weight.
+		Amount Weight;
+
+		/// Account address.
+		catapult::Address Address;
+	};
+
+	/// Immutable table of all finalization-eligible accounts in a voting set.
+	/// \note Table is independent of finalization point, so it can be shared by all rounds using the same voting set.
+	class FinalizationVoterTable {
+	public:
+		/// Creates a table around the voting set at \a height using account histories from \a accountStateCacheView.
+		FinalizationVoterTable(Height height, const cache::AccountStateCacheView& accountStateCacheView);
+
+	public:
+		/// Gets the height of the voting set.
+		Height height() const;
+
+		/// Gets the number of finalization-eligible accounts.
+		size_t size() const;
+
+		/// Gets the total weight of all finalization-eligible accounts.
+		Amount weight() const;
+
+		/// Gets the finalization account view associated with \a votingPublicKey at finalization \a point.
+		FinalizationAccountView lookup(const VotingKey& votingPublicKey, FinalizationPoint point) const;
+
+	private:
+		struct Voter {
+			PinnedVotingKey VotingPublicKey;
+			FinalizationAccountView AccountView;
+		};
+
+	private:
+		Height m_height;
+		size_t m_size;
+		Amount m_weight;
+		std::vector<Voter> m_voters; // sorted by voting public key
+	};
+}}
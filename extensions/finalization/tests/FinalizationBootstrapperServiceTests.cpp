@@ -19,11 +19,15 @@
 **/
 
 #include "finalization/src/FinalizationBootstrapperService.h"
+#include "finalization/src/FinalizationContextFactory.h"
 #include "finalization/src/chain/MultiRoundMessageAggregator.h"
 #include "finalization/tests/test/FinalizationBootstrapperServiceTestUtils.h"
 #include "finalization/tests/test/mocks/MockProofStorage.h"
+#include "catapult/api/RemoteChainApi.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
 #include "tests/test/local/ServiceTestUtils.h"
+#include "tests/test/net/mocks/MockPacketWriters.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace finalization {
@@ -160,6 +164,11 @@ namespace catapult { namespace finalization {
 			EXPECT_EQ(previousEstimateHeight.unwrap(), context.counter("FIN PREV EST"));
 			EXPECT_EQ(currentEstimateHeight.unwrap(), context.counter("FIN CUR EST"));
 		}
+
+		void AssertVoterTableCounters(const TestContext& context, uint64_t numVoters, Amount weight) {
+			EXPECT_EQ(numVoters, context.counter("FIN VOTERS"));
+			EXPECT_EQ(weight.unwrap(), context.counter("FIN WEIGHT"));
+		}
 	}
 
 	// endregion
@@ -178,7 +187,7 @@ namespace catapult { namespace finalization {
 
 		// Assert:
 		EXPECT_EQ(Num_Services, context.locator().numServices());
-		EXPECT_EQ(4u, context.locator().counters().size());
+		EXPECT_EQ(6u, context.locator().counters().size());
 
 		// - service
 		const auto& aggregator = GetMultiRoundMessageAggregator(context.locator());
@@ -189,6 +198,25 @@ namespace catapult { namespace finalization {
 		AssertAggregatorCounters(context, FinalizationPoint(12), FinalizationPoint(12), Height(100), Height(100));
 	}
 
+	TEST(TEST_CLASS, FinalizationContextFactoryServiceIsRegistered) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(Num_Services, context.locator().numServices());
+		EXPECT_EQ(6u, context.locator().counters().size());
+
+		// - service (no voter table has been built yet)
+		const auto& factory = GetFinalizationContextFactory(context.locator());
+		EXPECT_FALSE(!!factory.voterTable());
+
+		// - counters
+		AssertVoterTableCounters(context, 0, Amount());
+	}
+
 	TEST(TEST_CLASS, FinalizationHooksServiceIsRegistered) {
 		// Arrange:
 		TestContext context;
@@ -233,6 +261,51 @@ namespace catapult { namespace finalization {
 		EXPECT_EQ(Height(123), height);
 	}
 
+	namespace {
+		bool VerifyRemoteFinalizedHeight(TestContext& context, Height height) {
+			mocks::MockPacketIo packetIo;
+			model::TransactionRegistry transactionRegistry;
+			auto pRemoteChainApi = api::CreateRemoteChainApi(packetIo, model::NodeIdentity(), transactionRegistry);
+
+			auto verifier = context.testState().state().hooks().remoteFinalizedHeightVerifier();
+			return verifier(*pRemoteChainApi, height).get();
+		}
+	}
+
+	TEST(TEST_CLASS, RemoteFinalizedHeightVerifierHookIsRegistered) {
+		// Arrange:
+		TestContext context;
+		mocks::SeedStorageWithFixedSizeBlocks(context.testState().state().storage(), 25);
+		context.boot();
+
+		mocks::PickOneAwareMockPacketWriters writers;
+		context.testState().state().packetIoPickers().insert(writers, ionet::NodeRoles::Voting);
+
+		// Act: voting set of height 20 is calculated at height 1
+		auto isVerified = VerifyRemoteFinalizedHeight(context, Height(20));
+
+		// Assert: proof was requested from a voting node but none is available
+		EXPECT_FALSE(isVerified);
+		EXPECT_EQ(1u, writers.numPickOneCalls());
+	}
+
+	TEST(TEST_CLASS, RemoteFinalizedHeightVerifierHookDoesNotRequestProofWhenVotingSetIsUnknown) {
+		// Arrange:
+		TestContext context;
+		mocks::SeedStorageWithFixedSizeBlocks(context.testState().state().storage(), 25);
+		context.boot();
+
+		mocks::PickOneAwareMockPacketWriters writers;
+		context.testState().state().packetIoPickers().insert(writers, ionet::NodeRoles::Voting);
+
+		// Act: voting set of height 501 is calculated at height 500, which is not part of the local chain
+		auto isVerified = VerifyRemoteFinalizedHeight(context, Height(501));
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+		EXPECT_EQ(0u, writers.numPickOneCalls());
+	}
+
 	// endregion
 
 	// region FinalizationBootstrapperService - multi round message aggregator
@@ -263,8 +336,9 @@ namespace catapult { namespace finalization {
 			auto hash = test::GenerateRandomByteArray<Hash256>();
 			aggregator.modifier().add(context.createMessage(VoterType::Large1, { FinalizationPoint(12), Stage }, Height(22), hash));
 
-			// Assert:
+			// Assert: voter table is built for the first round (the ineligible account is excluded)
 			AssertAggregatorCounters(context, FinalizationPoint(12), FinalizationPoint(12), Height(20), Height(20));
+			AssertVoterTableCounters(context, 3, Amount(10'000'002'000'000));
 
 			// - check aggregator
 			EXPECT_EQ(1u, aggregator.view().size());
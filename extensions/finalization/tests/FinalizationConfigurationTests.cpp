@@ -46,7 +46,9 @@ namespace catapult { namespace finalization {
 
 							{ "maxHashesPerPoint", "123" },
 							{ "prevoteBlocksMultiple", "7" },
-							{ "otsKeyDilution", "357" }
+							{ "otsKeyDilution", "357" },
+
+							{ "maxCachedProofs", "27" }
 						}
 					}
 				};
@@ -71,6 +73,8 @@ namespace catapult { namespace finalization {
 				EXPECT_EQ(0u, config.PrevoteBlocksMultiple);
 				EXPECT_EQ(0u, config.OtsKeyDilution);
 
+				EXPECT_EQ(0u, config.MaxCachedProofs);
+
 				EXPECT_EQ(0u, config.VotingSetGrouping);
 			}
 
@@ -89,6 +93,8 @@ namespace catapult { namespace finalization {
 				EXPECT_EQ(7u, config.PrevoteBlocksMultiple);
 				EXPECT_EQ(357u, config.OtsKeyDilution);
 
+				EXPECT_EQ(27u, config.MaxCachedProofs);
+
 				EXPECT_EQ(0u, config.VotingSetGrouping);
 			}
 		};
@@ -121,6 +127,8 @@ namespace catapult { namespace finalization {
 		EXPECT_EQ(4u, config.PrevoteBlocksMultiple);
 		EXPECT_EQ(32u, config.OtsKeyDilution);
 
+		EXPECT_EQ(16u, config.MaxCachedProofs);
+
 		EXPECT_EQ(0u, config.VotingSetGrouping);
 	}
 
@@ -30,7 +30,8 @@ namespace catapult { namespace finalization {
 #define TEST_CLASS FinalizationContextFactoryTests
 
 	namespace {
-		void AssertCanCreateFinalizationContext(Height height, Height groupedHeight) {
+		template<typename TAction>
+		void RunFactoryTest(Height height, Height groupedHeight, TAction action) {
 			// Arrange: setup config
 			auto config = finalization::FinalizationConfiguration::Uninitialized();
 			config.Size = 9876;
@@ -57,20 +58,31 @@ namespace catapult { namespace finalization {
 			}
 
 			test::ServiceTestState testState(std::move(catapultCache));
-			mocks::SeedStorageWithFixedSizeBlocks(testState.state().storage(), static_cast<uint32_t>(groupedHeight.unwrap()));
+			mocks::SeedStorageWithFixedSizeBlocks(testState.state().storage(), static_cast<uint32_t>(height.unwrap()));
 
-			// Act:
 			FinalizationContextFactory factory(config, testState.state());
-			auto context = factory.create(FinalizationPoint(12), height);
 
-			// Assert: context should be seeded with data from groupedHeight, not height
-			auto expectedGenerationHash = testState.state().storage().view().loadBlockElement(groupedHeight)->GenerationHash;
+			// Act + Assert:
+			action(factory, testState.state());
+		}
+
+		void AssertCanCreateFinalizationContext(Height height, Height groupedHeight) {
+			RunFactoryTest(height, groupedHeight, [height, groupedHeight](const auto& factory, const auto& state) {
+				// Act:
+				auto context = factory.create(FinalizationPoint(12), height);
 
-			EXPECT_EQ(FinalizationPoint(12), context.point());
-			EXPECT_EQ(groupedHeight, context.height());
-			EXPECT_EQ(expectedGenerationHash, context.generationHash());
-			EXPECT_EQ(9876u, context.config().Size);
-			EXPECT_EQ(Amount(15'000'000), context.weight());
+				// Assert: context should be seeded with data from groupedHeight, not height
+				auto expectedGenerationHash = state.storage().view().loadBlockElement(groupedHeight)->GenerationHash;
+
+				EXPECT_EQ(FinalizationPoint(12), context.point());
+				EXPECT_EQ(groupedHeight, context.height());
+				EXPECT_EQ(expectedGenerationHash, context.generationHash());
+				EXPECT_EQ(9876u, context.config().Size);
+				EXPECT_EQ(Amount(15'000'000), context.weight());
+
+				// - voter table should be tracked
+				EXPECT_EQ(&context.voterTable(), factory.voterTable().get());
+			});
 		}
 	}
 
@@ -85,4 +97,45 @@ namespace catapult { namespace finalization {
 	TEST(TEST_CLASS, CanCreateFinalizationContextAtVotingSetGroupEnd) {
 		AssertCanCreateFinalizationContext(Height(100), Height(50));
 	}
+
+	TEST(TEST_CLASS, VoterTableIsInitiallyUnset) {
+		RunFactoryTest(Height(76), Height(50), [](const auto& factory, const auto&) {
+			// Act + Assert:
+			EXPECT_FALSE(!!factory.voterTable());
+		});
+	}
+
+	TEST(TEST_CLASS, CreateReusesVoterTableForSameVotingSet) {
+		RunFactoryTest(Height(76), Height(50), [](const auto& factory, const auto&) {
+			// Act: create contexts for different points in the same voting set (and from a factory copy)
+			auto context1 = factory.create(FinalizationPoint(12), Height(51));
+			auto context2 = factory.create(FinalizationPoint(13), Height(76));
+			auto context3 = FinalizationContextFactory(factory).create(FinalizationPoint(14), Height(60));
+
+			// Assert:
+			EXPECT_EQ(&context1.voterTable(), &context2.voterTable());
+			EXPECT_EQ(&context1.voterTable(), &context3.voterTable());
+			EXPECT_EQ(&context1.voterTable(), factory.voterTable().get());
+
+			EXPECT_EQ(FinalizationPoint(13), context2.point());
+			EXPECT_EQ(context1.generationHash(), context2.generationHash());
+		});
+	}
+
+	TEST(TEST_CLASS, CreateBuildsNewVoterTableForDifferentVotingSet) {
+		RunFactoryTest(Height(76), Height(50), [](const auto& factory, const auto&) {
+			// Act:
+			auto context1 = factory.create(FinalizationPoint(12), Height(51));
+			auto context2 = factory.create(FinalizationPoint(13), Height(49));
+
+			// Assert:
+			EXPECT_NE(&context1.voterTable(), &context2.voterTable());
+			EXPECT_EQ(&context2.voterTable(), factory.voterTable().get());
+
+			EXPECT_EQ(Height(50), context1.height());
+			EXPECT_EQ(Amount(15'000'000), context1.weight());
+			EXPECT_EQ(Height(1), context2.height());
+			EXPECT_EQ(Amount(0), context2.weight());
+		});
+	}
 }}
@@ -47,6 +47,7 @@ namespace catapult { namespace finalization {
 			static auto CreateRegistrar() {
 				auto config = FinalizationConfiguration::Uninitialized();
 				config.ShortLivedCacheMessageDuration = utils::TimeSpan::FromMinutes(1);
+				config.OtsKeyDilution = Ots_Key_Dilution;
 				return CreateFinalizationMessageProcessingServiceRegistrar(config);
 			}
 		};
@@ -167,8 +168,9 @@ namespace catapult { namespace finalization {
 		auto pMessage4 = context.createMessage(VoterType::Large1, { FinalizationPoint(9), Stage }, Height(6), hash);
 		auto pMessage5 = context.createMessage(VoterType::Large1, { FinalizationPoint(8), Stage }, Height(5), hash);
 
-		// Act:
+		// Act: wait for the first range to be forwarded because ranges are verified asynchronously
 		hooks.messageRangeConsumer()(CreateMessageRange({ pMessage1, pMessage3, pMessage5 }));
+		WAIT_FOR_ONE_EXPR(context.numBroadcastCalls());
 		hooks.messageRangeConsumer()(CreateMessageRange({ pMessage2, pMessage4 }));
 
 		// - wait for the aggregator and the broadcast
@@ -289,6 +291,73 @@ namespace catapult { namespace finalization {
 		test::AssertEqualPayload(CreateBroadcastPayload({ pMessage1, pMessage3 }), context.broadcastedPayloads()[0]);
 	}
 
+	TEST(TEST_CLASS, MessagesWithInvalidSignaturesAreIgnored) {
+		// Arrange:
+		TestContext context(FinalizationPoint(10));
+		context.boot();
+
+		const auto& hooks = GetFinalizationServerHooks(context.locator());
+		auto& aggregator = GetMultiRoundMessageAggregator(context.locator());
+		aggregator.modifier().setMaxFinalizationPoint(FinalizationPoint(12));
+
+		// - prepare message(s)
+		const auto& hash = test::GenerateRandomByteArray<Hash256>();
+		auto pMessage1 = context.createMessage(VoterType::Large1, { FinalizationPoint(10), Stage }, Height(9), hash);
+		auto pMessage2 = context.createMessage(VoterType::Large1, { FinalizationPoint(11), Stage }, Height(9), hash);
+		auto pMessage3 = context.createMessage(VoterType::Large1, { FinalizationPoint(12), Stage }, Height(9), hash);
+		auto pMessage4 = context.createMessage(VoterType::Large2, { FinalizationPoint(12), Stage }, Height(9), hash);
+
+		// - corrupt signatures of some messages
+		pMessage2->Signature.Bottom.Signature[0] ^= 0xFF;
+		pMessage4->Signature.Root.Signature[0] ^= 0xFF;
+
+		// Act:
+		hooks.messageRangeConsumer()(CreateMessageRange({ pMessage1, pMessage2, pMessage3, pMessage4 }));
+
+		// - wait for the aggregator and the broadcast
+		WAIT_FOR_VALUE_EXPR(2u, aggregator.view().size());
+		WAIT_FOR_ONE_EXPR(context.numBroadcastCalls());
+
+		// Assert: check the aggregator
+		EXPECT_EQ(2u, aggregator.view().size());
+
+		// - check the packet(s)
+		ASSERT_EQ(1u, context.numBroadcastCalls());
+		test::AssertEqualPayload(CreateBroadcastPayload({ pMessage1, pMessage3 }), context.broadcastedPayloads()[0]);
+	}
+
+	TEST(TEST_CLASS, MessagesFromIneligibleVotersInKnownRoundsAreIgnored) {
+		// Arrange:
+		TestContext context(FinalizationPoint(10));
+		context.boot();
+
+		const auto& hooks = GetFinalizationServerHooks(context.locator());
+		auto& aggregator = GetMultiRoundMessageAggregator(context.locator());
+		aggregator.modifier().setMaxFinalizationPoint(FinalizationPoint(12));
+
+		// - prepare message(s)
+		const auto& hash = test::GenerateRandomByteArray<Hash256>();
+		auto pMessage1 = context.createMessage(VoterType::Large1, { FinalizationPoint(10), Stage }, Height(9), hash);
+		auto pMessage2 = context.createMessage(VoterType::Ineligible, { FinalizationPoint(10), Stage }, Height(9), hash);
+		auto pMessage3 = context.createMessage(VoterType::Large2, { FinalizationPoint(10), Stage }, Height(9), hash);
+
+		// - send first range in order to create the round
+		hooks.messageRangeConsumer()(CreateMessageRange({ pMessage1 }));
+		WAIT_FOR_ONE_EXPR(aggregator.view().size());
+		WAIT_FOR_ONE_EXPR(context.numBroadcastCalls());
+
+		// Act: send second range with message from ineligible voter
+		hooks.messageRangeConsumer()(CreateMessageRange({ pMessage2, pMessage3 }));
+
+		// - wait for the broadcast
+		WAIT_FOR_VALUE_EXPR(2u, context.numBroadcastCalls());
+
+		// Assert: message from ineligible voter was not forwarded
+		ASSERT_EQ(2u, context.numBroadcastCalls());
+		test::AssertEqualPayload(CreateBroadcastPayload({ pMessage1 }), context.broadcastedPayloads()[0]);
+		test::AssertEqualPayload(CreateBroadcastPayload({ pMessage3 }), context.broadcastedPayloads()[1]);
+	}
+
 	TEST(TEST_CLASS, MessageWithHigherFinalizationPointCanBeProcessedAfterLocalFinalizationPointIncreases) {
 		// Arrange:
 		TestContext context(FinalizationPoint(10));
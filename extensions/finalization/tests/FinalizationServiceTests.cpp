@@ -37,6 +37,7 @@ namespace catapult { namespace finalization {
 		struct FinalizationServiceTraits {
 			static constexpr auto Counter_Name = "FIN WRITERS";
 			static constexpr auto Num_Expected_Services = 1 + Num_Dependent_Services; // writers (1) + dependent services
+			static constexpr auto Num_Expected_Counters = 1u;
 
 			static auto GetWriters(const extensions::ServiceLocator& locator) {
 				return locator.service<net::PacketWriters>("fin.writers");
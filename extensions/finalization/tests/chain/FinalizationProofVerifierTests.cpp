@@ -21,6 +21,8 @@
 #include "finalization/src/chain/FinalizationProofVerifier.h"
 #include "finalization/src/model/FinalizationProofUtils.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
+#include "catapult/utils/RandomGenerator.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace chain {
@@ -31,14 +33,51 @@ namespace catapult { namespace chain {
 		constexpr auto Finalization_Point = FinalizationPoint(3);
 		constexpr auto Last_Finalized_Height = Height(123);
 
+		// region traits
+
+		struct SerialTraits {
+			static auto Verify(
+					const model::FinalizationProof& proof,
+					const model::FinalizationContext& context,
+					thread::IoThreadPool&) {
+				return VerifyFinalizationProof(proof, context);
+			}
+		};
+
+		struct BatchTraits {
+			static auto Verify(
+					const model::FinalizationProof& proof,
+					const model::FinalizationContext& context,
+					thread::IoThreadPool& pool) {
+				return VerifyFinalizationProof(proof, context, CreateRandomFiller(), pool);
+			}
+
+		private:
+			static crypto::RandomFiller CreateRandomFiller() {
+				return [](auto* pOut, auto count) {
+					// can use low entropy source for tests
+					utils::LowEntropyRandomGenerator().fill(pOut, count);
+				};
+			}
+		};
+
+#define VERIFICATION_MODE_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Serial) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SerialTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Batch) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BatchTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+		// endregion
+
 		// region TestContext
 
+		template<typename TTraits>
 		class TestContext {
 		private:
 			static constexpr auto Ots_Key_Dilution = 7u;
 
 		public:
-			TestContext() {
+			TestContext() : m_pPool(test::CreateStartedIoThreadPool()) {
 				auto config = finalization::FinalizationConfiguration::Uninitialized();
 				config.Size = 1000;
 				config.Threshold = 700;
@@ -58,7 +97,7 @@ namespace catapult { namespace chain {
 
 		public:
 			auto verify(const model::FinalizationProof& proof) const {
-				return VerifyFinalizationProof(proof, *m_pFinalizationContext);
+				return TTraits::Verify(proof, *m_pFinalizationContext, *m_pPool);
 			}
 
 		public:
@@ -70,6 +109,7 @@ namespace catapult { namespace chain {
 			}
 
 		private:
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
 			std::unique_ptr<model::FinalizationContext> m_pFinalizationContext;
 			std::vector<test::AccountKeyPairDescriptor> m_keyPairDescriptors;
 		};
@@ -99,7 +139,7 @@ namespace catapult { namespace chain {
 
 		// region RunTest
 
-		template<typename TAction>
+		template<typename TTraits, typename TAction>
 		void RunTest(TAction action) {
 			// Arrange: only setup a prevote on the first 6/7 hashes
 			auto prevoteHashes = test::GenerateRandomDataVector<Hash256>(7);
@@ -114,7 +154,7 @@ namespace catapult { namespace chain {
 
 			// - sign prevotes with weights { 4M, 2M, 3M, 4M } (13M) > 15M * 0.7 (10.5M)
 			// - sign precommits with weights { 2M, 2M, 4M, 3M } (11M) > 15M * 0.7 (10.5M)
-			TestContext context;
+			TestContext<TTraits> context;
 			context.signAllMessages(prevoteMessages, { 5, 1, 4, 0 });
 			context.signAllMessages(precommitMessages, { 3, 1, 0, 4 });
 
@@ -122,10 +162,10 @@ namespace catapult { namespace chain {
 			action(context, prevoteHashes, prevoteMessages, precommitMessages);
 		}
 
-		template<typename TModifier>
+		template<typename TTraits, typename TModifier>
 		void RunModifiedStatisticsTest(VerifyFinalizationProofResult expectedResult, TModifier modifyStatistics) {
 			// Arrange:
-			RunTest([expectedResult, modifyStatistics](
+			RunTest<TTraits>([expectedResult, modifyStatistics](
 					const auto& context,
 					const auto& prevoteHashes,
 					const auto& prevoteMessages,
@@ -147,9 +187,9 @@ namespace catapult { namespace chain {
 
 	// region failure
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofHasUnsupportedVersion) {
+	VERIFICATION_MODE_TRAITS_BASED_TEST(VerifyFailsWhenProofHasUnsupportedVersion) {
 		// Arrange:
-		RunTest([](const auto& context, const auto& prevoteHashes, const auto& prevoteMessages, const auto& precommitMessages) {
+		RunTest<TTraits>([](const auto& context, const auto& prevoteHashes, const auto& prevoteMessages, const auto& precommitMessages) {
 			auto statistics = model::FinalizationStatistics{ Finalization_Point, Last_Finalized_Height + Height(3), prevoteHashes[2] };
 			auto pProof = model::CreateFinalizationProof(statistics, MergeMessages(prevoteMessages, precommitMessages));
 
@@ -164,27 +204,27 @@ namespace catapult { namespace chain {
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofPointDoesNotMatchContextPoint) {
-		RunModifiedStatisticsTest(VerifyFinalizationProofResult::Failure_Invalid_Point, [](auto& statistics) {
+	VERIFICATION_MODE_TRAITS_BASED_TEST(VerifyFailsWhenProofPointDoesNotMatchContextPoint) {
+		RunModifiedStatisticsTest<TTraits>(VerifyFinalizationProofResult::Failure_Invalid_Point, [](auto& statistics) {
 			statistics.Point = statistics.Point + FinalizationPoint(1);
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofHeightDoesNotMatchCalculatedHeight) {
-		RunModifiedStatisticsTest(VerifyFinalizationProofResult::Failure_Invalid_Height, [](auto& statistics) {
+	VERIFICATION_MODE_TRAITS_BASED_TEST(VerifyFailsWhenProofHeightDoesNotMatchCalculatedHeight) {
+		RunModifiedStatisticsTest<TTraits>(VerifyFinalizationProofResult::Failure_Invalid_Height, [](auto& statistics) {
 			statistics.Height = statistics.Height + Height(1);
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofHashDoesNotMatchCalculatedHash) {
-		RunModifiedStatisticsTest(VerifyFinalizationProofResult::Failure_Invalid_Hash, [](auto& statistics) {
+	VERIFICATION_MODE_TRAITS_BASED_TEST(VerifyFailsWhenProofHashDoesNotMatchCalculatedHash) {
+		RunModifiedStatisticsTest<TTraits>(VerifyFinalizationProofResult::Failure_Invalid_Hash, [](auto& statistics) {
 			test::FillWithRandomData(statistics.Hash);
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofDoesNotProveAnything) {
+	VERIFICATION_MODE_TRAITS_BASED_TEST(VerifyFailsWhenProofDoesNotProveAnything) {
 		// Arrange:
-		RunTest([](const auto& context, const auto& prevoteHashes, const auto& prevoteMessages, auto& precommitMessages) {
+		RunTest<TTraits>([](const auto& context, const auto& prevoteHashes, const auto& prevoteMessages, auto& precommitMessages) {
 			// - drop precommit message
 			precommitMessages.pop_back();
 
@@ -200,10 +240,10 @@ namespace catapult { namespace chain {
 	}
 
 	namespace {
-		template<typename TModifier>
+		template<typename TTraits, typename TModifier>
 		void RunModifiedPrevoteMessagesTest(TModifier modifyPrevoteMessages) {
 			// Arrange:
-			RunTest([modifyPrevoteMessages](
+			RunTest<TTraits>([modifyPrevoteMessages](
 					const auto& context,
 					const auto& prevoteHashes,
 					auto& prevoteMessages,
@@ -222,28 +262,36 @@ namespace catapult { namespace chain {
 		}
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofContainsRedundantMessage) {
+	VERIFICATION_MODE_TRAITS_BASED_TEST(VerifyFailsWhenProofContainsRedundantMessage) {
 		// Arrange:
-		RunModifiedPrevoteMessagesTest([](auto& prevoteMessages) {
+		RunModifiedPrevoteMessagesTest<TTraits>([](auto& prevoteMessages) {
 			// - duplicate prevote message
 			prevoteMessages.push_back(prevoteMessages.front());
 		});
 	}
 
-	TEST(TEST_CLASS, VerifyFailsWhenProofContainsMessageThatFailsProcessing) {
+	VERIFICATION_MODE_TRAITS_BASED_TEST(VerifyFailsWhenProofContainsMessageThatFailsProcessing) {
 		// Arrange:
-		RunModifiedPrevoteMessagesTest([](auto& prevoteMessages) {
+		RunModifiedPrevoteMessagesTest<TTraits>([](auto& prevoteMessages) {
 			// - corrupt signature
 			prevoteMessages[prevoteMessages.size() / 2]->Signature.Root.ParentPublicKey[0] ^= 0xFF;
 		});
 	}
 
+	VERIFICATION_MODE_TRAITS_BASED_TEST(VerifyFailsWhenProofContainsMessageWithInvalidBottomSignature) {
+		// Arrange:
+		RunModifiedPrevoteMessagesTest<TTraits>([](auto& prevoteMessages) {
+			// - corrupt signature of message data
+			prevoteMessages[prevoteMessages.size() / 2]->Signature.Bottom.Signature[0] ^= 0xFF;
+		});
+	}
+
 	// endregion
 
 	// region success
 
-	TEST(TEST_CLASS, CanVerifyProofWithMultipleMessageGroupsWithMultipleMessages) {
-		RunModifiedStatisticsTest(VerifyFinalizationProofResult::Success, [](const auto&) {});
+	VERIFICATION_MODE_TRAITS_BASED_TEST(CanVerifyProofWithMultipleMessageGroupsWithMultipleMessages) {
+		RunModifiedStatisticsTest<TTraits>(VerifyFinalizationProofResult::Success, [](const auto&) {});
 	}
 
 	// endregion
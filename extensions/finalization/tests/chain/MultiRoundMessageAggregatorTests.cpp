@@ -337,6 +337,23 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region tryGetFinalizationContext
+
+	TEST(TEST_CLASS, TryGetFinalizationContextReturnsNullptrWhenSpecifiedPointIsUnknown) {
+		// Arrange:
+		TestContext context;
+		AddRoundMessageAggregators(context, { FinalizationPoint(0), FinalizationPoint(5), FinalizationPoint(10) });
+
+		// Act:
+		auto aggregatorView = context.aggregator().view();
+		const auto* pFinalizationContext = aggregatorView.tryGetFinalizationContext(Default_Min_FP + FinalizationPoint(7));
+
+		// Assert:
+		EXPECT_FALSE(!!pFinalizationContext);
+	}
+
+	// endregion
+
 	// region findEstimate
 
 	namespace {
@@ -0,0 +1,182 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "finalization/src/chain/RemoteFinalizedHeightVerifier.h"
+#include "finalization/src/model/FinalizationProof.h"
+#include "catapult/api/RemoteChainApi.h"
+#include "catapult/model/TransactionPlugin.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS RemoteFinalizedHeightVerifierTests
+
+	namespace {
+		constexpr uint64_t Voting_Set_Grouping = 50;
+		constexpr auto Local_Chain_Height = Height(100);
+
+		enum class RetrieverMode { Proof, Proof_With_Wrong_Height, No_Proof, Exception };
+
+		class TestContext {
+		public:
+			explicit TestContext(RetrieverMode retrieverMode, bool validationResult = true)
+					: m_pRemoteChainApi(api::CreateRemoteChainApi(m_packetIo, model::NodeIdentity(), m_transactionRegistry))
+					, m_verifier(CreateRemoteFinalizedHeightVerifier(
+							Voting_Set_Grouping,
+							[]() { return Local_Chain_Height; },
+							[this, retrieverMode](auto height) {
+								m_retrievedHeights.push_back(height);
+								return retrieveProof(retrieverMode, height);
+							},
+							[this, validationResult](const auto& proof) {
+								m_validatedHeights.push_back(proof.Height);
+								return validationResult;
+							}))
+			{}
+
+		public:
+			const auto& retrievedHeights() const {
+				return m_retrievedHeights;
+			}
+
+			const auto& validatedHeights() const {
+				return m_validatedHeights;
+			}
+
+		public:
+			bool verify(Height height) {
+				return m_verifier(*m_pRemoteChainApi, height).get();
+			}
+
+		private:
+			static thread::future<std::shared_ptr<const model::FinalizationProof>> retrieveProof(RetrieverMode mode, Height height) {
+				using ProofPointer = std::shared_ptr<const model::FinalizationProof>;
+				if (RetrieverMode::Exception == mode)
+					return thread::make_exceptional_future<ProofPointer>(catapult_runtime_error("proof retrieval failed"));
+
+				if (RetrieverMode::No_Proof == mode)
+					return thread::make_ready_future(ProofPointer());
+
+				auto pProof = std::make_shared<model::FinalizationProof>();
+				pProof->Point = FinalizationPoint(11);
+				pProof->Height = RetrieverMode::Proof == mode ? height : height + Height(1);
+				return thread::make_ready_future(ProofPointer(std::move(pProof)));
+			}
+
+		private:
+			mocks::MockPacketIo m_packetIo;
+			model::TransactionRegistry m_transactionRegistry;
+			std::unique_ptr<api::RemoteChainApi> m_pRemoteChainApi;
+			RemoteFinalizedHeightVerifier m_verifier;
+
+			std::vector<Height> m_retrievedHeights;
+			std::vector<Height> m_validatedHeights;
+		};
+	}
+
+	TEST(TEST_CLASS, HeightWithVotingSetAboveLocalChainIsNotVerified) {
+		// Arrange:
+		TestContext context(RetrieverMode::Proof);
+
+		// Act: voting set of height 151 is calculated at height 150
+		auto isVerified = context.verify(Height(151));
+
+		// Assert: no proof was retrieved
+		EXPECT_FALSE(isVerified);
+		EXPECT_TRUE(context.retrievedHeights().empty());
+		EXPECT_TRUE(context.validatedHeights().empty());
+	}
+
+	TEST(TEST_CLASS, HeightIsNotVerifiedWhenProofIsNotReturned) {
+		// Arrange:
+		TestContext context(RetrieverMode::No_Proof);
+
+		// Act:
+		auto isVerified = context.verify(Height(120));
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+		EXPECT_EQ(std::vector<Height>({ Height(120) }), context.retrievedHeights());
+		EXPECT_TRUE(context.validatedHeights().empty());
+	}
+
+	TEST(TEST_CLASS, HeightIsNotVerifiedWhenProofRetrievalFails) {
+		// Arrange:
+		TestContext context(RetrieverMode::Exception);
+
+		// Act:
+		auto isVerified = context.verify(Height(120));
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+		EXPECT_EQ(std::vector<Height>({ Height(120) }), context.retrievedHeights());
+		EXPECT_TRUE(context.validatedHeights().empty());
+	}
+
+	TEST(TEST_CLASS, HeightIsNotVerifiedWhenProofHasWrongHeight) {
+		// Arrange:
+		TestContext context(RetrieverMode::Proof_With_Wrong_Height);
+
+		// Act:
+		auto isVerified = context.verify(Height(120));
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+		EXPECT_EQ(std::vector<Height>({ Height(120) }), context.retrievedHeights());
+		EXPECT_TRUE(context.validatedHeights().empty());
+	}
+
+	TEST(TEST_CLASS, HeightIsNotVerifiedWhenProofFailsValidation) {
+		// Arrange:
+		TestContext context(RetrieverMode::Proof, false);
+
+		// Act:
+		auto isVerified = context.verify(Height(120));
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+		EXPECT_EQ(std::vector<Height>({ Height(120) }), context.retrievedHeights());
+		EXPECT_EQ(std::vector<Height>({ Height(120) }), context.validatedHeights());
+	}
+
+	namespace {
+		void AssertHeightIsVerifiedWhenValidProofIsReturned(Height height) {
+			// Arrange:
+			TestContext context(RetrieverMode::Proof);
+
+			// Act:
+			auto isVerified = context.verify(height);
+
+			// Assert:
+			EXPECT_TRUE(isVerified) << height;
+			EXPECT_EQ(std::vector<Height>({ height }), context.retrievedHeights()) << height;
+			EXPECT_EQ(std::vector<Height>({ height }), context.validatedHeights()) << height;
+		}
+	}
+
+	TEST(TEST_CLASS, HeightIsVerifiedWhenValidProofIsReturned) {
+		// Assert: voting sets of all heights are calculated at or below the local chain height
+		AssertHeightIsVerifiedWhenValidProofIsReturned(Height(90));
+		AssertHeightIsVerifiedWhenValidProofIsReturned(Height(101));
+		AssertHeightIsVerifiedWhenValidProofIsReturned(Height(120));
+		AssertHeightIsVerifiedWhenValidProofIsReturned(Height(150));
+	}
+}}
@@ -38,6 +38,7 @@ namespace catapult { namespace chain {
 			uint64_t MaxResponseSize = 10'000'000;
 			uint32_t MaxHashesPerPoint = 100;
 			uint64_t VotingSetGrouping = 500;
+			bool SkipSignatureVerification = false;
 		};
 
 		class TestContext {
@@ -64,7 +65,9 @@ namespace catapult { namespace chain {
 				});
 
 				m_keyPairDescriptors = std::move(finalizationContextPair.second);
-				m_pAggregator = CreateRoundMessageAggregator(finalizationContextPair.first);
+				m_pAggregator = options.SkipSignatureVerification
+						? CreateVerifiedRoundMessageAggregator(finalizationContextPair.first)
+						: CreateRoundMessageAggregator(finalizationContextPair.first);
 			}
 
 		public:
@@ -256,6 +259,45 @@ namespace catapult { namespace chain {
 		EXPECT_EQ(0u, context.aggregator().size());
 	}
 
+	PREVOTE_PRECOMIT_TEST(CannotAddMessageWithIneligibleSignerToVerifiedAggregator) {
+		// Arrange:
+		auto pMessage = test::CreateMessage(Last_Finalized_Height + Height(1), 1);
+		pMessage->StepIdentifier = { Finalization_Point, TTraits::Stage };
+
+		TestContextOptions options;
+		options.SkipSignatureVerification = true;
+		TestContext context(1000, 700, options);
+		context.signMessage(*pMessage, 2);
+
+		// Act:
+		auto result = context.aggregator().add(std::move(pMessage));
+
+		// Assert:
+		EXPECT_EQ(RoundMessageAggregatorAddResult::Failure_Processing, result);
+		EXPECT_EQ(0u, context.aggregator().size());
+	}
+
+	PREVOTE_PRECOMIT_TEST(CanAddMessageWithInvalidSignatureToVerifiedAggregator) {
+		// Arrange:
+		auto pMessage = test::CreateMessage(Last_Finalized_Height + Height(1), 1);
+		pMessage->StepIdentifier = { Finalization_Point, TTraits::Stage };
+
+		TestContextOptions options;
+		options.SkipSignatureVerification = true;
+		TestContext context(1000, 700, options);
+		context.signMessage(*pMessage, 0);
+
+		// - corrupt the signature, which is not checked by the aggregator
+		pMessage->HashesPtr()[0][0] ^= 0xFF;
+
+		// Act:
+		auto result = context.aggregator().add(std::move(pMessage));
+
+		// Assert:
+		EXPECT_EQ(TTraits::Success_Result, result);
+		EXPECT_EQ(1u, context.aggregator().size());
+	}
+
 	namespace {
 		template<typename TTraits>
 		void AssertCannotAddMessageWithInvalidHeight(uint32_t numHashes, std::initializer_list<int64_t> heightDeltas) {
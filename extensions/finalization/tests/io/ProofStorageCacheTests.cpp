@@ -20,7 +20,9 @@
 
 #include "finalization/src/io/ProofStorageCache.h"
 #include "finalization/src/io/FileProofStorage.h"
+#include "finalization/src/model/FinalizationProofUtils.h"
 #include "finalization/tests/test/ProofStorageTests.h"
+#include "tests/test/core/EntityTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace io {
@@ -28,10 +30,13 @@ namespace catapult { namespace io {
 #define TEST_CLASS ProofStorageCacheTests
 
 	namespace {
+		constexpr size_t Max_Cached_Proofs = 3;
+
 		// wraps a ProofStorageCache in a ProofStorage so that it can be tested via the tests in ProofStorageTests.h
 		class ProofStorageCacheToProofStorageAdapter : public ProofStorage {
 		public:
-			explicit ProofStorageCacheToProofStorageAdapter(std::unique_ptr<ProofStorage>&& pStorage) : m_cache(std::move(pStorage))
+			explicit ProofStorageCacheToProofStorageAdapter(std::unique_ptr<ProofStorage>&& pStorage)
+					: m_cache(std::move(pStorage), Max_Cached_Proofs)
 			{}
 
 		public:
@@ -63,4 +68,215 @@ namespace catapult { namespace io {
 	}
 
 	DEFINE_PROOF_STORAGE_TESTS(ProofStorageCacheTraits)
+
+	// region cached proofs
+
+	namespace {
+		// in memory proof storage containing proofs with heights 10, 20, 30, ... that counts all loads
+		class CountingProofStorage : public ProofStorage {
+		public:
+			CountingProofStorage(size_t numProofs, size_t& numLoads) : m_numLoads(numLoads) {
+				for (auto i = 1u; i <= numProofs; ++i) {
+					auto point = FinalizationPoint(i);
+					auto height = Height(10 * i);
+					m_proofs.push_back(model::CreateFinalizationProof({ point, height, test::GenerateRandomByteArray<Hash256>() }, {}));
+				}
+			}
+
+		public:
+			model::FinalizationStatistics statistics() const override {
+				const auto& proof = *m_proofs.back();
+				return { proof.Point, proof.Height, proof.Hash };
+			}
+
+			std::shared_ptr<const model::FinalizationProof> loadProof(FinalizationPoint point) const override {
+				++m_numLoads;
+				return m_proofs[point.unwrap() - 1];
+			}
+
+			std::shared_ptr<const model::FinalizationProof> loadProof(Height height) const override {
+				++m_numLoads;
+				for (auto iter = m_proofs.crbegin(); m_proofs.crend() != iter; ++iter) {
+					if (height == (*iter)->Height)
+						return *iter;
+				}
+
+				return nullptr;
+			}
+
+			void saveProof(const model::FinalizationProof& proof) override {
+				auto index = proof.Point.unwrap() - 1;
+				if (index < m_proofs.size())
+					m_proofs[index] = test::CopyEntity(proof);
+				else
+					m_proofs.push_back(test::CopyEntity(proof));
+			}
+
+		private:
+			std::vector<std::shared_ptr<const model::FinalizationProof>> m_proofs;
+			size_t& m_numLoads;
+		};
+
+		class CountingTestContext {
+		public:
+			explicit CountingTestContext(size_t maxCachedProofs)
+					: m_numLoads(0)
+					, m_cache(std::make_unique<CountingProofStorage>(5, m_numLoads), maxCachedProofs)
+			{}
+
+		public:
+			size_t numLoads() const {
+				return m_numLoads;
+			}
+
+			ProofStorageCache& cache() {
+				return m_cache;
+			}
+
+		private:
+			size_t m_numLoads;
+			ProofStorageCache m_cache;
+		};
+	}
+
+	TEST(TEST_CLASS, LoadProofAtPointBypassesCacheWhenCachingIsDisabled) {
+		// Arrange:
+		CountingTestContext context(0);
+
+		// Act:
+		auto pProof1 = context.cache().view().loadProof(FinalizationPoint(2));
+		auto pProof2 = context.cache().view().loadProof(FinalizationPoint(2));
+
+		// Assert:
+		EXPECT_EQ(2u, context.numLoads());
+		EXPECT_EQ(pProof1.get(), pProof2.get());
+	}
+
+	TEST(TEST_CLASS, LoadProofAtPointLoadsProofFromStorageOnce) {
+		// Arrange:
+		CountingTestContext context(Max_Cached_Proofs);
+
+		// Act:
+		auto pProof1 = context.cache().view().loadProof(FinalizationPoint(2));
+		auto pProof2 = context.cache().view().loadProof(FinalizationPoint(2));
+
+		// Assert:
+		EXPECT_EQ(1u, context.numLoads());
+		EXPECT_EQ(pProof1.get(), pProof2.get());
+		EXPECT_EQ(FinalizationPoint(2), pProof2->Point);
+	}
+
+	TEST(TEST_CLASS, LoadProofAtHeightLoadsProofFromStorageOnce) {
+		// Arrange:
+		CountingTestContext context(Max_Cached_Proofs);
+
+		// Act:
+		auto pProof1 = context.cache().view().loadProof(Height(20));
+		auto pProof2 = context.cache().view().loadProof(Height(20));
+		auto pProof3 = context.cache().view().loadProof(FinalizationPoint(2));
+
+		// Assert: proof loaded by height can be reused when loading by point
+		EXPECT_EQ(1u, context.numLoads());
+		EXPECT_EQ(pProof1.get(), pProof2.get());
+		EXPECT_EQ(pProof1.get(), pProof3.get());
+		EXPECT_EQ(Height(20), pProof2->Height);
+	}
+
+	TEST(TEST_CLASS, LoadProofAtHeightDoesNotReuseProofLoadedByPoint) {
+		// Arrange: a proof loaded by point is not guaranteed to be the most recent proof at its height
+		CountingTestContext context(Max_Cached_Proofs);
+		auto pProof1 = context.cache().view().loadProof(FinalizationPoint(2));
+
+		// Act:
+		auto pProof2 = context.cache().view().loadProof(Height(20));
+		auto pProof3 = context.cache().view().loadProof(Height(20));
+
+		// Assert:
+		EXPECT_EQ(2u, context.numLoads());
+		EXPECT_EQ(pProof1.get(), pProof2.get());
+		EXPECT_EQ(pProof1.get(), pProof3.get());
+	}
+
+	TEST(TEST_CLASS, LoadProofEvictsLeastRecentlyUsedProofWhenCacheIsFull) {
+		// Arrange: fill the cache and touch point 1 so that point 2 is least recently used
+		CountingTestContext context(Max_Cached_Proofs);
+		for (auto i = 1u; i <= Max_Cached_Proofs; ++i)
+			context.cache().view().loadProof(FinalizationPoint(i));
+
+		context.cache().view().loadProof(FinalizationPoint(1));
+
+		// Act:
+		context.cache().view().loadProof(FinalizationPoint(4));
+		auto numLoadsAfterInsert = context.numLoads();
+
+		context.cache().view().loadProof(FinalizationPoint(1));
+		context.cache().view().loadProof(FinalizationPoint(3));
+		context.cache().view().loadProof(FinalizationPoint(4));
+		auto numLoadsAfterCachedLoads = context.numLoads();
+
+		context.cache().view().loadProof(FinalizationPoint(2));
+
+		// Assert:
+		EXPECT_EQ(Max_Cached_Proofs + 1, numLoadsAfterInsert);
+		EXPECT_EQ(Max_Cached_Proofs + 1, numLoadsAfterCachedLoads);
+		EXPECT_EQ(Max_Cached_Proofs + 2, context.numLoads());
+	}
+
+	TEST(TEST_CLASS, SaveProofSupersedesProofCachedAtSameHeight) {
+		// Arrange:
+		CountingTestContext context(Max_Cached_Proofs);
+		auto pProof1 = context.cache().view().loadProof(Height(50));
+
+		// Act:
+		auto pProof = model::CreateFinalizationProof({ FinalizationPoint(6), Height(50), Hash256() }, {});
+		context.cache().modifier().saveProof(*pProof);
+
+		auto pProof2 = context.cache().view().loadProof(Height(50));
+
+		// Assert:
+		EXPECT_EQ(2u, context.numLoads());
+		EXPECT_EQ(FinalizationPoint(5), pProof1->Point);
+		EXPECT_EQ(FinalizationPoint(6), pProof2->Point);
+	}
+
+	TEST(TEST_CLASS, SaveProofReplacesProofCachedAtSamePoint) {
+		// Arrange:
+		CountingTestContext context(Max_Cached_Proofs);
+		auto pProof1 = context.cache().view().loadProof(FinalizationPoint(3));
+
+		// Act: resave a different proof for the same point at a lower height
+		auto pProof = model::CreateFinalizationProof({ FinalizationPoint(3), Height(25), test::GenerateRandomByteArray<Hash256>() }, {});
+		context.cache().modifier().saveProof(*pProof);
+
+		auto pProof2 = context.cache().view().loadProof(FinalizationPoint(3));
+		auto pProof3 = context.cache().view().loadProof(FinalizationPoint(3));
+
+		// Assert: cached proof was evicted and the resaved proof was loaded (once) from storage
+		EXPECT_EQ(2u, context.numLoads());
+		EXPECT_EQ(Height(30), pProof1->Height);
+		EXPECT_EQ(Height(25), pProof2->Height);
+		EXPECT_EQ(pProof->Hash, pProof2->Hash);
+		EXPECT_EQ(pProof2.get(), pProof3.get());
+	}
+
+	TEST(TEST_CLASS, SaveProofReplacesProofCachedAtSamePointAndHeight) {
+		// Arrange:
+		CountingTestContext context(Max_Cached_Proofs);
+		auto pProof1 = context.cache().view().loadProof(Height(30));
+
+		// Act: resave a different proof for the same point and height
+		auto pProof = model::CreateFinalizationProof({ FinalizationPoint(3), Height(30), test::GenerateRandomByteArray<Hash256>() }, {});
+		context.cache().modifier().saveProof(*pProof);
+
+		auto pProof2 = context.cache().view().loadProof(Height(30));
+		auto pProof3 = context.cache().view().loadProof(FinalizationPoint(3));
+
+		// Assert: cached proof was evicted and the resaved proof was loaded (once) from storage
+		EXPECT_EQ(2u, context.numLoads());
+		EXPECT_NE(pProof->Hash, pProof1->Hash);
+		EXPECT_EQ(pProof->Hash, pProof2->Hash);
+		EXPECT_EQ(pProof->Hash, pProof3->Hash);
+	}
+
+	// endregion
 }}
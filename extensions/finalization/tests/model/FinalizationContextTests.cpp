@@ -49,7 +49,6 @@ namespace catapult { namespace model {
 		}
 
 		struct ExtendedFinalizationAccountView : public FinalizationAccountView {
-			catapult::Address Address;
 			VotingKey VotingPublicKey1;
 			VotingKey VotingPublicKey2;
 		};
@@ -116,6 +115,16 @@ namespace catapult { namespace model {
 			action(context, generationHash, accountViews1, accountViews2, accountViews3);
 		}
 
+		void AssertEqual(const FinalizationAccountView& expected, const FinalizationAccountView& actual) {
+			EXPECT_EQ(expected.Weight, actual.Weight);
+			EXPECT_EQ(expected.Address, actual.Address);
+		}
+
+		void AssertZero(const FinalizationAccountView& accountView) {
+			EXPECT_EQ(Amount(), accountView.Weight);
+			EXPECT_EQ(Address(), accountView.Address);
+		}
+
 		// endregion
 	}
 
@@ -222,20 +231,44 @@ namespace catapult { namespace model {
 		EXPECT_EQ(Amount(0), context.lookup(accountViews[1].VotingPublicKey1).Weight);
 	}
 
-	// endregion
+	TEST(TEST_CLASS, CanCreateContextAroundVoterTable) {
+		// Arrange:
+		auto generationHash = test::GenerateRandomByteArray<GenerationHash>();
+		auto config = CreateConfigurationWithSize(9876);
 
-	// region lookup
+		cache::AccountStateCache cache(cache::CacheConfiguration(), CreateOptions());
+		auto accountViews = AddAccountsWithBalances(cache, Height(123), { Amount(2'000'000), Amount(4'000'000) });
+		auto pVoterTable = std::make_shared<const FinalizationVoterTable>(Height(123), *cache.createView());
 
-	namespace {
-		void AssertEqual(const FinalizationAccountView& expected, const FinalizationAccountView& actual) {
-			EXPECT_EQ(expected.Weight, actual.Weight);
-		}
+		// Act:
+		FinalizationContext context(FP(50), generationHash, config, pVoterTable);
 
-		void AssertZero(const FinalizationAccountView& accountView) {
-			EXPECT_EQ(Amount(), accountView.Weight);
-		}
+		// Assert:
+		EXPECT_EQ(FP(50), context.point());
+		EXPECT_EQ(Height(123), context.height());
+		EXPECT_EQ(generationHash, context.generationHash());
+		EXPECT_EQ(9876u, context.config().Size);
+		EXPECT_EQ(Amount(6'000'000), context.weight());
+		EXPECT_EQ(pVoterTable.get(), &context.voterTable());
+
+		AssertEqual(accountViews[0], context.lookup(accountViews[0].VotingPublicKey1));
+		AssertEqual(accountViews[1], context.lookup(accountViews[1].VotingPublicKey1));
 	}
 
+	TEST(TEST_CLASS, ContextCopiesShareVoterTable) {
+		RunNineAccountTest([](const auto& context, const auto&, const auto&, const auto&, const auto&) {
+			// Act:
+			auto contextCopy = context;
+
+			// Assert:
+			EXPECT_EQ(&context.voterTable(), &contextCopy.voterTable());
+		});
+	}
+
+	// endregion
+
+	// region lookup
+
 	TEST(TEST_CLASS, CanLookupFinalizationAccountViewsForEligibleVotingAccounts) {
 		// Arrange:
 		RunNineAccountTest([](const auto& context, const auto&, const auto& accountViews1, const auto& accountViews2, const auto&) {
@@ -21,8 +21,10 @@
 #include "finalization/src/model/FinalizationMessage.h"
 #include "catapult/crypto_voting/OtsTree.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
+#include "catapult/utils/RandomGenerator.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/HashTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/VariableSizedEntityTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/test/nodeps/Alignment.h"
@@ -409,4 +411,142 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region ProcessVerifiedMessage
+
+	TEST(TEST_CLASS, ProcessVerifiedMessage_DoesNotVerifySignature) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Large, 3, [](const auto& context, const auto&, auto& message) {
+			// - corrupt a hash
+			test::FillWithRandomData(message.HashesPtr()[1]);
+
+			// Act:
+			auto processResultPair = ProcessVerifiedMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Success, processResultPair.first);
+			EXPECT_EQ(Expected_Large_Weight, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessVerifiedMessage_FailsWhenStageIsInvalid) {
+		// Arrange:
+		auto stepIdentifier = Default_Step_Identifier;
+		stepIdentifier.Stage = static_cast<FinalizationStage>(2);
+		RunProcessMessageTest(VoterType::Large, stepIdentifier, 3, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessVerifiedMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Stage, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessVerifiedMessage_FailsWhenAccountIsNotVotingEligible) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Ineligible, 3, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessVerifiedMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Voter, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	// endregion
+
+	// region VerifyMessageSignatures
+
+	namespace {
+		constexpr auto Ots_Key_Dilution = 13u;
+
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		std::vector<std::shared_ptr<FinalizationMessage>> CreateSignedMessages(size_t numMessages) {
+			std::vector<std::shared_ptr<FinalizationMessage>> messages;
+			for (auto i = 0u; i < numMessages; ++i) {
+				std::shared_ptr<FinalizationMessage> pMessage = CreateMessage(3);
+				pMessage->StepIdentifier = { FinalizationPoint(50 + i), FinalizationStage::Prevote };
+				test::SignMessage(*pMessage, test::GenerateKeyPair(), Ots_Key_Dilution);
+				messages.push_back(pMessage);
+			}
+
+			return messages;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_ReturnsNoResultsWhenThereAreNoMessages) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+
+		// Act:
+		auto results = VerifyMessageSignatures({}, Ots_Key_Dilution, CreateRandomFiller(), *pPool).get();
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_SucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto messages = CreateSignedMessages(10);
+
+		// Act:
+		auto results = VerifyMessageSignatures(messages, Ots_Key_Dilution, CreateRandomFiller(), *pPool).get();
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(10, true), results);
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_DetectsInvalidSignatures) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto messages = CreateSignedMessages(10);
+
+		// - corrupt a hash, a signature and a step identifier
+		test::FillWithRandomData(messages[1]->HashesPtr()[1]);
+		messages[4]->Signature.Top.Signature[0] ^= 0xFF;
+		messages[8]->StepIdentifier.Point = messages[8]->StepIdentifier.Point + FinalizationPoint(1);
+
+		// Act:
+		auto results = VerifyMessageSignatures(messages, Ots_Key_Dilution, CreateRandomFiller(), *pPool).get();
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>({ true, false, true, true, false, true, true, true, false, true }), results);
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_DoesNotRequireMessagesToOutliveCall) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto messages = CreateSignedMessages(10);
+
+		// Act: release all (external) references to the messages before waiting for the results
+		auto resultsFuture = VerifyMessageSignatures(messages, Ots_Key_Dilution, CreateRandomFiller(), *pPool);
+		messages.clear();
+		auto results = resultsFuture.get();
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(10, true), results);
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_DetectsSignaturesCreatedWithDifferentDilution) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto messages = CreateSignedMessages(4);
+
+		// Act:
+		auto results = VerifyMessageSignatures(messages, Ots_Key_Dilution + 1, CreateRandomFiller(), *pPool).get();
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(4, false), results);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,209 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "finalization/src/model/FinalizationVoterTable.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "tests/test/cache/AccountStateCacheTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS FinalizationVoterTableTests
+
+	namespace {
+		using FP = FinalizationPoint;
+
+		constexpr auto Harvesting_Mosaic_Id = MosaicId(9876);
+
+		struct VoterDescriptor {
+			catapult::Address Address;
+			VotingKey VotingPublicKey1;
+			VotingKey VotingPublicKey2;
+		};
+
+		cache::AccountStateCacheTypes::Options CreateOptions() {
+			auto options = test::CreateDefaultAccountStateCacheOptions(MosaicId(1111), Harvesting_Mosaic_Id);
+			options.MinVoterBalance = Amount(2'000'000);
+			return options;
+		}
+
+		std::vector<VoterDescriptor> AddAccountsWithBalances(
+				cache::AccountStateCache& cache,
+				Height height,
+				const std::vector<Amount>& balances) {
+			std::vector<VoterDescriptor> voterDescriptors;
+
+			auto delta = cache.createDelta();
+			for (auto balance : balances) {
+				VoterDescriptor voterDescriptor;
+				test::FillWithRandomData(voterDescriptor.Address);
+				test::FillWithRandomData(voterDescriptor.VotingPublicKey1);
+				test::FillWithRandomData(voterDescriptor.VotingPublicKey2);
+				voterDescriptors.push_back(voterDescriptor);
+
+				delta->addAccount(voterDescriptor.Address, height);
+				auto& accountState = delta->find(voterDescriptor.Address).get();
+				accountState.SupplementalPublicKeys.voting().add({ voterDescriptor.VotingPublicKey1, FP(1), FP(100) });
+				accountState.SupplementalPublicKeys.voting().add({ voterDescriptor.VotingPublicKey2, FP(151), FP(200) });
+				accountState.Balances.credit(Harvesting_Mosaic_Id, balance);
+			}
+
+			delta->updateHighValueAccounts(height);
+			cache.commit();
+
+			return voterDescriptors;
+		}
+
+		void AssertAccountView(Amount expectedWeight, const Address& expectedAddress, const FinalizationAccountView& accountView) {
+			EXPECT_EQ(expectedWeight, accountView.Weight);
+			EXPECT_EQ(expectedAddress, accountView.Address);
+		}
+
+		void AssertZero(const FinalizationAccountView& accountView) {
+			AssertAccountView(Amount(), Address(), accountView);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateTableAroundNoHighValueAccounts) {
+		// Arrange:
+		cache::AccountStateCache cache(cache::CacheConfiguration(), CreateOptions());
+
+		// Act:
+		FinalizationVoterTable table(Height(123), *cache.createView());
+
+		// Assert:
+		EXPECT_EQ(Height(123), table.height());
+		EXPECT_EQ(0u, table.size());
+		EXPECT_EQ(Amount(0), table.weight());
+	}
+
+	TEST(TEST_CLASS, CanCreateTableAroundHighValueAccounts) {
+		// Arrange: only accounts with a voter balance at or before the table height are eligible
+		cache::AccountStateCache cache(cache::CacheConfiguration(), CreateOptions());
+		AddAccountsWithBalances(cache, Height(122), { Amount(7'000'000), Amount(1'000'000), Amount(4'000'000) });
+		AddAccountsWithBalances(cache, Height(123), { Amount(2'000'000) });
+		AddAccountsWithBalances(cache, Height(124), { Amount(6'000'000) });
+
+		// Act:
+		FinalizationVoterTable table(Height(123), *cache.createView());
+
+		// Assert:
+		EXPECT_EQ(Height(123), table.height());
+		EXPECT_EQ(3u, table.size());
+		EXPECT_EQ(Amount(13'000'000), table.weight());
+	}
+
+	// endregion
+
+	// region lookup
+
+	namespace {
+		template<typename TAction>
+		void RunLookupTest(TAction action) {
+			// Arrange:
+			cache::AccountStateCache cache(cache::CacheConfiguration(), CreateOptions());
+			auto voterDescriptors = AddAccountsWithBalances(cache, Height(122), {
+				Amount(7'000'000), Amount(1'000'000), Amount(4'000'000), Amount(3'000'000)
+			});
+
+			FinalizationVoterTable table(Height(123), *cache.createView());
+
+			// Act + Assert:
+			action(table, voterDescriptors);
+		}
+	}
+
+	TEST(TEST_CLASS, CanLookupEligibleAccountByVotingPublicKeyActiveAtPoint) {
+		// Arrange:
+		RunLookupTest([](const auto& table, const auto& voterDescriptors) {
+			auto indexWeightPairs = std::vector<std::pair<size_t, Amount>>{
+				{ 0, Amount(7'000'000) }, { 2, Amount(4'000'000) }, { 3, Amount(3'000'000) }
+			};
+			for (const auto& indexWeightPair : indexWeightPairs) {
+				const auto& voterDescriptor = voterDescriptors[indexWeightPair.first];
+				auto weight = indexWeightPair.second;
+
+				// Act + Assert:
+				for (auto point : { FP(1), FP(50), FP(100) })
+					AssertAccountView(weight, voterDescriptor.Address, table.lookup(voterDescriptor.VotingPublicKey1, point));
+
+				for (auto point : { FP(151), FP(175), FP(200) })
+					AssertAccountView(weight, voterDescriptor.Address, table.lookup(voterDescriptor.VotingPublicKey2, point));
+			}
+		});
+	}
+
+	TEST(TEST_CLASS, CannotLookupEligibleAccountByVotingPublicKeyInactiveAtPoint) {
+		// Arrange:
+		RunLookupTest([](const auto& table, const auto& voterDescriptors) {
+			const auto& voterDescriptor = voterDescriptors[0];
+
+			// Act + Assert:
+			for (auto point : { FP(0), FP(101), FP(151), FP(201) })
+				AssertZero(table.lookup(voterDescriptor.VotingPublicKey1, point));
+
+			for (auto point : { FP(1), FP(100), FP(150), FP(201) })
+				AssertZero(table.lookup(voterDescriptor.VotingPublicKey2, point));
+		});
+	}
+
+	TEST(TEST_CLASS, CannotLookupIneligibleOrUnknownAccount) {
+		// Arrange:
+		RunLookupTest([](const auto& table, const auto& voterDescriptors) {
+			// Act + Assert:
+			AssertZero(table.lookup(voterDescriptors[1].VotingPublicKey1, FP(50)));
+
+			for (const auto& votingPublicKey : test::GenerateRandomDataVector<VotingKey>(3))
+				AssertZero(table.lookup(votingPublicKey, FP(50)));
+		});
+	}
+
+	TEST(TEST_CLASS, LookupIsDeterministicWhenAccountsShareVotingPublicKey) {
+		// Arrange: add five accounts that all share the same voting public key and points
+		cache::AccountStateCache cache(cache::CacheConfiguration(), CreateOptions());
+		auto votingPublicKey = test::GenerateRandomByteArray<VotingKey>();
+		auto addresses = test::GenerateRandomDataVector<Address>(5);
+		{
+			auto delta = cache.createDelta();
+			for (auto i = 0u; i < addresses.size(); ++i) {
+				delta->addAccount(addresses[i], Height(122));
+				auto& accountState = delta->find(addresses[i]).get();
+				accountState.SupplementalPublicKeys.voting().add({ votingPublicKey, FP(1), FP(100) });
+				accountState.Balances.credit(Harvesting_Mosaic_Id, Amount(2'000'000 + i * 1'000'000));
+			}
+
+			delta->updateHighValueAccounts(Height(122));
+			cache.commit();
+		}
+
+		// Act:
+		FinalizationVoterTable table(Height(123), *cache.createView());
+		auto accountView = table.lookup(votingPublicKey, FP(50));
+
+		// Assert: the account with the smallest address is always selected
+		auto minIter = std::min_element(addresses.cbegin(), addresses.cend());
+		auto minIndex = static_cast<size_t>(std::distance(addresses.cbegin(), minIter));
+		AssertAccountView(Amount(2'000'000 + minIndex * 1'000'000), *minIter, accountView);
+	}
+
+	// endregion
+}}
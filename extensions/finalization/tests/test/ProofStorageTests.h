@@ -49,6 +49,11 @@ namespace catapult { namespace test {
 				return *m_pStorage;
 			}
 
+			void reopen() {
+				m_pStorage.reset();
+				m_pStorage = TTraits::CreateStorage(m_pTempDirectoryGuard->name());
+			}
+
 			io::ProofStorage* operator->() {
 				return m_pStorage.get();
 			}
@@ -363,6 +368,51 @@ namespace catapult { namespace test {
 			AssertSerializedProof(*pProof3, *pLoadedProof);
 		}
 
+		static void AssertLoadProofAtHeightLoadsMostRecentProofAfterPreviousLoad() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithProofs(10);
+
+			auto pProof1 = GenerateProof(3, FinalizationPoint(11), Height(123));
+			pStorage->saveProof(*pProof1);
+
+			auto pLoadedProof1 = pStorage->loadProof(Height(123));
+
+			auto pProof2 = GenerateProof(3, FinalizationPoint(12), Height(123));
+			pStorage->saveProof(*pProof2);
+
+			// Act:
+			auto pLoadedProof2 = pStorage->loadProof(Height(123));
+
+			// Assert:
+			AssertStorageStatistics(*pStorage, { FinalizationPoint(12), Height(123), pProof2->Hash });
+			AssertSerializedProof(*pProof1, *pLoadedProof1);
+			AssertSerializedProof(*pProof2, *pLoadedProof2);
+		}
+
+		static void AssertCanLoadProofAtHeightAfterReopeningStorage() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithProofs(10);
+
+			auto pProof1 = GenerateProof(3, FinalizationPoint(11), Height(123));
+			pStorage->saveProof(*pProof1);
+
+			auto pProof2 = GenerateProof(3, FinalizationPoint(13), Height(125));
+			pStorage->saveProof(*pProof2);
+
+			pStorage.reopen();
+
+			// Act:
+			auto pLoadedProof1 = pStorage->loadProof(Height(123));
+			auto pLoadedProof2 = pStorage->loadProof(Height(125));
+			auto pLoadedProof3 = pStorage->loadProof(Height(124));
+
+			// Assert: gap point 12 is mapped to height of proof2
+			AssertStorageStatistics(*pStorage, { FinalizationPoint(13), Height(125), pProof2->Hash });
+			AssertSerializedProof(*pProof1, *pLoadedProof1);
+			AssertSerializedProof(*pProof2, *pLoadedProof2);
+			EXPECT_FALSE(!!pLoadedProof3);
+		}
+
 		static void AssertCannotLoadProofAtHeightZero() {
 			// Arrange:
 			auto pStorage = PrepareStorageWithProofs(3);
@@ -451,6 +501,8 @@ namespace catapult { namespace test {
 	MAKE_PROOF_STORAGE_TEST(TRAITS_NAME, CanLoadProofAtFinalizedHeight) \
 	MAKE_PROOF_STORAGE_TEST(TRAITS_NAME, CanLoadProofAtHeightLessThanCurrentFinalizedHeight) \
 	MAKE_PROOF_STORAGE_TEST(TRAITS_NAME, LoadProofAtHeightLoadsMostRecentProof) \
+	MAKE_PROOF_STORAGE_TEST(TRAITS_NAME, LoadProofAtHeightLoadsMostRecentProofAfterPreviousLoad) \
+	MAKE_PROOF_STORAGE_TEST(TRAITS_NAME, CanLoadProofAtHeightAfterReopeningStorage) \
 	MAKE_PROOF_STORAGE_TEST(TRAITS_NAME, CannotLoadProofAtHeightZero) \
 	MAKE_PROOF_STORAGE_TEST(TRAITS_NAME, CannotLoadProofAtHeightGreaterThanCurrentFinalizedHeight) \
 	MAKE_PROOF_STORAGE_TEST(TRAITS_NAME, CannotLoadProofAtHeightWithoutProof) \
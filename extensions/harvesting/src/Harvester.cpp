@@ -19,9 +19,8 @@
 **/
 
 #include "Harvester.h"
-#include "catapult/cache_core/ImportanceView.h"
+#include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/chain/BlockDifficultyScorer.h"
-#include "catapult/chain/BlockScorer.h"
 #include "catapult/crypto/KeyPair.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/utils/StackLogger.h"
@@ -77,11 +76,13 @@ namespace catapult { namespace harvesting {
 			const model::BlockChainConfiguration& config,
 			const Address& beneficiary,
 			const UnlockedAccounts& unlockedAccounts,
+			HarvesterHitTable& hitTable,
 			const BlockGenerator& blockGenerator)
 			: m_cache(cache)
 			, m_config(config)
 			, m_beneficiary(beneficiary)
 			, m_unlockedAccounts(unlockedAccounts)
+			, m_hitTable(hitTable)
 			, m_blockGenerator(blockGenerator)
 	{}
 
@@ -92,46 +93,28 @@ namespace catapult { namespace harvesting {
 			return nullptr;
 		}
 
-		chain::BlockHitContext hitContext;
-		hitContext.ElapsedTime = context.BlockTime;
-		hitContext.Difficulty = context.Difficulty;
+		HarvesterHitContext hitContext;
+		hitContext.ParentHash = lastBlockElement.EntityHash;
+		hitContext.ParentGenerationHash = context.ParentContext.GenerationHash;
 		hitContext.Height = context.Height;
+		hitContext.Difficulty = context.Difficulty;
 
-		const auto& accountStateCache = m_cache.sub<cache::AccountStateCache>();
-		chain::BlockHitPredicate hitPredicate(m_config, [&accountStateCache](const auto& key, auto height) {
-			auto lockedCacheView = accountStateCache.createView();
-			cache::ReadOnlyAccountStateCache readOnlyCache(*lockedCacheView);
-			cache::ImportanceView view(readOnlyCache);
-			return view.getAccountImportanceOrDefault(key, height);
-		});
-
+		// the first account (in priority order) with a hit is selected as harvester
 		auto unlockedAccountsView = m_unlockedAccounts.view();
-		const crypto::KeyPair* pHarvesterKeyPair = nullptr;
-		crypto::VrfProof vrfProof;
-
-		unlockedAccountsView.forEach([&context, &hitContext, &hitPredicate, &pHarvesterKeyPair, &vrfProof](const auto& descriptor) {
-			hitContext.Signer = descriptor.signingKeyPair().publicKey();
-
-			vrfProof = crypto::GenerateVrfProof(context.ParentContext.GenerationHash, descriptor.vrfKeyPair());
-			hitContext.GenerationHash = model::CalculateGenerationHash(vrfProof.Gamma);
-			if (hitPredicate(hitContext)) {
-				pHarvesterKeyPair = &descriptor.signingKeyPair();
-				return false;
-			}
-
-			return true;
-		});
-
-		if (!pHarvesterKeyPair)
+		const auto& accountStateCache = m_cache.sub<cache::AccountStateCache>();
+		const auto* pHit = m_hitTable.tryFindHit(hitContext, unlockedAccountsView, accountStateCache, context.BlockTime);
+		if (!pHit)
 			return nullptr;
 
+		const auto& harvesterKeyPair = pHit->pDescriptor->signingKeyPair();
+
 		utils::StackLogger stackLogger("generating candidate block", utils::LogLevel::debug);
 		auto networkIdentifier = m_config.Network.Identifier;
-		auto pBlockHeader = CreateUnsignedBlockHeader(context, networkIdentifier, pHarvesterKeyPair->publicKey(), m_beneficiary);
-		AddGenerationHashProof(*pBlockHeader, vrfProof);
+		auto pBlockHeader = CreateUnsignedBlockHeader(context, networkIdentifier, harvesterKeyPair.publicKey(), m_beneficiary);
+		AddGenerationHashProof(*pBlockHeader, pHit->VrfProof);
 		auto pBlock = m_blockGenerator(*pBlockHeader, m_config.MaxTransactionsPerBlock);
 		if (pBlock)
-			SignBlockHeader(*pHarvesterKeyPair, *pBlock);
+			SignBlockHeader(harvesterKeyPair, *pBlock);
 
 		return pBlock;
 	}
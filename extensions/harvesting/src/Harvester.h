@@ -20,6 +20,7 @@
 
 #pragma once
 #include "HarvesterBlockGenerator.h"
+#include "HarvesterHitTable.h"
 #include "UnlockedAccounts.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/model/BlockChainConfiguration.h"
@@ -34,12 +35,14 @@ namespace catapult { namespace harvesting {
 	class Harvester {
 	public:
 		/// Creates a harvester around catapult \a cache, block chain \a config, \a beneficiary,
-		/// unlocked accounts set (\a unlockedAccounts) and \a blockGenerator used to customize block generation.
+		/// unlocked accounts set (\a unlockedAccounts), per parent hit table (\a hitTable) and \a blockGenerator
+		/// used to customize block generation.
 		Harvester(
 				const cache::CatapultCache& cache,
 				const model::BlockChainConfiguration& config,
 				const Address& beneficiary,
 				const UnlockedAccounts& unlockedAccounts,
+				HarvesterHitTable& hitTable,
 				const BlockGenerator& blockGenerator);
 
 	public:
@@ -52,6 +55,7 @@ namespace catapult { namespace harvesting {
 		const model::BlockChainConfiguration m_config;
 		const Address m_beneficiary;
 		const UnlockedAccounts& m_unlockedAccounts;
+		HarvesterHitTable& m_hitTable;
 		BlockGenerator m_blockGenerator;
 	};
 }}
@@ -0,0 +1,199 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "HarvesterHitTable.h"
+#include "catapult/cache_core/ImportanceView.h"
+#include "catapult/chain/BlockScorer.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include "catapult/utils/StackTimer.h"
+#include <algorithm>
+#include <limits>
+
+namespace catapult { namespace harvesting {
+
+	// region CalculateEarliestHitSeconds
+
+	namespace {
+		// ~35k years, which is large enough to treat all accounts without a hit as never hitting
+		constexpr uint64_t Max_Hit_Search_Seconds = 1ull << 40;
+
+		class HitChecker {
+		public:
+			HitChecker(uint64_t hit, Difficulty difficulty, Importance importance, const model::BlockChainConfiguration& config)
+					: m_hit(hit)
+					, m_difficulty(difficulty)
+					, m_importance(importance)
+					, m_config(config)
+			{}
+
+		public:
+			bool operator()(uint64_t seconds) const {
+				return m_hit < chain::CalculateTarget(utils::TimeSpan::FromSeconds(seconds), m_difficulty, m_importance, m_config);
+			}
+
+		private:
+			uint64_t m_hit;
+			Difficulty m_difficulty;
+			Importance m_importance;
+			const model::BlockChainConfiguration& m_config;
+		};
+	}
+
+	uint64_t CalculateEarliestHitSeconds(
+			uint64_t hit,
+			Difficulty difficulty,
+			Importance importance,
+			const model::BlockChainConfiguration& config) {
+		// target is monotonically nondecreasing in elapsed time, so the earliest hit can be found with a binary search
+		HitChecker isHit(hit, difficulty, importance, config);
+		if (!isHit(Max_Hit_Search_Seconds))
+			return std::numeric_limits<uint64_t>::max();
+
+		// find upper bound exponentially; lower bound never hits because target is zero when no time has elapsed
+		uint64_t upperSeconds = 1;
+		while (!isHit(upperSeconds))
+			upperSeconds <<= 1;
+
+		uint64_t lowerSeconds = upperSeconds / 2;
+		while (upperSeconds - lowerSeconds > 1) {
+			auto middleSeconds = lowerSeconds + (upperSeconds - lowerSeconds) / 2;
+			if (isHit(middleSeconds))
+				upperSeconds = middleSeconds;
+			else
+				lowerSeconds = middleSeconds;
+		}
+
+		return upperSeconds;
+	}
+
+	// endregion
+
+	// region HarvesterHitTable
+
+	HarvesterHitTable::HarvesterHitTable(const model::BlockChainConfiguration& config, thread::IoThreadPool& pool)
+			: m_config(config)
+			, m_pool(pool)
+			, m_isBuilt(false)
+			, m_context()
+			, m_unlockedAccountsVersion(0)
+			, m_size(0)
+			, m_numTotalEvaluations(0)
+			, m_numEvaluationsPerSecond(0)
+	{}
+
+	size_t HarvesterHitTable::size() const {
+		return m_size;
+	}
+
+	uint64_t HarvesterHitTable::numTotalEvaluations() const {
+		return m_numTotalEvaluations;
+	}
+
+	uint64_t HarvesterHitTable::numEvaluationsPerSecond() const {
+		return m_numEvaluationsPerSecond;
+	}
+
+	const HarvesterHit* HarvesterHitTable::tryFindHit(
+			const HarvesterHitContext& context,
+			const UnlockedAccountsView& unlockedAccountsView,
+			const cache::AccountStateCache& accountStateCache,
+			const utils::TimeSpan& elapsedTime) {
+		if (isStale(context, unlockedAccountsView))
+			rebuild(context, unlockedAccountsView, accountStateCache);
+
+		// all accounts with a hit form a prefix of the table; select the one with highest priority
+		const HarvesterHit* pBestHit = nullptr;
+		auto elapsedSeconds = elapsedTime.seconds();
+		for (const auto& hit : m_hits) {
+			if (hit.EarliestHitSeconds > elapsedSeconds)
+				break;
+
+			if (!pBestHit || hit.PriorityIndex < pBestHit->PriorityIndex)
+				pBestHit = &hit;
+		}
+
+		return pBestHit;
+	}
+
+	bool HarvesterHitTable::isStale(const HarvesterHitContext& context, const UnlockedAccountsView& unlockedAccountsView) const {
+		return !m_isBuilt
+				|| m_unlockedAccountsVersion != unlockedAccountsView.version()
+				|| m_context.ParentHash != context.ParentHash
+				|| m_context.ParentGenerationHash != context.ParentGenerationHash
+				|| m_context.Height != context.Height
+				|| m_context.Difficulty != context.Difficulty;
+	}
+
+	void HarvesterHitTable::rebuild(
+			const HarvesterHitContext& context,
+			const UnlockedAccountsView& unlockedAccountsView,
+			const cache::AccountStateCache& accountStateCache) {
+		// look up all importances up front using a single cache view
+		std::vector<HarvesterHit> hits;
+		std::vector<Importance> importances;
+		{
+			auto accountStateCacheView = accountStateCache.createView();
+			cache::ReadOnlyAccountStateCache readOnlyCache(*accountStateCacheView);
+			cache::ImportanceView importanceView(readOnlyCache);
+
+			unlockedAccountsView.forEach([&context, &hits, &importances, &importanceView](const auto& descriptor) {
+				hits.push_back(HarvesterHit{ &descriptor, hits.size(), crypto::VrfProof(), 0 });
+				importances.push_back(importanceView.getAccountImportanceOrDefault(descriptor.signingKeyPair().publicKey(), context.Height));
+				return true;
+			});
+		}
+
+		// generate all vrf proofs in parallel
+		utils::StackTimer stopwatch;
+		if (!hits.empty()) {
+			const auto& config = m_config;
+			thread::ParallelFor(m_pool.ioContext(), hits, m_pool.numWorkerThreads(), [&context, &importances, &config](
+					auto& hit,
+					auto index) {
+				hit.VrfProof = crypto::GenerateVrfProof(context.ParentGenerationHash, hit.pDescriptor->vrfKeyPair());
+				auto hitValue = chain::CalculateHit(model::CalculateGenerationHash(hit.VrfProof.Gamma));
+				hit.EarliestHitSeconds = CalculateEarliestHitSeconds(hitValue, context.Difficulty, importances[index], config);
+				return true;
+			}).get();
+		}
+
+		std::sort(hits.begin(), hits.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs.EarliestHitSeconds < rhs.EarliestHitSeconds
+					|| (lhs.EarliestHitSeconds == rhs.EarliestHitSeconds && lhs.PriorityIndex < rhs.PriorityIndex);
+		});
+
+		auto elapsedMicros = std::max<uint64_t>(1, stopwatch.micros());
+		m_numEvaluationsPerSecond = hits.size() * 1'000'000 / elapsedMicros;
+		m_numTotalEvaluations += hits.size();
+		m_size = hits.size();
+
+		CATAPULT_LOG(debug)
+				<< "evaluated " << hits.size() << " harvesters at height " << context.Height
+				<< " in " << elapsedMicros << "us";
+
+		m_isBuilt = true;
+		m_context = context;
+		m_unlockedAccountsVersion = unlockedAccountsView.version();
+		m_hits = std::move(hits);
+	}
+
+	// endregion
+}}
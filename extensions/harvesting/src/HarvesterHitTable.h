@@ -0,0 +1,120 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#pragma once
+#include "UnlockedAccounts.h"
+#include "catapult/crypto/Vrf.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include <atomic>
+#include <vector>
+
+namespace catapult { namespace thread { class IoThreadPool; } }
+
+namespace catapult { namespace harvesting {
+
+	/// Parent block dependent information used to evaluate harvesting hits.
+	struct HarvesterHitContext {
+		/// Hash of the parent block.
+		Hash256 ParentHash;
+
+		/// Generation hash of the parent block.
+		catapult::GenerationHash ParentGenerationHash;
+
+		/// Height of the harvested block.
+		catapult::Height Height;
+
+		/// Difficulty of the harvested block.
+		catapult::Difficulty Difficulty;
+	};
+
+	/// Vrf evaluation of an unlocked account for a specific parent block.
+	struct HarvesterHit {
+		/// Account descriptor.
+		/// \note This is only valid as long as the unlocked accounts are not modified.
+		const BlockGeneratorAccountDescriptor* pDescriptor;
+
+		/// Index of the account in the prioritized unlocked accounts.
+		size_t PriorityIndex;
+
+		/// Vrf proof of the parent generation hash.
+		crypto::VrfProof VrfProof;
+
+		/// Minimum number of seconds after the parent block at which the account has a hit.
+		/// \note This is the maximum value when the account can never hit.
+		uint64_t EarliestHitSeconds;
+	};
+
+	/// Calculates the minimum number of seconds after the parent block at which an account with \a importance has a hit
+	/// given \a hit, \a difficulty and the block chain configuration (\a config).
+	/// \note The maximum value is returned when the account can never hit.
+	uint64_t CalculateEarliestHitSeconds(
+			uint64_t hit,
+			Difficulty difficulty,
+			Importance importance,
+			const model::BlockChainConfiguration& config);
+
+	/// Table of the vrf evaluations of all unlocked accounts for a single parent block that is sorted by earliest hit time.
+	/// \note Evaluations only depend on the parent block and the unlocked accounts, so they are calculated once per parent.
+	class HarvesterHitTable {
+	public:
+		/// Creates a table around block chain \a config that uses \a pool to evaluate accounts in parallel.
+		HarvesterHitTable(const model::BlockChainConfiguration& config, thread::IoThreadPool& pool);
+
+	public:
+		/// Gets the number of evaluated accounts in the table.
+		size_t size() const;
+
+		/// Gets the total number of account evaluations.
+		uint64_t numTotalEvaluations() const;
+
+		/// Gets the number of accounts evaluated per second during the last table rebuild.
+		uint64_t numEvaluationsPerSecond() const;
+
+	public:
+		/// Finds the highest priority account in \a unlockedAccountsView that has a hit \a elapsedTime after the parent block
+		/// described by \a context.
+		/// \note The table is rebuilt using importances from \a accountStateCache when the context or the accounts change.
+		const HarvesterHit* tryFindHit(
+				const HarvesterHitContext& context,
+				const UnlockedAccountsView& unlockedAccountsView,
+				const cache::AccountStateCache& accountStateCache,
+				const utils::TimeSpan& elapsedTime);
+
+	private:
+		bool isStale(const HarvesterHitContext& context, const UnlockedAccountsView& unlockedAccountsView) const;
+
+		void rebuild(
+				const HarvesterHitContext& context,
+				const UnlockedAccountsView& unlockedAccountsView,
+				const cache::AccountStateCache& accountStateCache);
+
+	private:
+		const model::BlockChainConfiguration m_config;
+		thread::IoThreadPool& m_pool;
+
+		bool m_isBuilt;
+		HarvesterHitContext m_context;
+		uint64_t m_unlockedAccountsVersion;
+		std::vector<HarvesterHit> m_hits;
+
+		std::atomic<size_t> m_size;
+		std::atomic<uint64_t> m_numTotalEvaluations;
+		std::atomic<uint64_t> m_numEvaluationsPerSecond;
+	};
+}}
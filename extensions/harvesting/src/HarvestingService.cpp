@@ -35,6 +35,7 @@
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/EntityRange.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/MultiServicePool.h"
 #include "catapult/utils/HexParser.h"
 
 namespace catapult { namespace harvesting {
@@ -86,6 +87,7 @@ namespace catapult { namespace harvesting {
 		thread::Task CreateHarvestingTask(
 				extensions::ServiceState& state,
 				UnlockedAccounts& unlockedAccounts,
+				const std::shared_ptr<HarvesterHitTable>& pHitTable,
 				const crypto::KeyPair& encryptionKeyPair,
 				const Address& beneficiaryAddress) {
 			const auto& cache = state.cache();
@@ -105,9 +107,9 @@ namespace catapult { namespace harvesting {
 			auto blockGenerator = CreateHarvesterBlockGenerator(strategy, utFacadeFactory, utCache);
 			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
 					CreateHarvesterTaskOptions(state),
-					std::make_unique<Harvester>(cache, blockChainConfig, beneficiaryAddress, unlockedAccounts, blockGenerator));
+					std::make_unique<Harvester>(cache, blockChainConfig, beneficiaryAddress, unlockedAccounts, *pHitTable, blockGenerator));
 
-			return thread::CreateNamedTask("harvesting task", [pUnlockedAccountsUpdater, pHarvesterTask]() {
+			return thread::CreateNamedTask("harvesting task", [pUnlockedAccountsUpdater, pHitTable, pHarvesterTask]() {
 				pUnlockedAccountsUpdater->update();
 
 				// harvest the next block
@@ -164,16 +166,28 @@ namespace catapult { namespace harvesting {
 				locator.registerServiceCounter<UnlockedAccounts>("unlockedAccounts", "UNLKED ACCTS", [](const auto& accounts) {
 					return accounts.view().size();
 				});
+				locator.registerServiceCounter<HarvesterHitTable>("harvesterHitTable", "HARVEST EVALS", [](const auto& hitTable) {
+					return hitTable.numTotalEvaluations();
+				});
+				locator.registerServiceCounter<HarvesterHitTable>("harvesterHitTable", "HARVEST RATE", [](const auto& hitTable) {
+					return hitTable.numEvaluationsPerSecond();
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				auto pUnlockedAccounts = CreateUnlockedAccounts(m_config, state.cache());
 				locator.registerRootedService("unlockedAccounts", pUnlockedAccounts);
 
+				// vrf proofs of all unlocked accounts are generated in parallel once per parent block
+				auto* pHitTablePool = state.pool().pushIsolatedPool("harvester");
+				auto pHitTable = std::make_shared<HarvesterHitTable>(state.config().BlockChain, *pHitTablePool);
+				locator.registerRootedService("harvesterHitTable", pHitTable);
+
 				// add tasks
 				state.tasks().push_back(CreateHarvestingTask(
 						state,
 						*pUnlockedAccounts,
+						pHitTable,
 						locator.keys().nodeKeyPair(),
 						m_config.BeneficiaryAddress));
 
@@ -49,8 +49,10 @@ namespace catapult { namespace harvesting {
 
 	UnlockedAccountsView::UnlockedAccountsView(
 			const UnlockedAccountsKeyPairContainer& prioritizedKeyPairs,
+			uint64_t version,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_prioritizedKeyPairs(prioritizedKeyPairs)
+			, m_version(version)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -58,6 +60,10 @@ namespace catapult { namespace harvesting {
 		return m_prioritizedKeyPairs.size();
 	}
 
+	uint64_t UnlockedAccountsView::version() const {
+		return m_version;
+	}
+
 	bool UnlockedAccountsView::contains(const Key& publicKey) const {
 		return std::any_of(m_prioritizedKeyPairs.cbegin(), m_prioritizedKeyPairs.cend(), CreateContainsPredicate(publicKey));
 	}
@@ -77,10 +83,12 @@ namespace catapult { namespace harvesting {
 			size_t maxUnlockedAccounts,
 			const DelegatePrioritizer& prioritizer,
 			UnlockedAccountsKeyPairContainer& prioritizedKeyPairs,
+			uint64_t& version,
 			utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
 			: m_maxUnlockedAccounts(maxUnlockedAccounts)
 			, m_prioritizer(prioritizer)
 			, m_prioritizedKeyPairs(prioritizedKeyPairs)
+			, m_version(version)
 			, m_writeLock(std::move(writeLock))
 	{}
 
@@ -89,6 +97,7 @@ namespace catapult { namespace harvesting {
 		for (auto& prioritizedKeyPair : m_prioritizedKeyPairs) {
 			if (CreateContainsPredicate(publicKey)(prioritizedKeyPair)) {
 				prioritizedKeyPair.first = std::move(descriptor);
+				++m_version;
 				return UnlockedAccountsAddResult::Success_Update;
 			}
 		}
@@ -99,6 +108,7 @@ namespace catapult { namespace harvesting {
 				return UnlockedAccountsAddResult::Failure_Server_Limit;
 
 			m_prioritizedKeyPairs.pop_back();
+			++m_version;
 		}
 
 		auto iter = m_prioritizedKeyPairs.cbegin();
@@ -108,6 +118,7 @@ namespace catapult { namespace harvesting {
 		}
 
 		m_prioritizedKeyPairs.emplace(iter, std::move(descriptor), priorityScore);
+		++m_version;
 		return UnlockedAccountsAddResult::Success_New;
 	}
 
@@ -115,6 +126,7 @@ namespace catapult { namespace harvesting {
 		auto iter = std::remove_if(m_prioritizedKeyPairs.begin(), m_prioritizedKeyPairs.end(), CreateContainsPredicate(publicKey));
 		if (m_prioritizedKeyPairs.end() != iter) {
 			m_prioritizedKeyPairs.erase(iter);
+			++m_version;
 			return true;
 		}
 
@@ -129,8 +141,10 @@ namespace catapult { namespace harvesting {
 		});
 
 		m_prioritizedKeyPairs.erase(newPrioritizedKeyPairsEnd, m_prioritizedKeyPairs.end());
-		if (m_prioritizedKeyPairs.size() != initialSize)
+		if (m_prioritizedKeyPairs.size() != initialSize) {
 			CATAPULT_LOG(info) << "pruned " << (initialSize - m_prioritizedKeyPairs.size()) << " unlocked accounts";
+			++m_version;
+		}
 	}
 
 	// endregion
@@ -140,16 +154,17 @@ namespace catapult { namespace harvesting {
 	UnlockedAccounts::UnlockedAccounts(size_t maxUnlockedAccounts, const DelegatePrioritizer& prioritizer)
 			: m_maxUnlockedAccounts(maxUnlockedAccounts)
 			, m_prioritizer(prioritizer)
+			, m_version(0)
 	{}
 
 	UnlockedAccountsView UnlockedAccounts::view() const {
 		auto readLock = m_lock.acquireReader();
-		return UnlockedAccountsView(m_prioritizedKeyPairs, std::move(readLock));
+		return UnlockedAccountsView(m_prioritizedKeyPairs, m_version, std::move(readLock));
 	}
 
 	UnlockedAccountsModifier UnlockedAccounts::modifier() {
 		auto writeLock = m_lock.acquireWriter();
-		return UnlockedAccountsModifier(m_maxUnlockedAccounts, m_prioritizer, m_prioritizedKeyPairs, std::move(writeLock));
+		return UnlockedAccountsModifier(m_maxUnlockedAccounts, m_prioritizer, m_prioritizedKeyPairs, m_version, std::move(writeLock));
 	}
 
 	// endregion
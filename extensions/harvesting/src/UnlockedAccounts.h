@@ -64,15 +64,19 @@ namespace catapult { namespace harvesting {
 	/// Read only view on top of unlocked accounts.
 	class UnlockedAccountsView : utils::MoveOnly {
 	public:
-		/// Creates a view around \a prioritizedKeyPairs with lock context \a readLock.
+		/// Creates a view around \a prioritizedKeyPairs and \a version with lock context \a readLock.
 		UnlockedAccountsView(
 				const UnlockedAccountsKeyPairContainer& prioritizedKeyPairs,
+				uint64_t version,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
 		/// Gets the number of unlocked accounts.
 		size_t size() const;
 
+		/// Gets the version of the unlocked accounts, which changes whenever any account is added, updated or removed.
+		uint64_t version() const;
+
 		/// Returns \c true if the public (signing) key belongs to an unlocked account, \c false otherwise.
 		bool contains(const Key& publicKey) const;
 
@@ -81,17 +85,20 @@ namespace catapult { namespace harvesting {
 
 	private:
 		const UnlockedAccountsKeyPairContainer& m_prioritizedKeyPairs;
+		uint64_t m_version;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// Write only view on top of unlocked accounts.
 	class UnlockedAccountsModifier : utils::MoveOnly {
 	public:
-		/// Creates a view around \a maxUnlockedAccounts, \a prioritizer and \a prioritizedKeyPairs with lock context \a writeLock.
+		/// Creates a view around \a maxUnlockedAccounts, \a prioritizer, \a prioritizedKeyPairs and \a version
+		/// with lock context \a writeLock.
 		UnlockedAccountsModifier(
 				size_t maxUnlockedAccounts,
 				const DelegatePrioritizer& prioritizer,
 				UnlockedAccountsKeyPairContainer& prioritizedKeyPairs,
+				uint64_t& version,
 				utils::SpinReaderWriterLock::WriterLockGuard&& writeLock);
 
 	public:
@@ -108,6 +115,7 @@ namespace catapult { namespace harvesting {
 		size_t m_maxUnlockedAccounts;
 		DelegatePrioritizer m_prioritizer;
 		UnlockedAccountsKeyPairContainer& m_prioritizedKeyPairs;
+		uint64_t& m_version;
 		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 	};
 
@@ -129,6 +137,7 @@ namespace catapult { namespace harvesting {
 		size_t m_maxUnlockedAccounts;
 		DelegatePrioritizer m_prioritizer;
 		UnlockedAccountsKeyPairContainer m_prioritizedKeyPairs;
+		uint64_t m_version;
 		mutable utils::SpinReaderWriterLock m_lock;
 	};
 }}
@@ -0,0 +1,304 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "harvesting/src/HarvesterHitTable.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/chain/BlockScorer.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/KeyTestUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/test/nodeps/TestConstants.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace harvesting {
+
+#define TEST_CLASS HarvesterHitTableTests
+
+	namespace {
+		constexpr size_t Num_Accounts = 5;
+		constexpr Importance Default_Importance(1'000'000);
+
+		model::BlockChainConfiguration CreateConfiguration() {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.BlockGenerationTargetTime = utils::TimeSpan::FromSeconds(60);
+			config.ImportanceGrouping = 123;
+			config.TotalChainImportance = test::Default_Total_Chain_Importance;
+			return config;
+		}
+
+		bool IsHit(uint64_t hit, uint64_t seconds, Importance importance, const model::BlockChainConfiguration& config) {
+			return hit < chain::CalculateTarget(utils::TimeSpan::FromSeconds(seconds), Difficulty(), importance, config);
+		}
+
+		HarvesterHitContext CreateHitContext() {
+			return {
+				test::GenerateRandomByteArray<Hash256>(),
+				test::GenerateRandomByteArray<GenerationHash>(),
+				Height(1),
+				Difficulty()
+			};
+		}
+
+		class TestContext {
+		public:
+			TestContext()
+					: m_config(CreateConfiguration())
+					, m_pPool(test::CreateStartedIoThreadPool())
+					, m_cache(test::CreateEmptyCatapultCache(m_config))
+					, m_unlockedAccounts(Num_Accounts, [](const auto&) { return 0; })
+					, m_hitTable(m_config, *m_pPool) {
+				auto delta = m_cache.createDelta();
+				auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+				auto modifier = m_unlockedAccounts.modifier();
+				for (auto i = 0u; i < Num_Accounts; ++i) {
+					auto signingKeyPair = test::GenerateKeyPair();
+					accountStateCacheDelta.addAccount(signingKeyPair.publicKey(), Height(1));
+					auto& accountState = accountStateCacheDelta.find(signingKeyPair.publicKey()).get();
+					accountState.ImportanceSnapshots.set(Default_Importance, model::ImportanceHeight(1));
+
+					m_signingPublicKeys.push_back(signingKeyPair.publicKey());
+					modifier.add(BlockGeneratorAccountDescriptor(std::move(signingKeyPair), test::GenerateKeyPair()));
+				}
+
+				m_cache.commit(Height(1));
+			}
+
+		public:
+			auto& unlockedAccounts() {
+				return m_unlockedAccounts;
+			}
+
+			auto& hitTable() {
+				return m_hitTable;
+			}
+
+			const auto& signingPublicKeys() const {
+				return m_signingPublicKeys;
+			}
+
+		public:
+			const HarvesterHit* tryFindHit(const HarvesterHitContext& context, const utils::TimeSpan& elapsedTime) {
+				auto view = m_unlockedAccounts.view();
+				return m_hitTable.tryFindHit(context, view, m_cache.sub<cache::AccountStateCache>(), elapsedTime);
+			}
+
+		private:
+			model::BlockChainConfiguration m_config;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			cache::CatapultCache m_cache;
+			UnlockedAccounts m_unlockedAccounts;
+			HarvesterHitTable m_hitTable;
+			std::vector<Key> m_signingPublicKeys;
+		};
+
+		auto Max_Elapsed_Time() {
+			return utils::TimeSpan::FromSeconds(std::numeric_limits<uint32_t>::max());
+		}
+	}
+
+	// region CalculateEarliestHitSeconds
+
+	TEST(TEST_CLASS, CalculateEarliestHitSecondsReturnsMaxWhenAccountHasNoImportance) {
+		// Act:
+		auto seconds = CalculateEarliestHitSeconds(test::Random(), Difficulty(), Importance(0), CreateConfiguration());
+
+		// Assert:
+		EXPECT_EQ(std::numeric_limits<uint64_t>::max(), seconds);
+	}
+
+	TEST(TEST_CLASS, CalculateEarliestHitSecondsReturnsEarliestSecondWithHit) {
+		// Arrange:
+		auto config = CreateConfiguration();
+
+		for (auto i = 0u; i < 10; ++i) {
+			auto hit = test::Random();
+
+			// Act:
+			auto seconds = CalculateEarliestHitSeconds(hit, Difficulty(), Default_Importance, config);
+
+			// Assert:
+			EXPECT_TRUE(IsHit(hit, seconds, Default_Importance, config)) << "hit " << hit << " seconds " << seconds;
+			EXPECT_FALSE(IsHit(hit, seconds - 1, Default_Importance, config)) << "hit " << hit << " seconds " << seconds;
+		}
+	}
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, TableIsInitiallyEmpty) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+
+		// Act:
+		HarvesterHitTable hitTable(CreateConfiguration(), *pPool);
+
+		// Assert:
+		EXPECT_EQ(0u, hitTable.size());
+		EXPECT_EQ(0u, hitTable.numTotalEvaluations());
+		EXPECT_EQ(0u, hitTable.numEvaluationsPerSecond());
+	}
+
+	// endregion
+
+	// region tryFindHit - hit selection
+
+	TEST(TEST_CLASS, TryFindHitReturnsNullptrWhenNoAccountHasHit) {
+		// Arrange:
+		TestContext context;
+
+		// Act: no account can hit when no time has elapsed
+		const auto* pHit = context.tryFindHit(CreateHitContext(), utils::TimeSpan());
+
+		// Assert:
+		EXPECT_FALSE(!!pHit);
+		EXPECT_EQ(Num_Accounts, context.hitTable().size());
+		EXPECT_EQ(Num_Accounts, context.hitTable().numTotalEvaluations());
+	}
+
+	TEST(TEST_CLASS, TryFindHitReturnsHighestPriorityAccountWhenMultipleAccountsHaveHit) {
+		// Arrange:
+		TestContext context;
+
+		// Act: all accounts have a hit eventually
+		const auto* pHit = context.tryFindHit(CreateHitContext(), Max_Elapsed_Time());
+
+		// Assert:
+		ASSERT_TRUE(!!pHit);
+		EXPECT_EQ(0u, pHit->PriorityIndex);
+		EXPECT_EQ(context.signingPublicKeys()[0], pHit->pDescriptor->signingKeyPair().publicKey());
+	}
+
+	TEST(TEST_CLASS, TryFindHitReturnsEarliestHittingAccountAtEarliestHitTime) {
+		// Arrange:
+		TestContext context;
+		auto hitContext = CreateHitContext();
+		const auto* pFirstHit = context.tryFindHit(hitContext, utils::TimeSpan());
+		EXPECT_FALSE(!!pFirstHit);
+
+		// - find the earliest hit time across all accounts
+		uint64_t earliestHitSeconds = std::numeric_limits<uint64_t>::max();
+		context.unlockedAccounts().view().forEach([&hitContext, &earliestHitSeconds](const auto& descriptor) {
+			auto vrfProof = crypto::GenerateVrfProof(hitContext.ParentGenerationHash, descriptor.vrfKeyPair());
+			auto hit = chain::CalculateHit(model::CalculateGenerationHash(vrfProof.Gamma));
+			auto seconds = CalculateEarliestHitSeconds(hit, hitContext.Difficulty, Default_Importance, CreateConfiguration());
+			earliestHitSeconds = std::min(earliestHitSeconds, seconds);
+			return true;
+		});
+
+		// Act:
+		const auto* pHitBefore = context.tryFindHit(hitContext, utils::TimeSpan::FromSeconds(earliestHitSeconds - 1));
+		const auto* pHitAt = context.tryFindHit(hitContext, utils::TimeSpan::FromSeconds(earliestHitSeconds));
+
+		// Assert:
+		EXPECT_FALSE(!!pHitBefore);
+		ASSERT_TRUE(!!pHitAt);
+		EXPECT_EQ(earliestHitSeconds, pHitAt->EarliestHitSeconds);
+		auto expectedVrfProof = crypto::GenerateVrfProof(hitContext.ParentGenerationHash, pHitAt->pDescriptor->vrfKeyPair());
+		EXPECT_EQ(expectedVrfProof.Gamma, pHitAt->VrfProof.Gamma);
+		EXPECT_EQ(expectedVrfProof.Scalar, pHitAt->VrfProof.Scalar);
+
+		// - table was only built once
+		EXPECT_EQ(Num_Accounts, context.hitTable().numTotalEvaluations());
+	}
+
+	// endregion
+
+	// region tryFindHit - caching
+
+	TEST(TEST_CLASS, TryFindHitReusesTableWhenContextAndAccountsAreUnchanged) {
+		// Arrange:
+		TestContext context;
+		auto hitContext = CreateHitContext();
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i)
+			context.tryFindHit(hitContext, utils::TimeSpan::FromSeconds(i * 1000));
+
+		// Assert:
+		EXPECT_EQ(Num_Accounts, context.hitTable().size());
+		EXPECT_EQ(Num_Accounts, context.hitTable().numTotalEvaluations());
+	}
+
+	namespace {
+		template<typename TModifier>
+		void AssertTableIsRebuiltWhenContextChanges(TModifier modifier) {
+			// Arrange:
+			TestContext context;
+			auto hitContext = CreateHitContext();
+			context.tryFindHit(hitContext, utils::TimeSpan());
+
+			// Act:
+			modifier(hitContext);
+			context.tryFindHit(hitContext, utils::TimeSpan());
+
+			// Assert:
+			EXPECT_EQ(Num_Accounts, context.hitTable().size());
+			EXPECT_EQ(2 * Num_Accounts, context.hitTable().numTotalEvaluations());
+		}
+	}
+
+	TEST(TEST_CLASS, TryFindHitRebuildsTableWhenParentHashChanges) {
+		AssertTableIsRebuiltWhenContextChanges([](auto& hitContext) {
+			hitContext.ParentHash = test::GenerateRandomByteArray<Hash256>();
+		});
+	}
+
+	TEST(TEST_CLASS, TryFindHitRebuildsTableWhenParentGenerationHashChanges) {
+		AssertTableIsRebuiltWhenContextChanges([](auto& hitContext) {
+			hitContext.ParentGenerationHash = test::GenerateRandomByteArray<GenerationHash>();
+		});
+	}
+
+	TEST(TEST_CLASS, TryFindHitRebuildsTableWhenHeightChanges) {
+		AssertTableIsRebuiltWhenContextChanges([](auto& hitContext) {
+			hitContext.Height = hitContext.Height + Height(1);
+		});
+	}
+
+	TEST(TEST_CLASS, TryFindHitRebuildsTableWhenDifficultyChanges) {
+		AssertTableIsRebuiltWhenContextChanges([](auto& hitContext) {
+			hitContext.Difficulty = hitContext.Difficulty + Difficulty::Unclamped(1);
+		});
+	}
+
+	TEST(TEST_CLASS, TryFindHitRebuildsTableWhenUnlockedAccountsChange) {
+		// Arrange:
+		TestContext context;
+		auto hitContext = CreateHitContext();
+		context.tryFindHit(hitContext, utils::TimeSpan());
+
+		// Act:
+		context.unlockedAccounts().modifier().remove(context.signingPublicKeys()[2]);
+		const auto* pHit = context.tryFindHit(hitContext, Max_Elapsed_Time());
+
+		// Assert:
+		EXPECT_EQ(Num_Accounts - 1, context.hitTable().size());
+		EXPECT_EQ(2 * Num_Accounts - 1, context.hitTable().numTotalEvaluations());
+
+		ASSERT_TRUE(!!pHit);
+		EXPECT_EQ(context.signingPublicKeys()[0], pHit->pDescriptor->signingKeyPair().publicKey());
+	}
+
+	// endregion
+}}
@@ -29,6 +29,7 @@
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/TestConstants.h"
 #include "tests/test/nodeps/Waits.h"
@@ -94,7 +95,8 @@ namespace catapult { namespace harvesting {
 		struct HarvesterContext {
 		public:
 			HarvesterContext()
-					: Cache(test::CreateEmptyCatapultCache(CreateConfiguration()))
+					: pPool(test::CreateStartedIoThreadPool())
+					, Cache(test::CreateEmptyCatapultCache(CreateConfiguration()))
 					, SigningKeyPairs(CreateKeyPairs(Num_Accounts))
 					, VrfKeyPairs(CreateKeyPairs(Num_Accounts))
 					, Beneficiary(test::GenerateRandomByteArray<Address>())
@@ -130,7 +132,8 @@ namespace catapult { namespace harvesting {
 			std::unique_ptr<Harvester> CreateHarvester(
 					const model::BlockChainConfiguration& config,
 					const BlockGenerator& blockGenerator) {
-				return std::make_unique<Harvester>(Cache, config, Beneficiary, *pUnlockedAccounts, blockGenerator);
+				HitTables.push_back(std::make_unique<HarvesterHitTable>(config, *pPool));
+				return std::make_unique<Harvester>(Cache, config, Beneficiary, *pUnlockedAccounts, *HitTables.back(), blockGenerator);
 			}
 
 			HarvesterDescriptor BestHarvester() const {
@@ -179,6 +182,7 @@ namespace catapult { namespace harvesting {
 			}
 
 		public:
+			std::unique_ptr<thread::IoThreadPool> pPool;
 			cache::CatapultCache Cache;
 			std::vector<KeyPair> SigningKeyPairs;
 			std::vector<KeyPair> VrfKeyPairs;
@@ -187,6 +191,7 @@ namespace catapult { namespace harvesting {
 			std::unique_ptr<UnlockedAccounts> pUnlockedAccounts;
 			std::shared_ptr<model::Block> pLastBlock;
 			model::BlockElement LastBlockElement;
+			std::vector<std::unique_ptr<HarvesterHitTable>> HitTables;
 		};
 
 		// endregion
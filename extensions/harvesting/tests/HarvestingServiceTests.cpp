@@ -19,6 +19,7 @@
 **/
 
 #include "harvesting/src/HarvestingService.h"
+#include "harvesting/src/HarvesterHitTable.h"
 #include "harvesting/src/HarvestingConfiguration.h"
 #include "harvesting/src/UnlockedAccounts.h"
 #include "harvesting/src/UnlockedAccountsStorage.h"
@@ -150,6 +151,26 @@ namespace catapult { namespace harvesting {
 
 	ADD_SERVICE_REGISTRAR_INFO_TEST(Harvesting, Post_Range_Consumers)
 
+	// region hit table
+
+	TEST(TEST_CLASS, HarvesterHitTableServiceIsRegistered) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		auto pHitTable = context.locator().service<HarvesterHitTable>("harvesterHitTable");
+		ASSERT_TRUE(!!pHitTable);
+		EXPECT_EQ(0u, pHitTable->size());
+
+		EXPECT_EQ(0u, context.counter("HARVEST EVALS"));
+		EXPECT_EQ(0u, context.counter("HARVEST RATE"));
+	}
+
+	// endregion
+
 	// region unlocked accounts
 
 	namespace {
@@ -159,8 +180,8 @@ namespace catapult { namespace harvesting {
 			context.boot();
 
 			// Assert:
-			EXPECT_EQ(1u, context.locator().numServices());
-			EXPECT_EQ(1u, context.locator().counters().size());
+			EXPECT_EQ(2u, context.locator().numServices());
+			EXPECT_EQ(3u, context.locator().counters().size());
 
 			auto pUnlockedAccounts = GetUnlockedAccounts(context.locator());
 			ASSERT_TRUE(!!pUnlockedAccounts);
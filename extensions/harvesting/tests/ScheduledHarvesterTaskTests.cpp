@@ -23,6 +23,7 @@
 #include "catapult/cache_core/BlockStatisticCache.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/TestConstants.h"
 #include "tests/TestHarness.h"
@@ -121,17 +122,21 @@ namespace catapult { namespace harvesting {
 			HarvesterContext(const model::Block& lastBlock)
 					: Config(CreateConfiguration())
 					, Cache(test::CreateEmptyCatapultCache(Config))
-					, Accounts(1, [](const auto&) { return 0; }) {
+					, Accounts(1, [](const auto&) { return 0; })
+					, pPool(test::CreateStartedIoThreadPool())
+					, HitTable(Config, *pPool) {
 				AddStatistic(Cache, lastBlock);
 			}
 
 			model::BlockChainConfiguration Config;
 			cache::CatapultCache Cache;
 			UnlockedAccounts Accounts;
+			std::unique_ptr<thread::IoThreadPool> pPool;
+			HarvesterHitTable HitTable;
 		};
 
 		auto CreateHarvester(HarvesterContext& context) {
-			return std::make_unique<Harvester>(context.Cache, context.Config, Address(), context.Accounts, [](
+			return std::make_unique<Harvester>(context.Cache, context.Config, Address(), context.Accounts, context.HitTable, [](
 					const auto& blockHeader,
 					auto) {
 				auto pBlock = std::make_unique<model::Block>();
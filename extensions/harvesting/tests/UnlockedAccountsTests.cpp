@@ -587,6 +587,83 @@ namespace catapult { namespace harvesting {
 
 	// endregion
 
+	// region version
+
+	TEST(TEST_CLASS, VersionIsInitiallyZero) {
+		// Arrange:
+		TestContext context(8);
+
+		// Act + Assert:
+		EXPECT_EQ(0u, context.Accounts.view().version());
+	}
+
+	TEST(TEST_CLASS, VersionChangesWhenAccountIsAddedOrUpdated) {
+		// Arrange:
+		TestContext context(8);
+		auto& accounts = context.Accounts;
+		auto signingKeyPair = test::GenerateKeyPair();
+
+		// Act: add and then update the same account
+		AddAccount(context, BlockGeneratorAccountDescriptor(test::CopyKeyPair(signingKeyPair), test::GenerateKeyPair()));
+		auto version1 = accounts.view().version();
+
+		AddAccount(context, BlockGeneratorAccountDescriptor(test::CopyKeyPair(signingKeyPair), test::GenerateKeyPair()));
+		auto version2 = accounts.view().version();
+
+		// Assert:
+		EXPECT_EQ(1u, accounts.view().size());
+		EXPECT_NE(0u, version1);
+		EXPECT_NE(version1, version2);
+	}
+
+	TEST(TEST_CLASS, VersionChangesWhenAccountIsRemoved) {
+		// Arrange:
+		TestContext context(8);
+		auto& accounts = context.Accounts;
+		auto accountDescriptorWrapper = GenerateAccountDescriptorWrapper();
+		AddAccount(context, std::move(accountDescriptorWrapper.Descriptor));
+		auto version = accounts.view().version();
+
+		// Act:
+		accounts.modifier().remove(accountDescriptorWrapper.SigningPublicKey);
+
+		// Assert:
+		EXPECT_NE(version, accounts.view().version());
+	}
+
+	TEST(TEST_CLASS, VersionChangesWhenAccountsAreRemovedByPredicate) {
+		// Arrange:
+		TestContext context(8);
+		auto& accounts = context.Accounts;
+		AddRandomAccount(context);
+		auto version = accounts.view().version();
+
+		// Act:
+		accounts.modifier().removeIf([](const auto&) { return true; });
+
+		// Assert:
+		EXPECT_NE(version, accounts.view().version());
+	}
+
+	TEST(TEST_CLASS, VersionDoesNotChangeWhenNothingIsModified) {
+		// Arrange:
+		TestContext context(1);
+		auto& accounts = context.Accounts;
+		AddRandomAccount(context);
+		auto version = accounts.view().version();
+
+		// Act: failed add, failed remove and no-op removeIf
+		auto result = AddRandomAccount(context);
+		accounts.modifier().remove(test::GenerateRandomByteArray<Key>());
+		accounts.modifier().removeIf([](const auto&) { return false; });
+
+		// Assert:
+		EXPECT_EQ(UnlockedAccountsAddResult::Failure_Server_Limit, result);
+		EXPECT_EQ(version, accounts.view().version());
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
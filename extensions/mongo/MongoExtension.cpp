@@ -32,7 +32,6 @@
 #include "src/MongoTransactionStorage.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/extensions/RootedService.h"
-#include "catapult/io/BlockStorageChangeSubscriber.h"
 #include <mongocxx/instance.hpp>
 
 namespace catapult { namespace mongo {
@@ -81,6 +80,27 @@ namespace catapult { namespace mongo {
 			std::shared_ptr<const MongoTransactionRegistry> m_pRegistry;
 		};
 
+		template<typename TSupplier>
+		utils::DiagnosticCounter CreateBulkWriterCounter(
+				const std::string& name,
+				const std::shared_ptr<MongoBulkWriter>& pBulkWriter,
+				TSupplier supplier) {
+			// capture a weak pointer because counters can outlive the bulk writer
+			return utils::DiagnosticCounter(utils::DiagnosticCounterId(name), [pBulkWriterWeak = std::weak_ptr(pBulkWriter), supplier]() {
+				auto pBulkWriterShared = pBulkWriterWeak.lock();
+				return pBulkWriterShared ? static_cast<uint64_t>(supplier(*pBulkWriterShared)) : 0;
+			});
+		}
+
+		void AddBulkWriterCounters(extensions::ExtensionManager& extensionManager, const std::shared_ptr<MongoBulkWriter>& pBulkWriter) {
+			extensionManager.addDiagnosticCounter(CreateBulkWriterCounter("MONGO QUEUE", pBulkWriter, [](const auto& bulkWriter) {
+				return bulkWriter.numPendingBatches();
+			}));
+			extensionManager.addDiagnosticCounter(CreateBulkWriterCounter("MONGO DOCS", pBulkWriter, [](const auto& bulkWriter) {
+				return bulkWriter.numWrittenDocuments();
+			}));
+		}
+
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
 			mongocxx::instance::current();
 
@@ -114,6 +134,9 @@ namespace catapult { namespace mongo {
 					"mongo.services",
 					extensions::ServiceRegistrarPhase::Initial_With_Modules));
 
+			// add bulk writer counters (the mongo extension is usually hosted by the broker, which does not register services)
+			AddBulkWriterCounters(bootstrapper.extensionManager(), pMongoBulkWriter);
+
 			// add a pre load handler for initializing (nemesis) storage
 			// (pPluginManager is kept alive by pTransactionRegistry)
 			auto pMongoBlockStorage = CreateMongoBlockStorage(*pMongoContext, *pTransactionRegistry, pPluginManager->receiptRegistry());
@@ -123,8 +146,7 @@ namespace catapult { namespace mongo {
 			EmptyCollection(*pMongoContext, Pt_Collection_Name);
 
 			// register subscriptions
-			bootstrapper.subscriptionManager().addBlockChangeSubscriber(
-					io::CreateBlockStorageChangeSubscriber(std::move(pMongoBlockStorage)));
+			bootstrapper.subscriptionManager().addBlockChangeSubscriber(CreateMongoBlockChangeSubscriber(std::move(pMongoBlockStorage)));
 			bootstrapper.subscriptionManager().addPtChangeSubscriber(CreateMongoPtStorage(*pMongoContext, *pTransactionRegistry));
 			bootstrapper.subscriptionManager().addUtChangeSubscriber(
 					CreateMongoTransactionStorage(*pMongoContext, *pTransactionRegistry, Ut_Collection_Name));
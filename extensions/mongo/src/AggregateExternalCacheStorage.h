@@ -44,6 +44,11 @@ namespace catapult { namespace mongo {
 				pStorage->saveDelta(changes);
 		}
 
+		void flush() override {
+			for (const auto& pStorage : m_storages)
+				pStorage->flush();
+		}
+
 	private:
 		StorageContainer m_storages;
 	};
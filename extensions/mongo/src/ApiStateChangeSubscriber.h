@@ -46,6 +46,10 @@ namespace catapult { namespace mongo {
 			m_pCacheStorage->saveDelta(stateChangeInfo.CacheChanges);
 		}
 
+		void flush() override {
+			m_pCacheStorage->flush();
+		}
+
 	private:
 		std::unique_ptr<ChainScoreProvider> m_pChainScoreProvider;
 		std::unique_ptr<ExternalCacheStorage> m_pCacheStorage;
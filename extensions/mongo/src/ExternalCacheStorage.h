@@ -51,6 +51,9 @@ namespace catapult { namespace mongo {
 		/// Saves cache \a changes to external storage.
 		virtual void saveDelta(const cache::CacheChanges& changes) = 0;
 
+		/// Flushes all pending changes to external storage.
+		virtual void flush() = 0;
+
 	private:
 		std::string m_name;
 		size_t m_id;
@@ -69,6 +72,10 @@ namespace catapult { namespace mongo {
 			saveDelta(changes.sub<TCache>());
 		}
 
+		void flush() override {
+			// changes are saved immediately by default
+		}
+
 	private:
 		using CacheChangesType = cache::SingleCacheChangesT<typename TCache::CacheDeltaType, typename TCache::CacheValueType>;
 
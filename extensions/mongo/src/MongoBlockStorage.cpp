@@ -28,6 +28,7 @@
 #include "mappers/ResolutionStatementMapper.h"
 #include "mappers/TransactionMapper.h"
 #include "mappers/TransactionStatementMapper.h"
+#include <deque>
 
 using namespace bsoncxx::builder::stream;
 
@@ -62,7 +63,27 @@ namespace catapult { namespace mongo {
 				CATAPULT_THROW_RUNTIME_ERROR("SaveBlockHeader failed: block header was not inserted");
 		}
 
-		void SaveTransactions(
+		thread::future<bool> CheckInsertedWhenComplete(
+				std::vector<thread::future<BulkWriteResult>>&& insertResultFutures,
+				size_t numExpectedInserts,
+				const MongoErrorPolicy& errorPolicy,
+				const std::string& itemsDescription) {
+			if (insertResultFutures.empty()) {
+				errorPolicy.checkInserted(numExpectedInserts, BulkWriteResult(), itemsDescription);
+				return thread::make_ready_future(true);
+			}
+
+			auto resultsFuture = thread::when_all(std::move(insertResultFutures));
+			return resultsFuture.then([numExpectedInserts, &errorPolicy, itemsDescription](auto&& completedResultsFuture) {
+				auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(completedResultsFuture.get()));
+				errorPolicy.checkInserted(numExpectedInserts, aggregateResult, itemsDescription);
+			});
+		}
+
+		// note: all SaveXyz functions wait until all documents have been created, so the returned futures
+		// (which complete when the documents have been written) do not reference the (saved) block element
+
+		thread::future<bool> SaveTransactions(
 				MongoBulkWriter& bulkWriter,
 				Height height,
 				const std::vector<model::TransactionElement>& transactions,
@@ -75,11 +96,10 @@ namespace catapult { namespace mongo {
 				numTotalTransactionDocuments += documents.size();
 				return documents;
 			};
-			auto results = bulkWriter.bulkInsert("transactions", transactions, createDocuments).get();
-			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
 
+			auto insertResultFutures = bulkWriter.bulkInsert("transactions", transactions, createDocuments).get();
 			auto itemsDescription = "transactions at height " + std::to_string(height.unwrap());
-			errorPolicy.checkInserted(numTotalTransactionDocuments, aggregateResult, itemsDescription);
+			return CheckInsertedWhenComplete(std::move(insertResultFutures), numTotalTransactionDocuments, errorPolicy, itemsDescription);
 		}
 
 		void SaveBlockStatement(
@@ -87,49 +107,46 @@ namespace catapult { namespace mongo {
 				Height height,
 				const model::BlockStatement& blockStatement,
 				const MongoReceiptRegistry& registry,
-				const MongoErrorPolicy& errorPolicy) {
-			using BulkWriteResultFuture = thread::future<std::vector<thread::future<BulkWriteResult>>>;
-
-			std::vector<BulkWriteResultFuture> futures;
-			std::vector<size_t> numExpectedInserts;
-
-			// transaction statements
-			numExpectedInserts.emplace_back(blockStatement.TransactionStatements.size());
-			futures.emplace_back(bulkWriter.bulkInsert("transactionStatements", blockStatement.TransactionStatements, [height, &registry](
-					const auto& pair,
-					auto) {
-				return mappers::ToDbModel(height, pair.second, registry);
-			}));
-
-			// address resolution statements
-			numExpectedInserts.emplace_back(blockStatement.AddressResolutionStatements.size());
-			futures.emplace_back(bulkWriter.bulkInsert("addressResolutionStatements", blockStatement.AddressResolutionStatements, [height](
-					const auto& pair,
-					auto) {
-				return mappers::ToDbModel(height, pair.second);
-			}));
-
-			// mosaic resolution statements
-			numExpectedInserts.emplace_back(blockStatement.MosaicResolutionStatements.size());
-			futures.emplace_back(bulkWriter.bulkInsert("mosaicResolutionStatements", blockStatement.MosaicResolutionStatements, [height](
-					const auto& pair,
-					auto) {
-				return mappers::ToDbModel(height, pair.second);
-			}));
-
-			auto statementsFuture = thread::when_all(std::move(futures)).then([height, numExpectedInserts, &errorPolicy](
-					auto&& resultsFuture) {
-				auto insertResultsContainer = resultsFuture.get();
-				auto i = 0u;
-				auto itemsDescription = "statements at height " + std::to_string(height.unwrap());
-				for (auto& insertResults : insertResultsContainer) {
-					auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(insertResults.get())));
-					errorPolicy.checkInserted(numExpectedInserts[i], aggregateResult, itemsDescription);
-					++i;
-				}
-			});
-
-			statementsFuture.get();
+				const MongoErrorPolicy& errorPolicy,
+				std::vector<thread::future<bool>>& futures) {
+			// issue all inserts before waiting for any documents to be created
+			auto transactionStatementsFuture = bulkWriter.bulkInsert(
+					"transactionStatements",
+					blockStatement.TransactionStatements,
+					[height, &registry](const auto& pair, auto) {
+						return mappers::ToDbModel(height, pair.second, registry);
+					});
+
+			auto addressResolutionStatementsFuture = bulkWriter.bulkInsert(
+					"addressResolutionStatements",
+					blockStatement.AddressResolutionStatements,
+					[height](const auto& pair, auto) {
+						return mappers::ToDbModel(height, pair.second);
+					});
+
+			auto mosaicResolutionStatementsFuture = bulkWriter.bulkInsert(
+					"mosaicResolutionStatements",
+					blockStatement.MosaicResolutionStatements,
+					[height](const auto& pair, auto) {
+						return mappers::ToDbModel(height, pair.second);
+					});
+
+			auto itemsDescription = "statements at height " + std::to_string(height.unwrap());
+			futures.push_back(CheckInsertedWhenComplete(
+					transactionStatementsFuture.get(),
+					blockStatement.TransactionStatements.size(),
+					errorPolicy,
+					itemsDescription));
+			futures.push_back(CheckInsertedWhenComplete(
+					addressResolutionStatementsFuture.get(),
+					blockStatement.AddressResolutionStatements.size(),
+					errorPolicy,
+					itemsDescription));
+			futures.push_back(CheckInsertedWhenComplete(
+					mosaicResolutionStatementsFuture.get(),
+					blockStatement.MosaicResolutionStatements.size(),
+					errorPolicy,
+					itemsDescription));
 		}
 
 		void DropDocuments(mongocxx::database& database, const std::string& collectionName, const std::string& indexName, Height height) {
@@ -145,9 +162,18 @@ namespace catapult { namespace mongo {
 				CATAPULT_THROW_RUNTIME_ERROR("delete returned empty result");
 		}
 
-		class MongoBlockStorage final : public io::LightBlockStorage {
+		class DefaultMongoBlockStorage final : public MongoBlockStorage {
+		private:
+			// maximum number of blocks with incomplete writes
+			static constexpr size_t Max_Pending_Blocks = 8;
+
+			struct PendingBlock {
+				Height BlockHeight;
+				thread::future<std::vector<thread::future<bool>>> WritesFuture;
+			};
+
 		public:
-			MongoBlockStorage(
+			DefaultMongoBlockStorage(
 					MongoStorageContext& context,
 					const MongoTransactionRegistry& transactionRegistry,
 					const MongoReceiptRegistry& receiptRegistry)
@@ -158,10 +184,18 @@ namespace catapult { namespace mongo {
 					, m_errorPolicy(m_context.createCollectionErrorPolicy(""))
 			{}
 
+			~DefaultMongoBlockStorage() override {
+				// pending writes reference the error policy, so they need to complete before destruction
+				discardPendingBlocks();
+			}
+
 		public:
 			// region LightBlockStorage
 
 			Height chainHeight() const override {
+				if (!m_pendingBlocks.empty())
+					return m_pendingBlocks.back().BlockHeight;
+
 				auto chainStatisticDocument = GetChainStatisticDocument(m_database);
 				if (mappers::IsEmptyDocument(chainStatisticDocument))
 					return Height();
@@ -172,6 +206,7 @@ namespace catapult { namespace mongo {
 			}
 
 			model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override {
+				// block headers are written synchronously, so hashes of pending blocks can be loaded
 				auto dbHeight = chainHeight();
 				if (Height(0) == height || dbHeight < height)
 					return model::HashRange();
@@ -196,11 +231,18 @@ namespace catapult { namespace mongo {
 				}
 
 				SaveBlockHeader(m_database, blockElement);
-				SaveTransactions(m_context.bulkWriter(), height, blockElement.Transactions, m_transactionRegistry, m_errorPolicy);
-				if (blockElement.OptionalStatement)
-					SaveBlockStatement(m_context.bulkWriter(), height, *blockElement.OptionalStatement, m_receiptRegistry, m_errorPolicy);
 
-				setHeight(blockElement.Block.Height);
+				// write transactions and statements concurrently and without waiting for the writes of previous blocks
+				auto& bulkWriter = m_context.bulkWriter();
+				std::vector<thread::future<bool>> futures;
+				futures.push_back(SaveTransactions(bulkWriter, height, blockElement.Transactions, m_transactionRegistry, m_errorPolicy));
+				if (blockElement.OptionalStatement) {
+					const auto& blockStatement = *blockElement.OptionalStatement;
+					SaveBlockStatement(bulkWriter, height, blockStatement, m_receiptRegistry, m_errorPolicy, futures);
+				}
+
+				m_pendingBlocks.push_back({ height, thread::when_all(std::move(futures)) });
+				commitPendingBlocks(Max_Pending_Blocks);
 			}
 
 			void dropBlocksAfter(Height height) override {
@@ -208,13 +250,59 @@ namespace catapult { namespace mongo {
 				if (dbHeight <= height)
 					return;
 
+				// pending writes need to complete before any documents are dropped
+				flush();
 				setHeight(height);
 				dropAll(height);
 			}
 
 			// endregion
 
+		public:
+			void flush() override {
+				commitPendingBlocks(0);
+			}
+
 		private:
+			void commitPendingBlocks(size_t maxPendingBlocks) {
+				// only update the chain height after all writes of a block (and all previous blocks) succeed
+				Height committedHeight;
+				try {
+					while (!m_pendingBlocks.empty()) {
+						if (m_pendingBlocks.size() <= maxPendingBlocks && !m_pendingBlocks.front().WritesFuture.is_ready())
+							break;
+
+						auto pendingBlock = std::move(m_pendingBlocks.front());
+						m_pendingBlocks.pop_front();
+						thread::get_all(pendingBlock.WritesFuture.get());
+						committedHeight = pendingBlock.BlockHeight;
+					}
+				} catch (...) {
+					discardPendingBlocks();
+					trySetHeight(committedHeight);
+					throw;
+				}
+
+				trySetHeight(committedHeight);
+			}
+
+			void discardPendingBlocks() {
+				for (auto& pendingBlock : m_pendingBlocks) {
+					try {
+						thread::get_all(pendingBlock.WritesFuture.get());
+					} catch (...) {
+						// suppress because only the first failure is reported
+					}
+				}
+
+				m_pendingBlocks.clear();
+			}
+
+			void trySetHeight(Height height) {
+				if (Height() != height)
+					setHeight(height);
+			}
+
 			void setHeight(Height height) {
 				auto journalHeight = document()
 						<< "$set" << open_document
@@ -240,13 +328,40 @@ namespace catapult { namespace mongo {
 			const MongoReceiptRegistry& m_receiptRegistry;
 			MongoDatabase m_database;
 			MongoErrorPolicy m_errorPolicy;
+			std::deque<PendingBlock> m_pendingBlocks;
+		};
+
+		class MongoBlockChangeSubscriber : public io::BlockChangeSubscriber {
+		public:
+			explicit MongoBlockChangeSubscriber(std::unique_ptr<MongoBlockStorage>&& pStorage) : m_pStorage(std::move(pStorage))
+			{}
+
+		public:
+			void notifyBlock(const model::BlockElement& blockElement) override {
+				m_pStorage->saveBlock(blockElement);
+			}
+
+			void notifyDropBlocksAfter(Height height) override {
+				m_pStorage->dropBlocksAfter(height);
+			}
+
+			void flush() override {
+				m_pStorage->flush();
+			}
+
+		private:
+			std::unique_ptr<MongoBlockStorage> m_pStorage;
 		};
 	}
 
-	std::unique_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+	std::unique_ptr<MongoBlockStorage> CreateMongoBlockStorage(
 			MongoStorageContext& context,
 			const MongoTransactionRegistry& transactionRegistry,
 			const MongoReceiptRegistry& receiptRegistry) {
-		return std::make_unique<MongoBlockStorage>(context, transactionRegistry, receiptRegistry);
+		return std::make_unique<DefaultMongoBlockStorage>(context, transactionRegistry, receiptRegistry);
+	}
+
+	std::unique_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeSubscriber(std::unique_ptr<MongoBlockStorage>&& pStorage) {
+		return std::make_unique<MongoBlockChangeSubscriber>(std::move(pStorage));
 	}
 }}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "MongoStorageContext.h"
+#include "catapult/io/BlockChangeSubscriber.h"
 #include "catapult/io/BlockStorage.h"
 
 namespace catapult {
@@ -31,9 +32,20 @@ namespace catapult {
 
 namespace catapult { namespace mongo {
 
+	/// Mongo block storage.
+	/// \note Writes of consecutive blocks overlap, but the chain height is only advanced (in order) after all writes of a block complete.
+	class MongoBlockStorage : public io::LightBlockStorage {
+	public:
+		/// Waits for all pending block writes to complete and advances the chain height accordingly.
+		virtual void flush() = 0;
+	};
+
 	/// Creates a mongodb block storage around \a context, \a transactionRegistry and \a receiptRegistry.
-	std::unique_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+	std::unique_ptr<MongoBlockStorage> CreateMongoBlockStorage(
 			MongoStorageContext& context,
 			const MongoTransactionRegistry& transactionRegistry,
 			const MongoReceiptRegistry& receiptRegistry);
+
+	/// Creates a block change subscriber around mongodb block storage (\a pStorage) that flushes the storage when it is flushed.
+	std::unique_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeSubscriber(std::unique_ptr<MongoBlockStorage>&& pStorage);
 }}
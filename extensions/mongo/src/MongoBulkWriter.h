@@ -33,22 +33,26 @@
 #include <mongocxx/client.hpp>
 #include <mongocxx/config/version.hpp>
 #include <mongocxx/exception/bulk_write_exception.hpp>
+#include <mongocxx/options/bulk_write.hpp>
 #include <mongocxx/pool.hpp>
+#include <atomic>
 #include <unordered_set>
 
 namespace catapult { namespace mongo {
 
 	/// Class for writing bulk data to the mongo database.
 	/// \note The bulk writer supports inserting, upserting and deleting documents.
+	///       Inserts are unordered, which allows the server to apply them (and update indexes) without serializing on
+	///       the first error, while upserts and deletes are ordered because they can target the same document.
 	class MongoBulkWriter final : public std::enable_shared_from_this<MongoBulkWriter> {
 	private:
 		struct BulkWriteParams {
 		public:
-			BulkWriteParams(MongoBulkWriter& mongoBulkWriter, const std::string& collectionName)
+			BulkWriteParams(MongoBulkWriter& mongoBulkWriter, const std::string& collectionName, bool isOrdered)
 					: pConnection(mongoBulkWriter.m_connectionPool.acquire())
 					, Database(pConnection->database(mongoBulkWriter.m_dbName))
 					, Collection(Database[collectionName])
-					, Bulk(Collection.create_bulk_write())
+					, Bulk(Collection.create_bulk_write(mongocxx::options::bulk_write().ordered(isOrdered)))
 		{}
 
 		public:
@@ -78,6 +82,8 @@ namespace catapult { namespace mongo {
 				: m_dbName(dbName)
 				, m_pool(pool)
 				, m_connectionPool(uri)
+				, m_numPendingBatches(0)
+				, m_numWrittenDocuments(0)
 		{}
 
 	public:
@@ -92,6 +98,17 @@ namespace catapult { namespace mongo {
 			return pWriter;
 		}
 
+	public:
+		/// Gets the number of bulk write batches that have been queued but not yet completed.
+		size_t numPendingBatches() const {
+			return m_numPendingBatches;
+		}
+
+		/// Gets the total number of documents inserted, upserted, modified or deleted by completed bulk writes.
+		uint64_t numWrittenDocuments() const {
+			return m_numWrittenDocuments;
+		}
+
 	public:
 		/// Inserts \a entities into the collection named \a collectionName using a one-to-one mapping of entities
 		/// to documents (\a createDocument).
@@ -105,7 +122,7 @@ namespace catapult { namespace mongo {
 				bulk.append(mongocxx::model::insert_one(entityDocument.view()));
 			};
 
-			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
+			return bulkWrite<TContainer>(collectionName, entities, appendOperation, false);
 		}
 
 		/// Inserts \a entities into the collection named \a collectionName using a one-to-many mapping of entities
@@ -120,7 +137,7 @@ namespace catapult { namespace mongo {
 					bulk.append(mongocxx::model::insert_one(entityDocument.view()));
 			};
 
-			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
+			return bulkWrite<TContainer>(collectionName, entities, appendOperation, false);
 		}
 
 		/// Upserts \a entities into the collection named \a collectionName using a one-to-one mapping of entities
@@ -139,7 +156,7 @@ namespace catapult { namespace mongo {
 				bulk.append(replace_op);
 			};
 
-			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
+			return bulkWrite<TContainer>(collectionName, entities, appendOperation, true);
 		}
 
 		/// Deletes \a entities from the collection named \a collectionName matching the specified entity filter (\a createFilter).
@@ -153,7 +170,7 @@ namespace catapult { namespace mongo {
 				bulk.append(mongocxx::model::delete_many(filter.view()));
 			};
 
-			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
+			return bulkWrite<TContainer>(collectionName, entities, appendOperation, true);
 		}
 
 	private:
@@ -161,6 +178,7 @@ namespace catapult { namespace mongo {
 			// note: pBulkWriteParams depends on pThis (pBulkWriteParams.pConnection depends on pThis.m_connectionPool)
 			// it's crucial to move pBulkWriteParams into lambda, otherwise it would be copied while pThis would be moved
 			auto pPromise = std::make_shared<thread::promise<BulkWriteResult>>();
+			++m_numPendingBatches;
 			boost::asio::post(m_pool.ioContext(), [pThis = shared_from_this(), pBulkWriteParams{std::move(pBulkWriteParams)}, pPromise]() {
 				pThis->bulkWrite(*pBulkWriteParams, *pPromise);
 			});
@@ -168,11 +186,33 @@ namespace catapult { namespace mongo {
 			return pPromise->get_future();
 		}
 
+		struct PendingBatchGuard {
+		public:
+			explicit PendingBatchGuard(std::atomic<size_t>& numPendingBatches) : m_numPendingBatches(numPendingBatches)
+			{}
+
+			~PendingBatchGuard() {
+				--m_numPendingBatches;
+			}
+
+		private:
+			std::atomic<size_t>& m_numPendingBatches;
+		};
+
+		BulkWriteResult execute(BulkWriteParams& bulkWriteParams) {
+			// decrement pending batches when execution completes, even if it throws
+			PendingBatchGuard guard(m_numPendingBatches);
+
+			// if something goes wrong mongo will throw, else a result is always available
+			auto result = BulkWriteResult(bulkWriteParams.Bulk.execute().value());
+			m_numWrittenDocuments += static_cast<uint64_t>(
+					result.NumInserted + result.NumModified + result.NumDeleted + result.NumUpserted);
+			return result;
+		}
+
 		void bulkWrite(BulkWriteParams& bulkWriteParams, thread::promise<BulkWriteResult>& promise) {
 			try {
-				// if something goes wrong mongo will throw, else a result is always available
-				auto result = bulkWriteParams.Bulk.execute().value();
-				promise.set_value(BulkWriteResult(result));
+				promise.set_value(execute(bulkWriteParams));
 			} catch (const mongocxx::bulk_write_exception& e) {
 				std::ostringstream stream;
 				stream << "message: " << e.code().message();
@@ -208,18 +248,19 @@ namespace catapult { namespace mongo {
 		BulkWriteResultFuture bulkWrite(
 				const std::string& collectionName,
 				const TContainer& entities,
-				const AppendOperation<typename TContainer::value_type>& appendOperation) {
+				const AppendOperation<typename TContainer::value_type>& appendOperation,
+				bool isOrdered) {
 			if (entities.empty())
 				return thread::make_ready_future(std::vector<thread::future<BulkWriteResult>>());
 
 			auto numThreads = m_pool.numWorkerThreads();
 			auto pContext = std::make_shared<BulkWriteContext>(std::min<size_t>(entities.size(), numThreads));
-			auto workCallback = [pThis = shared_from_this(), entitiesStart = entities.cbegin(), collectionName, appendOperation, pContext](
+			auto workCallback = [pThis = shared_from_this(), collectionName, appendOperation, isOrdered, pContext](
 					auto itBegin,
 					auto itEnd,
 					auto startIndex,
 					auto batchIndex) {
-				auto pBulkWriteParams = std::make_shared<BulkWriteParams>(*pThis, collectionName);
+				auto pBulkWriteParams = std::make_shared<BulkWriteParams>(*pThis, collectionName, isOrdered);
 
 				auto index = static_cast<uint32_t>(startIndex);
 				for (auto iter = itBegin; itEnd != iter; ++iter, ++index)
@@ -238,5 +279,8 @@ namespace catapult { namespace mongo {
 		std::string m_dbName;
 		thread::IoThreadPool& m_pool;
 		mongocxx::pool m_connectionPool;
+
+		std::atomic<size_t> m_numPendingBatches;
+		std::atomic<uint64_t> m_numWrittenDocuments;
 	};
 }}
@@ -23,6 +23,7 @@
 #include "mappers/MapperUtils.h"
 #include "mappers/TransactionStatusMapper.h"
 #include "catapult/model/TransactionStatus.h"
+#include "catapult/utils/ArraySet.h"
 #include "catapult/utils/SpinLock.h"
 #include <mongocxx/client.hpp>
 
@@ -44,6 +45,18 @@ namespace catapult { namespace mongo {
 			};
 		}
 
+		std::vector<model::TransactionStatus> SelectLatestStatuses(std::vector<model::TransactionStatus>&& transactionStatuses) {
+			// statuses are appended in notification order, so the last status for each hash is the most recent one
+			utils::HashSet hashes;
+			std::vector<model::TransactionStatus> latestStatuses;
+			for (auto iter = transactionStatuses.crbegin(); transactionStatuses.crend() != iter; ++iter) {
+				if (hashes.insert(iter->Hash).second)
+					latestStatuses.push_back(*iter);
+			}
+
+			return latestStatuses;
+		}
+
 		class MongoTransactionStatusStorage final : public subscribers::TransactionStatusSubscriber {
 		public:
 			MongoTransactionStatusStorage(MongoStorageContext& context)
@@ -68,6 +81,9 @@ namespace catapult { namespace mongo {
 				if (transactionStatuses.empty())
 					return;
 
+				// when flushes are batched across many messages (e.g. broker catch-up), a transaction can have multiple statuses
+				transactionStatuses = SelectLatestStatuses(std::move(transactionStatuses));
+
 				// upsert into transaction statuses collection
 				auto results = m_context.bulkWriter().bulkUpsert(
 						Collection_Name,
@@ -23,6 +23,8 @@
 #include "mongo/src/MongoStorageContext.h"
 #include "mongo/src/mappers/MapperUtils.h"
 #include "catapult/thread/FutureUtils.h"
+#include <map>
+#include <optional>
 #include <set>
 #include <unordered_set>
 
@@ -196,6 +198,7 @@ namespace catapult { namespace mongo { namespace storages {
 	};
 
 	/// Mongo cache storage that persists flat cache data using delete and upsert.
+	/// \note Changes are buffered until flush and only the last state of each element is written.
 	template<typename TCacheTraits>
 	class MongoFlatCacheStorage : public ExternalCacheStorageT<typename TCacheTraits::CacheType> {
 	private:
@@ -204,6 +207,17 @@ namespace catapult { namespace mongo { namespace storages {
 		using ModelType = typename TCacheTraits::ModelType;
 		using ElementContainerType = std::unordered_set<const ModelType*>;
 
+		struct PendingElement {
+			/// Last document of the element or \c nullopt when the element was removed.
+			std::optional<bsoncxx::document::value> Document;
+
+			/// \c true when the element was added after the last flush and is not yet in the db.
+			bool IsNew;
+		};
+
+		using PendingElements = std::map<KeyType, PendingElement>;
+		using PendingElementPointers = std::vector<const typename PendingElements::value_type*>;
+
 	public:
 		/// Creates a cache storage around \a storageContext and \a networkIdentifier.
 		MongoFlatCacheStorage(MongoStorageContext& storageContext, model::NetworkIdentifier networkIdentifier)
@@ -213,6 +227,18 @@ namespace catapult { namespace mongo { namespace storages {
 				, m_networkIdentifier(networkIdentifier)
 		{}
 
+	public:
+		void flush() override {
+			PendingElementPointers removedElements;
+			PendingElementPointers upsertedElements;
+			for (const auto& pair : m_pendingElements)
+				(pair.second.Document ? upsertedElements : removedElements).push_back(&pair);
+
+			removeAll(removedElements);
+			upsertAll(upsertedElements);
+			m_pendingElements.clear();
+		}
+
 	private:
 		void saveDelta(const CacheChangesType& changes) override {
 			auto addedElements = changes.addedElements();
@@ -222,16 +248,46 @@ namespace catapult { namespace mongo { namespace storages {
 			// 1. remove elements common to both added and removed
 			detail::MongoElementFilter<TCacheTraits, ElementContainerType>::RemoveCommonElements(addedElements, removedElements);
 
-			// 2. remove all removed elements from db
-			removeAll(removedElements);
+			// 2. buffer the last state of all changed elements
+			//    (documents are created immediately because the elements are not owned by the storage)
+			for (const auto* pElement : addedElements)
+				bufferDocument(*pElement, true);
 
-			// 3. upsert new elements and modified elements into db
-			modifiedElements.insert(addedElements.cbegin(), addedElements.cend());
-			upsertAll(modifiedElements);
+			for (const auto* pElement : modifiedElements)
+				bufferDocument(*pElement, false);
+
+			for (const auto* pElement : removedElements)
+				bufferRemoval(TCacheTraits::GetId(*pElement));
 		}
 
 	private:
-		void removeAll(const ElementContainerType& elements) {
+		void bufferDocument(const ModelType& element, bool isNew) {
+			auto document = TCacheTraits::MapToMongoDocument(element, m_networkIdentifier);
+			auto iter = m_pendingElements.find(TCacheTraits::GetId(element));
+			if (m_pendingElements.cend() == iter) {
+				m_pendingElements.emplace(TCacheTraits::GetId(element), PendingElement{ std::move(document), isNew });
+				return;
+			}
+
+			// keep IsNew from the first change since the last flush (e.g. an element removed and added again is in the db)
+			iter->second.Document = std::move(document);
+		}
+
+		void bufferRemoval(const KeyType& key) {
+			auto iter = m_pendingElements.find(key);
+			if (m_pendingElements.cend() == iter) {
+				m_pendingElements.emplace(key, PendingElement{ std::nullopt, false });
+				return;
+			}
+
+			// an element added and removed since the last flush was never in the db
+			if (iter->second.IsNew)
+				m_pendingElements.erase(iter);
+			else
+				iter->second.Document.reset();
+		}
+
+		void removeAll(const PendingElementPointers& elements) {
 			if (elements.empty())
 				return;
 
@@ -240,12 +296,12 @@ namespace catapult { namespace mongo { namespace storages {
 			m_errorPolicy.checkDeleted(elements.size(), aggregateResult, "removed elements");
 		}
 
-		void upsertAll(const ElementContainerType& elements) {
+		void upsertAll(const PendingElementPointers& elements) {
 			if (elements.empty())
 				return;
 
-			auto createDocument = [networkIdentifier = m_networkIdentifier](const auto* pModel, auto) {
-				return TCacheTraits::MapToMongoDocument(*pModel, networkIdentifier);
+			auto createDocument = [](const auto* pPair, auto) {
+				return bsoncxx::document::value(pPair->second.Document->view());
 			};
 			auto upsertResults = m_bulkWriter.bulkUpsert(TCacheTraits::Collection_Name, elements, createDocument, CreateFilter).get();
 			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(upsertResults)));
@@ -253,8 +309,8 @@ namespace catapult { namespace mongo { namespace storages {
 		}
 
 	private:
-		static bsoncxx::document::value CreateFilter(const ModelType* pModel) {
-			return CreateFilterByKey(TCacheTraits::GetId(*pModel));
+		static bsoncxx::document::value CreateFilter(const typename PendingElements::value_type* pPair) {
+			return CreateFilterByKey(pPair->first);
 		}
 
 		static bsoncxx::document::value CreateFilterByKey(const KeyType& key) {
@@ -268,5 +324,6 @@ namespace catapult { namespace mongo { namespace storages {
 		MongoErrorPolicy m_errorPolicy;
 		MongoBulkWriter& m_bulkWriter;
 		model::NetworkIdentifier m_networkIdentifier;
+		PendingElements m_pendingElements;
 	};
 }}}
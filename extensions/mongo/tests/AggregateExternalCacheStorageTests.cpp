@@ -125,4 +125,20 @@ namespace catapult { namespace mongo {
 		AssertStorage<2>(*subStorages[1], 1, Height(0));
 		AssertStorage<3>(*subStorages[2], 1, Height(0));
 	}
+
+	TEST(TEST_CLASS, AggregateExternalCacheStorage_FlushDelegatesToAllSubStorages) {
+		// Arrange:
+		std::vector<ExternalCacheStorage*> subStorages;
+		auto pStorage = CreateAggregateExternalCacheStorage(subStorages);
+
+		// Act:
+		pStorage->flush();
+
+		// Assert:
+		for (auto i = 0u; i < subStorages.size(); ++i) {
+			const auto& mockStorage = static_cast<const mocks::MockExternalCacheStorage<1>&>(*subStorages[i]);
+			EXPECT_EQ(0u, mockStorage.numSaveDeltaCalls()) << "for cache at " << i;
+			EXPECT_EQ(1u, mockStorage.numFlushCalls()) << "for cache at " << i;
+		}
+	}
 }}
@@ -46,7 +46,9 @@ namespace catapult { namespace mongo {
 
 		class MockExternalCacheStorage : public ExternalCacheStorage {
 		public:
-			MockExternalCacheStorage() : ExternalCacheStorage("MockExternalCacheStorage", std::numeric_limits<size_t>::max())
+			MockExternalCacheStorage()
+					: ExternalCacheStorage("MockExternalCacheStorage", std::numeric_limits<size_t>::max())
+					, m_numFlushes(0)
 			{}
 
 		public:
@@ -54,13 +56,22 @@ namespace catapult { namespace mongo {
 				return m_capturedChanges;
 			}
 
+			size_t numFlushes() const {
+				return m_numFlushes;
+			}
+
 		public:
 			void saveDelta(const cache::CacheChanges& changes) override {
 				m_capturedChanges.push_back(&changes);
 			}
 
+			void flush() override {
+				++m_numFlushes;
+			}
+
 		private:
 			std::vector<const cache::CacheChanges*> m_capturedChanges;
+			size_t m_numFlushes;
 		};
 
 		// endregion
@@ -131,4 +142,18 @@ namespace catapult { namespace mongo {
 		ASSERT_EQ(1u, context.externalCacheStorage().capturedChanges().size());
 		EXPECT_EQ(&stateChangeInfo.CacheChanges, context.externalCacheStorage().capturedChanges()[0]);
 	}
+
+	TEST(TEST_CLASS, FlushForwardsToExternalCacheStorage) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.subscriber().flush();
+
+		// Assert:
+		EXPECT_TRUE(context.chainScoreProvider().capturedScores().empty());
+
+		EXPECT_TRUE(context.externalCacheStorage().capturedChanges().empty());
+		EXPECT_EQ(1u, context.externalCacheStorage().numFlushes());
+	}
 }}
@@ -67,14 +67,14 @@ namespace catapult { namespace mongo {
 			}
 		};
 
-		std::shared_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+		std::shared_ptr<MongoBlockStorage> CreateMongoBlockStorage(
 				std::unique_ptr<MongoTransactionPlugin>&& pTransactionPlugin,
 				MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict) {
 			auto pMongoReceiptRegistry = std::make_shared<MongoReceiptRegistry>();
 			auto mockReceiptType = utils::to_underlying_type(mocks::MockReceipt::Receipt_Type);
 			pMongoReceiptRegistry->registerPlugin(mocks::CreateMockReceiptMongoPlugin(mockReceiptType));
 			const auto& receiptRegistry = *pMongoReceiptRegistry;
-			auto pBlockStorage = test::CreateMongoStorage<io::LightBlockStorage>(
+			auto pBlockStorage = test::CreateMongoStorage<MongoBlockStorage>(
 					std::move(pTransactionPlugin),
 					test::DbInitializationType::None,
 					errorPolicyMode,
@@ -347,13 +347,15 @@ namespace catapult { namespace mongo {
 			}
 
 		public:
-			io::LightBlockStorage& storage() {
+			MongoBlockStorage& storage() {
 				return *m_pStorage;
 			}
 
 			void saveBlocks() {
 				for (const auto& blockElement : m_blockElements)
 					storage().saveBlock(blockElement);
+
+				storage().flush();
 			}
 
 			const std::vector<model::BlockElement>& elements() {
@@ -363,7 +365,7 @@ namespace catapult { namespace mongo {
 		private:
 			std::vector<std::unique_ptr<model::Block>> m_blocks;
 			std::vector<model::BlockElement> m_blockElements;
-			std::shared_ptr<io::LightBlockStorage> m_pStorage;
+			std::shared_ptr<MongoBlockStorage> m_pStorage;
 		};
 
 		// endregion
@@ -396,6 +398,36 @@ namespace catapult { namespace mongo {
 		EXPECT_EQ(Height(Multiple_Blocks_Count), chainHeight);
 	}
 
+	TEST(TEST_CLASS, ChainHeightIncludesBlocksWithPendingWrites) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		for (const auto& blockElement : context.elements())
+			context.storage().saveBlock(blockElement);
+
+		// Act:
+		auto chainHeight = context.storage().chainHeight();
+
+		// Assert:
+		EXPECT_EQ(Height(Multiple_Blocks_Count), chainHeight);
+	}
+
+	TEST(TEST_CLASS, FlushSetsDatabaseChainHeightToBlockCount) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		for (const auto& blockElement : context.elements())
+			context.storage().saveBlock(blockElement);
+
+		// Act:
+		context.storage().flush();
+
+		// Assert:
+		auto connection = test::CreateDbConnection();
+		auto database = connection[test::DatabaseName()];
+		auto chainStatisticDocument = GetChainStatisticDocument(database);
+		auto currentView = chainStatisticDocument.view()["current"].get_document().view();
+		EXPECT_EQ(Multiple_Blocks_Count, test::GetUint64(currentView, "height"));
+	}
+
 	// endregion
 
 	// region loadHashesFrom
@@ -464,6 +496,7 @@ namespace catapult { namespace mongo {
 
 			// Act:
 			pStorage->saveBlock(blockElement);
+			pStorage->flush();
 
 			// Assert:
 			ASSERT_EQ(Height(1), pStorage->chainHeight());
@@ -575,6 +608,7 @@ namespace catapult { namespace mongo {
 
 		// Act:
 		pStorage->saveBlock(blockElement);
+		pStorage->flush();
 
 		// Assert:
 		ASSERT_EQ(Height(1), pStorage->chainHeight());
@@ -606,6 +640,7 @@ namespace catapult { namespace mongo {
 
 		// Act:
 		context.storage().saveBlock(newBlockElement);
+		context.storage().flush();
 
 		// Assert: unmodified block elements
 		ASSERT_EQ(Height(Multiple_Blocks_Count), context.storage().chainHeight());
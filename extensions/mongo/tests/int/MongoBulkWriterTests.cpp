@@ -564,6 +564,35 @@ namespace catapult { namespace mongo {
 
 	// endregion
 
+	// region counters
+
+	TEST(TEST_CLASS, CountersAreInitiallyZero) {
+		// Arrange:
+		PerformanceContext context(1);
+
+		// Act + Assert:
+		EXPECT_EQ(0u, context.bulkWriter().numPendingBatches());
+		EXPECT_EQ(0u, context.bulkWriter().numWrittenDocuments());
+	}
+
+	BULK_OPERATION_TEST(BulkOperationUpdatesCounters) {
+		// Arrange:
+		PerformanceContext context(1);
+		std::atomic_bool blockFlag(false);
+		typename TTraits::Capture capture;
+
+		// Act:
+		auto results = TTraits::Execute(context.bulkWriter(), TTraits::GetElements(context), blockFlag, capture).get();
+
+		// Assert:
+		auto result = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
+		auto numExpectedDocuments = static_cast<uint64_t>(result.NumInserted + result.NumModified + result.NumDeleted + result.NumUpserted);
+		EXPECT_EQ(0u, context.bulkWriter().numPendingBatches());
+		EXPECT_EQ(numExpectedDocuments, context.bulkWriter().numWrittenDocuments());
+	}
+
+	// endregion
+
 	// region shutdown
 
 	BULK_OPERATION_TEST(FutureIsFulfilledEvenWhenWriterIsDestroyed) {
@@ -199,6 +199,28 @@ namespace catapult { namespace mongo {
 		test::AssertCollectionSize(Collection_Name, transactionStatuses.size());
 	}
 
+	TEST(TEST_CLASS, FlushWritesOnlyLatestBufferedStatusOfEachTransaction) {
+		// Arrange:
+		TransactionStatusSubscriberContext context(Num_Transaction_Statuses);
+		auto transactionStatuses = context.statuses();
+		for (auto i = 0u; i < 3; ++i) {
+			for (auto& status : transactionStatuses) {
+				status.Status += i;
+				context.subscriber().notifyStatus(*test::GenerateTransactionWithDeadline(status.Deadline), status.Hash, status.Status);
+			}
+		}
+
+		// Act:
+		context.subscriber().flush();
+
+		// Assert: last status of each transaction should be in the db
+		TransactionStatusesMap map;
+		for (const auto& status : transactionStatuses)
+			map.emplace(status.Hash, status);
+
+		AssertTransactionStatuses(map);
+	}
+
 	TEST(TEST_CLASS, FlushIsNoOpWhenNoDataIsPending) {
 		// Arrange:
 		TransactionStatusSubscriberContext context(Num_Transaction_Statuses);
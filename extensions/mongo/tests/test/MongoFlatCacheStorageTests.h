@@ -47,6 +47,7 @@ namespace catapult { namespace test {
 
 			// Act:
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 
 			// Assert:
 			EXPECT_EQ(0u, GetCollectionSize());
@@ -62,6 +63,7 @@ namespace catapult { namespace test {
 			auto originalElement = TTraits::GenerateRandomElement(11);
 			TTraits::Add(delta, originalElement);
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 			cache.commit(Height());
 
 			// Sanity:
@@ -72,6 +74,7 @@ namespace catapult { namespace test {
 			auto newElement = TTraits::GenerateRandomElement(54321);
 			TTraits::Add(delta, newElement);
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 
 			// Sanity:
 			EXPECT_EQ(1u, GetDelta(delta).addedElements().size());
@@ -91,6 +94,7 @@ namespace catapult { namespace test {
 			auto element = TTraits::GenerateRandomElement(11);
 			TTraits::Add(delta, element);
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 			cache.commit(Height());
 
 			// Sanity:
@@ -100,6 +104,7 @@ namespace catapult { namespace test {
 			// Act:
 			TTraits::Mutate(delta, element);
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 
 			// Sanity:
 			EXPECT_EQ(1u, GetDelta(delta).modifiedElements().size());
@@ -121,6 +126,7 @@ namespace catapult { namespace test {
 			TTraits::Add(delta, element1);
 			TTraits::Add(delta, element2);
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 			cache.commit(Height());
 
 			// Sanity:
@@ -130,6 +136,7 @@ namespace catapult { namespace test {
 			// Act:
 			TTraits::Remove(delta, element2);
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 
 			// Sanity:
 			EXPECT_EQ(1u, GetDelta(delta).removedElements().size());
@@ -153,6 +160,7 @@ namespace catapult { namespace test {
 			}
 
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 			cache.commit(Height());
 
 			// Assert:
@@ -174,6 +182,7 @@ namespace catapult { namespace test {
 			}
 
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 			cache.commit(Height());
 
 			// Act: drop some and modify some
@@ -200,6 +209,7 @@ namespace catapult { namespace test {
 			}
 
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 
 			// Sanity:
 			EXPECT_NE(0u, numRemoved);
@@ -227,6 +237,7 @@ namespace catapult { namespace test {
 				}
 
 				storage.get().saveDelta(cache::CacheChanges(delta));
+				storage.get().flush();
 				cache.commit(Height());
 
 				// Sanity:
@@ -239,11 +250,77 @@ namespace catapult { namespace test {
 			TTraits::Add(delta, element);
 			TTraits::Remove(delta, element);
 			storage.get().saveDelta(cache::CacheChanges(delta));
+			storage.get().flush();
 
 			// Assert: the db collection did not change
 			AssertDbContents(elements);
 		}
 
+		static void AssertChangesAreNotSavedBeforeFlush() {
+			// Arrange:
+			CacheStorageWrapper storage;
+			auto cache = TTraits::CreateCache();
+			auto delta = cache.createDelta();
+
+			// Act:
+			auto element = TTraits::GenerateRandomElement(11);
+			TTraits::Add(delta, element);
+			storage.get().saveDelta(cache::CacheChanges(delta));
+
+			// Assert:
+			EXPECT_EQ(0u, GetCollectionSize());
+		}
+
+		static void AssertOnlyLastStateIsSavedWhenMultipleDeltasAreFlushed() {
+			// Arrange:
+			CacheStorageWrapper storage;
+			auto cache = TTraits::CreateCache();
+			auto delta = cache.createDelta();
+
+			// - add and then modify an element in two deltas
+			auto element = TTraits::GenerateRandomElement(11);
+			TTraits::Add(delta, element);
+			storage.get().saveDelta(cache::CacheChanges(delta));
+			cache.commit(Height());
+
+			TTraits::Mutate(delta, element);
+			storage.get().saveDelta(cache::CacheChanges(delta));
+			cache.commit(Height());
+
+			// Act:
+			storage.get().flush();
+
+			// Assert:
+			EXPECT_EQ(1u, GetCollectionSize());
+			AssertDbContents({ element });
+		}
+
+		static void AssertElementsAddedAndRemovedInDifferentDeltasAreIgnored() {
+			// Arrange:
+			CacheStorageWrapper storage;
+			auto cache = TTraits::CreateCache();
+			auto delta = cache.createDelta();
+
+			// - add two elements and then remove one of them in a second delta
+			auto element1 = TTraits::GenerateRandomElement(11);
+			auto element2 = TTraits::GenerateRandomElement(12);
+			TTraits::Add(delta, element1);
+			TTraits::Add(delta, element2);
+			storage.get().saveDelta(cache::CacheChanges(delta));
+			cache.commit(Height());
+
+			TTraits::Remove(delta, element2);
+			storage.get().saveDelta(cache::CacheChanges(delta));
+			cache.commit(Height());
+
+			// Act:
+			storage.get().flush();
+
+			// Assert:
+			EXPECT_EQ(1u, GetCollectionSize());
+			AssertDbContents({ element1 });
+		}
+
 	private:
 		static auto GetCacheContents(const cache::CatapultCache& cache) {
 			std::vector<ElementType> contents;
@@ -268,5 +345,9 @@ namespace catapult { namespace test {
 	\
 	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, CanSaveMultipleElements) \
 	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, CanAddAndModifyAndDeleteMultipleElements) \
-	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, ElementsBothAddedAndRemovedAreIgnored)
+	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, ElementsBothAddedAndRemovedAreIgnored) \
+	\
+	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, ChangesAreNotSavedBeforeFlush) \
+	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, OnlyLastStateIsSavedWhenMultipleDeltasAreFlushed) \
+	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, ElementsAddedAndRemovedInDifferentDeltasAreIgnored)
 }}
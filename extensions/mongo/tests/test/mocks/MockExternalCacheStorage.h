@@ -29,9 +29,16 @@ namespace catapult { namespace mocks {
 	class MockExternalCacheStorage final : public mongo::ExternalCacheStorageT<test::SimpleCacheT<CacheId>> {
 	public:
 		/// Creates a mock external cache storage.
-		MockExternalCacheStorage() : m_numSaveDeltaCalls(0)
+		MockExternalCacheStorage()
+				: m_numSaveDeltaCalls(0)
+				, m_numFlushCalls(0)
 		{}
 
+	public:
+		void flush() override {
+			++m_numFlushCalls;
+		}
+
 	private:
 		void saveDelta(const cache::SingleCacheChangesT<test::SimpleCacheDelta, uint64_t>&) override {
 			++m_numSaveDeltaCalls;
@@ -43,6 +50,11 @@ namespace catapult { namespace mocks {
 			return m_numSaveDeltaCalls;
 		}
 
+		/// Gets the number of flush calls.
+		size_t numFlushCalls() const {
+			return m_numFlushCalls;
+		}
+
 		/// Gets the last chain height seen in load all.
 		Height chainHeight() const {
 			return m_chainHeight;
@@ -50,6 +62,7 @@ namespace catapult { namespace mocks {
 
 	private:
 		size_t m_numSaveDeltaCalls;
+		size_t m_numFlushCalls;
 		mutable Height m_chainHeight;
 	};
 }}
@@ -88,6 +88,18 @@ namespace catapult { namespace nodediscovery {
 				locator.registerServiceCounter<NodePingRequestor>(Service_Name, "SUCCESS PINGS", [](const auto& requestor) {
 					return requestor.numSuccessfulRequests();
 				});
+				locator.registerServiceCounter<NodePingRequestor>(Service_Name, "PING REUSED", [](const auto& requestor) {
+					return requestor.numReusedConnections();
+				});
+				locator.registerServiceCounter<NodePingRequestor>(Service_Name, "PING HS FULL", [](const auto& requestor) {
+					return requestor.handshakeStatistics().NumFullHandshakes;
+				});
+				locator.registerServiceCounter<NodePingRequestor>(Service_Name, "PING HS RESUM", [](const auto& requestor) {
+					return requestor.handshakeStatistics().NumResumedHandshakes;
+				});
+				locator.registerServiceCounter<NodePingRequestor>(Service_Name, "PING HS US", [](const auto& requestor) {
+					return ionet::CalculateAverageHandshakeMicros(requestor.handshakeStatistics());
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
@@ -99,7 +111,7 @@ namespace catapult { namespace nodediscovery {
 				auto pushNodeConsumer = CreatePushNodeConsumer(state);
 
 				// register services
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				auto connectionSettings = extensions::GetConnectionSettings(state);
 				auto pServiceGroup = state.pool().pushServiceGroup("node_discovery");
 				auto pNodePingRequestor = pServiceGroup->pushService(
 						CreateNodePingRequestor,
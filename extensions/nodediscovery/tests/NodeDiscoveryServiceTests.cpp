@@ -45,6 +45,10 @@ namespace catapult { namespace nodediscovery {
 		constexpr auto Active_Counter_Name = "ACTIVE PINGS";
 		constexpr auto Total_Counter_Name = "TOTAL PINGS";
 		constexpr auto Success_Counter_Name = "SUCCESS PINGS";
+		constexpr auto Reused_Counter_Name = "PING REUSED";
+		constexpr auto Full_Handshakes_Counter_Name = "PING HS FULL";
+		constexpr auto Resumed_Handshakes_Counter_Name = "PING HS RESUM";
+		constexpr auto Handshake_Micros_Counter_Name = "PING HS US";
 		constexpr auto Sentinel_Counter_Value = extensions::ServiceLocator::Sentinel_Counter_Value;
 
 		constexpr auto Num_Expected_Tasks = 2;
@@ -112,13 +116,17 @@ namespace catapult { namespace nodediscovery {
 
 		// Assert:
 		EXPECT_EQ(1u, context.locator().numServices());
-		EXPECT_EQ(3u, context.locator().counters().size());
+		EXPECT_EQ(7u, context.locator().counters().size());
 
 		EXPECT_TRUE(!!context.locator().service<void>(Service_Name));
 
 		EXPECT_EQ(0u, context.counter(Active_Counter_Name));
 		EXPECT_EQ(0u, context.counter(Total_Counter_Name));
 		EXPECT_EQ(0u, context.counter(Success_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Reused_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Full_Handshakes_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Resumed_Handshakes_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Handshake_Micros_Counter_Name));
 	}
 
 	TEST(TEST_CLASS, CanShutdownService) {
@@ -131,13 +139,17 @@ namespace catapult { namespace nodediscovery {
 
 		// Assert:
 		EXPECT_EQ(1u, context.locator().numServices());
-		EXPECT_EQ(3u, context.locator().counters().size());
+		EXPECT_EQ(7u, context.locator().counters().size());
 
 		EXPECT_FALSE(!!context.locator().service<void>(Service_Name));
 
 		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Active_Counter_Name));
 		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Total_Counter_Name));
 		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Success_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Reused_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Full_Handshakes_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Resumed_Handshakes_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Handshake_Micros_Counter_Name));
 	}
 
 	TEST(TEST_CLASS, PacketHandlersAreRegistered) {
@@ -64,13 +64,14 @@ namespace catapult { namespace packetserver {
 						net::CreatePacketReaders,
 						state.packetHandlers(),
 						locator.keys().caPublicKey(),
-						extensions::GetConnectionSettings(config),
+						extensions::GetConnectionSettings(state),
 						config.Node.MaxIncomingConnectionsPerIdentity);
 				extensions::BootServer(
 						*pServiceGroup,
 						config.Node.Port,
 						Service_Id,
 						config,
+						state.workingBufferPool(),
 						state.timeSupplier(),
 						state.nodeSubscriber(),
 						*pReaders);
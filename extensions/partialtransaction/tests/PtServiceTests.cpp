@@ -36,6 +36,7 @@ namespace catapult { namespace partialtransaction {
 		struct PtServiceTraits {
 			static constexpr auto Counter_Name = "PT WRITERS";
 			static constexpr auto Num_Expected_Services = 3u; // writers (1) + dependent services (2)
+			static constexpr auto Num_Expected_Counters = 1u;
 			static constexpr auto CreateRegistrar = CreatePtServiceRegistrar;
 
 			static auto GetWriters(const extensions::ServiceLocator& locator) {
@@ -66,12 +66,6 @@ namespace catapult { namespace sync {
 	namespace {
 		// region utils
 
-		crypto::RandomFiller CreateRandomFiller() {
-			return [](auto* pOut, auto count) {
-				crypto::SecureRandomGenerator().fill(pOut, count);
-			};
-		}
-
 		std::shared_ptr<const validators::ParallelValidationPolicy> CreateParallelValidationPolicy(
 				thread::IoThreadPool& validatorPool,
 				const plugins::PluginManager& pluginManager) {
@@ -223,7 +217,10 @@ namespace catapult { namespace sync {
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
 			}
 
-			std::shared_ptr<ConsumerDispatcher> build(thread::IoThreadPool& validatorPool, RollbackInfo& rollbackInfo) {
+			std::shared_ptr<ConsumerDispatcher> build(
+					thread::IoThreadPool& validatorPool,
+					thread::IoThreadPool& commitPool,
+					RollbackInfo& rollbackInfo) {
 				const auto& utCache = const_cast<const extensions::ServiceState&>(m_state).utCache();
 				auto requiresValidationPredicate = ToRequiresValidationPredicate(m_state.hooks().knownHashPredicate(utCache));
 				m_consumers.push_back(CreateBlockChainCheckConsumer(
@@ -235,7 +232,7 @@ namespace catapult { namespace sync {
 						requiresValidationPredicate));
 				m_consumers.push_back(CreateBlockBatchSignatureConsumer(
 						m_state.config().BlockChain.Network.GenerationHashSeed,
-						CreateRandomFiller(),
+						crypto::CreateSecureRandomFiller(),
 						m_state.pluginManager().createNotificationPublisher(),
 						validatorPool,
 						requiresValidationPredicate));
@@ -244,6 +241,7 @@ namespace catapult { namespace sync {
 				disruptorConsumers.push_back(CreateBlockChainSyncConsumer(
 						m_state.cache(),
 						m_state.storage(),
+						commitPool,
 						CreateBlockChainSyncHandlers(m_state, rollbackInfo)));
 
 				if (m_state.config().Node.EnableAutoSyncCleanup)
@@ -320,7 +318,7 @@ namespace catapult { namespace sync {
 						failedTransactionSink));
 				m_consumers.push_back(CreateTransactionBatchSignatureConsumer(
 						m_state.config().BlockChain.Network.GenerationHashSeed,
-						CreateRandomFiller(),
+						crypto::CreateSecureRandomFiller(),
 						m_state.pluginManager().createNotificationPublisher(),
 						validatorPool,
 						failedTransactionSink));
@@ -433,10 +431,11 @@ namespace catapult { namespace sync {
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				// create shared services
 				auto* pValidatorPool = state.pool().pushIsolatedPool("validator");
+				auto* pCommitPool = state.pool().pushIsolatedPool("block commit", 1);
 				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state);
 
 				// create the block and transaction dispatchers and related services
-				// (notice that the dispatcher service group must be after the validator isolated pool in order to allow proper shutdown)
+				// (notice that the dispatcher service group must be after the isolated pools in order to allow proper shutdown)
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
@@ -446,7 +445,7 @@ namespace catapult { namespace sync {
 				transactionDispatcherBuilder.addHashConsumers();
 
 				auto pRollbackInfo = CreateAndRegisterRollbackService(locator, state.timeSupplier(), state.config().BlockChain);
-				auto pBlockDispatcher = blockDispatcherBuilder.build(*pValidatorPool, *pRollbackInfo);
+				auto pBlockDispatcher = blockDispatcherBuilder.build(*pValidatorPool, *pCommitPool, *pRollbackInfo);
 				RegisterBlockDispatcherService(pBlockDispatcher, *pServiceGroup, locator, state);
 
 				auto pTransactionDispatcher = transactionDispatcherBuilder.build(*pValidatorPool, utUpdater);
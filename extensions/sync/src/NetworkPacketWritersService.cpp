@@ -71,10 +71,16 @@ namespace catapult { namespace sync {
 				locator.registerServiceCounter<net::PacketWriters>(Service_Name, "WRITERS", [](const auto& writers) {
 					return writers.numActiveWriters();
 				});
+				locator.registerServiceCounter<net::PacketWriters>(Service_Name, "WRITERS HI Q", [](const auto& writers) {
+					return writers.numPendingBroadcasts(net::BroadcastLane::High);
+				});
+				locator.registerServiceCounter<net::PacketWriters>(Service_Name, "WRITERS LO Q", [](const auto& writers) {
+					return writers.numPendingBroadcasts(net::BroadcastLane::Normal);
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				auto connectionSettings = extensions::GetConnectionSettings(state);
 				auto pServiceGroup = state.pool().pushServiceGroup(Service_Name);
 				auto pWriters = pServiceGroup->pushService(net::CreatePacketWriters, locator.keys().caPublicKey(), connectionSettings);
 
@@ -56,24 +56,27 @@ namespace catapult { namespace sync {
 			chainSynchronizerConfig.MaxHashesPerSyncAttempt = config.Node.MaxHashesPerSyncAttempt;
 			chainSynchronizerConfig.MaxBlocksPerSyncAttempt = config.Node.MaxBlocksPerSyncAttempt;
 			chainSynchronizerConfig.MaxChainBytesPerSyncAttempt = config.Node.MaxChainBytesPerSyncAttempt.bytes32();
+			chainSynchronizerConfig.MaxChainBytesPerSyncChunk = config.Node.MaxChainBytesPerSyncChunk.bytes32();
+			chainSynchronizerConfig.MaxParallelSyncRanges = config.Node.MaxParallelSyncRanges;
 			chainSynchronizerConfig.MaxRollbackBlocks = config.BlockChain.MaxRollbackBlocks;
 			return chainSynchronizerConfig;
 		}
 
 		thread::Task CreateSynchronizerTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& config = state.config();
-			auto chainSynchronizer = chain::CreateChainSynchronizer(
+			auto chainSynchronizer = chain::CreateParallelChainSynchronizer(
 					api::CreateLocalChainApi(
 							state.storage(),
 							[&score = state.score()]() { return score.get(); },
 							state.hooks().localFinalizedHeightSupplier()),
 					CreateChainSynchronizerConfiguration(config),
 					extensions::CreateLocalFinalizedHeightSupplier(state),
+					state.hooks().remoteFinalizedHeightVerifier(),
 					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
 
 			thread::Task task;
 			task.Name = "synchronizer task";
-			task.Callback = CreateSynchronizerTaskCallback(
+			task.Callback = CreateParallelSynchronizerTaskCallback(
 					std::move(chainSynchronizer),
 					api::CreateRemoteChainApi,
 					packetWriters,
@@ -33,6 +33,7 @@ namespace catapult { namespace sync {
 		struct NetworkPacketWritersServiceTraits {
 			static constexpr auto Counter_Name = "WRITERS";
 			static constexpr auto Num_Expected_Services = 1u;
+			static constexpr auto Num_Expected_Counters = 3u;
 
 			static constexpr auto GetWriters = GetPacketWriters;
 			static constexpr auto CreateRegistrar = CreateNetworkPacketWritersServiceRegistrar;
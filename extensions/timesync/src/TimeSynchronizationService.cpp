@@ -67,6 +67,14 @@ namespace catapult { namespace timesync {
 					locator.registerServiceCounter<NodeNetworkTimeRequestor>(Requestor_Service_Name, counterName, supplier);
 				};
 				addRequestorCounter("TS TOTAL REQ", [](const auto& requestor) { return requestor.numTotalRequests();});
+				addRequestorCounter("TS REUSED", [](const auto& requestor) { return requestor.numReusedConnections(); });
+				addRequestorCounter("TS HS FULL", [](const auto& requestor) { return requestor.handshakeStatistics().NumFullHandshakes; });
+				addRequestorCounter("TS HS RESUM", [](const auto& requestor) {
+					return requestor.handshakeStatistics().NumResumedHandshakes;
+				});
+				addRequestorCounter("TS HS US", [](const auto& requestor) {
+					return ionet::CalculateAverageHandshakeMicros(requestor.handshakeStatistics());
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
@@ -78,7 +86,7 @@ namespace catapult { namespace timesync {
 				};
 
 				// register services
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				auto connectionSettings = extensions::GetConnectionSettings(state);
 				auto pServiceGroup = state.pool().pushServiceGroup(Service_Group);
 				auto pNodeNetworkTimeRequestor = pServiceGroup->pushService(
 						CreateNodeNetworkTimeRequestor,
@@ -41,11 +41,15 @@ namespace catapult { namespace timesync {
 #define TEST_CLASS TimeSynchronizationServiceTests
 
 	namespace {
-		constexpr auto Num_Expected_Counters = 4u;
+		constexpr auto Num_Expected_Counters = 8u;
 		constexpr auto Time_Offset_Absolute_Counter_Name = "TS OFFSET ABS";
 		constexpr auto Time_Offset_Direction_Counter_Name = "TS OFFSET DIR";
 		constexpr auto Node_Age_Counter_Name = "TS NODE AGE";
 		constexpr auto Total_Requests_Counter_Name = "TS TOTAL REQ";
+		constexpr auto Reused_Counter_Name = "TS REUSED";
+		constexpr auto Full_Handshakes_Counter_Name = "TS HS FULL";
+		constexpr auto Resumed_Handshakes_Counter_Name = "TS HS RESUM";
+		constexpr auto Handshake_Micros_Counter_Name = "TS HS US";
 		constexpr auto Sentinel_Counter_Value = extensions::ServiceLocator::Sentinel_Counter_Value;
 
 		constexpr auto Num_Expected_Services = 3u;
@@ -112,6 +116,10 @@ namespace catapult { namespace timesync {
 		EXPECT_EQ(0u, context.counter(Time_Offset_Direction_Counter_Name));
 		EXPECT_EQ(0u, context.counter(Node_Age_Counter_Name));
 		EXPECT_EQ(0u, context.counter(Total_Requests_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Reused_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Full_Handshakes_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Resumed_Handshakes_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Handshake_Micros_Counter_Name));
 	}
 
 	TEST(TEST_CLASS, CanShutdownService) {
@@ -134,6 +142,10 @@ namespace catapult { namespace timesync {
 		EXPECT_EQ(0u, context.counter(Time_Offset_Direction_Counter_Name));
 		EXPECT_EQ(0u, context.counter(Node_Age_Counter_Name));
 		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Total_Requests_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Reused_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Full_Handshakes_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Resumed_Handshakes_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Handshake_Micros_Counter_Name));
 	}
 
 	TEST(TEST_CLASS, PacketHandlersAreRegistered) {
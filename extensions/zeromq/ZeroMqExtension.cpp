@@ -32,10 +32,32 @@
 namespace catapult { namespace zeromq {
 
 	namespace {
+		template<typename TSupplier>
+		utils::DiagnosticCounter CreatePublisherCounter(
+				const std::string& name,
+				const std::shared_ptr<ZeroMqEntityPublisher>& pPublisher,
+				TSupplier supplier) {
+			// capture a weak pointer because counters can outlive the publisher
+			return utils::DiagnosticCounter(utils::DiagnosticCounterId(name), [pPublisherWeak = std::weak_ptr(pPublisher), supplier]() {
+				auto pPublisherShared = pPublisherWeak.lock();
+				return pPublisherShared ? static_cast<uint64_t>(supplier(*pPublisherShared)) : 0;
+			});
+		}
+
+		void AddPublisherCounters(extensions::ExtensionManager& extensionManager, const std::shared_ptr<ZeroMqEntityPublisher>& pPublisher) {
+			extensionManager.addDiagnosticCounter(CreatePublisherCounter("ZMQ QUEUE", pPublisher, [](const auto& publisher) {
+				return publisher.numPendingMessageGroups();
+			}));
+			extensionManager.addDiagnosticCounter(CreatePublisherCounter("ZMQ DROPPED", pPublisher, [](const auto& publisher) {
+				return publisher.numDroppedMessageGroups();
+			}));
+		}
+
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
 			auto config = MessagingConfiguration::LoadFromPath(bootstrapper.resourcesPath());
 			auto pZeroEntityPublisher = std::make_shared<ZeroMqEntityPublisher>(
 					config.SubscriberPort,
+					config.MaxPendingMessageGroups,
 					bootstrapper.pluginManager().createNotificationPublisher());
 
 			// add a dummy service for extending service lifetimes
@@ -44,6 +66,9 @@ namespace catapult { namespace zeromq {
 					"zeromq.publisher",
 					extensions::ServiceRegistrarPhase::Initial));
 
+			// add publisher counters (the zeromq extension is usually hosted by the broker, which does not register services)
+			AddPublisherCounters(bootstrapper.extensionManager(), pZeroEntityPublisher);
+
 			// register subscriptions
 			auto& subscriptionManager = bootstrapper.subscriptionManager();
 			subscriptionManager.addBlockChangeSubscriber(CreateZeroMqBlockChangeSubscriber(*pZeroEntityPublisher));
@@ -35,8 +35,9 @@ namespace catapult { namespace zeromq {
 		MessagingConfiguration config;
 
 		LOAD_PROPERTY(SubscriberPort);
+		LOAD_PROPERTY(MaxPendingMessageGroups);
 
-		utils::VerifyBagSizeExact(bag, 1);
+		utils::VerifyBagSizeExact(bag, 2);
 		return config;
 	}
 
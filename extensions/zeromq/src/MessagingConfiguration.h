@@ -31,6 +31,9 @@ namespace catapult { namespace zeromq {
 		/// Subscriber port.
 		unsigned short SubscriberPort;
 
+		/// Maximum number of transaction message groups that can be pending publishing before new ones are dropped.
+		uint32_t MaxPendingMessageGroups;
+
 	private:
 		MessagingConfiguration() = default;
 
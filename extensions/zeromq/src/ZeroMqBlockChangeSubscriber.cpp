@@ -33,19 +33,18 @@ namespace catapult { namespace zeromq {
 
 		public:
 			void notifyBlock(const model::BlockElement& blockElement) override {
-				// block header
-				m_publisher.publishBlockHeader(blockElement);
-
-				// transactions
-				auto height = blockElement.Block.Height;
-				for (const auto& transactionElement : blockElement.Transactions)
-					m_publisher.publishTransaction(TransactionMarker::Transaction_Marker, transactionElement, height);
+				// block header and transactions
+				m_publisher.publishBlock(blockElement);
 			}
 
 			void notifyDropBlocksAfter(Height height) override {
 				m_publisher.publishDropBlocks(height);
 			}
 
+			void flush() override {
+				// messages are published immediately
+			}
+
 		private:
 			ZeroMqEntityPublisher& m_publisher;
 		};
@@ -26,12 +26,17 @@
 #include "catapult/model/TransactionStatus.h"
 #include "catapult/model/TransactionUtils.h"
 #include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/MemoryUtils.h"
 #include <boost/asio.hpp>
+#include <atomic>
 #include <set>
 
 namespace catapult { namespace zeromq {
 
 	class MessageGroup {
+	public:
+		using Builder = consumer<MessageGroup&>;
+
 	public:
 		explicit MessageGroup(const supplier<std::string>& errorMessageGenerator) : m_errorMessageGenerator(errorMessageGenerator)
 		{}
@@ -41,7 +46,14 @@ namespace catapult { namespace zeromq {
 			m_messages.push_back(std::move(message));
 		}
 
+		void addDeferred(Builder&& builder) {
+			m_builders.push_back(std::move(builder));
+		}
+
 		void flush(zmq::socket_t& zmqSocket) {
+			for (const auto& builder : m_builders)
+				builder(*this);
+
 			bool result = true;
 			for (auto& message : m_messages)
 				result &= message.send(zmqSocket);
@@ -52,13 +64,21 @@ namespace catapult { namespace zeromq {
 
 	private:
 		supplier<std::string> m_errorMessageGenerator;
+		std::vector<Builder> m_builders;
 		std::vector<zmq::multipart_t> m_messages;
 	};
 
+	namespace {
+		enum class QueuePolicy { Always_Queue, Drop_When_Full };
+	}
+
 	class ZeroMqEntityPublisher::SynchronizedPublisher {
 	public:
-		explicit SynchronizedPublisher(unsigned short port)
-				: m_zmqSocket(m_zmqContext, ZMQ_PUB)
+		SynchronizedPublisher(unsigned short port, uint32_t maxPendingMessageGroups)
+				: m_maxPendingMessageGroups(maxPendingMessageGroups)
+				, m_numPendingMessageGroups(0)
+				, m_numDroppedMessageGroups(0)
+				, m_zmqSocket(m_zmqContext, ZMQ_PUB)
 				, m_pPool(thread::CreateIoThreadPool(1, "ZeroMqEntityPublisher")) {
 			// note that we want closing the socket to be synchronous
 			// setting linger to 0 means that all pending messages are discarded and the socket is closed immediately
@@ -75,59 +95,97 @@ namespace catapult { namespace zeromq {
 		}
 
 	public:
-		void queue(std::unique_ptr<MessageGroup>&& pMessageGroup) {
+		size_t numPendingMessageGroups() const {
+			return m_numPendingMessageGroups;
+		}
+
+		uint64_t numDroppedMessageGroups() const {
+			return m_numDroppedMessageGroups;
+		}
+
+	public:
+		void queue(std::unique_ptr<MessageGroup>&& pMessageGroup, QueuePolicy policy) {
+			if (QueuePolicy::Drop_When_Full == policy && m_numPendingMessageGroups >= m_maxPendingMessageGroups) {
+				++m_numDroppedMessageGroups;
+				return;
+			}
+
+			++m_numPendingMessageGroups;
+
 			// dispatch function needs to be copyable
 			auto pMessageGroupShared = std::shared_ptr<MessageGroup>(std::move(pMessageGroup));
-			boost::asio::dispatch(m_pPool->ioContext(), [&zmqSocket = m_zmqSocket, pMessageGroup{std::move(pMessageGroupShared)}]() {
-				pMessageGroup->flush(zmqSocket);
+			boost::asio::dispatch(m_pPool->ioContext(), [this, pMessageGroup{std::move(pMessageGroupShared)}]() {
+				pMessageGroup->flush(m_zmqSocket);
+				--m_numPendingMessageGroups;
 			});
 		}
 
 	private:
+		uint32_t m_maxPendingMessageGroups;
+		std::atomic<size_t> m_numPendingMessageGroups;
+		std::atomic<uint64_t> m_numDroppedMessageGroups;
+
 		zmq::context_t m_zmqContext;
 		zmq::socket_t m_zmqSocket;
 		std::unique_ptr<thread::IoThreadPool> m_pPool;
 	};
 
-	struct ZeroMqEntityPublisher::WeakTransactionInfo {
+	namespace {
+		std::shared_ptr<const model::Transaction> CopyTransaction(const model::Transaction& transaction) {
+			auto pTransactionCopy = utils::MakeSharedWithSize<model::Transaction>(transaction.Size);
+			std::memcpy(static_cast<void*>(pTransactionCopy.get()), &transaction, transaction.Size);
+			return pTransactionCopy;
+		}
+	}
+
+	struct ZeroMqEntityPublisher::SharedTransactionInfo {
 	public:
-		explicit WeakTransactionInfo(const model::TransactionInfo& transactionInfo)
-				: Transaction(*transactionInfo.pEntity)
+		explicit SharedTransactionInfo(const model::TransactionInfo& transactionInfo)
+				: pTransaction(transactionInfo.pEntity)
 				, EntityHash(transactionInfo.EntityHash)
 				, MerkleComponentHash(transactionInfo.MerkleComponentHash)
-				, OptionalAddresses(transactionInfo.OptionalExtractedAddresses.get())
+				, pOptionalAddresses(transactionInfo.OptionalExtractedAddresses)
 		{}
 
-		explicit WeakTransactionInfo(const model::TransactionElement& element)
-				: Transaction(element.Transaction)
+		// transaction elements do not own their transactions, so a copy is required for publishing on another thread
+		explicit SharedTransactionInfo(const model::TransactionElement& element)
+				: pTransaction(CopyTransaction(element.Transaction))
 				, EntityHash(element.EntityHash)
 				, MerkleComponentHash(element.MerkleComponentHash)
-				, OptionalAddresses(element.OptionalExtractedAddresses.get())
+				, pOptionalAddresses(element.OptionalExtractedAddresses)
 		{}
 
-		WeakTransactionInfo(const model::Transaction& transaction, const Hash256& hash)
-				: Transaction(transaction)
+		SharedTransactionInfo(const std::shared_ptr<const model::Transaction>& pSharedTransaction, const Hash256& hash)
+				: pTransaction(pSharedTransaction)
 				, EntityHash(hash)
 				, MerkleComponentHash(hash)
-				, OptionalAddresses(nullptr)
 		{}
 
 	public:
-		const model::Transaction& Transaction;
-		const Hash256& EntityHash;
-		const Hash256& MerkleComponentHash;
-		const model::UnresolvedAddressSet* OptionalAddresses;
+		std::shared_ptr<const model::Transaction> pTransaction;
+		Hash256 EntityHash;
+		Hash256 MerkleComponentHash;
+		std::shared_ptr<const model::UnresolvedAddressSet> pOptionalAddresses;
 	};
 
 	ZeroMqEntityPublisher::ZeroMqEntityPublisher(
 			unsigned short port,
+			uint32_t maxPendingMessageGroups,
 			std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher)
 			: m_pNotificationPublisher(std::move(pNotificationPublisher))
-			, m_pSynchronizedPublisher(std::make_unique<SynchronizedPublisher>(port))
+			, m_pSynchronizedPublisher(std::make_unique<SynchronizedPublisher>(port, maxPendingMessageGroups))
 	{}
 
 	ZeroMqEntityPublisher::~ZeroMqEntityPublisher() = default;
 
+	size_t ZeroMqEntityPublisher::numPendingMessageGroups() const {
+		return m_pSynchronizedPublisher->numPendingMessageGroups();
+	}
+
+	uint64_t ZeroMqEntityPublisher::numDroppedMessageGroups() const {
+		return m_pSynchronizedPublisher->numDroppedMessageGroups();
+	}
+
 	namespace {
 		auto CreateHeightMessageGenerator(const std::string& topicName, Height height) {
 			return [topicName, height]() {
@@ -136,19 +194,94 @@ namespace catapult { namespace zeromq {
 				return out.str();
 			};
 		}
+
+		zmq::multipart_t CreateBlockHeaderMessage(const model::BlockElement& blockElement) {
+			zmq::multipart_t multipart;
+			auto marker = BlockMarker::Block_Marker;
+			multipart.addmem(&marker, sizeof(BlockMarker));
+			multipart.addmem(static_cast<const void*>(&blockElement.Block), sizeof(model::BlockHeader));
+			multipart.addmem(static_cast<const void*>(&blockElement.EntityHash), Hash256::Size);
+			multipart.addmem(static_cast<const void*>(&blockElement.GenerationHash), Hash256::Size);
+			return multipart;
+		}
+
+		void ReleaseSharedTransaction(void*, void* pHint) {
+			delete static_cast<std::shared_ptr<const model::Transaction>*>(pHint);
+		}
+
+		zmq::message_t CreateSharedTransactionMessage(const std::shared_ptr<const model::Transaction>& pTransaction) {
+			// the frame shares ownership of the transaction, which is released by zeromq after the frame has been sent
+			auto pOwner = std::make_unique<std::shared_ptr<const model::Transaction>>(pTransaction);
+			auto* pData = const_cast<model::Transaction*>(pTransaction.get());
+			zmq::message_t message(static_cast<void*>(pData), pTransaction->Size, ReleaseSharedTransaction, pOwner.get());
+			pOwner.release();
+			return message;
+		}
+
+		consumer<zmq::multipart_t&> CreateTransactionPayloadBuilder(
+				const std::shared_ptr<const model::Transaction>& pTransaction,
+				const Hash256& entityHash,
+				const Hash256& merkleComponentHash,
+				Height height) {
+			return [pTransaction, entityHash, merkleComponentHash, height](auto& multipart) {
+				multipart.add(CreateSharedTransactionMessage(pTransaction));
+				multipart.addmem(static_cast<const void*>(&entityHash), Hash256::Size);
+				multipart.addmem(static_cast<const void*>(&merkleComponentHash), Hash256::Size);
+				multipart.addtyp(height);
+			};
+		}
+
+		MessageGroup::Builder CreateTransactionMessagesBuilder(
+				TransactionMarker topicMarker,
+				const std::shared_ptr<const model::Transaction>& pTransaction,
+				const Hash256& hash,
+				const std::shared_ptr<const model::UnresolvedAddressSet>& pOptionalAddresses,
+				const model::NotificationPublisher& notificationPublisher,
+				const consumer<zmq::multipart_t&>& payloadBuilder) {
+			return [topicMarker, pTransaction, hash, pOptionalAddresses, &notificationPublisher, payloadBuilder](auto& messageGroup) {
+				const auto& addresses = pOptionalAddresses
+						? *pOptionalAddresses
+						: model::ExtractAddresses(*pTransaction, notificationPublisher);
+
+				if (addresses.empty())
+					CATAPULT_LOG(warning) << "no addresses are associated with transaction " << hash;
+
+				for (const auto& address : addresses) {
+					zmq::multipart_t multipart;
+					auto topic = CreateTopic(topicMarker, address);
+					multipart.addmem(topic.data(), topic.size());
+					payloadBuilder(multipart);
+					messageGroup.add(std::move(multipart));
+				}
+			};
+		}
+	}
+
+	void ZeroMqEntityPublisher::publishBlock(const model::BlockElement& blockElement) {
+		auto height = blockElement.Block.Height;
+		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHeightMessageGenerator("block", height));
+		pMessageGroup->add(CreateBlockHeaderMessage(blockElement));
+
+		for (const auto& transactionElement : blockElement.Transactions) {
+			SharedTransactionInfo transactionInfo(transactionElement);
+			const auto& pTransaction = transactionInfo.pTransaction;
+			const auto& entityHash = transactionInfo.EntityHash;
+			pMessageGroup->addDeferred(CreateTransactionMessagesBuilder(
+					TransactionMarker::Transaction_Marker,
+					pTransaction,
+					entityHash,
+					transactionInfo.pOptionalAddresses,
+					*m_pNotificationPublisher,
+					CreateTransactionPayloadBuilder(pTransaction, entityHash, transactionInfo.MerkleComponentHash, height)));
+		}
+
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup), QueuePolicy::Always_Queue);
 	}
 
 	void ZeroMqEntityPublisher::publishBlockHeader(const model::BlockElement& blockElement) {
 		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHeightMessageGenerator("block header", blockElement.Block.Height));
-
-		zmq::multipart_t multipart;
-		auto marker = BlockMarker::Block_Marker;
-		multipart.addmem(&marker, sizeof(BlockMarker));
-		multipart.addmem(static_cast<const void*>(&blockElement.Block), sizeof(model::BlockHeader));
-		multipart.addmem(static_cast<const void*>(&blockElement.EntityHash), Hash256::Size);
-		multipart.addmem(static_cast<const void*>(&blockElement.GenerationHash), Hash256::Size);
-		pMessageGroup->add(std::move(multipart));
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+		pMessageGroup->add(CreateBlockHeaderMessage(blockElement));
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup), QueuePolicy::Always_Queue);
 	}
 
 	void ZeroMqEntityPublisher::publishDropBlocks(Height height) {
@@ -159,7 +292,7 @@ namespace catapult { namespace zeromq {
 		multipart.addmem(&marker, sizeof(BlockMarker));
 		multipart.addmem(static_cast<const void*>(&height), sizeof(Height));
 		pMessageGroup->add(std::move(multipart));
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup), QueuePolicy::Always_Queue);
 	}
 
 	void ZeroMqEntityPublisher::publishFinalizedBlock(Height height, const Hash256& hash, FinalizationPoint point) {
@@ -172,7 +305,7 @@ namespace catapult { namespace zeromq {
 		multipart.addmem(static_cast<const void*>(&point), sizeof(FinalizationPoint));
 		multipart.addmem(static_cast<const void*>(&hash), Hash256::Size);
 		pMessageGroup->add(std::move(multipart));
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup), QueuePolicy::Always_Queue);
 	}
 
 	namespace {
@@ -189,40 +322,47 @@ namespace catapult { namespace zeromq {
 			TransactionMarker topicMarker,
 			const model::TransactionElement& transactionElement,
 			Height height) {
-		publishTransaction(topicMarker, WeakTransactionInfo(transactionElement), height);
+		publishTransaction(topicMarker, SharedTransactionInfo(transactionElement), height);
 	}
 
 	void ZeroMqEntityPublisher::publishTransaction(
 			TransactionMarker topicMarker,
 			const model::TransactionInfo& transactionInfo,
 			Height height) {
-		publishTransaction(topicMarker, WeakTransactionInfo(transactionInfo), height);
+		publishTransaction(topicMarker, SharedTransactionInfo(transactionInfo), height);
 	}
 
 	void ZeroMqEntityPublisher::publishTransactionHash(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo) {
-		const auto& hash = transactionInfo.EntityHash;
-		publish("transaction hash", topicMarker, WeakTransactionInfo(transactionInfo), [&hash](auto& multipart) {
+		auto hash = transactionInfo.EntityHash;
+		publish("transaction hash", topicMarker, SharedTransactionInfo(transactionInfo), [hash](auto& multipart) {
 			multipart.addmem(static_cast<const void*>(&hash), Hash256::Size);
 		});
 	}
 
 	void ZeroMqEntityPublisher::publishTransaction(
 			TransactionMarker topicMarker,
-			const WeakTransactionInfo& transactionInfo,
+			SharedTransactionInfo&& transactionInfo,
 			Height height) {
-		publish("transaction", topicMarker, transactionInfo, [&transactionInfo, height](auto& multipart) {
-			const auto& transaction = transactionInfo.Transaction;
-			multipart.addmem(static_cast<const void*>(&transaction), transaction.Size);
-			multipart.addmem(static_cast<const void*>(&transactionInfo.EntityHash), Hash256::Size);
-			multipart.addmem(static_cast<const void*>(&transactionInfo.MerkleComponentHash), Hash256::Size);
-			multipart.addtyp(height);
-		});
+		auto payloadBuilder = CreateTransactionPayloadBuilder(
+				transactionInfo.pTransaction,
+				transactionInfo.EntityHash,
+				transactionInfo.MerkleComponentHash,
+				height);
+		publish("transaction", topicMarker, std::move(transactionInfo), payloadBuilder);
 	}
 
 	void ZeroMqEntityPublisher::publishTransactionStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status) {
+		// transaction is not owned, so a copy is required for publishing on another thread
+		publishTransactionStatus(CopyTransaction(transaction), hash, status);
+	}
+
+	void ZeroMqEntityPublisher::publishTransactionStatus(
+			const std::shared_ptr<const model::Transaction>& pTransaction,
+			const Hash256& hash,
+			uint32_t status) {
 		auto topicMarker = TransactionMarker::Transaction_Status_Marker;
-		model::TransactionStatus transactionStatus(hash, transaction.Deadline, status);
-		publish("transaction status", topicMarker, WeakTransactionInfo(transaction, hash), [&transactionStatus](auto& multipart) {
+		model::TransactionStatus transactionStatus(hash, pTransaction->Deadline, status);
+		publish("transaction status", topicMarker, SharedTransactionInfo(pTransaction, hash), [transactionStatus](auto& multipart) {
 			multipart.addmem(static_cast<const void*>(&transactionStatus), sizeof(model::TransactionStatus));
 		});
 	}
@@ -232,7 +372,8 @@ namespace catapult { namespace zeromq {
 			const model::Cosignature& cosignature) {
 		auto topicMarker = TransactionMarker::Cosignature_Marker;
 		model::DetachedCosignature detachedCosignature(cosignature, parentTransactionInfo.EntityHash);
-		publish("detached cosignature", topicMarker, WeakTransactionInfo(parentTransactionInfo), [&detachedCosignature](auto& multipart) {
+		publish("detached cosignature", topicMarker, SharedTransactionInfo(parentTransactionInfo), [detachedCosignature](
+				auto& multipart) {
 			multipart.addmem(static_cast<const void*>(&detachedCosignature), sizeof(model::DetachedCosignature));
 		});
 	}
@@ -240,25 +381,19 @@ namespace catapult { namespace zeromq {
 	void ZeroMqEntityPublisher::publish(
 			const std::string& topicName,
 			TransactionMarker topicMarker,
-			const WeakTransactionInfo& transactionInfo,
+			SharedTransactionInfo&& transactionInfo,
 			const MessagePayloadBuilder& payloadBuilder) {
 		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHashMessageGenerator(topicName, transactionInfo.EntityHash));
-
-		const auto& addresses = transactionInfo.OptionalAddresses
-				? *transactionInfo.OptionalAddresses
-				: model::ExtractAddresses(transactionInfo.Transaction, *m_pNotificationPublisher);
-
-		if (addresses.empty())
-			CATAPULT_LOG(warning) << "no addresses are associated with transaction " << transactionInfo.EntityHash;
-
-		for (const auto& address : addresses) {
-			zmq::multipart_t multipart;
-			auto topic = CreateTopic(topicMarker, address);
-			multipart.addmem(topic.data(), topic.size());
-			payloadBuilder(multipart);
-			pMessageGroup->add(std::move(multipart));
-		}
-
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+		pMessageGroup->addDeferred(CreateTransactionMessagesBuilder(
+				topicMarker,
+				transactionInfo.pTransaction,
+				transactionInfo.EntityHash,
+				transactionInfo.pOptionalAddresses,
+				*m_pNotificationPublisher,
+				payloadBuilder));
+
+		// only confirmed transactions are always published; all other transaction messages are dropped when publishing falls behind
+		auto policy = TransactionMarker::Transaction_Marker == topicMarker ? QueuePolicy::Always_Queue : QueuePolicy::Drop_When_Full;
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup), policy);
 	}
 }}
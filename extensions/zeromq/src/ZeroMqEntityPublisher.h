@@ -74,14 +74,30 @@ namespace catapult { namespace zeromq {
 	};
 
 	/// Zeromq entity publisher.
+	/// \note Messages are built and sent on a dedicated publishing thread, so address extraction and frame creation do not
+	///       delay the calling thread. Transaction messages that are not part of a block are dropped when too many
+	///       message groups are pending, while block related messages are always queued.
 	class ZeroMqEntityPublisher {
 	public:
-		/// Creates a zeromq entity publisher around \a port and \a pNotificationPublisher.
-		ZeroMqEntityPublisher(unsigned short port, std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher);
+		/// Creates a zeromq entity publisher around \a port, \a maxPendingMessageGroups and \a pNotificationPublisher.
+		ZeroMqEntityPublisher(
+				unsigned short port,
+				uint32_t maxPendingMessageGroups,
+				std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher);
 
 		~ZeroMqEntityPublisher();
 
 	public:
+		/// Gets the number of message groups that are queued but not yet published.
+		size_t numPendingMessageGroups() const;
+
+		/// Gets the number of message groups that were dropped because too many message groups were pending.
+		uint64_t numDroppedMessageGroups() const;
+
+	public:
+		/// Publishes the block header and all transactions in \a blockElement as a single batch.
+		void publishBlock(const model::BlockElement& blockElement);
+
 		/// Publishes the block header in \a blockElement.
 		void publishBlockHeader(const model::BlockElement& blockElement);
 
@@ -103,18 +119,21 @@ namespace catapult { namespace zeromq {
 		/// Publishes a transaction status composed of \a transaction, \a hash and \a status.
 		void publishTransactionStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status);
 
+		/// Publishes a transaction status composed of shared transaction (\a pTransaction), \a hash and \a status.
+		void publishTransactionStatus(const std::shared_ptr<const model::Transaction>& pTransaction, const Hash256& hash, uint32_t status);
+
 		/// Publishes \a cosignature associated with parent transaction info (\a parentTransactionInfo).
 		void publishCosignature(const model::TransactionInfo& parentTransactionInfo, const model::Cosignature& cosignature);
 
 	private:
-		struct WeakTransactionInfo;
+		struct SharedTransactionInfo;
 		using MessagePayloadBuilder = consumer<zmq::multipart_t&>;
 
-		void publishTransaction(TransactionMarker topicMarker, const WeakTransactionInfo& transactionInfo, Height height);
+		void publishTransaction(TransactionMarker topicMarker, SharedTransactionInfo&& transactionInfo, Height height);
 		void publish(
 				const std::string& topicName,
 				TransactionMarker topicMarker,
-				const WeakTransactionInfo& transactionInfo,
+				SharedTransactionInfo&& transactionInfo,
 				const MessagePayloadBuilder& payloadBuilder);
 
 	private:
@@ -36,6 +36,13 @@ namespace catapult { namespace zeromq {
 				m_publisher.publishTransactionStatus(transaction, hash, status);
 			}
 
+			void notifySharedStatus(
+					const std::shared_ptr<const model::Transaction>& pTransaction,
+					const Hash256& hash,
+					uint32_t status) override {
+				m_publisher.publishTransactionStatus(pTransaction, hash, status);
+			}
+
 			void flush() override {
 				// empty since the publisher will flush all pending statuses periodically
 			}
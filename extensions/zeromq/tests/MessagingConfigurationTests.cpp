@@ -35,7 +35,8 @@ namespace catapult { namespace zeromq {
 					{
 						"messaging",
 						{
-							{ "subscriberPort", "9753" }
+							{ "subscriberPort", "9753" },
+							{ "maxPendingMessageGroups", "1234" }
 						}
 					}
 				};
@@ -48,11 +49,13 @@ namespace catapult { namespace zeromq {
 			static void AssertZero(const MessagingConfiguration& config) {
 				// Assert:
 				EXPECT_EQ(0u, config.SubscriberPort);
+				EXPECT_EQ(0u, config.MaxPendingMessageGroups);
 			}
 
 			static void AssertCustom(const MessagingConfiguration& config) {
 				// Assert:
 				EXPECT_EQ(9753u, config.SubscriberPort);
+				EXPECT_EQ(1234u, config.MaxPendingMessageGroups);
 			}
 		};
 	}
@@ -72,6 +75,7 @@ namespace catapult { namespace zeromq {
 
 		// Assert:
 		EXPECT_EQ(7902u, config.SubscriberPort);
+		EXPECT_EQ(10'000u, config.MaxPendingMessageGroups);
 	}
 
 	// endregion
@@ -52,6 +52,16 @@ namespace catapult { namespace zeromq {
 
 		class EntityPublisherContext : public test::MqContext {
 		public:
+			EntityPublisherContext() = default;
+
+			explicit EntityPublisherContext(uint32_t maxPendingMessageGroups) : MqContext(maxPendingMessageGroups)
+			{}
+
+		public:
+			void publishBlock(const model::BlockElement& blockElement) {
+				publisher().publishBlock(blockElement);
+			}
+
 			void publishBlockHeader(const model::BlockElement& blockElement) {
 				publisher().publishBlockHeader(blockElement);
 			}
@@ -102,6 +112,38 @@ namespace catapult { namespace zeromq {
 		context.destroyPublisher();
 	}
 
+	TEST(TEST_CLASS, PublisherCountersAreInitiallyZero) {
+		// Arrange:
+		EntityPublisherContext context;
+
+		// Act + Assert:
+		EXPECT_EQ(0u, context.publisher().numPendingMessageGroups());
+		EXPECT_EQ(0u, context.publisher().numDroppedMessageGroups());
+	}
+
+	// endregion
+
+	// region publishBlock
+
+	TEST(TEST_CLASS, CanPublishBlock) {
+		// Arrange:
+		EntityPublisherContext context;
+		context.subscribe(BlockMarker::Block_Marker);
+
+		auto pBlock = test::GenerateEmptyRandomBlock();
+		auto blockElement = test::BlockToBlockElement(*pBlock);
+
+		// Act:
+		context.publishBlock(blockElement);
+
+		// Assert:
+		zmq::multipart_t message;
+		test::ZmqReceive(message, context.zmqSocket());
+
+		test::AssertBlockHeaderMessage(message, blockElement);
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
 	// endregion
 
 	// region publishBlockHeader
@@ -367,5 +409,61 @@ namespace catapult { namespace zeromq {
 		});
 	}
 
+	// endregion
+	// region queue policy
+
+	TEST(TEST_CLASS, TransactionMessagesAreDroppedWhenTooManyMessageGroupsArePending) {
+		// Arrange: no message groups can be pending
+		EntityPublisherContext context(0);
+		auto transactionInfo = ToTransactionInfo(mocks::CreateMockTransaction(0));
+		auto addresses = test::ExtractAddresses(test::ToMockTransaction(*transactionInfo.pEntity));
+		context.subscribeAll(TransactionMarker::Unconfirmed_Transaction_Add_Marker, addresses);
+
+		// Act:
+		context.publishTransaction(TransactionMarker::Unconfirmed_Transaction_Add_Marker, transactionInfo, Height());
+
+		// Assert:
+		test::AssertNoPendingMessages(context.zmqSocket());
+		EXPECT_EQ(1u, context.publisher().numDroppedMessageGroups());
+	}
+
+	TEST(TEST_CLASS, BlockMessagesAreNotDroppedWhenTooManyMessageGroupsArePending) {
+		// Arrange: no message groups can be pending
+		EntityPublisherContext context(0);
+		context.subscribe(BlockMarker::Block_Marker);
+
+		auto pBlock = test::GenerateEmptyRandomBlock();
+		auto blockElement = test::BlockToBlockElement(*pBlock);
+
+		// Act:
+		context.publishBlock(blockElement);
+
+		// Assert:
+		zmq::multipart_t message;
+		test::ZmqReceive(message, context.zmqSocket());
+
+		test::AssertBlockHeaderMessage(message, blockElement);
+		EXPECT_EQ(0u, context.publisher().numDroppedMessageGroups());
+	}
+
+	TEST(TEST_CLASS, ConfirmedTransactionMessagesAreNotDroppedWhenTooManyMessageGroupsArePending) {
+		// Arrange: no message groups can be pending
+		EntityPublisherContext context(0);
+		auto pTransaction = mocks::CreateMockTransaction(0);
+		auto transactionElement = ToTransactionElement(*pTransaction);
+		auto addresses = test::ExtractAddresses(*pTransaction);
+		context.subscribeAll(TransactionMarker::Transaction_Marker, addresses);
+
+		// Act:
+		context.publishTransaction(TransactionMarker::Transaction_Marker, transactionElement, Height(123));
+
+		// Assert:
+		auto marker = TransactionMarker::Transaction_Marker;
+		test::AssertMessages(context.zmqSocket(), marker, addresses, [&transactionElement](const auto& message, const auto& topic) {
+			test::AssertTransactionElementMessage(message, topic, transactionElement, Height(123));
+		});
+		EXPECT_EQ(0u, context.publisher().numDroppedMessageGroups());
+	}
+
 	// endregion
 }}
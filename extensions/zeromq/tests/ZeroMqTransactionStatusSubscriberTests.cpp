@@ -47,6 +47,10 @@ namespace catapult { namespace zeromq {
 				subscriber().notifyStatus(transaction, hash, status);
 			}
 
+			void notifySharedStatus(const std::shared_ptr<const model::Transaction>& pTransaction, const Hash256& hash, uint32_t status) {
+				subscriber().notifySharedStatus(pTransaction, hash, status);
+			}
+
 			void flush() {
 				subscriber().flush();
 			}
@@ -105,6 +109,25 @@ namespace catapult { namespace zeromq {
 		test::AssertNoPendingMessages(context.zmqSocket());
 	}
 
+	TEST(TEST_CLASS, CanAddSingleSharedTransactionStatus) {
+		// Arrange:
+		MqSubscriberContext context;
+		auto transactionInfos = CreateTransactionInfos(1);
+		auto addresses = test::ExtractAddresses(test::ToMockTransaction(*transactionInfos[0].pEntity));
+		context.subscribeAll(Marker, addresses);
+
+		// Act:
+		context.notifySharedStatus(transactionInfos[0].pEntity, transactionInfos[0].EntityHash, 123);
+
+		// Assert:
+		model::TransactionStatus transactionStatus(transactionInfos[0].EntityHash, transactionInfos[0].pEntity->Deadline, 123);
+		test::AssertMessages(context.zmqSocket(), Marker, addresses, [&transactionStatus](const auto& message, const auto& topic) {
+			test::AssertTransactionStatusMessage(message, topic, transactionStatus);
+		});
+
+		test::AssertNoPendingMessages(context.zmqSocket());
+	}
+
 	// endregion
 
 	// region flush
@@ -121,10 +121,15 @@ namespace catapult { namespace test {
 	class MqContext {
 	public:
 		/// Creates a message queue context.
-		MqContext()
+		MqContext() : MqContext(1'000)
+		{}
+
+		/// Creates a message queue context around \a maxPendingMessageGroups.
+		explicit MqContext(uint32_t maxPendingMessageGroups)
 				: m_registry(mocks::CreateDefaultTransactionRegistry())
 				, m_pZeroMqEntityPublisher(std::make_shared<zeromq::ZeroMqEntityPublisher>(
 						GetDefaultLocalHostZmqPort(),
+						maxPendingMessageGroups,
 						model::CreateNotificationPublisher(m_registry, UnresolvedMosaicId())))
 				, m_zmqSocket(m_zmqContext, ZMQ_SUB) {
 			m_zmqSocket.setsockopt(ZMQ_RCVTIMEO, 10);
@@ -26,6 +26,7 @@
 namespace catapult {
 	namespace cache { class AccountStateCacheDelta; }
 	namespace model { struct BlockChainConfiguration; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace importance {
@@ -41,9 +42,17 @@ namespace catapult { namespace importance {
 		virtual void recalculate(model::ImportanceHeight importanceHeight, cache::AccountStateCacheDelta& cache) const = 0;
 	};
 
-	/// Creates an importance calculator for the block chain described by \a config.
+	/// Creates an importance calculator for the block chain described by \a config that recalculates on the calling thread.
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config);
 
+	/// Creates an importance calculator for the block chain described by \a config that spreads recalculation across
+	/// the worker threads of \a pool, each processing at least \a minAccountsPerThread high value accounts.
+	/// \note Results are identical for all thread counts.
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			thread::IoThreadPool& pool,
+			uint32_t minAccountsPerThread);
+
 	/// Creates a restore importance calculator.
 	std::unique_ptr<ImportanceCalculator> CreateRestoreImportanceCalculator();
 }}
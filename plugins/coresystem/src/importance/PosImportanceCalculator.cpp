@@ -24,6 +24,8 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/HeightGrouping.h"
 #include "catapult/state/AccountImportanceSnapshots.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 #include <boost/multiprecision/cpp_int.hpp>
 #include <memory>
@@ -32,9 +34,77 @@
 namespace catapult { namespace importance {
 
 	namespace {
+		using AccountSummaries = std::vector<AccountSummary>;
+
+		// region PartitionedRunner
+
+		// runs work over contiguous partitions of account summaries, optionally in parallel on a worker pool
+		class PartitionedRunner {
+		public:
+			PartitionedRunner(AccountSummaries& accountSummaries, thread::IoThreadPool* pPool, uint32_t minAccountsPerThread)
+					: m_accountSummaries(accountSummaries)
+					, m_pPool(nullptr)
+					, m_numPartitions(1) {
+				if (!pPool)
+					return;
+
+				auto maxPartitions = accountSummaries.size() / std::max(1u, minAccountsPerThread);
+				m_numPartitions = std::max<size_t>(1, std::min<size_t>(pPool->numWorkerThreads(), maxPartitions));
+				if (m_numPartitions > 1)
+					m_pPool = pPool;
+			}
+
+		public:
+			size_t numPartitions() const {
+				return m_numPartitions;
+			}
+
+		public:
+			// calls \a action with (begin, end, partition index) for each partition
+			// and rethrows the first exception raised by any partition
+			template<typename TAction>
+			void run(TAction action) {
+				if (!m_pPool) {
+					action(m_accountSummaries.begin(), m_accountSummaries.end(), 0);
+					return;
+				}
+
+				std::vector<std::exception_ptr> exceptions(m_numPartitions);
+				thread::ParallelForPartition(m_pPool->ioContext(), m_accountSummaries, m_numPartitions, [action, &exceptions](
+						auto itBegin,
+						auto itEnd,
+						auto,
+						auto partitionIndex) {
+					try {
+						action(itBegin, itEnd, partitionIndex);
+					} catch (...) {
+						exceptions[partitionIndex] = std::current_exception();
+					}
+				}).get();
+
+				for (const auto& pException : exceptions) {
+					if (pException)
+						std::rethrow_exception(pException);
+				}
+			}
+
+		private:
+			AccountSummaries& m_accountSummaries;
+			thread::IoThreadPool* m_pPool;
+			size_t m_numPartitions;
+		};
+
+		// endregion
+
 		class PosImportanceCalculator final : public ImportanceCalculator {
 		public:
-			explicit PosImportanceCalculator(const model::BlockChainConfiguration& config) : m_config(config)
+			PosImportanceCalculator(
+					const model::BlockChainConfiguration& config,
+					thread::IoThreadPool* pPool,
+					uint32_t minAccountsPerThread)
+					: m_config(config)
+					, m_pPool(pPool)
+					, m_minAccountsPerThread(minAccountsPerThread)
 			{}
 
 		public:
@@ -42,46 +112,71 @@ namespace catapult { namespace importance {
 				utils::StackLogger stopwatch("PosImportanceCalculator::recalculate", utils::LogLevel::debug);
 
 				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
+				//    lookups modify the delta, so they are performed sequentially before any parallel work
 				const auto& highValueAccounts = cache.highValueAccounts();
 				const auto& highValueAddresses = highValueAccounts.addresses();
-				std::vector<AccountSummary> accountSummaries;
+				AccountSummaries accountSummaries;
 				accountSummaries.reserve(highValueAddresses.size());
+				for (const auto& address : highValueAddresses)
+					accountSummaries.emplace_back(AccountActivitySummary(), cache.find(address).get());
+
+				// 2. calculate sums (each partition accumulates into its own context, which are reduced in partition order)
+				PartitionedRunner runner(accountSummaries, m_pPool, m_minAccountsPerThread);
+				std::vector<ImportanceCalculationContext> partitionContexts(runner.numPartitions());
+				runner.run([importanceHeight, &partitionContexts, &config = m_config](auto itBegin, auto itEnd, auto partitionIndex) {
+					auto& context = partitionContexts[partitionIndex];
+					auto mosaicId = config.HarvestingMosaicId;
+					for (auto iter = itBegin; itEnd != iter; ++iter) {
+						const auto& accountState = *iter->pAccountState;
+						const auto& activityBuckets = accountState.ActivityBuckets;
+						iter->ActivitySummary = SummarizeAccountActivity(importanceHeight, config.ImportanceGrouping, activityBuckets);
+						context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + accountState.Balances.get(mosaicId);
+						context.TotalBeneficiaryCount += iter->ActivitySummary.BeneficiaryCount;
+						context.TotalFeesPaid = context.TotalFeesPaid + iter->ActivitySummary.TotalFeesPaid;
+					}
+				});
 
-				// 2. calculate sums
-				auto importanceGrouping = m_config.ImportanceGrouping;
 				ImportanceCalculationContext context;
-				auto mosaicId = m_config.HarvestingMosaicId;
-				for (const auto& address : highValueAddresses) {
-					auto accountStateIter = cache.find(address);
-					auto& accountState = accountStateIter.get();
-					const auto& activityBuckets = accountState.ActivityBuckets;
-					auto accountActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
-					accountSummaries.push_back(AccountSummary(accountActivitySummary, accountState));
-					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + accountState.Balances.get(mosaicId);
-					context.TotalBeneficiaryCount += accountActivitySummary.BeneficiaryCount;
-					context.TotalFeesPaid = context.TotalFeesPaid + accountActivitySummary.TotalFeesPaid;
+				for (const auto& partitionContext : partitionContexts) {
+					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + partitionContext.ActiveHarvestingMosaics;
+					context.TotalBeneficiaryCount += partitionContext.TotalBeneficiaryCount;
+					context.TotalFeesPaid = context.TotalFeesPaid + partitionContext.TotalFeesPaid;
 				}
 
 				// 3. calculate importance parts
+				std::vector<Importance> partitionActivityImportances(runner.numPartitions());
+				runner.run([&context, &partitionActivityImportances, &config = m_config](auto itBegin, auto itEnd, auto partitionIndex) {
+					auto& activityImportance = partitionActivityImportances[partitionIndex];
+					for (auto iter = itBegin; itEnd != iter; ++iter) {
+						CalculateImportances(*iter, context, config);
+						activityImportance = activityImportance + iter->ActivityImportance;
+					}
+				});
+
 				Importance totalActivityImportance;
-				for (auto& accountSummary : accountSummaries) {
-					CalculateImportances(accountSummary, context, m_config);
-					totalActivityImportance = totalActivityImportance + accountSummary.ActivityImportance;
-				}
+				for (auto activityImportance : partitionActivityImportances)
+					totalActivityImportance = totalActivityImportance + activityImportance;
 
-				// 4. calculate the final importance
+				// 4. calculate the final importance (each account state is only modified by a single partition)
 				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
-				for (auto& accountSummary : accountSummaries) {
-					auto importance = calculateFinalImportance(accountSummary, totalActivityImportance, targetActivityImportanceRaw);
-					auto& accountState = *accountSummary.pAccountState;
-					FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
-					auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
-							? importance
-							: Importance(std::min(importance.unwrap(), accountSummary.ActivitySummary.PreviousImportance.unwrap()));
-					accountSummary.pAccountState->ImportanceSnapshots.set(effectiveImportance, importanceHeight);
-				}
+				runner.run([this, importanceHeight, totalActivityImportance, targetActivityImportanceRaw](
+						auto itBegin,
+						auto itEnd,
+						auto) {
+					for (auto iter = itBegin; itEnd != iter; ++iter) {
+						auto importance = calculateFinalImportance(*iter, totalActivityImportance, targetActivityImportanceRaw);
+						auto& accountState = *iter->pAccountState;
+						FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
+						auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
+								? importance
+								: Importance(std::min(importance.unwrap(), iter->ActivitySummary.PreviousImportance.unwrap()));
+						accountState.ImportanceSnapshots.set(effectiveImportance, importanceHeight);
+					}
+				});
 
-				CATAPULT_LOG(debug) << "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)";
+				CATAPULT_LOG(debug)
+						<< "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible) using "
+						<< runner.numPartitions() << " partitions";
 
 				// 5. disable collection of activity for the removed accounts
 				const auto& removedHighValueAddresses = highValueAccounts.removedAddresses();
@@ -115,10 +210,19 @@ namespace catapult { namespace importance {
 
 		private:
 			const model::BlockChainConfiguration m_config;
+			thread::IoThreadPool* m_pPool;
+			uint32_t m_minAccountsPerThread;
 		};
 	}
 
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config) {
-		return std::make_unique<PosImportanceCalculator>(config);
+		return std::make_unique<PosImportanceCalculator>(config, nullptr, 0);
+	}
+
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			thread::IoThreadPool& pool,
+			uint32_t minAccountsPerThread) {
+		return std::make_unique<PosImportanceCalculator>(config, &pool, minAccountsPerThread);
 	}
 }}
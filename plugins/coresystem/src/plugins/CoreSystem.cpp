@@ -53,6 +53,25 @@ namespace catapult { namespace plugins {
 			};
 		}
 
+		uint64_t CalculateAverageAccountStateMemorySize(const cache::AccountStateCacheView& view) {
+			// only sample a bounded number of accounts so that the counter stays cheap for large caches
+			constexpr auto Max_Sampled_Accounts = 1000u;
+
+			auto pIterableView = view.tryMakeIterableView();
+			if (!pIterableView)
+				return 0;
+
+			auto numSampledAccounts = 0u;
+			uint64_t totalMemorySize = 0;
+			for (const auto& pair : *pIterableView) {
+				totalMemorySize += state::GetAccountStateMemorySize(pair.second);
+				if (Max_Sampled_Accounts == ++numSampledAccounts)
+					break;
+			}
+
+			return 0 == numSampledAccounts ? 0 : totalMemorySize / numSampledAccounts;
+		}
+
 		void AddAccountStateCache(PluginManager& manager, const model::BlockChainConfiguration& config) {
 			using namespace catapult::cache;
 
@@ -70,6 +89,9 @@ namespace catapult { namespace plugins {
 				counters.emplace_back(utils::DiagnosticCounterId("ACNTST C HVA"), [&cache]() {
 					return cache.sub<AccountStateCache>().createView()->highValueAccounts().addresses().size();
 				});
+				counters.emplace_back(utils::DiagnosticCounterId("ACNTST C MEM"), [&cache]() {
+					return CalculateAverageAccountStateMemorySize(*cache.sub<AccountStateCache>().createView());
+				});
 			});
 		}
 
@@ -188,9 +210,13 @@ namespace catapult { namespace plugins {
 				.add(observers::CreateHighValueAccountObserver(observers::NotifyMode::Commit));
 		});
 
-		manager.addTransientObserverHook([&config](auto& builder) {
+		manager.addTransientObserverHook([&config, &manager](auto& builder) {
+			// only parallelize when each worker thread has enough accounts to amortize the dispatch overhead
+			auto* pWorkerPool = manager.workerPool();
 			auto pRecalculateImportancesObserver = observers::CreateRecalculateImportancesObserver(
-					importance::CreateImportanceCalculator(config),
+					pWorkerPool
+							? importance::CreateImportanceCalculator(config, *pWorkerPool, 16 * 1024)
+							: importance::CreateImportanceCalculator(config),
 					importance::CreateRestoreImportanceCalculator());
 			builder
 				.add(std::move(pRecalculateImportancesObserver))
@@ -24,6 +24,7 @@
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/state/AccountActivityBuckets.h"
 #include "tests/test/cache/AccountStateCacheTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace importance {
@@ -370,6 +371,102 @@ namespace catapult { namespace importance {
 		EXPECT_LT(Importance(), holder.get(Key{ { 2 } }).ImportanceSnapshots.current());
 	}
 
+	// region parallel recalculation
+
+	namespace {
+		std::vector<AccountSeed> CreateRandomAccountSeeds(size_t count, Amount minBalance) {
+			std::vector<AccountSeed> accountSeeds;
+			for (auto i = 0u; i < count; ++i) {
+				auto amount = minBalance + Amount(test::Random() % minBalance.unwrap());
+				std::vector<state::AccountActivityBuckets::ActivityBucket> buckets;
+				for (auto j = 2u; j >= 1; --j) {
+					auto fees = Amount(test::Random() % 10'000);
+					auto beneficiaryCount = static_cast<uint32_t>(test::Random() % 1'000);
+					buckets.push_back(CreateActivityBucket(fees, beneficiaryCount, Recalculation_Height - model::ImportanceHeight(j)));
+				}
+
+				accountSeeds.emplace_back(amount, buckets);
+			}
+
+			return accountSeeds;
+		}
+
+		template<typename TTraits>
+		void AssertRecalculationIsIndependentOfNumberOfWorkerThreads(uint32_t maxWorkerThreads, uint32_t minAccountsPerThread) {
+			// Arrange: seed two caches identically
+			auto config = TTraits::CreateConfiguration();
+			auto accountSeeds = CreateRandomAccountSeeds(200, config.MinHarvesterBalance);
+
+			CacheHolder sequentialHolder(config.MinHarvesterBalance);
+			sequentialHolder.seedDelta(accountSeeds, Recalculation_Height);
+
+			CacheHolder parallelHolder(config.MinHarvesterBalance);
+			parallelHolder.seedDelta(accountSeeds, Recalculation_Height);
+
+			auto pPool = test::CreateStartedIoThreadPool(maxWorkerThreads);
+
+			// Act:
+			RecalculateTwice(*CreateImportanceCalculator(config), Recalculation_Height, sequentialHolder.delta());
+			auto pParallelCalculator = CreateImportanceCalculator(config, *pPool, minAccountsPerThread);
+			RecalculateTwice(*pParallelCalculator, Recalculation_Height, parallelHolder.delta());
+
+			// Assert: all importances and raw scores are bit-exact
+			auto numAccountsWithImportance = 0u;
+			for (uint8_t i = 1; i <= accountSeeds.size(); ++i) {
+				const auto& expectedAccountState = sequentialHolder.get(Key{ { i } });
+				const auto& accountState = parallelHolder.get(Key{ { i } });
+
+				auto expectedImportance = expectedAccountState.ImportanceSnapshots.current();
+				EXPECT_EQ(expectedImportance, accountState.ImportanceSnapshots.current()) << "account " << i;
+				EXPECT_EQ(
+						expectedAccountState.ActivityBuckets.get(Recalculation_Height).RawScore,
+						accountState.ActivityBuckets.get(Recalculation_Height).RawScore) << "account " << i;
+
+				if (Importance() != expectedImportance)
+					++numAccountsWithImportance;
+			}
+
+			// Sanity:
+			EXPECT_EQ(accountSeeds.size(), numAccountsWithImportance);
+		}
+	}
+
+	ACTIVITY_BASED_TEST(RecalculationIsIndependentOfNumberOfWorkerThreads_EvenPartitions) {
+		AssertRecalculationIsIndependentOfNumberOfWorkerThreads<TTraits>(4, 1);
+	}
+
+	ACTIVITY_BASED_TEST(RecalculationIsIndependentOfNumberOfWorkerThreads_UnevenPartitions) {
+		AssertRecalculationIsIndependentOfNumberOfWorkerThreads<TTraits>(7, 1);
+	}
+
+	ACTIVITY_BASED_TEST(RecalculationIsIndependentOfNumberOfWorkerThreads_MinAccountsPerThread) {
+		// Assert: 200 accounts with at least 80 accounts per thread are split into two partitions
+		AssertRecalculationIsIndependentOfNumberOfWorkerThreads<TTraits>(4, 80);
+	}
+
+	ACTIVITY_BASED_TEST(RecalculationIsIndependentOfNumberOfWorkerThreads_TooFewAccountsPerThread) {
+		// Assert: 200 accounts with at least 1000 accounts per thread are processed sequentially
+		AssertRecalculationIsIndependentOfNumberOfWorkerThreads<TTraits>(4, 1000);
+	}
+
+	ACTIVITY_BASED_TEST(RecalculationPropagatesPartitionErrors) {
+		// Arrange: add an account with a bucket that is newer than the recalculation height
+		auto config = TTraits::CreateConfiguration();
+		auto accountSeeds = CreateRandomAccountSeeds(20, config.MinHarvesterBalance);
+		accountSeeds[13].Buckets.push_back(CreateActivityBucket(Amount(), 0, Recalculation_Height + model::ImportanceHeight(1)));
+
+		CacheHolder holder(config.MinHarvesterBalance);
+		holder.seedDelta(accountSeeds, Recalculation_Height);
+
+		auto pPool = test::CreateStartedIoThreadPool(4);
+		auto pCalculator = CreateImportanceCalculator(config, *pPool, 1);
+
+		// Act + Assert:
+		EXPECT_THROW(Recalculate(*pCalculator, Recalculation_Height, holder.delta()), catapult_invalid_argument);
+	}
+
+	// endregion
+
 	// region pure pos
 
 	TEST(TEST_CLASS, PosGivesAccountsImportanceProportionalToBalance) {
@@ -56,7 +56,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "ACNTST C", "ACNTST C HVA", "BLKDIF C" };
+				return { "ACNTST C", "ACNTST C HVA", "ACNTST C MEM", "BLKDIF C" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
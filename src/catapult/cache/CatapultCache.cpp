@@ -23,6 +23,7 @@
 #include "CatapultCacheDetachedDelta.h"
 #include "ReadOnlyCatapultCache.h"
 #include "SubCachePluginAdapter.h"
+#include "SynchronizedCache.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkIdentifier.h"
@@ -316,6 +317,21 @@ namespace catapult { namespace cache {
 		cacheHeightModifier.set(height);
 	}
 
+	CacheLockWaitStatistics CatapultCache::lockWaitStatistics() const {
+		CacheLockWaitStatistics aggregateStatistics{};
+		for (const auto& pSubCache : m_subCaches) {
+			if (!pSubCache)
+				continue;
+
+			auto statistics = pSubCache->lockWaitStatistics();
+			aggregateStatistics.ReaderWaitMicros += statistics.ReaderWaitMicros;
+			aggregateStatistics.WriterWaitMicros += statistics.WriterWaitMicros;
+			aggregateStatistics.MaxWriterWaitMicros = std::max(aggregateStatistics.MaxWriterWaitMicros, statistics.MaxWriterWaitMicros);
+		}
+
+		return aggregateStatistics;
+	}
+
 	std::vector<std::unique_ptr<const CacheStorage>> CatapultCache::storages() const {
 		return MapSubCaches<const CacheStorage>(
 				m_subCaches,
@@ -30,6 +30,7 @@ namespace catapult {
 		class CacheHeight;
 		class CacheStorage;
 		class SubCachePlugin;
+		struct CacheLockWaitStatistics;
 	}
 	namespace model { struct BlockChainConfiguration; }
 }
@@ -72,6 +73,10 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
 		void commit(Height height);
 
+		/// Gets the lock wait statistics aggregated across all sub caches.
+		/// \note Maximum writer wait is the maximum of all sub cache maximums.
+		CacheLockWaitStatistics lockWaitStatistics() const;
+
 	public:
 		/// Gets the (const) cache storages for all sub caches.
 		std::vector<std::unique_ptr<const CacheStorage>> storages() const;
@@ -29,6 +29,7 @@ namespace catapult {
 		class CacheChangesStorage;
 		class CacheStorage;
 		class CatapultCache;
+		struct CacheLockWaitStatistics;
 	}
 }
 
@@ -141,6 +142,9 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage.
 		virtual void commit() = 0;
 
+		/// Gets the lock wait statistics of this cache.
+		virtual CacheLockWaitStatistics lockWaitStatistics() const = 0;
+
 	public:
 		/// Gets a const pointer to the underlying cache.
 		virtual const void* get() const = 0;
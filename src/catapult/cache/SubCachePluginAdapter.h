@@ -22,6 +22,7 @@
 #include "CacheChangesStorageAdapter.h"
 #include "CacheStorageAdapter.h"
 #include "SubCachePlugin.h"
+#include "SynchronizedCache.h"
 #include <memory>
 #include <sstream>
 
@@ -70,6 +71,10 @@ namespace catapult { namespace cache {
 			m_pCache->commit();
 		}
 
+		CacheLockWaitStatistics lockWaitStatistics() const override {
+			return m_pCache->lockWaitStatistics();
+		}
+
 	public:
 		const void* get() const override {
 			return m_pCache.get();
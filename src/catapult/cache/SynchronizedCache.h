@@ -21,11 +21,85 @@
 #pragma once
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/StackTimer.h"
 #include <boost/optional.hpp>
+#include <atomic>
 
 namespace catapult { namespace cache {
 
+	// region CacheLockWaitStatistics
+
+	/// Cumulative cache lock wait statistics.
+	/// \note Views and deltas still hold the (single) reader lock of a cache, so commits wait for all outstanding readers.
+	///       These statistics only measure that contention and do not change it.
+	struct CacheLockWaitStatistics {
+		/// Total time spent waiting for reader locks (in microseconds).
+		uint64_t ReaderWaitMicros;
+
+		/// Total time spent waiting for writer locks (in microseconds).
+		uint64_t WriterWaitMicros;
+
+		/// Maximum time spent waiting for a single writer lock (in microseconds).
+		uint64_t MaxWriterWaitMicros;
+	};
+
+	// endregion
+
 	namespace detail {
+		// region CacheLockWaitTracker
+
+		/// Acquires cache locks and tracks the time spent waiting for them.
+		class CacheLockWaitTracker {
+		public:
+			/// Creates a tracker.
+			CacheLockWaitTracker()
+					: m_readerWaitMicros(0)
+					, m_writerWaitMicros(0)
+					, m_maxWriterWaitMicros(0)
+			{}
+
+		public:
+			/// Gets the lock wait statistics.
+			CacheLockWaitStatistics statistics() const {
+				return { m_readerWaitMicros, m_writerWaitMicros, m_maxWriterWaitMicros };
+			}
+
+		public:
+			/// Blocks until a reader lock can be acquired on \a lock.
+			/// \note Only acquisitions that (might) wait for a pending writer are timed.
+			utils::SpinReaderWriterLock::ReaderLockGuard acquireReader(utils::SpinReaderWriterLock& lock) {
+				if (!lock.isWriterPending())
+					return lock.acquireReader();
+
+				utils::StackTimer stopwatch;
+				auto readLock = lock.acquireReader();
+				m_readerWaitMicros += stopwatch.micros();
+				return readLock;
+			}
+
+			/// Blocks until \a readLock can be promoted to a writer lock.
+			/// \note This is always timed because it is only called once per (infrequent) commit.
+			utils::SpinReaderWriterLock::WriterLockGuard promoteToWriter(utils::SpinReaderWriterLock::ReaderLockGuard& readLock) {
+				utils::StackTimer stopwatch;
+				auto writeLock = readLock.promoteToWriter();
+				auto waitMicros = stopwatch.micros();
+				m_writerWaitMicros += waitMicros;
+
+				// only the (single) committer promotes, so there is no contention on the maximum
+				if (m_maxWriterWaitMicros < waitMicros)
+					m_maxWriterWaitMicros = waitMicros;
+
+				return writeLock;
+			}
+
+		private:
+			std::atomic<uint64_t> m_readerWaitMicros;
+			std::atomic<uint64_t> m_writerWaitMicros;
+			std::atomic<uint64_t> m_maxWriterWaitMicros;
+		};
+
+		// endregion
+
 		// region CacheViewReadLockPair
 
 		/// Cache-view, read-lock pair.
@@ -169,18 +243,24 @@ namespace catapult { namespace cache {
 	public:
 		/// Creates a lockable cache delta around \a cacheDelta using the specified \a lock
 		/// and commit counter (\a commitCounter).
-		LockableCacheDelta(TCacheDelta&& cacheDelta, const size_t& commitCounter, utils::SpinReaderWriterLock& lock)
+		/// Lock waits are recorded in \a lockWaitTracker.
+		LockableCacheDelta(
+				TCacheDelta&& cacheDelta,
+				const size_t& commitCounter,
+				utils::SpinReaderWriterLock& lock,
+				detail::CacheLockWaitTracker& lockWaitTracker)
 				: m_cacheDelta(std::move(cacheDelta))
 				, m_initialCommitCount(commitCounter)
 				, m_commitCounter(commitCounter)
 				, m_lock(lock)
+				, m_lockWaitTracker(lockWaitTracker)
 		{}
 
 	public:
 		/// Locks the cache delta.
 		/// \note Returns a falsy structure if the lockable delta is no longer valid.
 		OptionalLockedCacheDelta<TCacheDelta> tryLock() {
-			auto readLock = m_lock.acquireReader();
+			auto readLock = m_lockWaitTracker.acquireReader(m_lock);
 			return m_initialCommitCount != m_commitCounter
 					? OptionalLockedCacheDelta<TCacheDelta>()
 					: OptionalLockedCacheDelta<TCacheDelta>(m_cacheDelta, std::move(readLock));
@@ -191,6 +271,7 @@ namespace catapult { namespace cache {
 		size_t m_initialCommitCount;
 		const size_t& m_commitCounter;
 		utils::SpinReaderWriterLock& m_lock;
+		detail::CacheLockWaitTracker& m_lockWaitTracker;
 	};
 
 	// endregion
@@ -213,17 +294,23 @@ namespace catapult { namespace cache {
 				, m_commitCounter(0)
 		{}
 
+	public:
+		/// Gets the lock wait statistics of this cache.
+		CacheLockWaitStatistics lockWaitStatistics() const {
+			return m_lockWaitTracker.statistics();
+		}
+
 	public:
 		/// Gets a locked cache view based on this cache.
 		LockedCacheView<CacheViewType> createView() const {
-			auto readLock = m_lock.acquireReader();
+			auto readLock = m_lockWaitTracker.acquireReader(m_lock);
 			return LockedCacheView<CacheViewType>(m_cache.createView(), std::move(readLock));
 		}
 
 		/// Gets a locked cache delta based on this cache.
 		/// \note Changes to an attached delta can be committed by calling commit.
 		LockedCacheDelta<CacheDeltaType> createDelta() {
-			auto readLock = m_lock.acquireReader();
+			auto readLock = m_lockWaitTracker.acquireReader(m_lock);
 
 			// notice that this is not a foolproof check since multiple threads could create multiple deltas at the same time
 			// but it is good enough as a sanity check
@@ -239,9 +326,9 @@ namespace catapult { namespace cache {
 		/// Gets a lockable cache delta based on this cache but without the ability
 		/// to commit any changes to the original cache.
 		LockableCacheDelta<CacheDeltaType> createDetachedDelta() const {
-			auto readLock = m_lock.acquireReader();
+			auto readLock = m_lockWaitTracker.acquireReader(m_lock);
 			auto delta = m_cache.createDetachedDelta();
-			return LockableCacheDelta<CacheDeltaType>(std::move(delta), m_commitCounter, m_lock);
+			return LockableCacheDelta<CacheDeltaType>(std::move(delta), m_commitCounter, m_lock, m_lockWaitTracker);
 		}
 
 		/// Commits all pending changes to the underlying storage.
@@ -250,7 +337,7 @@ namespace catapult { namespace cache {
 			if (!pDeltaPair)
 				CATAPULT_THROW_RUNTIME_ERROR("attempting to commit changes to a cache without any outstanding attached deltas");
 
-			auto writeLock = pDeltaPair->ReadLock.promoteToWriter();
+			auto writeLock = m_lockWaitTracker.promoteToWriter(pDeltaPair->ReadLock);
 			m_cache.commit(pDeltaPair->CacheView);
 			++m_commitCounter;
 		}
@@ -266,6 +353,7 @@ namespace catapult { namespace cache {
 		size_t m_commitCounter;
 		std::weak_ptr<detail::CacheViewReadLockPair<CacheDeltaType>> m_pWeakDeltaPair;
 		mutable utils::SpinReaderWriterLock m_lock;
+		mutable detail::CacheLockWaitTracker m_lockWaitTracker;
 	};
 
 	// endregion
@@ -56,6 +56,7 @@ namespace catapult { namespace cache {
 			, m_options(options)
 			, m_pKeyLookupAdapter(std::move(pKeyLookupAdapter))
 			, m_highValueAccountsUpdater(m_options, highValueAccounts)
+			, m_nextHighValueAccountsGenerationId(0)
 	{}
 
 	model::NetworkIdentifier BasicAccountStateCacheDelta::networkIdentifier() const {
@@ -165,11 +166,21 @@ namespace catapult { namespace cache {
 	}
 
 	void BasicAccountStateCacheDelta::updateHighValueAccounts(Height height) {
+		// only process accounts that have been modified since the last update because unmodified accounts cannot change
+		const auto& stateByAddress = *m_pStateByAddress;
+		auto isModified = [&stateByAddress, minGenerationId = m_nextHighValueAccountsGenerationId](const auto& address) {
+			return minGenerationId <= stateByAddress.generationId(address);
+		};
+
 		m_highValueAccountsUpdater.setHeight(height);
-		m_highValueAccountsUpdater.update(m_pStateByAddress->deltas());
+		m_highValueAccountsUpdater.update(m_pStateByAddress->deltas(), isModified);
+
+		m_pStateByAddress->incrementGenerationId();
+		m_nextHighValueAccountsGenerationId = m_pStateByAddress->generationId();
 	}
 
 	HighValueAccounts BasicAccountStateCacheDelta::detachHighValueAccounts() {
+		m_nextHighValueAccountsGenerationId = 0;
 		return m_highValueAccountsUpdater.detachAccounts();
 	}
 
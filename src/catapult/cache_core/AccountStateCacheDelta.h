@@ -182,6 +182,7 @@ namespace catapult { namespace cache {
 		const AccountStateCacheTypes::Options& m_options;
 		std::unique_ptr<AccountStateCacheDeltaMixins::KeyLookupAdapter> m_pKeyLookupAdapter;
 		HighValueAccountsUpdater m_highValueAccountsUpdater;
+		uint32_t m_nextHighValueAccountsGenerationId;
 
 		QueuedRemovalSet<Address> m_queuedRemoveByAddress;
 		QueuedRemovalSet<Key> m_queuedRemoveByPublicKey;
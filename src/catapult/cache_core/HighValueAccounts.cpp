@@ -20,30 +20,39 @@
 
 #include "HighValueAccounts.h"
 #include "catapult/utils/ContainerHelpers.h"
+#include <algorithm>
 
 namespace catapult { namespace cache {
 
 	// region HighValueAccounts
 
 	HighValueAccounts::HighValueAccounts()
+			: HighValueAccounts(model::AddressSet(), AddressAccountHistoryMap())
 	{}
 
 	HighValueAccounts::HighValueAccounts(const model::AddressSet& addresses, const AddressAccountHistoryMap& accountHistories)
-			: m_addresses(addresses)
-			, m_accountHistories(accountHistories)
+			: m_pAddresses(std::make_shared<const model::AddressSet>(addresses))
+			, m_pAccountHistories(std::make_shared<const AddressAccountHistoryMap>(accountHistories))
 	{}
 
 	HighValueAccounts::HighValueAccounts(model::AddressSet&& addresses, AddressAccountHistoryMap&& accountHistories)
-			: m_addresses(std::move(addresses))
-			, m_accountHistories(std::move(accountHistories))
+			: m_pAddresses(std::make_shared<const model::AddressSet>(std::move(addresses)))
+			, m_pAccountHistories(std::make_shared<const AddressAccountHistoryMap>(std::move(accountHistories)))
+	{}
+
+	HighValueAccounts::HighValueAccounts(
+			const std::shared_ptr<const model::AddressSet>& pAddresses,
+			const std::shared_ptr<const AddressAccountHistoryMap>& pAccountHistories)
+			: m_pAddresses(pAddresses)
+			, m_pAccountHistories(pAccountHistories)
 	{}
 
 	const model::AddressSet& HighValueAccounts::addresses() const {
-		return m_addresses;
+		return *m_pAddresses;
 	}
 
 	const AddressAccountHistoryMap& HighValueAccounts::accountHistories() const {
-		return m_accountHistories;
+		return *m_pAccountHistories;
 	}
 
 	// endregion
@@ -57,39 +66,47 @@ namespace catapult { namespace cache {
 
 		public:
 			HighValueAddressesUpdater(
-					const model::AddressSet& originalAddresses,
-					model::AddressSet& currentAddresses,
-					model::AddressSet& removedAddresses)
-					: m_original(originalAddresses)
-					, m_current(currentAddresses)
+					detail::CopyOnWriteContainer<model::AddressSet>& addresses,
+					model::AddressSet& removedAddresses,
+					const predicate<const Address&>& isModified)
+					: m_addresses(addresses)
 					, m_removed(removedAddresses)
+					, m_isModified(isModified)
 			{}
 
 		public:
 			void update(const MemorySetType& source, const predicate<const state::AccountState&>& include) {
-				for (const auto& pair : source)
-					updateOne(pair.second.Address, include(pair.second));
+				for (const auto& pair : source) {
+					if (m_isModified(pair.first))
+						updateOne(pair.second.Address, include(pair.second));
+				}
 			}
 
 		private:
 			void updateOne(const Address& address, bool shouldInclude) {
+				// only modify current addresses when necessary in order to avoid copying them
+				const auto& currentAddresses = m_addresses.get();
+				auto isIncluded = currentAddresses.cend() != currentAddresses.find(address);
 				if (shouldInclude) {
-					m_current.insert(address);
+					if (!isIncluded)
+						m_addresses.modify().insert(address);
 
 					// needed for multiblock syncs when original account is removed and then readded
 					m_removed.erase(address);
 				} else {
-					m_current.erase(address);
+					if (isIncluded)
+						m_addresses.modify().erase(address);
 
-					if (m_original.cend() != m_original.find(address))
+					const auto& originalAddresses = m_addresses.original();
+					if (originalAddresses.cend() != originalAddresses.find(address))
 						m_removed.insert(address);
 				}
 			}
 
 		private:
-			const model::AddressSet& m_original;
-			model::AddressSet& m_current;
+			detail::CopyOnWriteContainer<model::AddressSet>& m_addresses;
 			model::AddressSet& m_removed;
+			const predicate<const Address&>& m_isModified;
 		};
 	}
 
@@ -105,42 +122,54 @@ namespace catapult { namespace cache {
 			using MemorySetType = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::SetType::MemorySetType;
 
 		public:
-			HighValueBalancesUpdater(AddressAccountHistoryMap& accountHistories, Height height)
+			HighValueBalancesUpdater(
+					detail::CopyOnWriteContainer<AddressAccountHistoryMap>& accountHistories,
+					Height height,
+					const predicate<const Address&>& isModified)
 					: m_accountHistories(accountHistories)
 					, m_height(height)
+					, m_isModified(isModified)
 			{}
 
 		public:
 			void update(const MemorySetType& source, const EffectiveBalanceCalculator& effectiveBalanceCalculator) {
-				for (const auto& pair : source)
-					updateOne(pair.second, effectiveBalanceCalculator(pair.second));
+				for (const auto& pair : source) {
+					if (m_isModified(pair.first))
+						updateOne(pair.second, effectiveBalanceCalculator(pair.second));
+				}
 			}
 
 			void prune(Amount minBalance) {
-				utils::map_erase_if(m_accountHistories, [minBalance](const auto& pair) {
+				auto isPrunable = [minBalance](const auto& pair) {
 					return !pair.second.anyAtLeast(minBalance);
-				});
+				};
+
+				// only modify account histories when necessary in order to avoid copying them
+				const auto& accountHistories = m_accountHistories.get();
+				if (std::any_of(accountHistories.cbegin(), accountHistories.cend(), isPrunable))
+					utils::map_erase_if(m_accountHistories.modify(), isPrunable);
 			}
 
 		private:
 			void updateOne(const state::AccountState& accountState, const std::pair<Amount, bool>& effectiveBalancePair) {
-				auto accountHistoriesIter = m_accountHistories.find(accountState.Address);
+				// if this account is neither tracked nor has a newly high balance, there is nothing to update
+				const auto& accountHistories = m_accountHistories.get();
+				if (accountHistories.cend() == accountHistories.find(accountState.Address) && !effectiveBalancePair.second)
+					return;
 
 				// if this account has a newly high balance, start tracking it
-				if (m_accountHistories.cend() == accountHistoriesIter && effectiveBalancePair.second)
-					accountHistoriesIter = m_accountHistories.emplace(accountState.Address, state::AccountHistory()).first;
-
-				// if this account is tracked, add tracked values
-				if (m_accountHistories.cend() != accountHistoriesIter) {
-					accountHistoriesIter->second.add(m_height, effectiveBalancePair.first);
-					accountHistoriesIter->second.add(m_height, accountState.SupplementalPublicKeys.vrf().get());
-					accountHistoriesIter->second.add(m_height, accountState.SupplementalPublicKeys.voting().getAll());
-				}
+				auto& accountHistory = m_accountHistories.modify()[accountState.Address];
+
+				// add tracked values
+				accountHistory.add(m_height, effectiveBalancePair.first);
+				accountHistory.add(m_height, accountState.SupplementalPublicKeys.vrf().get());
+				accountHistory.add(m_height, accountState.SupplementalPublicKeys.voting().getAll());
 			}
 
 		private:
-			AddressAccountHistoryMap& m_accountHistories;
+			detail::CopyOnWriteContainer<AddressAccountHistoryMap>& m_accountHistories;
 			Height m_height;
+			const predicate<const Address&>& m_isModified;
 		};
 	}
 
@@ -150,9 +179,8 @@ namespace catapult { namespace cache {
 
 	HighValueAccountsUpdater::HighValueAccountsUpdater(const AccountStateCacheTypes::Options& options, const HighValueAccounts& accounts)
 			: m_options(options)
-			, m_original(accounts.addresses())
-			, m_current(accounts.addresses())
-			, m_accountHistories(accounts.accountHistories())
+			, m_addresses(accounts.m_pAddresses)
+			, m_accountHistories(accounts.m_pAccountHistories)
 			, m_height(Height(1))
 	{}
 
@@ -161,7 +189,7 @@ namespace catapult { namespace cache {
 	}
 
 	const model::AddressSet& HighValueAccountsUpdater::addresses() const {
-		return m_current;
+		return m_addresses.get();
 	}
 
 	const model::AddressSet& HighValueAccountsUpdater::removedAddresses() const {
@@ -169,7 +197,7 @@ namespace catapult { namespace cache {
 	}
 
 	const AddressAccountHistoryMap& HighValueAccountsUpdater::accountHistories() const {
-		return m_accountHistories;
+		return m_accountHistories.get();
 	}
 
 	void HighValueAccountsUpdater::setHeight(Height height) {
@@ -177,24 +205,37 @@ namespace catapult { namespace cache {
 	}
 
 	void HighValueAccountsUpdater::update(const deltaset::DeltaElements<MemorySetType>& deltas) {
-		updateHarvestingAccounts(deltas);
-		updateVotingAccounts(deltas);
+		update(deltas, [](const auto&) { return true; });
+	}
+
+	void HighValueAccountsUpdater::update(
+			const deltaset::DeltaElements<MemorySetType>& deltas,
+			const predicate<const Address&>& isModified) {
+		updateHarvestingAccounts(deltas, isModified);
+		updateVotingAccounts(deltas, isModified);
 	}
 
 	void HighValueAccountsUpdater::prune(Height height) {
-		utils::map_erase_if(m_accountHistories, [height, minBalance = m_options.MinVoterBalance](auto& pair) {
+		auto minBalance = m_options.MinVoterBalance;
+		auto isModifiedByPrune = [height, minBalance](const auto& pair) {
+			// a history that is not prunable at height is unchanged by pruning, so it can be checked before pruning
+			return pair.second.isPrunable(height) || !pair.second.anyAtLeast(minBalance);
+		};
+
+		// only modify account histories when necessary in order to avoid copying them
+		const auto& accountHistories = m_accountHistories.get();
+		if (std::none_of(accountHistories.cbegin(), accountHistories.cend(), isModifiedByPrune))
+			return;
+
+		utils::map_erase_if(m_accountHistories.modify(), [height, minBalance](auto& pair) {
 			pair.second.prune(height);
 			return !pair.second.anyAtLeast(minBalance);
 		});
 	}
 
 	HighValueAccounts HighValueAccountsUpdater::detachAccounts() {
-		auto accounts = HighValueAccounts(std::move(m_current), std::move(m_accountHistories));
-
-		m_current.clear();
+		auto accounts = HighValueAccounts(m_addresses.detach(), m_accountHistories.detach());
 		m_removed.clear();
-		m_accountHistories.clear();
-
 		return accounts;
 	}
 
@@ -208,18 +249,22 @@ namespace catapult { namespace cache {
 		}
 	}
 
-	void HighValueAccountsUpdater::updateHarvestingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas) {
+	void HighValueAccountsUpdater::updateHarvestingAccounts(
+			const deltaset::DeltaElements<MemorySetType>& deltas,
+			const predicate<const Address&>& isModified) {
 		auto hasHighValue = [&options = m_options](const auto& accountState) {
 			return EffectiveBalanceRetriever(accountState, options.HarvestingMosaicId, options.MinHarvesterBalance).second;
 		};
 
-		HighValueAddressesUpdater updater(m_original, m_current, m_removed);
+		HighValueAddressesUpdater updater(m_addresses, m_removed, isModified);
 		updater.update(deltas.Added, hasHighValue);
 		updater.update(deltas.Copied, hasHighValue);
 		updater.update(deltas.Removed, [](const auto&) { return false; });
 	}
 
-	void HighValueAccountsUpdater::updateVotingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas) {
+	void HighValueAccountsUpdater::updateVotingAccounts(
+			const deltaset::DeltaElements<MemorySetType>& deltas,
+			const predicate<const Address&>& isModified) {
 		auto effectiveBalanceCalculator = [&options = m_options](const auto& accountState) {
 			if (0 != accountState.SupplementalPublicKeys.voting().size()) {
 				auto balancePair = EffectiveBalanceRetriever(accountState, options.HarvestingMosaicId, options.MinVoterBalance);
@@ -230,7 +275,7 @@ namespace catapult { namespace cache {
 			return std::make_pair(Amount(), false);
 		};
 
-		HighValueBalancesUpdater updater(m_accountHistories, m_height);
+		HighValueBalancesUpdater updater(m_accountHistories, m_height, isModified);
 		updater.update(deltas.Added, effectiveBalanceCalculator);
 		updater.update(deltas.Copied, effectiveBalanceCalculator);
 		updater.update(deltas.Removed, [](const auto&) { return std::make_pair(Amount(), false); });
@@ -22,6 +22,8 @@
 #include "AccountStateCacheTypes.h"
 #include "catapult/model/ContainerTypes.h"
 #include "catapult/state/AccountHistory.h"
+#include "catapult/functions.h"
+#include <memory>
 
 namespace catapult { namespace cache {
 
@@ -48,10 +50,64 @@ namespace catapult { namespace cache {
 		const AddressAccountHistoryMap& accountHistories() const;
 
 	private:
-		model::AddressSet m_addresses;
-		AddressAccountHistoryMap m_accountHistories;
+		HighValueAccounts(
+				const std::shared_ptr<const model::AddressSet>& pAddresses,
+				const std::shared_ptr<const AddressAccountHistoryMap>& pAccountHistories);
+
+	private:
+		// containers are immutable and shared with updaters until they are modified
+		std::shared_ptr<const model::AddressSet> m_pAddresses;
+		std::shared_ptr<const AddressAccountHistoryMap> m_pAccountHistories;
+
+	private:
+		friend class HighValueAccountsUpdater;
 	};
 
+	namespace detail {
+		/// Container that shares an immutable original until it is first modified.
+		template<typename TContainer>
+		class CopyOnWriteContainer {
+		public:
+			/// Creates a container around \a pOriginal.
+			explicit CopyOnWriteContainer(const std::shared_ptr<const TContainer>& pOriginal) : m_pOriginal(pOriginal)
+			{}
+
+		public:
+			/// Gets the original container.
+			const TContainer& original() const {
+				return *m_pOriginal;
+			}
+
+			/// Gets the current container.
+			const TContainer& get() const {
+				return m_pCopy ? *m_pCopy : *m_pOriginal;
+			}
+
+			/// Gets the current container for modification, copying the original container on first access.
+			TContainer& modify() {
+				if (!m_pCopy)
+					m_pCopy = std::make_shared<TContainer>(*m_pOriginal);
+
+				return *m_pCopy;
+			}
+
+			/// Detaches the current container and resets this container to empty.
+			std::shared_ptr<const TContainer> detach() {
+				std::shared_ptr<const TContainer> pContainer = m_pOriginal;
+				if (m_pCopy)
+					pContainer = std::move(m_pCopy);
+
+				m_pOriginal = std::make_shared<const TContainer>();
+				m_pCopy.reset();
+				return pContainer;
+			}
+
+		private:
+			std::shared_ptr<const TContainer> m_pOriginal;
+			std::shared_ptr<TContainer> m_pCopy;
+		};
+	}
+
 	/// High value accounts updater.
 	class HighValueAccountsUpdater {
 	private:
@@ -81,6 +137,10 @@ namespace catapult { namespace cache {
 		/// Updates high value accounts based on changes described in \a deltas.
 		void update(const deltaset::DeltaElements<MemorySetType>& deltas);
 
+		/// Updates high value accounts based on changes described in \a deltas for addresses accepted by \a isModified.
+		/// \note This allows changes that were already processed by a previous update to be skipped.
+		void update(const deltaset::DeltaElements<MemorySetType>& deltas, const predicate<const Address&>& isModified);
+
 		/// Prunes all balances less than \a height.
 		void prune(Height height);
 
@@ -89,15 +149,18 @@ namespace catapult { namespace cache {
 		HighValueAccounts detachAccounts();
 
 	private:
-		void updateHarvestingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas);
-		void updateVotingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas);
+		void updateHarvestingAccounts(
+				const deltaset::DeltaElements<MemorySetType>& deltas,
+				const predicate<const Address&>& isModified);
+		void updateVotingAccounts(
+				const deltaset::DeltaElements<MemorySetType>& deltas,
+				const predicate<const Address&>& isModified);
 
 	private:
 		AccountStateCacheTypes::Options m_options;
-		const model::AddressSet& m_original;
-		model::AddressSet m_current;
+		detail::CopyOnWriteContainer<model::AddressSet> m_addresses;
 		model::AddressSet m_removed;
-		AddressAccountHistoryMap m_accountHistories;
+		detail::CopyOnWriteContainer<AddressAccountHistoryMap> m_accountHistories;
 		Height m_height;
 	};
 }}
@@ -45,6 +45,13 @@ namespace catapult { namespace cache {
 		elements.setSize(size);
 	}
 
+	/// Applies all changes in \a deltas to \a elements.
+	/// \note Elements are serialized into storage, so there is no benefit to moving them.
+	template<typename TKeyTraits, typename TDescriptor, typename TContainer, typename TMemorySet>
+	void UpdateSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const deltaset::MovableDeltaElements<TMemorySet>& deltas) {
+		UpdateSet<TKeyTraits>(elements, static_cast<deltaset::DeltaElements<TMemorySet>>(deltas));
+	}
+
 	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
 	template<typename TDescriptor, typename TContainer, typename TPruningBoundary>
 	void PruneBaseSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const TPruningBoundary& pruningBoundary) {
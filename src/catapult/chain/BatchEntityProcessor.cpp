@@ -22,12 +22,43 @@
 #include "ProcessContextsBuilder.h"
 #include "ProcessingNotificationSubscriber.h"
 #include "catapult/cache/CatapultCache.h"
+#include <chrono>
 
 using namespace catapult::validators;
 
 namespace catapult { namespace chain {
 
 	namespace {
+		class BlockProfilingScope {
+		private:
+			using Clock = std::chrono::steady_clock;
+
+		public:
+			BlockProfilingScope(model::ExecutionProfiler* pProfiler, Height height)
+					: m_pProfiler(pProfiler)
+					, m_height(height) {
+				if (!m_pProfiler)
+					return;
+
+				m_pProfiler->startBlock();
+				m_start = Clock::now();
+			}
+
+			~BlockProfilingScope() {
+				if (!m_pProfiler)
+					return;
+
+				auto elapsedDuration = Clock::now() - m_start;
+				auto elapsedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsedDuration).count();
+				m_pProfiler->completeBlock(m_height, static_cast<uint64_t>(elapsedNanoseconds));
+			}
+
+		private:
+			model::ExecutionProfiler* m_pProfiler;
+			Height m_height;
+			Clock::time_point m_start;
+		};
+
 		class DefaultBatchEntityProcessor {
 		public:
 			explicit DefaultBatchEntityProcessor(const ExecutionConfiguration& config) : m_config(config)
@@ -42,6 +73,7 @@ namespace catapult { namespace chain {
 				if (entityInfos.empty())
 					return ValidationResult::Neutral;
 
+				BlockProfilingScope profilingScope(m_config.pExecutionProfiler.get(), height);
 				ProcessContextsBuilder contextBuilder(height, timestamp, m_config);
 				contextBuilder.setObserverState(state); // this uses contents of ObserverState to initialize the builder
 				auto validatorContext = contextBuilder.buildValidatorContext();
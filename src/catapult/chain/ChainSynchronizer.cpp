@@ -22,8 +22,11 @@
 #include "CompareChains.h"
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/SpinLock.h"
+#include <algorithm>
+#include <map>
 #include <queue>
 
 namespace catapult { namespace chain {
@@ -45,6 +48,7 @@ namespace catapult { namespace chain {
 					: m_blockRangeConsumer(blockRangeConsumer)
 					, m_maxSize(maxSize)
 					, m_numBytes(0)
+					, m_numAbortedElements(0)
 					, m_hasPendingSync(false)
 					, m_dirty(false)
 			{}
@@ -59,6 +63,16 @@ namespace catapult { namespace chain {
 				return m_numBytes;
 			}
 
+			size_t numAbortedElements() {
+				utils::SpinLockGuard guard(m_spinLock);
+				return m_numAbortedElements;
+			}
+
+			bool canAcceptRange() {
+				utils::SpinLockGuard guard(m_spinLock);
+				return m_numBytes < m_maxSize && !m_dirty;
+			}
+
 			bool shouldStartSync() {
 				utils::SpinLockGuard guard(m_spinLock);
 				if (m_numBytes >= m_maxSize || m_hasPendingSync || m_dirty)
@@ -105,6 +119,9 @@ namespace catapult { namespace chain {
 
 				m_numBytes -= info.NumBytes;
 				m_elements.pop();
+				if (disruptor::CompletionStatus::Aborted == status)
+					++m_numAbortedElements;
+
 				m_dirty = hasPendingOperation() && disruptor::CompletionStatus::Normal != status;
 			}
 
@@ -127,6 +144,7 @@ namespace catapult { namespace chain {
 			std::queue<ElementInfo> m_elements;
 			size_t m_maxSize;
 			size_t m_numBytes;
+			size_t m_numAbortedElements;
 			bool m_hasPendingSync;
 			bool m_dirty;
 		};
@@ -149,7 +167,10 @@ namespace catapult { namespace chain {
 			}
 
 			auto merge() {
-				return model::AnnotatedBlockRange(model::BlockRange::MergeRanges(std::move(m_ranges)), m_sourceIdentity);
+				auto mergedRange = model::BlockRange::MergeRanges(std::move(m_ranges));
+				m_ranges.clear();
+				m_numBlocks = 0;
+				return model::AnnotatedBlockRange(std::move(mergedRange), m_sourceIdentity);
 			}
 
 			auto empty() {
@@ -168,6 +189,303 @@ namespace catapult { namespace chain {
 
 		// endregion
 
+		// region ChainBlocksFromState
+
+		using BlocksFromFutureSupplier = std::function<thread::future<model::BlockRange>(Height, const api::BlocksFromOptions&)>;
+
+		class ChainBlocksFromState {
+		public:
+			ChainBlocksFromState(
+					const BlocksFromFutureSupplier& futureSupplier,
+					const api::BlocksFromOptions& attemptOptions,
+					uint32_t maxChunkBytes,
+					uint64_t forkDepth,
+					const model::NodeIdentity& sourceIdentity)
+					: m_futureSupplier(futureSupplier)
+					, m_attemptOptions(attemptOptions)
+					, m_maxChunkBytes(maxChunkBytes)
+					, m_forkDepth(forkDepth)
+					, m_rangeAggregator(sourceIdentity)
+					, m_numReceivedBlocks(0)
+					, m_numReceivedBytes(0)
+					, m_hasForwardedRange(false)
+			{}
+
+		public:
+			auto& rangeAggregator() {
+				return m_rangeAggregator;
+			}
+
+			bool hasForwardedRange() const {
+				return m_hasForwardedRange;
+			}
+
+		public:
+			thread::future<model::BlockRange> requestBlocks(Height height) const {
+				if (!isStreaming())
+					return m_futureSupplier(height, m_attemptOptions);
+
+				// only limit the number of blocks by the remaining attempt budget after the fork has been covered
+				auto numBlocks = m_hasForwardedRange
+						? static_cast<uint32_t>(m_attemptOptions.NumBlocks - m_numReceivedBlocks)
+						: m_attemptOptions.NumBlocks;
+				return m_futureSupplier(height, api::BlocksFromOptions(numBlocks, m_maxChunkBytes));
+			}
+
+			void add(model::BlockRange&& range) {
+				m_numReceivedBlocks += range.size();
+				m_numReceivedBytes += range.totalSize();
+				m_rangeAggregator.add(std::move(range));
+			}
+
+			bool shouldForward() const {
+				// after the first (fork covering) range has been forwarded, every subsequent chunk extends it
+				return m_hasForwardedRange || m_forkDepth <= m_rangeAggregator.numBlocks();
+			}
+
+			void markForwarded() {
+				m_hasForwardedRange = true;
+			}
+
+			bool shouldRequestMore() const {
+				return isStreaming()
+						&& m_numReceivedBlocks < m_attemptOptions.NumBlocks
+						&& m_numReceivedBytes < m_attemptOptions.NumBytes;
+			}
+
+		private:
+			bool isStreaming() const {
+				return 0 != m_maxChunkBytes;
+			}
+
+		private:
+			BlocksFromFutureSupplier m_futureSupplier;
+			api::BlocksFromOptions m_attemptOptions;
+			uint32_t m_maxChunkBytes;
+			uint64_t m_forkDepth;
+			RangeAggregator m_rangeAggregator;
+			uint64_t m_numReceivedBlocks;
+			uint64_t m_numReceivedBytes;
+			bool m_hasForwardedRange;
+		};
+
+		// endregion
+
+		// region ParallelRanges
+
+		// maximum number of consecutive empty or failed pulls before a parallel sync session is stopped
+		constexpr size_t Max_Failed_Parallel_Pulls = 4;
+
+		struct ParallelRangeClaim {
+			uint64_t SessionId;
+			Height StartHeight;
+			Height EndHeight;
+		};
+
+		struct PulledRange {
+			model::AnnotatedBlockRange Range;
+			Hash256 PreviousBlockHash;
+			Hash256 LastBlockHash;
+		};
+
+		class ParallelRanges {
+		private:
+			struct RangeState {
+				Height EndHeight;
+				size_t NumPendingPulls;
+				std::unique_ptr<PulledRange> pPulledRange;
+			};
+
+		public:
+			ParallelRanges(UnprocessedElements& unprocessedElements, uint32_t maxParallelRanges, uint32_t maxBlocksPerRange)
+					: m_unprocessedElements(unprocessedElements)
+					, m_maxParallelRanges(maxParallelRanges)
+					, m_maxBlocksPerRange(maxBlocksPerRange)
+					, m_numPendingPulls(0)
+					, m_sessionId(0)
+					, m_isActive(false)
+					, m_numFailedPulls(0)
+					, m_numAbortedElements(0)
+			{}
+
+		public:
+			bool isActive() {
+				utils::SpinLockGuard guard(m_spinLock);
+				return m_isActive;
+			}
+
+			bool canActivate(Height startHeight, Height finalizedHeight) {
+				utils::SpinLockGuard guard(m_spinLock);
+				return canActivateUnlocked(startHeight, finalizedHeight);
+			}
+
+			bool tryActivate(Height startHeight, Height finalizedHeight) {
+				utils::SpinLockGuard guard(m_spinLock);
+				if (!canActivateUnlocked(startHeight, finalizedHeight))
+					return false;
+
+				CATAPULT_LOG(info) << "starting parallel sync from height " << startHeight << " to finalized height " << finalizedHeight;
+				++m_sessionId;
+				m_isActive = true;
+				m_nextHeight = startHeight;
+				m_finalizedHeight = finalizedHeight;
+				m_lastForwardedBlockHash = Hash256();
+				m_numFailedPulls = 0;
+				m_numAbortedElements = m_unprocessedElements.numAbortedElements();
+				return true;
+			}
+
+			bool tryClaim(ParallelRangeClaim& claim) {
+				utils::SpinLockGuard guard(m_spinLock);
+				if (!m_isActive || m_numPendingPulls >= m_maxParallelRanges || !m_unprocessedElements.canAcceptRange())
+					return false;
+
+				if (hasAbortedElements()) {
+					deactivate("disruptor aborted a range");
+					return false;
+				}
+
+				auto iter = findNextClaimableRange();
+				if (m_ranges.end() == iter)
+					return false;
+
+				++iter->second.NumPendingPulls;
+				++m_numPendingPulls;
+				claim = { m_sessionId, iter->first, iter->second.EndHeight };
+				return true;
+			}
+
+			void release(const ParallelRangeClaim& claim) {
+				utils::SpinLockGuard guard(m_spinLock);
+				if (m_ranges.end() == markPullCompleted(claim))
+					return;
+
+				// fall back to regular sync when remotes are repeatedly unable to deliver ranges below the finalized height
+				if (++m_numFailedPulls >= Max_Failed_Parallel_Pulls)
+					deactivate("too many parallel pulls failed");
+			}
+
+			ionet::NodeInteractionResultCode complete(const ParallelRangeClaim& claim, std::unique_ptr<PulledRange>&& pPulledRange) {
+				utils::SpinLockGuard guard(m_spinLock);
+				auto iter = markPullCompleted(claim);
+
+				// a range that was already pulled from a faster remote is discarded
+				if (m_ranges.end() == iter || iter->second.pPulledRange)
+					return ionet::NodeInteractionResultCode::Neutral;
+
+				auto& rangeState = iter->second;
+				auto pulledEndHeight = (--pPulledRange->Range.Range.cend())->Height;
+				if (pulledEndHeight < rangeState.EndHeight) {
+					// remote returned a partial range, so the remainder needs to be pulled separately
+					m_ranges.emplace(pulledEndHeight + Height(1), RangeState{ rangeState.EndHeight, 0, nullptr });
+					rangeState.EndHeight = pulledEndHeight;
+				}
+
+				rangeState.pPulledRange = std::move(pPulledRange);
+				m_numFailedPulls = 0;
+				return claim.StartHeight == forwardOrderedRanges()
+						? ionet::NodeInteractionResultCode::Failure
+						: ionet::NodeInteractionResultCode::Success;
+			}
+
+		private:
+			bool canActivateUnlocked(Height startHeight, Height finalizedHeight) const {
+				// only sync in parallel when the finalized part of the remote chain spans more than a single range
+				return 0 != m_maxParallelRanges && !m_isActive && finalizedHeight >= startHeight + Height(m_maxBlocksPerRange);
+			}
+
+			std::map<Height, RangeState>::iterator findNextClaimableRange() {
+				// prefer ranges that were released by failed or partial pulls
+				auto iter = std::find_if(m_ranges.begin(), m_ranges.end(), [](const auto& pair) {
+					return !pair.second.pPulledRange && 0 == pair.second.NumPendingPulls;
+				});
+				if (m_ranges.end() != iter)
+					return iter;
+
+				if (m_nextHeight <= m_finalizedHeight && m_ranges.size() < 2 * m_maxParallelRanges) {
+					auto endHeight = std::min(m_finalizedHeight, m_nextHeight + Height(m_maxBlocksPerRange - 1));
+					iter = m_ranges.emplace(m_nextHeight, RangeState{ endHeight, 0, nullptr }).first;
+					m_nextHeight = endHeight + Height(1);
+					return iter;
+				}
+
+				// re-request the oldest range from another remote when it is blocking forwarding so that a slow remote can't stall sync
+				iter = m_ranges.begin();
+				return m_ranges.end() != iter && !iter->second.pPulledRange && 1 == iter->second.NumPendingPulls ? iter : m_ranges.end();
+			}
+
+			std::map<Height, RangeState>::iterator markPullCompleted(const ParallelRangeClaim& claim) {
+				--m_numPendingPulls;
+				if (!m_isActive || claim.SessionId != m_sessionId)
+					return m_ranges.end();
+
+				auto iter = m_ranges.find(claim.StartHeight);
+				if (m_ranges.end() != iter && 0 != iter->second.NumPendingPulls)
+					--iter->second.NumPendingPulls;
+
+				return iter;
+			}
+
+			// returns the start height of a pulled range that stopped the session because it does not link to the last forwarded block
+			Height forwardOrderedRanges() {
+				while (!m_ranges.empty() && m_ranges.cbegin()->second.pPulledRange) {
+					auto iter = m_ranges.begin();
+					auto& pulledRange = *iter->second.pPulledRange;
+					if (Hash256() != m_lastForwardedBlockHash && m_lastForwardedBlockHash != pulledRange.PreviousBlockHash) {
+						// remotes disagree about the finalized chain, so let regular sync resolve it
+						auto startHeight = iter->first;
+						CATAPULT_LOG(warning) << "range at height " << startHeight << " does not link to previous range";
+						deactivate("pulled ranges do not link");
+						return startHeight;
+					}
+
+					auto lastBlockHash = pulledRange.LastBlockHash;
+					if (hasAbortedElements() || !m_unprocessedElements.add(std::move(pulledRange.Range))) {
+						deactivate("disruptor did not accept range");
+						return Height();
+					}
+
+					m_lastForwardedBlockHash = lastBlockHash;
+					m_ranges.erase(iter);
+				}
+
+				if (m_ranges.empty() && m_nextHeight > m_finalizedHeight) {
+					CATAPULT_LOG(info) << "completed parallel sync to finalized height " << m_finalizedHeight;
+					m_isActive = false;
+				}
+
+				return Height();
+			}
+
+			bool hasAbortedElements() {
+				return m_numAbortedElements != m_unprocessedElements.numAbortedElements();
+			}
+
+			void deactivate(const char* reason) {
+				CATAPULT_LOG(warning) << "stopping parallel sync at height " << m_nextHeight << ": " << reason;
+				m_isActive = false;
+				m_ranges.clear();
+			}
+
+		private:
+			UnprocessedElements& m_unprocessedElements;
+			uint32_t m_maxParallelRanges;
+			uint32_t m_maxBlocksPerRange;
+
+			utils::SpinLock m_spinLock;
+			size_t m_numPendingPulls;
+			uint64_t m_sessionId;
+			bool m_isActive;
+			size_t m_numFailedPulls;
+			Height m_nextHeight;
+			Height m_finalizedHeight;
+			Hash256 m_lastForwardedBlockHash;
+			size_t m_numAbortedElements;
+			std::map<Height, RangeState> m_ranges;
+		};
+
+		// endregion
+
 		// region interaction and future utils
 
 		ionet::NodeInteractionResultCode ToNodeInteractionResultCode(ChainComparisonCode code) {
@@ -177,38 +495,42 @@ namespace catapult { namespace chain {
 					: ionet::NodeInteractionResultCode::Neutral;
 		}
 
-		auto CreateFutureSupplier(const api::RemoteChainApi& remoteChainApi, const api::BlocksFromOptions& options) {
-			return [&remoteChainApi, options](auto height) {
+		auto CreateFutureSupplier(const api::RemoteChainApi& remoteChainApi) {
+			return [&remoteChainApi](auto height, const auto& options) {
 				return remoteChainApi.blocksFrom(height, options);
 			};
 		}
 
-		NodeInteractionFuture CompleteChainBlocksFrom(RangeAggregator& rangeAggregator, UnprocessedElements& unprocessedElements) {
-			if (rangeAggregator.empty())
-				return thread::make_ready_future(ionet::NodeInteractionResultCode::Neutral);
+		ionet::NodeInteractionResultCode ToNodeInteractionResultCode(const ChainBlocksFromState& state) {
+			return state.hasForwardedRange() ? ionet::NodeInteractionResultCode::Success : ionet::NodeInteractionResultCode::Neutral;
+		}
 
-			auto mergedRange = rangeAggregator.merge();
-			auto addResult = unprocessedElements.add(std::move(mergedRange))
-					? ionet::NodeInteractionResultCode::Success
-					: ionet::NodeInteractionResultCode::Neutral;
-			return thread::make_ready_future(std::move(addResult));
+		bool ForwardAggregatedRange(ChainBlocksFromState& state, UnprocessedElements& unprocessedElements) {
+			auto& rangeAggregator = state.rangeAggregator();
+			if (rangeAggregator.empty() || !unprocessedElements.add(rangeAggregator.merge()))
+				return false;
+
+			state.markForwarded();
+			return true;
+		}
+
+		NodeInteractionFuture CompleteChainBlocksFrom(ChainBlocksFromState& state, UnprocessedElements& unprocessedElements) {
+			ForwardAggregatedRange(state, unprocessedElements);
+			return thread::make_ready_future(ToNodeInteractionResultCode(state));
 		}
 
 		NodeInteractionFuture ChainBlocksFrom(
-				const std::function<thread::future<model::BlockRange>(Height)>& futureSupplier,
+				const std::shared_ptr<ChainBlocksFromState>& pState,
 				Height height,
-				uint64_t forkDepth,
-				const std::shared_ptr<RangeAggregator>& pRangeAggregator,
 				UnprocessedElements& unprocessedElements) {
-			return thread::compose(futureSupplier(height), [futureSupplier, forkDepth, pRangeAggregator, &unprocessedElements](
-					auto&& blocksFuture) {
+			return thread::compose(pState->requestBlocks(height), [pState, &unprocessedElements](auto&& blocksFuture) {
 				try {
 					auto range = blocksFuture.get();
 
 					// if the range is empty, stop processing
 					if (range.empty()) {
 						CATAPULT_LOG(info) << "peer returned 0 blocks";
-						return CompleteChainBlocksFrom(*pRangeAggregator, unprocessedElements);
+						return CompleteChainBlocksFrom(*pState, unprocessedElements);
 					}
 
 					// if the range is not empty, continue processing
@@ -217,12 +539,15 @@ namespace catapult { namespace chain {
 							<< "peer returned " << range.size()
 							<< " blocks (heights " << range.cbegin()->Height << " - " << endHeight << ")";
 
-					pRangeAggregator->add(std::move(range));
-					if (forkDepth <= pRangeAggregator->numBlocks())
-						return CompleteChainBlocksFrom(*pRangeAggregator, unprocessedElements);
+					pState->add(std::move(range));
+					if (pState->shouldForward()) {
+						// stop streaming when the disruptor did not accept the range (e.g. a previous chunk failed processing)
+						if (!ForwardAggregatedRange(*pState, unprocessedElements) || !pState->shouldRequestMore())
+							return thread::make_ready_future(ToNodeInteractionResultCode(*pState));
+					}
 
 					auto nextHeight = endHeight + Height(1);
-					return ChainBlocksFrom(futureSupplier, nextHeight, forkDepth, pRangeAggregator, unprocessedElements);
+					return ChainBlocksFrom(pState, nextHeight, unprocessedElements);
 				} catch (const catapult_runtime_error& e) {
 					CATAPULT_LOG(warning) << "exception thrown while requesting blocks: " << e.what();
 					return thread::make_ready_future(ionet::NodeInteractionResultCode::Failure);
@@ -230,6 +555,66 @@ namespace catapult { namespace chain {
 			});
 		}
 
+		std::unique_ptr<PulledRange> CreatePulledRange(
+				const ParallelRangeClaim& claim,
+				model::BlockRange&& range,
+				const model::NodeIdentity& sourceIdentity) {
+			if (range.size() > (claim.EndHeight - claim.StartHeight).unwrap() + 1)
+				return nullptr;
+
+			auto pPulledRange = std::make_unique<PulledRange>();
+			pPulledRange->PreviousBlockHash = range.cbegin()->PreviousBlockHash;
+
+			// blocks must be ordered and each block must link to its predecessor
+			auto expectedHeight = claim.StartHeight;
+			for (const auto& block : range) {
+				if (expectedHeight != block.Height)
+					return nullptr;
+
+				if (claim.StartHeight != expectedHeight && pPulledRange->LastBlockHash != block.PreviousBlockHash)
+					return nullptr;
+
+				pPulledRange->LastBlockHash = model::CalculateHash(block);
+				expectedHeight = expectedHeight + Height(1);
+			}
+
+			pPulledRange->Range = model::AnnotatedBlockRange(std::move(range), sourceIdentity);
+			return pPulledRange;
+		}
+
+		NodeInteractionFuture PullParallelRange(
+				ParallelRanges& parallelRanges,
+				const ParallelRangeClaim& claim,
+				const api::RemoteChainApi& remoteChainApi,
+				uint32_t maxBytes) {
+			CATAPULT_LOG(debug) << "pulling parallel range from remote (heights " << claim.StartHeight << " - " << claim.EndHeight << ")";
+			auto numBlocks = static_cast<uint32_t>((claim.EndHeight - claim.StartHeight).unwrap() + 1);
+			auto blocksFuture = remoteChainApi.blocksFrom(claim.StartHeight, api::BlocksFromOptions(numBlocks, maxBytes));
+			return blocksFuture.then([&parallelRanges, claim, sourceIdentity = remoteChainApi.remoteIdentity()](auto&& future) {
+				try {
+					auto range = future.get();
+					if (range.empty()) {
+						CATAPULT_LOG(info) << "peer returned 0 blocks for parallel range at height " << claim.StartHeight;
+						parallelRanges.release(claim);
+						return ionet::NodeInteractionResultCode::Neutral;
+					}
+
+					auto pPulledRange = CreatePulledRange(claim, std::move(range), sourceIdentity);
+					if (!pPulledRange) {
+						CATAPULT_LOG(warning) << "peer returned unexpected blocks for parallel range at height " << claim.StartHeight;
+						parallelRanges.release(claim);
+						return ionet::NodeInteractionResultCode::Failure;
+					}
+
+					return parallelRanges.complete(claim, std::move(pPulledRange));
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while requesting parallel range: " << e.what();
+					parallelRanges.release(claim);
+					return ionet::NodeInteractionResultCode::Failure;
+				}
+			});
+		}
+
 		// endregion
 
 		// region DefaultChainSynchronizer
@@ -243,17 +628,31 @@ namespace catapult { namespace chain {
 					const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 					const ChainSynchronizerConfiguration& config,
 					const supplier<Height>& localFinalizedHeightSupplier,
+					const RemoteFinalizedHeightVerifier& remoteFinalizedHeightVerifier,
 					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
 					: m_pLocalChainApi(pLocalChainApi)
 					, m_compareChainOptions{ config.MaxHashesPerSyncAttempt, localFinalizedHeightSupplier }
+					, m_remoteFinalizedHeightVerifier(remoteFinalizedHeightVerifier)
 					, m_blocksFromOptions(config.MaxBlocksPerSyncAttempt, config.MaxChainBytesPerSyncAttempt)
+					, m_maxChunkBytes(config.MaxChainBytesPerSyncChunk)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
 							3 * config.MaxChainBytesPerSyncAttempt))
+					, m_maxParallelRanges(config.MaxParallelSyncRanges)
+					, m_parallelRanges(*m_pUnprocessedElements, config.MaxParallelSyncRanges, config.MaxBlocksPerSyncAttempt)
 			{}
 
 		public:
+			size_t parallelism() {
+				// each concurrent call claims a different range, so only regular sync is limited to a single remote
+				return m_parallelRanges.isActive() ? m_maxParallelRanges : 1;
+			}
+
 			NodeInteractionFuture operator()(const RemoteApiType& remoteChainApi) {
+				// while a parallel sync session is active, every remote is asked for a different range
+				if (m_parallelRanges.isActive())
+					return pullParallelRange(remoteChainApi);
+
 				if (!m_pUnprocessedElements->shouldStartSync())
 					return thread::make_ready_future(ionet::NodeInteractionResultCode::Neutral);
 
@@ -284,10 +683,11 @@ namespace catapult { namespace chain {
 				result.Code = ChainComparisonCode::Remote_Is_Not_Synced;
 				result.CommonBlockHeight = m_pUnprocessedElements->maxHeight();
 				result.ForkDepth = 0;
+				result.RemoteFinalizedHeight = Height();
 				return thread::make_ready_future(std::move(result));
 			}
 
-			NodeInteractionFuture syncWithPeer(const RemoteApiType& remoteChainApi, const CompareChainsResult& compareResult) const {
+			NodeInteractionFuture syncWithPeer(const RemoteApiType& remoteChainApi, const CompareChainsResult& compareResult) {
 				switch (compareResult.Code) {
 				case ChainComparisonCode::Remote_Is_Not_Synced:
 					break;
@@ -300,22 +700,67 @@ namespace catapult { namespace chain {
 					return thread::make_ready_future(std::move(code));
 				}
 
+				// blocks below the remote finalized height can't be rolled back, so they can be pulled from multiple remotes at once
+				auto startHeight = compareResult.CommonBlockHeight + Height(1);
+				if (0 == compareResult.ForkDepth && m_parallelRanges.canActivate(startHeight, compareResult.RemoteFinalizedHeight))
+					return verifyAndSyncWithPeer(remoteChainApi, compareResult);
+
+				return pullBlocks(remoteChainApi, compareResult);
+			}
+
+			NodeInteractionFuture verifyAndSyncWithPeer(const RemoteApiType& remoteChainApi, const CompareChainsResult& compareResult) {
+				// the remote finalized height anchors the parallel sync session, so it must be backed by a valid finalization proof
+				auto finalizedHeight = compareResult.RemoteFinalizedHeight;
+				auto verifyFuture = m_remoteFinalizedHeightVerifier(remoteChainApi, finalizedHeight);
+				return thread::compose(std::move(verifyFuture), [this, &remoteChainApi, compareResult](auto&& isVerifiedFuture) {
+					try {
+						if (!isVerifiedFuture.get()) {
+							CATAPULT_LOG(debug) << "unable to verify remote finalized height " << compareResult.RemoteFinalizedHeight;
+							return this->pullBlocks(remoteChainApi, compareResult);
+						}
+					} catch (const catapult_runtime_error& e) {
+						CATAPULT_LOG(warning) << "exception thrown while verifying remote finalized height: " << e.what();
+						return thread::make_ready_future(ionet::NodeInteractionResultCode::Failure);
+					}
+
+					auto startHeight = compareResult.CommonBlockHeight + Height(1);
+					if (this->m_parallelRanges.tryActivate(startHeight, compareResult.RemoteFinalizedHeight))
+						return this->pullParallelRange(remoteChainApi);
+
+					return this->pullBlocks(remoteChainApi, compareResult);
+				});
+			}
+
+			NodeInteractionFuture pullBlocks(const RemoteApiType& remoteChainApi, const CompareChainsResult& compareResult) {
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
 						<< " (fork depth = " << compareResult.ForkDepth << ")";
-				return ChainBlocksFrom(
-						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
-						compareResult.CommonBlockHeight + Height(1),
+				auto pState = std::make_shared<ChainBlocksFromState>(
+						CreateFutureSupplier(remoteChainApi),
+						m_blocksFromOptions,
+						m_maxChunkBytes,
 						compareResult.ForkDepth,
-						std::make_shared<RangeAggregator>(remoteChainApi.remoteIdentity()),
-						*m_pUnprocessedElements);
+						remoteChainApi.remoteIdentity());
+				return ChainBlocksFrom(pState, compareResult.CommonBlockHeight + Height(1), *m_pUnprocessedElements);
+			}
+
+			NodeInteractionFuture pullParallelRange(const RemoteApiType& remoteChainApi) {
+				ParallelRangeClaim claim;
+				if (!m_parallelRanges.tryClaim(claim))
+					return thread::make_ready_future(ionet::NodeInteractionResultCode::Neutral);
+
+				return PullParallelRange(m_parallelRanges, claim, remoteChainApi, m_blocksFromOptions.NumBytes);
 			}
 
 		private:
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
 			CompareChainsOptions m_compareChainOptions;
+			RemoteFinalizedHeightVerifier m_remoteFinalizedHeightVerifier;
 			api::BlocksFromOptions m_blocksFromOptions;
+			uint32_t m_maxChunkBytes;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
+			uint32_t m_maxParallelRanges;
+			ParallelRanges m_parallelRanges;
 		};
 
 		// endregion
@@ -325,12 +770,28 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const supplier<Height>& localFinalizedHeightSupplier,
+			const RemoteFinalizedHeightVerifier& remoteFinalizedHeightVerifier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
+		return CreateParallelChainSynchronizer(
+				pLocalChainApi,
+				config,
+				localFinalizedHeightSupplier,
+				remoteFinalizedHeightVerifier,
+				blockRangeConsumer).Synchronizer;
+	}
+
+	ParallelRemoteNodeSynchronizer<api::RemoteChainApi> CreateParallelChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const supplier<Height>& localFinalizedHeightSupplier,
+			const RemoteFinalizedHeightVerifier& remoteFinalizedHeightVerifier,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
 		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(
 				pLocalChainApi,
 				config,
 				localFinalizedHeightSupplier,
+				remoteFinalizedHeightVerifier,
 				blockRangeConsumer);
-		return CreateRemoteNodeSynchronizer(pSynchronizer);
+		return { CreateRemoteNodeSynchronizer(pSynchronizer), [pSynchronizer]() { return pSynchronizer->parallelism(); } };
 	}
 }}
@@ -42,6 +42,10 @@ namespace catapult { namespace chain {
 			model::AnnotatedBlockRange&&,
 			const disruptor::ProcessingCompleteFunc&)>;
 
+	/// Function signature for verifying a finalization proof for a height reported as finalized by a remote.
+	/// \note The returned future resolves to \c true only when a valid finalization proof at the height was obtained.
+	using RemoteFinalizedHeightVerifier = std::function<thread::future<bool> (const api::RemoteChainApi&, Height)>;
+
 	/// Configuration for customizing a chain synchronizer.
 	struct ChainSynchronizerConfiguration {
 		/// Maximum number of hashes per sync attempt.
@@ -53,15 +57,40 @@ namespace catapult { namespace chain {
 		/// Maximum chain bytes per sync attempt.
 		uint32_t MaxChainBytesPerSyncAttempt;
 
+		/// Maximum chain bytes per sync request when streaming a sync attempt in chunks.
+		/// \note When nonzero, each chunk is forwarded to the block range consumer as soon as it arrives (once the fork is covered)
+		///       and the next chunk is only requested after the previous one was received.
+		uint32_t MaxChainBytesPerSyncChunk;
+
+		/// Maximum number of disjoint block ranges that are pulled in parallel (from different remotes) below a remote finalized height.
+		/// \note When nonzero, a remote reporting a verified finalized height above the local chain anchors a parallel sync session.
+		///       Pulled ranges are checked for hash chain continuity and forwarded to the block range consumer in height order.
+		///       The session is stopped and regular sync is resumed when a range does not link or too many pulls fail.
+		uint32_t MaxParallelSyncRanges;
+
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
 	};
 
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), block chain \a config,
-	/// local finalized height supplier (\a localFinalizedHeightSupplier) and block range consumer (\a blockRangeConsumer).
+	/// local finalized height supplier (\a localFinalizedHeightSupplier), remote finalized height verifier
+	/// (\a remoteFinalizedHeightVerifier) and block range consumer (\a blockRangeConsumer).
 	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const supplier<Height>& localFinalizedHeightSupplier,
+			const RemoteFinalizedHeightVerifier& remoteFinalizedHeightVerifier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
+
+	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), block chain \a config,
+	/// local finalized height supplier (\a localFinalizedHeightSupplier), remote finalized height verifier
+	/// (\a remoteFinalizedHeightVerifier) and block range consumer (\a blockRangeConsumer) that can be used with
+	/// multiple remotes at once.
+	/// \note The parallelism is greater than one only while a parallel sync session is active.
+	ParallelRemoteNodeSynchronizer<api::RemoteChainApi> CreateParallelChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const supplier<Height>& localFinalizedHeightSupplier,
+			const RemoteFinalizedHeightVerifier& remoteFinalizedHeightVerifier,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
 }}
@@ -73,8 +73,8 @@ namespace catapult { namespace chain {
 
 					auto forkDepth = (m_localHeight - m_commonBlockHeight).unwrap();
 					auto result = ChainComparisonCode::Remote_Is_Not_Synced == code
-							? CompareChainsResult{ code, m_commonBlockHeight, forkDepth }
-							: CompareChainsResult{ code, Height(static_cast<Height::ValueType>(-1)), 0 };
+							? CompareChainsResult{ code, m_commonBlockHeight, forkDepth, m_remoteFinalizedHeight }
+							: CompareChainsResult{ code, Height(static_cast<Height::ValueType>(-1)), 0, Height() };
 					m_promise.set_value(std::move(result));
 					return true;
 				} catch (...) {
@@ -106,6 +106,7 @@ namespace catapult { namespace chain {
 
 				if (remoteScore > localScore) {
 					m_localHeight = localChainStatistics.Height;
+					m_remoteFinalizedHeight = remoteChainStatistics.FinalizedHeight;
 					return Incomplete_Chain_Comparison_Code;
 				}
 
@@ -194,6 +195,7 @@ namespace catapult { namespace chain {
 
 			Height m_localHeight;
 			Height m_commonBlockHeight;
+			Height m_remoteFinalizedHeight;
 		};
 	}
 
@@ -44,6 +44,9 @@ namespace catapult { namespace chain {
 
 		/// Depth of the fork that needs to be resolved.
 		uint64_t ForkDepth;
+
+		/// Finalized height reported by the remote.
+		Height RemoteFinalizedHeight;
 	};
 
 	/// Compares two chains (\a local and \a remote) with the specified \a options.
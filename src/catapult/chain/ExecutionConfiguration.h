@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/model/ExecutionProfiler.h"
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/observers/ObserverTypes.h"
@@ -45,6 +46,7 @@ namespace catapult { namespace chain {
 		using ObserverPointer = std::shared_ptr<const observers::AggregateNotificationObserver>;
 		using ValidatorPointer = std::shared_ptr<const validators::stateful::AggregateNotificationValidator>;
 		using PublisherPointer = std::shared_ptr<const model::NotificationPublisher>;
+		using ProfilerPointer = std::shared_ptr<model::ExecutionProfiler>;
 
 	public:
 
@@ -56,5 +58,8 @@ namespace catapult { namespace chain {
 
 		/// Notification publisher.
 		PublisherPointer pNotificationPublisher;
+
+		/// Execution profiler (optional).
+		ProfilerPointer pExecutionProfiler;
 	};
 }}
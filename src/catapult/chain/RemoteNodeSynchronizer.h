@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/functions.h"
 #include "catapult/ionet/NodeInteractionResultCode.h"
 #include "catapult/thread/FutureUtils.h"
 #include <functional>
@@ -29,6 +30,16 @@ namespace catapult { namespace chain {
 	template<typename TRemoteApi>
 	using RemoteNodeSynchronizer = std::function<thread::future<ionet::NodeInteractionResultCode> (const TRemoteApi&)>;
 
+	/// Remote node synchronizer that can synchronize with multiple remote nodes at once.
+	template<typename TRemoteApi>
+	struct ParallelRemoteNodeSynchronizer {
+		/// Synchronizer that is called once for each remote node.
+		RemoteNodeSynchronizer<TRemoteApi> Synchronizer;
+
+		/// Supplier of the number of remote nodes that should currently be synchronized with at once.
+		supplier<size_t> ParallelismSupplier;
+	};
+
 	/// Creates a remote node synchronizer around \a pSynchronizer.
 	template<typename TSynchronizer>
 	RemoteNodeSynchronizer<typename TSynchronizer::RemoteApiType> CreateRemoteNodeSynchronizer(
@@ -49,6 +49,8 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(MaxHashesPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncChunk);
+		LOAD_NODE_PROPERTY(MaxParallelSyncRanges);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -62,9 +64,12 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
+		LOAD_NODE_PROPERTY(MaxSslSessionCacheSize);
+		LOAD_NODE_PROPERTY(BriefConnectionReuseDuration);
 
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSize);
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSensitivity);
+		LOAD_NODE_PROPERTY(MaxSocketWorkingBufferPoolSize);
 		LOAD_NODE_PROPERTY(MaxPacketDataSize);
 
 		LOAD_NODE_PROPERTY(BlockDisruptorSize);
@@ -75,6 +80,9 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableDispatcherAbortWhenFull);
 		LOAD_NODE_PROPERTY(EnableDispatcherInputAuditing);
 
+		LOAD_NODE_PROPERTY(EnableExecutionProfiling);
+		LOAD_NODE_PROPERTY(SlowBlockExecutionThreshold);
+
 		LOAD_NODE_PROPERTY(MaxCacheDatabaseWriteBatchSize);
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
@@ -124,7 +132,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 34 + 4 + 4 + 5 + 7);
+		utils::VerifyBagSizeExact(bag, 41 + 4 + 4 + 5 + 7);
 		return config;
 	}
 
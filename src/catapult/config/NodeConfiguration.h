@@ -66,6 +66,13 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum chain bytes per sync request when a sync attempt is split into streamed chunks (\c 0 disables chunking).
+		utils::FileSize MaxChainBytesPerSyncChunk;
+
+		/// Maximum number of disjoint block ranges pulled in parallel from different peers below a remote finalized height
+		/// (\c 0 disables parallel sync).
+		uint32_t MaxParallelSyncRanges;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -96,6 +103,14 @@ namespace catapult { namespace config {
 		/// Timeout for syncing with a peer.
 		utils::TimeSpan SyncTimeout;
 
+		/// Maximum number of tls sessions cached for resumption of outgoing connections.
+		/// \note \c 0 will disable session resumption.
+		uint32_t MaxSslSessionCacheSize;
+
+		/// Duration idle connections used for brief requests (e.g. pings and time synchronization) are kept alive for reuse.
+		/// \note \c 0 will disable connection reuse.
+		utils::TimeSpan BriefConnectionReuseDuration;
+
 		/// Initial socket working buffer size (socket reads will attempt to read buffers of roughly this size).
 		utils::FileSize SocketWorkingBufferSize;
 
@@ -103,6 +118,10 @@ namespace catapult { namespace config {
 		/// \note \c 0 will disable memory reclamation.
 		uint32_t SocketWorkingBufferSensitivity;
 
+		/// Maximum memory retained by idle socket working buffers that are pooled across all connections.
+		/// \note \c 0 will disable pooling.
+		utils::FileSize MaxSocketWorkingBufferPoolSize;
+
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
@@ -124,6 +143,12 @@ namespace catapult { namespace config {
 		/// \c true if all dispatcher inputs should be audited.
 		bool EnableDispatcherInputAuditing;
 
+		/// \c true if the execution of validators and observers should be profiled.
+		bool EnableExecutionProfiling;
+
+		/// Minimum block execution time that causes the block profile to be logged when profiling is enabled.
+		utils::TimeSpan SlowBlockExecutionThreshold;
+
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
 
@@ -26,8 +26,11 @@
 #include "catapult/chain/ChainUtils.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/thread/Future.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/asio.hpp>
 
 namespace catapult { namespace consumers {
 
@@ -38,6 +41,37 @@ namespace catapult { namespace consumers {
 			return disruptor::CompletionStatus::Aborted == result.CompletionStatus;
 		}
 
+		template<typename TAction>
+		thread::future<bool> StartAsync(thread::IoThreadPool& pool, TAction action) {
+			auto pPromise = std::make_shared<thread::promise<bool>>();
+			auto future = pPromise->get_future();
+			boost::asio::post(pool.ioContext(), [pPromise, action]() {
+				try {
+					action();
+					pPromise->set_value(true);
+				} catch (...) {
+					pPromise->set_exception(std::current_exception());
+				}
+			});
+
+			return future;
+		}
+
+		template<typename TAction>
+		std::exception_ptr CaptureException(TAction action) {
+			try {
+				action();
+				return nullptr;
+			} catch (...) {
+				return std::current_exception();
+			}
+		}
+
+		void RethrowIfSet(const std::exception_ptr& pException) {
+			if (pException)
+				std::rethrow_exception(pException);
+		}
+
 		struct UnwindResult {
 		public:
 			model::ChainScore Score;
@@ -121,9 +155,14 @@ namespace catapult { namespace consumers {
 
 		class BlockChainSyncConsumer {
 		public:
-			BlockChainSyncConsumer(cache::CatapultCache& cache, io::BlockStorageCache& storage, const BlockChainSyncHandlers& handlers)
+			BlockChainSyncConsumer(
+					cache::CatapultCache& cache,
+					io::BlockStorageCache& storage,
+					thread::IoThreadPool& commitPool,
+					const BlockChainSyncHandlers& handlers)
 					: m_cache(cache)
 					, m_storage(storage)
+					, m_commitPool(commitPool)
 					, m_handlers(handlers)
 			{}
 
@@ -240,30 +279,46 @@ namespace catapult { namespace consumers {
 			void commitAll(const BlockElements& elements, SyncState& syncState) const {
 				utils::SlowOperationLogger logger("BlockChainSyncConsumer::commitAll", utils::LogLevel::warning);
 
-				// 1. save the peer chain into storage
-				logger.addSubOperation("save the peer chain into storage");
+				// 1. save the peer chain into staging storage while indicating a state change
+				//    (both only produce data that is discarded by recovery until State_Written is set)
+				logger.addSubOperation("save the peer chain into storage and indicate a state change");
 				auto storageModifier = m_storage.modifier();
-				storageModifier.dropBlocksAfter(syncState.commonBlockHeight());
-				storageModifier.saveBlocks(elements);
-				m_handlers.CommitStep(CommitOperationStep::Blocks_Written);
+				auto blocksWrittenFuture = StartAsync(m_commitPool, [&storageModifier, &elements, &syncState]() {
+					storageModifier.dropBlocksAfter(syncState.commonBlockHeight());
+					storageModifier.saveBlocks(elements);
+				});
 
-				// 2. indicate a state change
-				logger.addSubOperation("indicate a state change");
 				auto newHeight = elements.back().Block.Height;
-				m_handlers.StateChange({ cache::CacheChanges(syncState.cacheDelta()), syncState.scoreDelta(), newHeight });
-				m_handlers.PreStateWritten(syncState.cacheDelta(), newHeight);
+				auto pStateWrittenException = CaptureException([this, &syncState, newHeight]() {
+					m_handlers.StateChange({ cache::CacheChanges(syncState.cacheDelta()), syncState.scoreDelta(), newHeight });
+					m_handlers.PreStateWritten(syncState.cacheDelta(), newHeight);
+				});
+
+				// 2. wait for both writes to complete before setting the commit steps (durability barrier)
+				logger.addSubOperation("wait for blocks and state to be written");
+				blocksWrittenFuture.get();
+				m_handlers.CommitStep(CommitOperationStep::Blocks_Written);
+
+				RethrowIfSet(pStateWrittenException);
 				m_handlers.CommitStep(CommitOperationStep::State_Written);
 
 				// *** checkpoint ***
 				// - both blocks and state have been written out to disk and can be fully restored
 				// - broker process is not yet able to consume changes (all changes are consumable after step 3)
 
-				// 3. commit changes to the in-memory cache and primary block chain storage
-				logger.addSubOperation("commit changes to the in-memory cache");
-				syncState.commit(newHeight);
+				// 3. commit changes to the in-memory cache and primary block chain storage in parallel
+				//    (recovery redoes both when interrupted after the checkpoint)
+				logger.addSubOperation("commit changes to the in-memory cache and primary block chain storage");
+				auto storageCommitFuture = StartAsync(m_commitPool, [&storageModifier]() {
+					storageModifier.commit();
+				});
+
+				auto pCacheCommitException = CaptureException([&syncState, newHeight]() {
+					syncState.commit(newHeight);
+				});
 
-				logger.addSubOperation("commit changes to the primary block chain storage");
-				storageModifier.commit();
+				storageCommitFuture.get();
+				RethrowIfSet(pCacheCommitException);
 				m_handlers.CommitStep(CommitOperationStep::All_Updated);
 
 				// 4. update the unconfirmed transactions
@@ -289,6 +344,7 @@ namespace catapult { namespace consumers {
 		private:
 			cache::CatapultCache& m_cache;
 			io::BlockStorageCache& m_storage;
+			thread::IoThreadPool& m_commitPool;
 			BlockChainSyncHandlers m_handlers;
 		};
 	}
@@ -296,7 +352,8 @@ namespace catapult { namespace consumers {
 	disruptor::DisruptorConsumer CreateBlockChainSyncConsumer(
 			cache::CatapultCache& cache,
 			io::BlockStorageCache& storage,
+			thread::IoThreadPool& commitPool,
 			const BlockChainSyncHandlers& handlers) {
-		return BlockChainSyncConsumer(cache, storage, handlers);
+		return BlockChainSyncConsumer(cache, storage, commitPool, handlers);
 	}
 }}
@@ -77,11 +77,13 @@ namespace catapult { namespace consumers {
 
 	/// Creates a consumer that attempts to synchronize a remote chain with the local chain, which is composed of
 	/// state (in \a cache) and blocks (in \a storage).
+	/// \a commitPool is used to write blocks in parallel with state during a commit.
 	/// \a handlers are used to customize the sync process.
 	/// \note This consumer is non-const because it updates the element generation hashes.
 	disruptor::DisruptorConsumer CreateBlockChainSyncConsumer(
 			cache::CatapultCache& cache,
 			io::BlockStorageCache& storage,
+			thread::IoThreadPool& commitPool,
 			const BlockChainSyncHandlers& handlers);
 
 	/// Creates a consumer that cleans up temporary state produced by the block chain sync consumer given \a dataDirectory.
@@ -43,4 +43,10 @@ namespace catapult { namespace crypto {
 		if (!RAND_bytes(pOut, static_cast<int>(count)))
 			CATAPULT_THROW_RUNTIME_ERROR("unable to generate secure random numbers");
 	}
+
+	consumer<uint8_t*, size_t> CreateSecureRandomFiller() {
+		return [](auto* pOut, auto count) {
+			SecureRandomGenerator().fill(pOut, count);
+		};
+	}
 }}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/functions.h"
 #include <cstring>
 #include <limits>
 #include <stdint.h>
@@ -48,4 +49,7 @@ namespace catapult { namespace crypto {
 		/// Generates \a count random bytes into \a pOut.
 		void fill(uint8_t* pOut, size_t count);
 	};
+
+	/// Creates a random filler that generates cryptographically secure random bytes.
+	consumer<uint8_t*, size_t> CreateSecureRandomFiller();
 }}
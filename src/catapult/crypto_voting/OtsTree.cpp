@@ -20,7 +20,6 @@
 
 #include "OtsTree.h"
 #include "catapult/crypto/SecureRandomGenerator.h"
-#include "catapult/crypto/Signer.h"
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/exceptions.h"
 #include <type_traits>
@@ -372,6 +371,13 @@ namespace catapult { namespace crypto {
 		bool VerifyBoundSignature(const OtsParentPublicKeySignaturePair& pair, const OtsPublicKey& signedPublicKey, uint64_t boundary) {
 			return crypto::Verify(pair.ParentPublicKey, { signedPublicKey, ToBuffer(boundary) }, pair.Signature);
 		}
+
+		SignatureInput CreateBoundSignatureInput(
+				const OtsParentPublicKeySignaturePair& pair,
+				const OtsPublicKey& signedPublicKey,
+				const uint64_t& boundary) {
+			return { pair.ParentPublicKey, { signedPublicKey, ToBuffer(boundary) }, pair.Signature };
+		}
 	}
 
 	bool Verify(const OtsTreeSignature& signature, const OtsKeyIdentifier& keyIdentifier, const RawBuffer& buffer) {
@@ -386,4 +392,44 @@ namespace catapult { namespace crypto {
 
 		return true;
 	}
+
+	std::pair<std::vector<bool>, bool> VerifyMulti(
+			const RandomFiller& randomFiller,
+			const OtsTreeSignatureInput* pSignatureInputs,
+			size_t count) {
+		constexpr size_t Num_Signatures_Per_Tree_Signature = 3;
+
+		// flatten all ots tree signatures into their component signatures
+		// note: boundaries are copied into a presized vector so that the buffers referencing them remain valid
+		std::vector<uint64_t> boundaries;
+		boundaries.reserve(2 * count);
+
+		std::vector<SignatureInput> inputs;
+		inputs.reserve(Num_Signatures_Per_Tree_Signature * count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& signature = pSignatureInputs[i].Signature;
+			const auto& keyIdentifier = pSignatureInputs[i].KeyIdentifier;
+
+			boundaries.push_back(keyIdentifier.BatchId);
+			inputs.push_back(CreateBoundSignatureInput(signature.Root, signature.Top.ParentPublicKey, boundaries.back()));
+
+			boundaries.push_back(keyIdentifier.KeyId);
+			inputs.push_back(CreateBoundSignatureInput(signature.Top, signature.Bottom.ParentPublicKey, boundaries.back()));
+
+			inputs.push_back({ signature.Bottom.ParentPublicKey, { pSignatureInputs[i].Buffer }, signature.Bottom.Signature });
+		}
+
+		auto resultPair = crypto::VerifyMulti(randomFiller, inputs.data(), inputs.size());
+
+		// ots tree signature is only valid when all of its component signatures are valid
+		std::vector<bool> results(count, true);
+		if (!resultPair.second) {
+			for (auto i = 0u; i < inputs.size(); ++i) {
+				if (!resultPair.first[i])
+					results[i / Num_Signatures_Per_Tree_Signature] = false;
+			}
+		}
+
+		return std::make_pair(std::move(results), resultPair.second);
+	}
 }}
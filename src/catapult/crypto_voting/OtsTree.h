@@ -21,9 +21,11 @@
 #pragma once
 #include "OtsTypes.h"
 #include "catapult/crypto/KeyPair.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/io/SeekableStream.h"
 #include <array>
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace crypto {
 
@@ -80,4 +82,26 @@ namespace catapult { namespace crypto {
 
 	/// Verifies \a signature of \a buffer at \a keyIdentifier.
 	bool Verify(const OtsTreeSignature& signature, const OtsKeyIdentifier& keyIdentifier, const RawBuffer& buffer);
+
+	/// Ots tree signature input.
+	struct OtsTreeSignatureInput {
+		/// Signature.
+		const OtsTreeSignature& Signature;
+
+		/// Key identifier.
+		OtsKeyIdentifier KeyIdentifier;
+
+		/// Signed buffer.
+		RawBuffer Buffer;
+	};
+
+	/// Verifies all \a count ots tree signatures pointed to by \a pSignatureInputs.
+	/// \a randomFiller is used to generate random bytes.
+	/// Collates and returns a pair consisting of an aggregate result that is \c true when all signatures are valid
+	/// and a vector of bools that indicates the verification result for each individual ots tree signature.
+	/// \note All (root, top and bottom) signatures composing the ots tree signatures are batch verified together.
+	std::pair<std::vector<bool>, bool> VerifyMulti(
+			const RandomFiller& randomFiller,
+			const OtsTreeSignatureInput* pSignatureInputs,
+			size_t count);
 }}
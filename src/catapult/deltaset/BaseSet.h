@@ -116,7 +116,8 @@ namespace catapult { namespace deltaset {
 			if (!pDelta)
 				CATAPULT_THROW_RUNTIME_ERROR("attempting to commit changes to a set without any outstanding attached deltas");
 
-			auto deltas = pDelta->deltas();
+			// pending modifications are moved into the original set, so the delta must be reset afterwards
+			auto deltas = pDelta->movableDeltas();
 			TCommitPolicy::Update(m_elements, deltas, std::forward<TArgs>(args)...);
 			pDelta->reset();
 		}
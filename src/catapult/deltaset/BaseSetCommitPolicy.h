@@ -21,22 +21,39 @@
 #pragma once
 #include "DeltaElements.h"
 #include "catapult/exceptions.h"
+#include <type_traits>
 
 namespace catapult { namespace deltaset {
 
-	/// Applies all changes in \a deltas to \a elements.
+	/// Applies all changes in \a deltas to \a elements by moving added and copied elements.
+	/// \note Added and copied elements are left in a moved-from state.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
-	void UpdateSet(TStorageSet& elements, const DeltaElements<TMemorySet>& deltas) {
-		if (!deltas.Added.empty())
-			elements.insert(deltas.Added.cbegin(), deltas.Added.cend());
+	void UpdateSet(TStorageSet& elements, const MovableDeltaElements<TMemorySet>& deltas) {
+		if constexpr (std::is_same_v<TStorageSet, TMemorySet>) {
+			// splice nodes directly into the original set without copying or reallocating any elements
+			// (redundant additions are left behind in the delta, consistent with insert)
+			elements.merge(deltas.Added);
 
-		for (const auto& element : deltas.Copied) {
-			auto iter = elements.find(TKeyTraits::ToKey(element));
-			if (elements.cend() == iter)
-				CATAPULT_THROW_INVALID_ARGUMENT("element not found, cannot update");
+			for (auto copiedIter = deltas.Copied.begin(); deltas.Copied.end() != copiedIter;) {
+				auto iter = elements.find(TKeyTraits::ToKey(*copiedIter));
+				if (elements.cend() == iter)
+					CATAPULT_THROW_INVALID_ARGUMENT("element not found, cannot update");
 
-			iter = elements.erase(iter);
-			elements.insert(iter, element);
+				iter = elements.erase(iter);
+				elements.insert(iter, deltas.Copied.extract(copiedIter++));
+			}
+		} else {
+			for (auto& element : deltas.Added)
+				elements.insert(std::move(element));
+
+			for (auto& element : deltas.Copied) {
+				auto iter = elements.find(TKeyTraits::ToKey(element));
+				if (elements.cend() == iter)
+					CATAPULT_THROW_INVALID_ARGUMENT("element not found, cannot update");
+
+				iter = elements.erase(iter);
+				elements.insert(iter, std::move(element));
+			}
 		}
 
 		for (const auto& element : deltas.Removed)
@@ -47,7 +64,9 @@ namespace catapult { namespace deltaset {
 	template<typename TSetTraits>
 	struct BaseSetCommitPolicy {
 		/// Applies all changes in \a deltas to \a elements.
-		static void Update(typename TSetTraits::SetType& elements, const DeltaElements<typename TSetTraits::MemorySetType>& deltas) {
+		static void Update(
+				typename TSetTraits::SetType& elements,
+				const MovableDeltaElements<typename TSetTraits::MemorySetType>& deltas) {
 			UpdateSet<typename TSetTraits::KeyTraits>(elements, deltas);
 		}
 	};
@@ -305,6 +305,12 @@ namespace catapult { namespace deltaset {
 			return DeltaElements<MemorySetType>(m_addedElements, m_removedElements, m_copiedElements);
 		}
 
+		/// Gets all pending modifications such that they can be moved into the original set.
+		/// \note This must only be used during commit because the pending modifications are invalidated.
+		MovableDeltaElements<MemorySetType> movableDeltas() {
+			return MovableDeltaElements<MemorySetType>(m_addedElements, m_removedElements, m_copiedElements);
+		}
+
 		/// Resets all pending modifications.
 		void reset() {
 			m_addedElements.clear();
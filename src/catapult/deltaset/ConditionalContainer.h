@@ -156,7 +156,7 @@ namespace catapult { namespace deltaset {
 
 	public:
 		/// Applies all changes in \a deltas to the underlying container.
-		void update(const DeltaElements<MemorySetType>& deltas) {
+		void update(const MovableDeltaElements<MemorySetType>& deltas) {
 			if (m_pContainer1)
 				UpdateSet<TKeyTraits>(*m_pContainer1, deltas);
 			else
@@ -205,7 +205,7 @@ namespace catapult { namespace deltaset {
 	/// Applies all changes in \a deltas to \a container.
 	/// \note Specialization for ConditionalContainer.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
-	void UpdateSet(ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const DeltaElements<TMemorySet>& deltas) {
+	void UpdateSet(ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const MovableDeltaElements<TMemorySet>& deltas) {
 		container.update(deltas);
 	}
 
@@ -49,4 +49,38 @@ namespace catapult { namespace deltaset {
 		/// Copied elements.
 		const TSet& Copied;
 	};
+
+	/// Slim wrapper around changed elements that allows the elements to be moved.
+	/// \note This is used when committing changes because all pending modifications are discarded afterwards.
+	template<typename TSet>
+	struct MovableDeltaElements {
+	public:
+		/// Creates new movable delta elements from \a addedElements, \a removedElements and \a copiedElements.
+		constexpr MovableDeltaElements(TSet& addedElements, TSet& removedElements, TSet& copiedElements)
+				: Added(addedElements)
+				, Removed(removedElements)
+				, Copied(copiedElements)
+		{}
+
+	public:
+		/// Returns \c true if there are any pending changes.
+		bool HasChanges() const {
+			return !(Added.empty() && Copied.empty() && Removed.empty());
+		}
+
+		/// Converts these elements into (read-only) delta elements.
+		operator DeltaElements<TSet>() const {
+			return DeltaElements<TSet>(Added, Removed, Copied);
+		}
+
+	public:
+		/// Added elements.
+		TSet& Added;
+
+		/// Removed elements.
+		TSet& Removed;
+
+		/// Copied elements.
+		TSet& Copied;
+	};
 }}
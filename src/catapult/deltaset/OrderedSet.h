@@ -42,7 +42,7 @@ namespace catapult { namespace deltaset {
 			template<typename TPruningBoundary>
 			static void Update(
 					typename TSetTraits::SetType& elements,
-					const DeltaElements<typename TSetTraits::MemorySetType>& deltas,
+					const MovableDeltaElements<typename TSetTraits::MemorySetType>& deltas,
 					const TPruningBoundary& pruningBoundary) {
 				UpdateSet<typename TSetTraits::KeyTraits>(elements, deltas);
 
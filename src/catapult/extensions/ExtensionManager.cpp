@@ -42,6 +42,10 @@ namespace catapult { namespace extensions {
 		m_serviceRegistrars.push_back(std::move(pServiceRegistrar));
 	}
 
+	void ExtensionManager::addDiagnosticCounter(const utils::DiagnosticCounter& counter) {
+		m_diagnosticCounters.push_back(counter);
+	}
+
 	const std::vector<std::string>& ExtensionManager::systemPluginNames() const {
 		return m_systemPluginNames;
 	}
@@ -50,6 +54,10 @@ namespace catapult { namespace extensions {
 		return m_networkTimeSupplier ? m_networkTimeSupplier : [epochAdjustment]() { return utils::NetworkTime(epochAdjustment).now(); };
 	}
 
+	const std::vector<utils::DiagnosticCounter>& ExtensionManager::diagnosticCounters() const {
+		return m_diagnosticCounters;
+	}
+
 	void ExtensionManager::registerServices(ServiceLocator& locator, ServiceState& state) {
 		// sort the registrars based on their annnounced phases
 		std::sort(m_serviceRegistrars.begin(), m_serviceRegistrars.end(), [](const auto& pLhs, const auto& pRhs) {
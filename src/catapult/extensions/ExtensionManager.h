@@ -20,6 +20,7 @@
 
 #pragma once
 #include "ServiceRegistrar.h"
+#include "catapult/utils/DiagnosticCounter.h"
 #include "catapult/functions.h"
 #include "catapult/types.h"
 #include <memory>
@@ -52,6 +53,10 @@ namespace catapult { namespace extensions {
 		/// Adds a service registrar (\a pServiceRegistrar).
 		void addServiceRegistrar(std::unique_ptr<ServiceRegistrar>&& pServiceRegistrar);
 
+		/// Adds a diagnostic \a counter that is reported by the hosting process.
+		/// \note Unlike service counters, these counters are also reported by processes that do not register services.
+		void addDiagnosticCounter(const utils::DiagnosticCounter& counter);
+
 	public:
 		/// Gets the system plugin names.
 		const std::vector<std::string>& systemPluginNames() const;
@@ -59,6 +64,9 @@ namespace catapult { namespace extensions {
 		/// Gets the network time supplier given \a epochAdjustment.
 		NetworkTimeSupplier networkTimeSupplier(const utils::TimeSpan& epochAdjustment) const;
 
+		/// Gets the diagnostic counters reported by the hosting process.
+		const std::vector<utils::DiagnosticCounter>& diagnosticCounters() const;
+
 		/// Registers all services by forwarding \a locator and \a state.
 		void registerServices(ServiceLocator& locator, ServiceState& state);
 
@@ -66,5 +74,6 @@ namespace catapult { namespace extensions {
 		std::vector<std::string> m_systemPluginNames;
 		NetworkTimeSupplier m_networkTimeSupplier;
 		std::vector<std::unique_ptr<ServiceRegistrar>> m_serviceRegistrars;
+		std::vector<utils::DiagnosticCounter> m_diagnosticCounters;
 	};
 }}
@@ -20,7 +20,10 @@
 
 #include "NetworkUtils.h"
 #include "Results.h"
+#include "ServiceState.h"
 #include "catapult/ionet/ReadRateMonitorSocketDecorator.h"
+#include "catapult/ionet/SslSessionCache.h"
+#include "catapult/ionet/WorkingBufferPool.h"
 #include "catapult/net/ConnectionContainer.h"
 #include "catapult/net/PeerConnectResult.h"
 #include "catapult/subscribers/NodeSubscriber.h"
@@ -53,6 +56,16 @@ namespace catapult { namespace extensions {
 
 		settings.SslOptions.ContextSupplier = ionet::CreateSslContextSupplier(config.User.CertificateDirectory);
 		settings.SslOptions.VerifyCallbackSupplier = ionet::CreateSslVerifyCallbackSupplier();
+		if (0 != config.Node.MaxSslSessionCacheSize)
+			settings.SslOptions.pSessionCache = std::make_shared<ionet::SslSessionCache>(config.Node.MaxSslSessionCacheSize);
+
+		settings.BriefConnectionReuseDuration = config.Node.BriefConnectionReuseDuration;
+		return settings;
+	}
+
+	net::ConnectionSettings GetConnectionSettings(const ServiceState& state) {
+		auto settings = GetConnectionSettings(state.config());
+		settings.pSocketWorkingBufferPool = state.workingBufferPool();
 		return settings;
 	}
 
@@ -96,6 +109,7 @@ namespace catapult { namespace extensions {
 			unsigned short port,
 			ionet::ServiceIdentifier serviceId,
 			const config::CatapultConfiguration& config,
+			const std::shared_ptr<ionet::WorkingBufferPool>& pWorkingBufferPool,
 			const supplier<Timestamp>& timeSupplier,
 			subscribers::NodeSubscriber& nodeSubscriber,
 			net::AcceptedConnectionContainer& acceptor) {
@@ -138,6 +152,7 @@ namespace catapult { namespace extensions {
 		});
 
 		UpdateAsyncTcpServerSettings(serverSettings, config);
+		serverSettings.PacketSocketOptions.pWorkingBufferPool = pWorkingBufferPool;
 		return serviceGroup.pushService(net::CreateAsyncTcpServer, endpoint, serverSettings);
 	}
 
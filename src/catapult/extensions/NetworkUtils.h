@@ -27,6 +27,7 @@
 #include "catapult/thread/MultiServicePool.h"
 
 namespace catapult {
+	namespace extensions { class ServiceState; }
 	namespace net { class AcceptedConnectionContainer; }
 	namespace subscribers { class NodeSubscriber; }
 }
@@ -37,18 +38,24 @@ namespace catapult { namespace extensions {
 	ionet::RateMonitorSettings GetRateMonitorSettings(const config::NodeConfiguration::BanningSubConfiguration& banConfig);
 
 	/// Extracts connection settings from \a config.
+	/// \note Returned settings do not include a socket working buffer pool.
 	net::ConnectionSettings GetConnectionSettings(const config::CatapultConfiguration& config);
 
+	/// Extracts connection settings from \a state, including its (shared) socket working buffer pool.
+	net::ConnectionSettings GetConnectionSettings(const ServiceState& state);
+
 	/// Updates \a settings with values in \a config.
 	void UpdateAsyncTcpServerSettings(net::AsyncTcpServerSettings& settings, const config::CatapultConfiguration& config);
 
 	/// Boots a tcp server with \a serviceGroup on localhost \a port with connection \a config and \a acceptor given \a timeSupplier.
 	/// Incoming connections are assumed to be associated with \a serviceId and are added to \a nodeSubscriber.
+	/// Socket working buffers are acquired from \a pWorkingBufferPool, when specified.
 	std::shared_ptr<net::AsyncTcpServer> BootServer(
 			thread::MultiServicePool::ServiceGroup& serviceGroup,
 			unsigned short port,
 			ionet::ServiceIdentifier serviceId,
 			const config::CatapultConfiguration& config,
+			const std::shared_ptr<ionet::WorkingBufferPool>& pWorkingBufferPool,
 			const supplier<Timestamp>& timeSupplier,
 			subscribers::NodeSubscriber& nodeSubscriber,
 			net::AcceptedConnectionContainer& acceptor);
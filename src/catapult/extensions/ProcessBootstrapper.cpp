@@ -53,6 +53,11 @@ namespace catapult { namespace extensions {
 			// need to forcibly inject typeinfos into containing exe so that they are properly resolved across modules
 			ForceSymbolInjection<model::EmbeddedTransactionPlugin>();
 #endif
+
+			if (m_config.Node.EnableExecutionProfiling)
+				m_pluginManager.enableExecutionProfiler(m_config.Node.SlowBlockExecutionThreshold);
+
+			m_pluginManager.setWorkerPool(*m_pMultiServicePool->pushIsolatedPool("plugin worker"));
 	}
 
 	const config::CatapultConfiguration& ProcessBootstrapper::config() const {
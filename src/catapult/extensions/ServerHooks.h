@@ -74,6 +74,9 @@ namespace catapult { namespace extensions {
 	/// Supplier for retrieving the local finalized height.
 	using LocalFinalizedHeightSupplier = supplier<Height>;
 
+	/// Verifier for checking a finalization proof at a height reported as finalized by a remote.
+	using RemoteFinalizedHeightVerifier = chain::RemoteFinalizedHeightVerifier;
+
 	/// Predicate for determining if a chain is synced.
 	using ChainSyncedPredicate = predicate<>;
 
@@ -140,6 +143,11 @@ namespace catapult { namespace extensions {
 			SetOnce(m_localFinalizedHeightSupplier, supplier);
 		}
 
+		/// Sets the remote finalized height \a verifier.
+		void setRemoteFinalizedHeightVerifier(const RemoteFinalizedHeightVerifier& verifier) {
+			SetOnce(m_remoteFinalizedHeightVerifier, verifier);
+		}
+
 		/// Sets the chain synced \a predicate.
 		void setChainSyncedPredicate(const ChainSyncedPredicate& predicate) {
 			SetOnce(m_chainSyncedPredicate, predicate);
@@ -206,6 +214,14 @@ namespace catapult { namespace extensions {
 			return m_localFinalizedHeightSupplier ? m_localFinalizedHeightSupplier : []() { return Height(1); };
 		}
 
+		/// Gets the remote finalized height verifier.
+		/// \note When unset, no remote finalized height can be verified.
+		auto remoteFinalizedHeightVerifier() const {
+			return m_remoteFinalizedHeightVerifier
+					? m_remoteFinalizedHeightVerifier
+					: [](const auto&, auto) { return thread::make_ready_future(false); };
+		}
+
 		/// Gets the chain synced predicate.
 		auto chainSyncedPredicate() const {
 			return m_chainSyncedPredicate ? m_chainSyncedPredicate : []() { return true; };
@@ -240,6 +256,7 @@ namespace catapult { namespace extensions {
 
 		RemoteChainHeightsRetriever m_remoteChainHeightsRetriever;
 		LocalFinalizedHeightSupplier m_localFinalizedHeightSupplier;
+		RemoteFinalizedHeightVerifier m_remoteFinalizedHeightVerifier;
 		ChainSyncedPredicate m_chainSyncedPredicate;
 		std::vector<KnownHashPredicate> m_knownHashPredicates;
 	};
@@ -23,6 +23,7 @@
 #include "ServiceState.h"
 #include "catapult/config/CatapultConfiguration.h"
 #include "catapult/ionet/PacketHandlers.h"
+#include "catapult/ionet/WorkingBufferPool.h"
 #include "catapult/net/PacketIoPickerContainer.h"
 #include "catapult/thread/Task.h"
 
@@ -93,6 +94,7 @@ namespace catapult { namespace extensions {
 				, m_pluginManager(pluginManager)
 				, m_pool(pool)
 				, m_packetHandlers(m_config.Node.MaxPacketDataSize.bytes32())
+				, m_pWorkingBufferPool(CreateWorkingBufferPool(m_config.Node))
 		{}
 
 	public:
@@ -197,6 +199,21 @@ namespace catapult { namespace extensions {
 			return m_packetIoPickers;
 		}
 
+		/// Gets the socket working buffer pool shared by all connections (or \c nullptr when pooling is disabled).
+		const auto& workingBufferPool() const {
+			return m_pWorkingBufferPool;
+		}
+
+	private:
+		static std::shared_ptr<ionet::WorkingBufferPool> CreateWorkingBufferPool(const config::NodeConfiguration& config) {
+			if (0 == config.MaxSocketWorkingBufferPoolSize.bytes())
+				return nullptr;
+
+			return std::make_shared<ionet::WorkingBufferPool>(
+					config.SocketWorkingBufferSize.bytes(),
+					config.MaxSocketWorkingBufferPoolSize.bytes());
+		}
+
 	private:
 		// references
 		const config::CatapultConfiguration& m_config;
@@ -222,6 +239,7 @@ namespace catapult { namespace extensions {
 		ionet::ServerPacketHandlers m_packetHandlers;
 		ServerHooks m_hooks;
 		net::PacketIoPickerContainer m_packetIoPickers;
+		std::shared_ptr<ionet::WorkingBufferPool> m_pWorkingBufferPool;
 	};
 
 	// endregion
@@ -51,6 +51,38 @@ namespace catapult { namespace extensions {
 		};
 	}
 
+	/// Creates a synchronizer task callback for \a synchronizer named \a taskName that does not require the local chain to be synced
+	/// and synchronizes with as many peers at once as indicated by the synchronizer.
+	/// \a packetIoPicker is used to select peers and \a remoteApiFactory wraps an api around peers.
+	/// \a state provides additional service information.
+	template<typename TRemoteApi, typename TRemoteApiFactory>
+	thread::TaskCallback CreateParallelSynchronizerTaskCallback(
+			chain::ParallelRemoteNodeSynchronizer<TRemoteApi>&& synchronizer,
+			TRemoteApiFactory remoteApiFactory,
+			net::PacketIoPicker& packetIoPicker,
+			const extensions::ServiceState& state,
+			const std::string& taskName) {
+		auto syncTimeout = state.config().Node.SyncTimeout;
+		chain::RemoteApiForwarder forwarder(packetIoPicker, state.pluginManager().transactionRegistry(), syncTimeout, taskName);
+
+		auto syncHandler = [&nodes = state.nodes()](auto&& resultsFuture) {
+			for (auto& resultFuture : resultsFuture.get())
+				IncrementNodeInteraction(nodes, resultFuture.get());
+
+			return thread::TaskResult::Continue;
+		};
+
+		return [forwarder, syncHandler, synchronizer, remoteApiFactory]() {
+			// a picked peer is not picked again until its interaction completes, so every interaction is with a different peer
+			auto parallelism = std::max<size_t>(1, synchronizer.ParallelismSupplier());
+			std::vector<thread::future<ionet::NodeInteractionResult>> syncFutures;
+			for (auto i = 0u; i < parallelism; ++i)
+				syncFutures.push_back(forwarder.processSync(synchronizer.Synchronizer, remoteApiFactory));
+
+			return thread::when_all(std::move(syncFutures)).then(syncHandler);
+		};
+	}
+
 	/// Creates a synchronizer task callback for \a synchronizer named \a taskName that requires the local chain to be synced.
 	/// \a packetIoPicker is used to select peers and \a remoteApiFactory wraps an api around peers.
 	/// \a state provides additional service information.
@@ -25,7 +25,9 @@
 #include "catapult/api/ChainPackets.h"
 #include "catapult/ionet/NodeContainer.h"
 #include "catapult/ionet/PackedNodeInfo.h"
+#include "catapult/ionet/PackedPacketStatistics.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/ionet/PacketStatistics.h"
 #include "catapult/model/DiagnosticCounterValue.h"
 #include "catapult/utils/DiagnosticCounter.h"
 
@@ -147,4 +149,84 @@ namespace catapult { namespace handlers {
 	}
 
 	// endregion
+
+	// region DiagnosticPacketStatisticsHandlers
+
+	namespace {
+		template<typename TPackedValue, typename TStatisticsMap, typename TPack>
+		auto CreatePackedStatisticsPacket(ionet::PacketType packetType, const TStatisticsMap& statisticsMap, TPack pack) {
+			auto payloadSize = utils::checked_cast<size_t, uint32_t>(statisticsMap.size() * sizeof(TPackedValue));
+			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+			pResponsePacket->Type = packetType;
+
+			auto* pPackedValue = reinterpret_cast<TPackedValue*>(pResponsePacket->Data());
+			for (const auto& pair : statisticsMap) {
+				pack(pair.first, pair.second, *pPackedValue);
+				++pPackedValue;
+			}
+
+			return pResponsePacket;
+		}
+
+		void PackLatencies(const utils::LatencyHistogram& histogram, uint64_t& p50, uint64_t& p99, uint64_t& max) {
+			p50 = histogram.valueAtPercentile(50);
+			p99 = histogram.valueAtPercentile(99);
+			max = histogram.max();
+		}
+
+		auto CreatePacketTypeStatisticsHandler(const std::shared_ptr<ionet::PacketStatistics>& pStatistics) {
+			return [pStatistics](const auto& packet, auto& context) {
+				if (!ionet::IsPacketValid(packet, ionet::PacketType::Packet_Type_Statistics))
+					return;
+
+				auto packetType = ionet::PacketType::Packet_Type_Statistics;
+				auto pResponsePacket = CreatePackedStatisticsPacket<ionet::PackedPacketTypeStatistics>(
+						packetType,
+						pStatistics->packetTypeStatistics(),
+						[](auto type, const auto& statistics, auto& packedStatistics) {
+							packedStatistics.Type = type;
+							packedStatistics.NumPackets = statistics.NumPackets;
+							packedStatistics.NumBytes = statistics.NumBytes;
+							PackLatencies(
+									statistics.HandlerLatencies,
+									packedStatistics.HandlerMicrosP50,
+									packedStatistics.HandlerMicrosP99,
+									packedStatistics.HandlerMicrosMax);
+							PackLatencies(
+									statistics.ResponseLatencies,
+									packedStatistics.ResponseMicrosP50,
+									packedStatistics.ResponseMicrosP99,
+									packedStatistics.ResponseMicrosMax);
+						});
+				context.response(ionet::PacketPayload(pResponsePacket));
+			};
+		}
+
+		auto CreatePeerPacketStatisticsHandler(const std::shared_ptr<ionet::PacketStatistics>& pStatistics) {
+			return [pStatistics](const auto& packet, auto& context) {
+				if (!ionet::IsPacketValid(packet, ionet::PacketType::Peer_Packet_Statistics))
+					return;
+
+				auto packetType = ionet::PacketType::Peer_Packet_Statistics;
+				auto pResponsePacket = CreatePackedStatisticsPacket<ionet::PackedPeerPacketStatistics>(
+						packetType,
+						pStatistics->peerStatistics(),
+						[](const auto& key, const auto& statistics, auto& packedStatistics) {
+							packedStatistics.IdentityKey = key;
+							packedStatistics.NumPackets = statistics.NumPackets;
+							packedStatistics.NumBytes = statistics.NumBytes;
+							packedStatistics.TotalHandlerMicros = statistics.TotalHandlerMicros;
+						});
+				context.response(ionet::PacketPayload(pResponsePacket));
+			};
+		}
+	}
+
+	void RegisterDiagnosticPacketStatisticsHandlers(ionet::ServerPacketHandlers& handlers) {
+		const auto& pStatistics = handlers.statistics();
+		handlers.registerHandler(ionet::PacketType::Packet_Type_Statistics, CreatePacketTypeStatisticsHandler(pStatistics));
+		handlers.registerHandler(ionet::PacketType::Peer_Packet_Statistics, CreatePeerPacketStatisticsHandler(pStatistics));
+	}
+
+	// endregion
 }}
@@ -38,4 +38,8 @@ namespace catapult { namespace handlers {
 
 	/// Registers a diagnostic block statement handler in \a handlers that responds with data from \a storage.
 	void RegisterDiagnosticBlockStatementHandler(ionet::ServerPacketHandlers& handlers, const io::BlockStorageCache& storage);
+
+	/// Registers diagnostic packet statistics handlers in \a handlers that respond with the packet handler statistics
+	/// (grouped by packet type and by peer) collected by \a handlers.
+	void RegisterDiagnosticPacketStatisticsHandlers(ionet::ServerPacketHandlers& handlers);
 }}
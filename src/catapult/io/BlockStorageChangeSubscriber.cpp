@@ -38,6 +38,10 @@ namespace catapult { namespace io {
 				m_pStorage->dropBlocksAfter(height);
 			}
 
+			void flush() override {
+				// storage writes are synchronous
+			}
+
 		private:
 			std::unique_ptr<LightBlockStorage> m_pStorage;
 		};
@@ -118,20 +118,34 @@ namespace catapult { namespace io {
 		});
 	}
 
+	bool FileQueueReader::tryPeekMessage(uint32_t offset, std::vector<uint8_t>& buffer) const {
+		auto messageIndexValue = m_readerIndexFile.get() + offset;
+		if (!m_writerIndexFile.exists() || messageIndexValue >= m_writerIndexFile.get())
+			return false;
+
+		buffer = ReadAllContents(getExistingMessagePath(messageIndexValue).generic_string());
+		return true;
+	}
+
 	void FileQueueReader::skip(uint32_t count) {
 		for (auto i = 0u; i < count; ++i)
 			process([](const auto&) {});
 	}
 
+	boost::filesystem::path FileQueueReader::getExistingMessagePath(uint64_t indexValue) const {
+		auto messageFilename = m_directory / GetFilename(indexValue);
+		if (!boost::filesystem::exists(messageFilename))
+			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", messageFilename);
+
+		return messageFilename;
+	}
+
 	bool FileQueueReader::process(const consumer<const std::string&>& processFilename) {
 		auto readerIndexValue = m_readerIndexFile.get();
 		if (!m_writerIndexFile.exists() || readerIndexValue >= m_writerIndexFile.get())
 			return false;
 
-		auto nextMessageFilename = m_directory / GetFilename(readerIndexValue);
-		if (!boost::filesystem::exists(nextMessageFilename))
-			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", nextMessageFilename);
-
+		auto nextMessageFilename = getExistingMessagePath(readerIndexValue);
 		processFilename(nextMessageFilename.generic_string());
 
 		m_readerIndexFile.increment();
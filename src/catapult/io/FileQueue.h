@@ -65,10 +65,16 @@ namespace catapult { namespace io {
 		/// Tries to read the next message and forwards it to \a consumer if successful.
 		bool tryReadNextMessage(const consumer<const std::vector<uint8_t>&>& consumer);
 
+		/// Tries to read the message \a offset messages after the next message into \a buffer without consuming it.
+		/// \note This does not modify any queue state, so it can be used to read ahead while another message is processed.
+		bool tryPeekMessage(uint32_t offset, std::vector<uint8_t>& buffer) const;
+
 		/// Skips at most the next \a count messages.
 		void skip(uint32_t count);
 
 	private:
+		boost::filesystem::path getExistingMessagePath(uint64_t indexValue) const;
+
 		bool process(const consumer<const std::string&>& processFilename);
 
 	private:
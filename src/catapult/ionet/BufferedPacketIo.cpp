@@ -30,20 +30,20 @@ namespace catapult { namespace ionet {
 
 		class WriteRequest {
 		public:
-			WriteRequest(PacketIo& io, const PacketPayload& payload)
+			WriteRequest(PacketIo& io, const std::shared_ptr<const PacketPayload>& pPayload)
 					: m_io(io)
-					, m_payload(payload)
+					, m_pPayload(pPayload)
 			{}
 
 		public:
 			template<typename TCallback>
 			void invoke(TCallback callback) {
-				m_io.write(m_payload, callback);
+				m_io.writeShared(m_pPayload, callback);
 			}
 
 		private:
 			PacketIo& m_io;
-			PacketPayload m_payload;
+			std::shared_ptr<const PacketPayload> m_pPayload;
 		};
 
 		// endregion
@@ -172,7 +172,11 @@ namespace catapult { namespace ionet {
 
 		public:
 			void write(const PacketPayload& payload, const WriteCallback& callback) override {
-				auto request = WriteRequest(*m_pIo, payload);
+				writeShared(std::make_shared<const PacketPayload>(payload), callback);
+			}
+
+			void writeShared(const std::shared_ptr<const PacketPayload>& pPayload, const WriteCallback& callback) override {
+				auto request = WriteRequest(*m_pIo, pPayload);
 				m_pWriteOperation->push(request, [pThis = shared_from_this(), callback](auto code) {
 					callback(code);
 				});
@@ -0,0 +1,75 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketType.h"
+#include "catapult/types.h"
+
+namespace catapult { namespace ionet {
+
+#pragma pack(push, 1)
+
+	/// Packed packet handler statistics for a single packet type.
+	struct PackedPacketTypeStatistics {
+		/// Packet type.
+		PacketType Type;
+
+		/// Number of handled packets.
+		uint64_t NumPackets;
+
+		/// Number of handled packet bytes.
+		uint64_t NumBytes;
+
+		/// Median handler execution latency (in microseconds).
+		uint64_t HandlerMicrosP50;
+
+		/// 99th percentile handler execution latency (in microseconds).
+		uint64_t HandlerMicrosP99;
+
+		/// Maximum handler execution latency (in microseconds).
+		uint64_t HandlerMicrosMax;
+
+		/// Median response latency (in microseconds).
+		uint64_t ResponseMicrosP50;
+
+		/// 99th percentile response latency (in microseconds).
+		uint64_t ResponseMicrosP99;
+
+		/// Maximum response latency (in microseconds).
+		uint64_t ResponseMicrosMax;
+	};
+
+	/// Packed packet handler statistics for a single peer.
+	struct PackedPeerPacketStatistics {
+		/// Peer identity key.
+		Key IdentityKey;
+
+		/// Number of handled packets.
+		uint64_t NumPackets;
+
+		/// Number of handled packet bytes.
+		uint64_t NumBytes;
+
+		/// Total handler execution time (in microseconds).
+		uint64_t TotalHandlerMicros;
+	};
+
+#pragma pack(pop)
+}}
@@ -19,7 +19,9 @@
 **/
 
 #include "PacketHandlers.h"
+#include "PacketStatistics.h"
 #include "catapult/utils/Casting.h"
+#include "catapult/utils/StackTimer.h"
 
 namespace catapult { namespace ionet {
 
@@ -69,7 +71,9 @@ namespace catapult { namespace ionet {
 
 	// region ServerPacketHandlers
 
-	ServerPacketHandlers::ServerPacketHandlers(uint32_t maxPacketDataSize) : m_maxPacketDataSize(maxPacketDataSize)
+	ServerPacketHandlers::ServerPacketHandlers(uint32_t maxPacketDataSize)
+			: m_maxPacketDataSize(maxPacketDataSize)
+			, m_pStatistics(std::make_shared<PacketStatistics>())
 	{}
 
 	size_t ServerPacketHandlers::size() const {
@@ -84,6 +88,10 @@ namespace catapult { namespace ionet {
 		return m_maxPacketDataSize;
 	}
 
+	const std::shared_ptr<PacketStatistics>& ServerPacketHandlers::statistics() const {
+		return m_pStatistics;
+	}
+
 	bool ServerPacketHandlers::canProcess(PacketType type) const {
 		Packet packet;
 		packet.Type = type;
@@ -116,7 +124,9 @@ namespace catapult { namespace ionet {
 		}
 
 		CATAPULT_LOG(trace) << "processing " << packet;
+		utils::StackTimer stopwatch;
 		pDescriptor->Handler(packet, context);
+		m_pStatistics->addHandlerSample(packet.Type, packet.Size, context.key(), stopwatch.micros());
 		return true;
 	}
 
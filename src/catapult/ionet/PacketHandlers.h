@@ -25,9 +25,12 @@
 #include "catapult/constants.h"
 #include "catapult/functions.h"
 #include "catapult/types.h"
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
+namespace catapult { namespace ionet { class PacketStatistics; } }
+
 namespace catapult { namespace ionet {
 
 	/// Context passed to a server packet handler function.
@@ -86,6 +89,10 @@ namespace catapult { namespace ionet {
 		/// Gets the max packet data size.
 		uint32_t maxPacketDataSize() const;
 
+		/// Gets the packet handler statistics.
+		/// \note Statistics are shared by all copies of these handlers.
+		const std::shared_ptr<PacketStatistics>& statistics() const;
+
 		/// Determines if \a type can be processed by a registered handler.
 		bool canProcess(PacketType type) const;
 
@@ -94,6 +101,7 @@ namespace catapult { namespace ionet {
 
 		/// Processes \a packet using the specified \a context and returns \c true if the
 		/// packet was processed.
+		/// \note Handler execution time is recorded in statistics.
 		bool process(const Packet& packet, ContextType& context) const;
 
 	public:
@@ -114,6 +122,7 @@ namespace catapult { namespace ionet {
 
 	private:
 		uint32_t m_maxPacketDataSize;
+		std::shared_ptr<PacketStatistics> m_pStatistics;
 		std::vector<PacketHandlerDescriptor> m_descriptors;
 		std::unordered_set<std::string> m_activeAllowedHosts;
 	};
@@ -40,6 +40,12 @@ namespace catapult { namespace ionet {
 		/// Writes \a payload and calls \a callback on completion.
 		virtual void write(const PacketPayload& payload, const WriteCallback& callback) = 0;
 
+		/// Writes shared \a pPayload and calls \a callback on completion.
+		/// \note Implementations can hold on to \a pPayload instead of copying it.
+		virtual void writeShared(const std::shared_ptr<const PacketPayload>& pPayload, const WriteCallback& callback) {
+			write(*pPayload, callback);
+		}
+
 		/// Reads and consumes the next packet and calls \a callback on completion.
 		/// On success, the read packet is passed to \a callback.
 		virtual void read(const ReadCallback& callback) = 0;
@@ -21,6 +21,7 @@
 #include "PacketSocket.h"
 #include "BufferedPacketIo.h"
 #include "Node.h"
+#include "SslSessionCache.h"
 #include "WorkingBuffer.h"
 #include "catapult/thread/StrandOwnerLifetimeExtender.h"
 #include "catapult/thread/TimedCallback.h"
@@ -167,14 +168,14 @@ namespace catapult { namespace ionet {
 			{}
 
 		public:
-			void write(const PacketPayload& payload, const PacketSocket::WriteCallback& callback) {
-				if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
-					CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
+			void write(const std::shared_ptr<const PacketPayload>& pPayload, const PacketSocket::WriteCallback& callback) {
+				if (!IsPacketDataSizeValid(pPayload->header(), m_maxPacketDataSize)) {
+					CATAPULT_LOG(warning) << "bypassing write of malformed " << pPayload->header();
 					callback(SocketOperationCode::Malformed_Data);
 					return;
 				}
 
-				auto pContext = std::make_shared<WriteContext>(payload, callback);
+				auto pContext = std::make_shared<WriteContext>(pPayload, callback);
 				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
 					this->writeNext(ec, pContext);
 				}));
@@ -183,26 +184,26 @@ namespace catapult { namespace ionet {
 		private:
 			struct WriteContext {
 			public:
-				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
-						: m_payload(payload)
+				WriteContext(const std::shared_ptr<const PacketPayload>& pPayload, const PacketSocket::WriteCallback& callback)
+						: m_pPayload(pPayload)
 						, m_callback(callback)
 						, m_nextBufferIndex(0)
 				{}
 
 			public:
 				auto headerBuffer() const {
-					const auto& header = m_payload.header();
+					const auto& header = m_pPayload->header();
 					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
 				}
 
 				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
+					auto rawBuffer = m_pPayload->buffers()[m_nextBufferIndex++];
 					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
 				}
 
 				bool tryComplete(const boost::system::error_code& ec) {
 					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
+					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_pPayload->buffers().size()) {
 						m_callback(lastCode);
 						return true;
 					}
@@ -211,7 +212,7 @@ namespace catapult { namespace ionet {
 				}
 
 			private:
-				const PacketPayload m_payload;
+				const std::shared_ptr<const PacketPayload> m_pPayload;
 				const PacketSocket::WriteCallback m_callback;
 				size_t m_nextBufferIndex;
 			};
@@ -354,6 +355,7 @@ namespace catapult { namespace ionet {
 			void ConfigureSslVerify(Socket& socket, Key& publicKey, const predicate<PacketSocketSslVerifyContext&>& verifyCallback) {
 				socket.set_verify_mode(boost::asio::ssl::verify_peer);
 				socket.set_verify_depth(1);
+				SetSslPublicKeyStorage(*socket.native_handle(), publicKey);
 				socket.set_verify_callback([&publicKey, verifyCallback](auto preverified, auto& asioVerifyContext) {
 					PacketSocketSslVerifyContext verifyContext(preverified, asioVerifyContext, publicKey);
 					return verifyCallback(verifyContext);
@@ -402,14 +404,19 @@ namespace catapult { namespace ionet {
 					// try to (non-blocking) read a single byte from the stream
 					// this will skip any and all protocol-level data (e.g. ssl handshake)
 					uint8_t peekByte;
-					boost::system::error_code ignoredEc;
-					auto numBytesRead = m_socket.read_some(boost::asio::buffer(&peekByte, 1), ignoredEc);
+					boost::system::error_code readEc;
+					auto numBytesRead = m_socket.read_some(boost::asio::buffer(&peekByte, 1), readEc);
 
 					// if a byte was successfully read, trigger the callback
 					if (1 == numBytesRead) {
 						m_buffer.append(peekByte);
 						callback();
+						return;
 					}
+
+					// keep waiting when only protocol-level data (e.g. tls session tickets) was available
+					if (boost::asio::error::would_block == readEc)
+						this->waitForData(callback);
 				}));
 			}
 
@@ -515,7 +522,11 @@ namespace catapult { namespace ionet {
 
 		public:
 			void write(const PacketPayload& payload, const WriteCallback& callback) override {
-				post([payload, callback](auto& socket) { socket.write(payload, callback); });
+				writeShared(std::make_shared<const PacketPayload>(payload), callback);
+			}
+
+			void writeShared(const std::shared_ptr<const PacketPayload>& pPayload, const WriteCallback& callback) override {
+				post([pPayload, callback](auto& socket) { socket.write(pPayload, callback); });
 			}
 
 			void read(const ReadCallback& callback) override {
@@ -757,6 +768,7 @@ namespace catapult { namespace ionet {
 					boost::asio::io_context& ioContext,
 					const PacketSocketOptions& options,
 					const NodeEndpoint& endpoint,
+					const Key& identityKey,
 					const ConnectCallback& callback,
 					TCallbackWrapper& wrapper)
 					: m_callback(callback)
@@ -767,6 +779,8 @@ namespace catapult { namespace ionet {
 					, m_resolver(ioContext)
 					, m_host(endpoint.Host)
 					, m_query(m_host, std::to_string(endpoint.Port))
+					, m_identityKey(identityKey)
+					, m_pSessionCache(options.SslOptions.pSessionCache)
 					, m_isCancelled(false)
 			{}
 
@@ -803,12 +817,18 @@ namespace catapult { namespace ionet {
 				if (shouldAbort(ec, "connecting to"))
 					return invokeCallback(ConnectResult::Connect_Error);
 
+				if (m_pSessionCache && Key() != m_identityKey)
+					BindSslSessionCache(*m_pSocket->impl().native_handle(), m_pSessionCache, m_identityKey);
+
+				m_handshakeTimer = utils::StackTimer();
 				m_pSocket->impl().async_handshake(Socket::client, m_wrapper.wrap([this](const auto& handshakeEc) {
 					this->handleHandshake(handshakeEc);
 				}));
 			}
 
 			void handleHandshake(const boost::system::error_code& ec) {
+				auto isHandshakeSuccess = !ec && !m_isCancelled;
+				NotifySslHandshakeComplete(*m_pSocket->impl().native_handle(), isHandshakeSuccess, m_handshakeTimer.micros());
 				if (shouldAbort(ec, "handshaking with"))
 					return invokeCallback(ConnectResult::Handshake_Error);
 
@@ -846,8 +866,11 @@ namespace catapult { namespace ionet {
 			Resolver m_resolver;
 			std::string m_host;
 			Resolver::query m_query;
+			Key m_identityKey;
+			std::shared_ptr<SslSessionCache> m_pSessionCache;
 			bool m_isCancelled;
 			boost::asio::ip::tcp::endpoint m_endpoint;
+			utils::StackTimer m_handshakeTimer;
 		};
 
 		// implements connect handler using an explicit strand and ensures deterministic shutdown by using enable_shared_from_this
@@ -857,8 +880,9 @@ namespace catapult { namespace ionet {
 					boost::asio::io_context& ioContext,
 					const PacketSocketOptions& options,
 					const NodeEndpoint& endpoint,
+					const Key& identityKey,
 					const ConnectCallback& callback)
-					: m_handler(ioContext, options, endpoint, callback, *this)
+					: m_handler(ioContext, options, endpoint, identityKey, callback, *this)
 					, m_strandWrapper(m_handler.impl().strand()) // use the socket's strand
 			{}
 
@@ -896,7 +920,16 @@ namespace catapult { namespace ionet {
 			const PacketSocketOptions& options,
 			const NodeEndpoint& endpoint,
 			const ConnectCallback& callback) {
-		auto pHandler = std::make_shared<StrandedConnectHandler>(ioContext, options, endpoint, callback);
+		return Connect(ioContext, options, endpoint, Key(), callback);
+	}
+
+	action Connect(
+			boost::asio::io_context& ioContext,
+			const PacketSocketOptions& options,
+			const NodeEndpoint& endpoint,
+			const Key& identityKey,
+			const ConnectCallback& callback) {
+		auto pHandler = std::make_shared<StrandedConnectHandler>(ioContext, options, endpoint, identityKey, callback);
 		pHandler->start();
 		return [pHandler] { pHandler->cancel(); };
 	}
@@ -134,5 +134,15 @@ namespace catapult { namespace ionet {
 			const NodeEndpoint& endpoint,
 			const ConnectCallback& callback);
 
+	/// Attempts to connect a socket to the specified \a endpoint of the node with \a identityKey using \a ioContext and calls
+	/// \a callback on completion configuring the socket with \a options. The returned function can be used to cancel the connect.
+	/// \note When \a options contain a session cache, a tls session previously established with the node is resumed, if possible.
+	action Connect(
+			boost::asio::io_context& ioContext,
+			const PacketSocketOptions& options,
+			const NodeEndpoint& endpoint,
+			const Key& identityKey,
+			const ConnectCallback& callback);
+
 	// endregion
 }}
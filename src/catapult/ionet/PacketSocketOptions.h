@@ -22,6 +22,7 @@
 #include "catapult/utils/TimeSpan.h"
 #include "catapult/functions.h"
 #include <boost/filesystem/path.hpp>
+#include <memory>
 
 namespace boost {
 	namespace asio {
@@ -34,6 +35,9 @@ namespace boost {
 
 namespace catapult { namespace ionet {
 
+	class SslSessionCache;
+	class WorkingBufferPool;
+
 	/// Context passed to ssl verify context predicate.
 	class PacketSocketSslVerifyContext {
 	public:
@@ -70,6 +74,9 @@ namespace catapult { namespace ionet {
 
 		/// Callback used to verify ssl certificates.
 		supplier<predicate<PacketSocketSslVerifyContext&>> VerifyCallbackSupplier;
+
+		/// Optional cache used to resume tls sessions of outgoing connections.
+		std::shared_ptr<SslSessionCache> pSessionCache;
 	};
 
 	/// Packet socket options.
@@ -87,6 +94,9 @@ namespace catapult { namespace ionet {
 		/// Maximum packet data size.
 		size_t MaxPacketDataSize;
 
+		/// Optional pool of working buffers shared across sockets.
+		std::shared_ptr<WorkingBufferPool> pWorkingBufferPool;
+
 		/// Ssl options.
 		PacketSocketSslOptions SslOptions;
 	};
@@ -0,0 +1,132 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PacketStatistics.h"
+#include "catapult/utils/SpinLock.h"
+#include <algorithm>
+#include <atomic>
+#include <list>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr size_t Num_Shards = 16;
+		constexpr size_t Default_Max_Peers = 1'000;
+
+		size_t GetThreadShardIndex() {
+			// assign shards to threads in round robin order so that (up to Num_Shards) threads never contend
+			static std::atomic<size_t> nextShardIndex(0);
+			thread_local auto shardIndex = nextShardIndex++ % Num_Shards;
+			return shardIndex;
+		}
+	}
+
+	struct PacketStatistics::Shard {
+		using PeerList = std::list<std::pair<Key, PeerPacketStatistics>>;
+
+		std::unordered_map<PacketType, PacketTypeStatistics> PacketTypes;
+		PeerList Peers; // most recently active peer first
+		std::unordered_map<Key, PeerList::iterator, utils::ArrayHasher<Key>> PeerIndex;
+		utils::SpinLock Lock;
+
+		PeerPacketStatistics& peer(const Key& key, size_t maxPeers) {
+			auto indexIter = PeerIndex.find(key);
+			if (PeerIndex.cend() != indexIter) {
+				Peers.splice(Peers.begin(), Peers, indexIter->second);
+				return indexIter->second->second;
+			}
+
+			if (Peers.size() >= maxPeers) {
+				PeerIndex.erase(Peers.back().first);
+				Peers.pop_back();
+			}
+
+			Peers.emplace_front(key, PeerPacketStatistics());
+			PeerIndex.emplace(key, Peers.begin());
+			return Peers.front().second;
+		}
+	};
+
+	PacketStatistics::PacketStatistics() : PacketStatistics(Default_Max_Peers)
+	{}
+
+	PacketStatistics::PacketStatistics(size_t maxPeers) : m_maxPeers(std::max<size_t>(1, maxPeers)) {
+		for (auto i = 0u; i < Num_Shards; ++i)
+			m_shards.push_back(std::make_unique<Shard>());
+	}
+
+	PacketStatistics::~PacketStatistics() = default;
+
+	void PacketStatistics::addHandlerSample(PacketType type, uint32_t size, const Key& key, uint64_t elapsedMicros) {
+		auto& shard = localShard();
+		utils::SpinLockGuard guard(shard.Lock);
+
+		auto& packetTypeStatistics = shard.PacketTypes[type];
+		++packetTypeStatistics.NumPackets;
+		packetTypeStatistics.NumBytes += size;
+		packetTypeStatistics.HandlerLatencies.add(elapsedMicros);
+
+		auto& peerStatistics = shard.peer(key, m_maxPeers);
+		++peerStatistics.NumPackets;
+		peerStatistics.NumBytes += size;
+		peerStatistics.TotalHandlerMicros += elapsedMicros;
+	}
+
+	void PacketStatistics::addResponseSample(PacketType type, uint64_t elapsedMicros) {
+		auto& shard = localShard();
+		utils::SpinLockGuard guard(shard.Lock);
+		shard.PacketTypes[type].ResponseLatencies.add(elapsedMicros);
+	}
+
+	PacketStatistics::PacketTypeStatisticsMap PacketStatistics::packetTypeStatistics() const {
+		PacketTypeStatisticsMap statisticsMap;
+		for (const auto& pShard : m_shards) {
+			utils::SpinLockGuard guard(pShard->Lock);
+			for (const auto& pair : pShard->PacketTypes) {
+				auto& statistics = statisticsMap[pair.first];
+				statistics.NumPackets += pair.second.NumPackets;
+				statistics.NumBytes += pair.second.NumBytes;
+				statistics.HandlerLatencies.merge(pair.second.HandlerLatencies);
+				statistics.ResponseLatencies.merge(pair.second.ResponseLatencies);
+			}
+		}
+
+		return statisticsMap;
+	}
+
+	PacketStatistics::PeerStatisticsMap PacketStatistics::peerStatistics() const {
+		PeerStatisticsMap statisticsMap;
+		for (const auto& pShard : m_shards) {
+			utils::SpinLockGuard guard(pShard->Lock);
+			for (const auto& pair : pShard->Peers) {
+				auto& statistics = statisticsMap[pair.first];
+				statistics.NumPackets += pair.second.NumPackets;
+				statistics.NumBytes += pair.second.NumBytes;
+				statistics.TotalHandlerMicros += pair.second.TotalHandlerMicros;
+			}
+		}
+
+		return statisticsMap;
+	}
+
+	PacketStatistics::Shard& PacketStatistics::localShard() {
+		return *m_shards[GetThreadShardIndex()];
+	}
+}}
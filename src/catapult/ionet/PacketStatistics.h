@@ -0,0 +1,105 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketType.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/LatencyHistogram.h"
+#include "catapult/types.h"
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace ionet {
+
+	/// Packet statistics for a single packet type.
+	struct PacketTypeStatistics {
+		/// Number of handled packets.
+		uint64_t NumPackets = 0;
+
+		/// Number of handled packet bytes.
+		uint64_t NumBytes = 0;
+
+		/// Handler execution latencies (in microseconds).
+		utils::LatencyHistogram HandlerLatencies;
+
+		/// Response latencies, including queueing and writing (in microseconds).
+		utils::LatencyHistogram ResponseLatencies;
+	};
+
+	/// Packet statistics for a single peer.
+	struct PeerPacketStatistics {
+		/// Number of handled packets.
+		uint64_t NumPackets = 0;
+
+		/// Number of handled packet bytes.
+		uint64_t NumBytes = 0;
+
+		/// Total handler execution time (in microseconds).
+		uint64_t TotalHandlerMicros = 0;
+	};
+
+	/// Collects packet handler statistics grouped by packet type and peer.
+	/// \note Samples are accumulated in per-thread shards and are only merged when statistics are retrieved.
+	///       Each shard retains statistics for a bounded number of peers and evicts the least recently active peer when full.
+	class PacketStatistics {
+	public:
+		/// Packet type statistics map.
+		using PacketTypeStatisticsMap = std::map<PacketType, PacketTypeStatistics>;
+
+		/// Peer statistics map.
+		using PeerStatisticsMap = std::unordered_map<Key, PeerPacketStatistics, utils::ArrayHasher<Key>>;
+
+	public:
+		/// Creates empty statistics.
+		PacketStatistics();
+
+		/// Creates empty statistics that retain at most \a maxPeers peers per shard.
+		explicit PacketStatistics(size_t maxPeers);
+
+		/// Destroys the statistics.
+		~PacketStatistics();
+
+	public:
+		/// Adds a handler sample for a packet with \a type and \a size from peer identified by \a key
+		/// that took \a elapsedMicros to process.
+		void addHandlerSample(PacketType type, uint32_t size, const Key& key, uint64_t elapsedMicros);
+
+		/// Adds a response sample for a packet with \a type that took \a elapsedMicros to be written.
+		void addResponseSample(PacketType type, uint64_t elapsedMicros);
+
+	public:
+		/// Gets merged statistics grouped by packet type.
+		PacketTypeStatisticsMap packetTypeStatistics() const;
+
+		/// Gets merged statistics grouped by peer.
+		PeerStatisticsMap peerStatistics() const;
+
+	private:
+		struct Shard;
+
+		Shard& localShard();
+
+	private:
+		size_t m_maxPeers;
+		std::vector<std::unique_ptr<Shard>> m_shards;
+	};
+}}
@@ -162,6 +162,12 @@ namespace catapult { namespace ionet {
 	/* Unlocked accounts have been requested by a client. */ \
 	ENUM_VALUE(Unlocked_Accounts, 0x304) \
 	\
+	/* Packet handler statistics grouped by packet type have been requested by a client. */ \
+	ENUM_VALUE(Packet_Type_Statistics, 0x305) \
+	\
+	/* Packet handler statistics grouped by peer have been requested by a client. */ \
+	ENUM_VALUE(Peer_Packet_Statistics, 0x306) \
+	\
 	/* diagnostic info packets have types [0x400, 0x500) - ordered by facility code name */ \
 	\
 	/* Account infos have been requested by a client. */ \
@@ -20,6 +20,8 @@
 
 #include "SocketReader.h"
 #include "PacketSocket.h"
+#include "PacketStatistics.h"
+#include "catapult/utils/StackTimer.h"
 
 namespace catapult { namespace ionet {
 
@@ -79,11 +81,15 @@ namespace catapult { namespace ionet {
 				if (!handlerContext.hasResponse())
 					return invokeCallback(SocketOperationCode::Success);
 
-				write(handlerContext);
+				write(pPacket->Type, handlerContext);
 			}
 
-			void write(const ServerPacketHandlerContext& handlerContext) {
-				m_pWriter->write(handlerContext.response(), [pThis = shared_from_this()](auto code) {
+			void write(PacketType requestType, const ServerPacketHandlerContext& handlerContext) {
+				// capture statistics by value because handlers are externally owned
+				auto pStatistics = m_handlers.statistics();
+				auto stopwatch = utils::StackTimer();
+				m_pWriter->write(handlerContext.response(), [pThis = shared_from_this(), pStatistics, requestType, stopwatch](auto code) {
+					pStatistics->addResponseSample(requestType, stopwatch.micros());
 					pThis->handleWriteCallback(code);
 				});
 			}
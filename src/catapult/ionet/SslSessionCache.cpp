@@ -0,0 +1,284 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "SslSessionCache.h"
+#include "catapult/exceptions.h"
+#include <openssl/ssl.h>
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+
+namespace catapult { namespace ionet {
+
+	uint64_t CalculateAverageHandshakeMicros(const SslHandshakeStatistics& statistics) {
+		auto numHandshakes = statistics.NumFullHandshakes + statistics.NumResumedHandshakes;
+		auto totalMicros = statistics.TotalFullHandshakeMicros + statistics.TotalResumedHandshakeMicros;
+		return 0 == numHandshakes ? 0 : totalMicros / numHandshakes;
+	}
+
+	// region SslSessionCache
+
+	namespace {
+		bool IsExpired(const ssl_session_st& session, time_t now) {
+			return SSL_SESSION_get_time(&session) + SSL_SESSION_get_timeout(&session) <= now;
+		}
+	}
+
+	SslSessionCache::SslSessionCache(size_t maxSize)
+			: m_maxSize(maxSize)
+			, m_numFullHandshakes(0)
+			, m_numResumedHandshakes(0)
+			, m_numFailedHandshakes(0)
+			, m_totalFullHandshakeMicros(0)
+			, m_totalResumedHandshakeMicros(0)
+	{}
+
+	size_t SslSessionCache::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_sessions.size();
+	}
+
+	SslHandshakeStatistics SslSessionCache::statistics() const {
+		SslHandshakeStatistics statistics;
+		statistics.NumFullHandshakes = m_numFullHandshakes;
+		statistics.NumResumedHandshakes = m_numResumedHandshakes;
+		statistics.NumFailedHandshakes = m_numFailedHandshakes;
+		statistics.TotalFullHandshakeMicros = m_totalFullHandshakeMicros;
+		statistics.TotalResumedHandshakeMicros = m_totalResumedHandshakeMicros;
+		return statistics;
+	}
+
+	SslSessionCache::SessionPointer SslSessionCache::find(const Key& identityKey) const {
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = m_sessions.find(identityKey);
+		if (m_sessions.cend() == iter || IsExpired(*iter->second, std::time(nullptr)))
+			return nullptr;
+
+		return iter->second;
+	}
+
+	void SslSessionCache::add(const Key& identityKey, const SessionPointer& pSession) {
+		utils::SpinLockGuard guard(m_lock);
+		if (0 == m_maxSize)
+			return;
+
+		m_sessions.erase(identityKey);
+		if (m_sessions.size() >= m_maxSize)
+			pruneExpired();
+
+		if (m_sessions.size() >= m_maxSize) {
+			auto oldestIter = std::min_element(m_sessions.cbegin(), m_sessions.cend(), [](const auto& lhs, const auto& rhs) {
+				return SSL_SESSION_get_time(lhs.second.get()) < SSL_SESSION_get_time(rhs.second.get());
+			});
+			m_sessions.erase(oldestIter);
+		}
+
+		m_sessions.emplace(identityKey, pSession);
+	}
+
+	void SslSessionCache::remove(const Key& identityKey) {
+		utils::SpinLockGuard guard(m_lock);
+		m_sessions.erase(identityKey);
+	}
+
+	void SslSessionCache::addHandshakeSample(bool isResumed, uint64_t elapsedMicros) {
+		if (isResumed) {
+			++m_numResumedHandshakes;
+			m_totalResumedHandshakeMicros += elapsedMicros;
+		} else {
+			++m_numFullHandshakes;
+			m_totalFullHandshakeMicros += elapsedMicros;
+		}
+	}
+
+	void SslSessionCache::addFailedHandshakeSample() {
+		++m_numFailedHandshakes;
+	}
+
+	void SslSessionCache::pruneExpired() {
+		auto now = std::time(nullptr);
+		for (auto iter = m_sessions.cbegin(); m_sessions.cend() != iter;) {
+			if (IsExpired(*iter->second, now))
+				iter = m_sessions.erase(iter);
+			else
+				++iter;
+		}
+	}
+
+	// endregion
+
+	// region ssl integration
+
+	namespace {
+		// client connection state attached to ssl connections that participate in session resumption
+		struct SessionCacheBinding {
+			std::weak_ptr<SslSessionCache> pSessionCache;
+			Key IdentityKey;
+			bool IsVerified = false;
+		};
+
+		void FreeSessionCacheBinding(void*, void* pData, CRYPTO_EX_DATA*, int, long, void*) {
+			delete static_cast<SessionCacheBinding*>(pData);
+		}
+
+		int GetPublicKeyIndex() {
+			static auto index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+			return index;
+		}
+
+		int GetSessionCacheBindingIndex() {
+			static auto index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, FreeSessionCacheBinding);
+			return index;
+		}
+
+		Key* GetPublicKeyStorage(ssl_st& ssl) {
+			return static_cast<Key*>(SSL_get_ex_data(&ssl, GetPublicKeyIndex()));
+		}
+
+		SessionCacheBinding* GetSessionCacheBinding(ssl_st& ssl) {
+			return static_cast<SessionCacheBinding*>(SSL_get_ex_data(&ssl, GetSessionCacheBindingIndex()));
+		}
+
+		// region client callbacks
+
+		int HandleNewSession(ssl_st* pSsl, ssl_session_st* pSession) {
+			auto* pBinding = GetSessionCacheBinding(*pSsl);
+			if (!pBinding || !pBinding->IsVerified || !SSL_SESSION_is_resumable(pSession))
+				return 0;
+
+			auto pSessionCache = pBinding->pSessionCache.lock();
+			if (!pSessionCache)
+				return 0;
+
+			// returning 1 transfers ownership of the session reference to the cache
+			pSessionCache->add(pBinding->IdentityKey, SslSessionCache::SessionPointer(pSession, SSL_SESSION_free));
+			return 1;
+		}
+
+		// endregion
+
+		// region server callbacks
+
+		int HandleGenerateTicket(ssl_st* pSsl, void*) {
+			// embed the verified client identity in the (server encrypted) ticket so it can be restored upon resumption
+			const auto* pPublicKey = GetPublicKeyStorage(*pSsl);
+			if (!pPublicKey || Key() == *pPublicKey)
+				return 1;
+
+			return SSL_SESSION_set1_ticket_appdata(SSL_get_session(pSsl), pPublicKey->data(), pPublicKey->size());
+		}
+
+		SSL_TICKET_RETURN HandleDecryptTicket(
+				ssl_st* pSsl,
+				ssl_session_st* pSession,
+				const unsigned char*,
+				size_t,
+				SSL_TICKET_STATUS status,
+				void*) {
+			switch (status) {
+			case SSL_TICKET_EMPTY:
+			case SSL_TICKET_NO_DECRYPT:
+				return SSL_TICKET_RETURN_IGNORE_RENEW;
+
+			case SSL_TICKET_SUCCESS:
+			case SSL_TICKET_SUCCESS_RENEW:
+				break;
+
+			default:
+				return SSL_TICKET_RETURN_ABORT;
+			}
+
+			void* pAppData = nullptr;
+			size_t appDataSize = 0;
+			auto* pPublicKey = GetPublicKeyStorage(*pSsl);
+			if (!pPublicKey || !SSL_SESSION_get0_ticket_appdata(pSession, &pAppData, &appDataSize) || Key::Size != appDataSize)
+				return SSL_TICKET_RETURN_IGNORE_RENEW; // fall back to a full handshake
+
+			std::memcpy(pPublicKey->data(), pAppData, Key::Size);
+			return SSL_TICKET_SUCCESS == status ? SSL_TICKET_RETURN_USE : SSL_TICKET_RETURN_USE_RENEW;
+		}
+
+		// endregion
+	}
+
+	void EnableSslSessionResumption(ssl_ctx_st& context) {
+		if (!SSL_CTX_set_num_tickets(&context, 1))
+			CATAPULT_THROW_RUNTIME_ERROR("failed to set the number of server tickets");
+
+		// server rejects resumption of sessions with verified peers unless a session id context is set
+		constexpr auto Session_Id_Context = "catapult";
+		if (!SSL_CTX_set_session_id_context(&context, reinterpret_cast<const unsigned char*>(Session_Id_Context), 8))
+			CATAPULT_THROW_RUNTIME_ERROR("failed to set session id context");
+
+		// sessions are stored in SslSessionCache (client) and in stateless tickets (server)
+		SSL_CTX_set_session_cache_mode(&context, SSL_SESS_CACHE_BOTH | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+		SSL_CTX_sess_set_new_cb(&context, HandleNewSession);
+
+		if (!SSL_CTX_set_session_ticket_cb(&context, HandleGenerateTicket, HandleDecryptTicket, nullptr))
+			CATAPULT_THROW_RUNTIME_ERROR("failed to set session ticket callbacks");
+	}
+
+	void SetSslPublicKeyStorage(ssl_st& ssl, Key& publicKey) {
+		SSL_set_ex_data(&ssl, GetPublicKeyIndex(), &publicKey);
+	}
+
+	void BindSslSessionCache(ssl_st& ssl, const std::shared_ptr<SslSessionCache>& pSessionCache, const Key& identityKey) {
+		auto pBinding = std::make_unique<SessionCacheBinding>();
+		pBinding->pSessionCache = pSessionCache;
+		pBinding->IdentityKey = identityKey;
+		if (!SSL_set_ex_data(&ssl, GetSessionCacheBindingIndex(), pBinding.get()))
+			return;
+
+		pBinding.release();
+
+		auto pSession = pSessionCache->find(identityKey);
+		if (pSession)
+			SSL_set_session(&ssl, pSession.get());
+	}
+
+	void NotifySslHandshakeComplete(ssl_st& ssl, bool isSuccess, uint64_t elapsedMicros) {
+		auto* pBinding = GetSessionCacheBinding(ssl);
+		if (!pBinding)
+			return;
+
+		auto pSessionCache = pBinding->pSessionCache.lock();
+		if (!pSessionCache)
+			return;
+
+		if (!isSuccess) {
+			// drop the cached session in case it caused the failure
+			pSessionCache->remove(pBinding->IdentityKey);
+			pSessionCache->addFailedHandshakeSample();
+			return;
+		}
+
+		auto* pPublicKey = GetPublicKeyStorage(ssl);
+		auto isResumed = 1 == SSL_session_reused(&ssl);
+		if (isResumed && pPublicKey) {
+			// certificates are not exchanged when a session is resumed, so restore the identity verified when it was established
+			*pPublicKey = pBinding->IdentityKey;
+		}
+
+		// only cache subsequent sessions when the remote presented the expected identity
+		pBinding->IsVerified = pPublicKey && pBinding->IdentityKey == *pPublicKey;
+		pSessionCache->addHandshakeSample(isResumed, elapsedMicros);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,120 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#pragma once
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/types.h"
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+struct ssl_ctx_st;
+struct ssl_session_st;
+struct ssl_st;
+
+namespace catapult { namespace ionet {
+
+	/// Tls handshake statistics.
+	struct SslHandshakeStatistics {
+		/// Number of full handshakes.
+		uint64_t NumFullHandshakes = 0;
+
+		/// Number of handshakes that resumed a cached session.
+		uint64_t NumResumedHandshakes = 0;
+
+		/// Number of failed handshakes.
+		uint64_t NumFailedHandshakes = 0;
+
+		/// Total duration of all full handshakes (in microseconds).
+		uint64_t TotalFullHandshakeMicros = 0;
+
+		/// Total duration of all resumed handshakes (in microseconds).
+		uint64_t TotalResumedHandshakeMicros = 0;
+	};
+
+	/// Calculates the average duration of all successful handshakes in \a statistics (in microseconds).
+	uint64_t CalculateAverageHandshakeMicros(const SslHandshakeStatistics& statistics);
+
+	/// Client-side cache of resumable tls sessions keyed by remote node identity key.
+	/// \note Only sessions established with a successfully verified node identity are cached.
+	class SslSessionCache {
+	public:
+		/// Shared ssl session pointer.
+		using SessionPointer = std::shared_ptr<ssl_session_st>;
+
+	public:
+		/// Creates a cache that holds at most \a maxSize sessions.
+		explicit SslSessionCache(size_t maxSize);
+
+	public:
+		/// Gets the number of cached sessions.
+		size_t size() const;
+
+		/// Gets the handshake statistics.
+		SslHandshakeStatistics statistics() const;
+
+	public:
+		/// Finds the unexpired session for the node with \a identityKey.
+		SessionPointer find(const Key& identityKey) const;
+
+		/// Adds \a pSession for the node with \a identityKey, replacing any previously cached session.
+		/// \note When the cache is full, expired sessions are pruned first and then the oldest session is evicted.
+		void add(const Key& identityKey, const SessionPointer& pSession);
+
+		/// Removes the session for the node with \a identityKey.
+		void remove(const Key& identityKey);
+
+		/// Adds a handshake sample that took \a elapsedMicros and did (\a isResumed is \c true) or did not resume a session.
+		void addHandshakeSample(bool isResumed, uint64_t elapsedMicros);
+
+		/// Adds a failed handshake sample.
+		void addFailedHandshakeSample();
+
+	private:
+		void pruneExpired();
+
+	private:
+		size_t m_maxSize;
+		std::unordered_map<Key, SessionPointer, utils::ArrayHasher<Key>> m_sessions;
+		mutable utils::SpinLock m_lock;
+
+		std::atomic<uint64_t> m_numFullHandshakes;
+		std::atomic<uint64_t> m_numResumedHandshakes;
+		std::atomic<uint64_t> m_numFailedHandshakes;
+		std::atomic<uint64_t> m_totalFullHandshakeMicros;
+		std::atomic<uint64_t> m_totalResumedHandshakeMicros;
+	};
+
+	/// Configures \a context to issue session tickets and to support client session resumption.
+	/// \note Tickets carry the verified identity of the client, which is restored when the ticket is redeemed.
+	void EnableSslSessionResumption(ssl_ctx_st& context);
+
+	/// Registers \a publicKey as the identity storage of the connection represented by \a ssl.
+	void SetSslPublicKeyStorage(ssl_st& ssl, Key& publicKey);
+
+	/// Attaches \a pSessionCache to the client connection represented by \a ssl to node with \a identityKey
+	/// and offers a cached session for resumption, if available.
+	void BindSslSessionCache(ssl_st& ssl, const std::shared_ptr<SslSessionCache>& pSessionCache, const Key& identityKey);
+
+	/// Notifies the client connection represented by \a ssl that its handshake completed after \a elapsedMicros
+	/// with success (\a isSuccess is \c true) or failure.
+	/// \note When a session was resumed, the cached identity is written to the registered identity storage.
+	void NotifySslHandshakeComplete(ssl_st& ssl, bool isSuccess, uint64_t elapsedMicros);
+}}
@@ -19,6 +19,7 @@
 **/
 
 #include "WorkingBuffer.h"
+#include "WorkingBufferPool.h"
 
 namespace catapult { namespace ionet {
 
@@ -26,7 +27,15 @@ namespace catapult { namespace ionet {
 			: m_options(options)
 			, m_numDataSizeSamples(0)
 			, m_maxDataSize(0) {
-		m_data.reserve(m_options.WorkingBufferSize);
+		if (m_options.pWorkingBufferPool)
+			m_data = m_options.pWorkingBufferPool->acquire(m_options.WorkingBufferSize);
+		else
+			m_data.reserve(m_options.WorkingBufferSize);
+	}
+
+	WorkingBuffer::~WorkingBuffer() {
+		if (m_options.pWorkingBufferPool)
+			m_options.pWorkingBufferPool->release(std::move(m_data));
 	}
 
 	void WorkingBuffer::append(uint8_t byte) {
@@ -34,6 +43,9 @@ namespace catapult { namespace ionet {
 	}
 
 	AppendContext WorkingBuffer::prepareAppend() {
+		if (m_options.pWorkingBufferPool)
+			reserveAppend();
+
 		AppendContext appendContext(m_data, m_options.WorkingBufferSize);
 		checkMemoryUsage();
 		return appendContext;
@@ -43,6 +55,27 @@ namespace catapult { namespace ionet {
 		return PacketExtractor(m_data, m_options.MaxPacketDataSize);
 	}
 
+	void WorkingBuffer::reserveAppend() {
+		// append context only resizes the buffer when less than half of the append size is available
+		if (m_data.capacity() - m_data.size() >= m_options.WorkingBufferSize / 2)
+			return;
+
+		// grow by (at most) a single append size based on the received data, never on the (unverified) pending packet size,
+		// so that a peer cannot force large allocations by sending only a packet header
+		replaceData(m_data.size() + m_options.WorkingBufferSize);
+	}
+
+	void WorkingBuffer::replaceData(size_t capacity) {
+		auto& pool = *m_options.pWorkingBufferPool;
+		auto data = pool.acquire(capacity);
+		data.resize(m_data.size());
+		if (!m_data.empty())
+			std::memcpy(data.data(), m_data.data(), m_data.size());
+
+		pool.release(std::move(m_data));
+		m_data = std::move(data);
+	}
+
 	void WorkingBuffer::checkMemoryUsage() {
 		// ignore if memory reclamation is disabled
 		if (0 == m_options.WorkingBufferSensitivity)
@@ -60,8 +93,18 @@ namespace catapult { namespace ionet {
 		if (m_data.capacity() - maxDataSize < m_options.WorkingBufferSize)
 			return;
 
+		// ignore if the pooled buffer would not be smaller
+		if (m_options.pWorkingBufferPool && m_options.pWorkingBufferPool->calculateBufferCapacity(maxDataSize) >= m_data.capacity())
+			return;
+
 		CATAPULT_LOG(debug) << "reclaiming memory, decreasing buffer capacity from " << m_data.capacity() << " to " << maxDataSize;
 
+		// return the larger buffer to the pool instead of freeing it
+		if (m_options.pWorkingBufferPool) {
+			replaceData(maxDataSize);
+			return;
+		}
+
 		ByteBuffer dataCopy;
 		dataCopy.reserve(maxDataSize);
 		dataCopy.resize(m_data.size());
@@ -27,11 +27,15 @@
 namespace catapult { namespace ionet {
 
 	/// Buffer for storing working data.
+	/// \note When a working buffer pool is configured, memory is acquired from and released to the (shared) pool.
 	class WorkingBuffer {
 	public:
 		/// Creates an empty working buffer around \a options.
 		explicit WorkingBuffer(const PacketSocketOptions& options);
 
+		/// Destroys the working buffer and releases its memory to the working buffer pool, if any.
+		~WorkingBuffer();
+
 	public:
 		/// Gets a const iterator to the beginning of the buffer
 		inline auto begin() const {
@@ -69,6 +73,8 @@ namespace catapult { namespace ionet {
 		PacketExtractor preparePacketExtractor();
 
 	private:
+		void reserveAppend();
+		void replaceData(size_t capacity);
 		void checkMemoryUsage();
 
 	private:
@@ -0,0 +1,123 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "WorkingBufferPool.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		size_t CalculateSizeClassIndex(size_t minBufferSize, size_t size) {
+			size_t index = 0;
+			auto capacity = minBufferSize;
+			while (capacity < size) {
+				capacity <<= 1;
+				++index;
+			}
+
+			return index;
+		}
+	}
+
+	WorkingBufferPool::WorkingBufferPool(size_t minBufferSize, size_t maxPooledBytes)
+			: m_minBufferSize(minBufferSize)
+			, m_maxPooledBytes(maxPooledBytes)
+			, m_pooledBytes(0)
+			, m_numPooledBuffers(0)
+			, m_numHits(0)
+			, m_numMisses(0) {
+		if (0 == m_minBufferSize)
+			CATAPULT_THROW_INVALID_ARGUMENT("minimum buffer size must be nonzero");
+	}
+
+	size_t WorkingBufferPool::minBufferSize() const {
+		return m_minBufferSize;
+	}
+
+	size_t WorkingBufferPool::maxPooledBytes() const {
+		return m_maxPooledBytes;
+	}
+
+	size_t WorkingBufferPool::pooledBytes() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_pooledBytes;
+	}
+
+	size_t WorkingBufferPool::numPooledBuffers() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_numPooledBuffers;
+	}
+
+	size_t WorkingBufferPool::numHits() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_numHits;
+	}
+
+	size_t WorkingBufferPool::numMisses() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_numMisses;
+	}
+
+	size_t WorkingBufferPool::calculateBufferCapacity(size_t size) const {
+		return m_minBufferSize << CalculateSizeClassIndex(m_minBufferSize, size);
+	}
+
+	ByteBuffer WorkingBufferPool::acquire(size_t size) {
+		auto index = CalculateSizeClassIndex(m_minBufferSize, size);
+		{
+			utils::SpinLockGuard guard(m_lock);
+			if (index < m_sizeClassBuffers.size() && !m_sizeClassBuffers[index].empty()) {
+				auto buffer = std::move(m_sizeClassBuffers[index].back());
+				m_sizeClassBuffers[index].pop_back();
+
+				m_pooledBytes -= buffer.capacity();
+				--m_numPooledBuffers;
+				++m_numHits;
+				return buffer;
+			}
+
+			++m_numMisses;
+		}
+
+		// allocate outside of lock
+		ByteBuffer buffer;
+		buffer.reserve(m_minBufferSize << index);
+		return buffer;
+	}
+
+	void WorkingBufferPool::release(ByteBuffer buffer) {
+		auto capacity = buffer.capacity();
+		auto index = CalculateSizeClassIndex(m_minBufferSize, capacity);
+		if (capacity != m_minBufferSize << index)
+			return;
+
+		buffer.clear();
+
+		utils::SpinLockGuard guard(m_lock);
+		if (m_pooledBytes + capacity > m_maxPooledBytes)
+			return;
+
+		if (m_sizeClassBuffers.size() <= index)
+			m_sizeClassBuffers.resize(index + 1);
+
+		m_sizeClassBuffers[index].push_back(std::move(buffer));
+		m_pooledBytes += capacity;
+		++m_numPooledBuffers;
+	}
+}}
@@ -0,0 +1,75 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#pragma once
+#include "IoTypes.h"
+#include "catapult/utils/SpinLock.h"
+#include <vector>
+
+namespace catapult { namespace ionet {
+
+	/// Pool of size-classed working buffers that is shared across packet sockets.
+	/// \note Size classes are power of two multiples of the minimum buffer size.
+	class WorkingBufferPool {
+	public:
+		/// Creates a pool with a smallest size class of \a minBufferSize bytes that retains at most \a maxPooledBytes
+		/// in idle buffers.
+		WorkingBufferPool(size_t minBufferSize, size_t maxPooledBytes);
+
+	public:
+		/// Gets the capacity of the smallest size class.
+		size_t minBufferSize() const;
+
+		/// Gets the maximum number of bytes retained in idle buffers.
+		size_t maxPooledBytes() const;
+
+		/// Gets the number of bytes retained in idle buffers.
+		size_t pooledBytes() const;
+
+		/// Gets the number of idle buffers.
+		size_t numPooledBuffers() const;
+
+		/// Gets the number of acquisitions that were satisfied by an idle buffer.
+		size_t numHits() const;
+
+		/// Gets the number of acquisitions that required a new allocation.
+		size_t numMisses() const;
+
+	public:
+		/// Gets the capacity of the smallest size class that can hold \a size bytes.
+		size_t calculateBufferCapacity(size_t size) const;
+
+		/// Acquires an empty buffer with a capacity of at least \a size bytes.
+		ByteBuffer acquire(size_t size);
+
+		/// Releases \a buffer to the pool.
+		/// \note Buffer memory is freed when it does not match a size class or when the pool is full.
+		void release(ByteBuffer buffer);
+
+	private:
+		size_t m_minBufferSize;
+		size_t m_maxPooledBytes;
+		size_t m_pooledBytes;
+		size_t m_numPooledBuffers;
+		size_t m_numHits;
+		size_t m_numMisses;
+		std::vector<std::vector<ByteBuffer>> m_sizeClassBuffers;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -19,6 +19,7 @@
 **/
 
 #include "Broker.h"
+#include "MessageQueueIngester.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/io/FileQueue.h"
@@ -29,12 +30,48 @@
 #include "catapult/subscribers/StateChangeReader.h"
 #include "catapult/subscribers/TransactionStatusReader.h"
 #include "catapult/subscribers/UtChangeReader.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/Scheduler.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/asio.hpp>
+#include <sstream>
 
 namespace catapult { namespace local {
 
 	namespace {
+		// when a queue has a large backlog (e.g. after the broker was offline), batch flushes across messages
+		constexpr MessageQueueCatchUpOptions Catch_Up_Options{ 1'000, 250 };
+
+		// poll busy queues almost continuously and back off exponentially when idle
+		const MessageQueuePollingOptions Polling_Options{ utils::TimeSpan::FromMilliseconds(1), utils::TimeSpan::FromMilliseconds(500) };
+
+		// log counters with the same cadence as the (server) diagnostics logging task
+		constexpr auto Counters_Logging_Start_Delay = utils::TimeSpan::FromMinutes(1);
+		constexpr auto Counters_Logging_Repeat_Delay = utils::TimeSpan::FromMinutes(10);
+
+		struct QueueInfo {
+			std::string Name;
+			std::string CounterPrefix;
+		};
+
+		thread::Task CreateCountersLoggingTask(const std::vector<utils::DiagnosticCounter>& counters) {
+			auto task = thread::CreateNamedTask("logging task", [counters]() {
+				std::ostringstream table;
+				table << "--- current counter values ---";
+				for (const auto& counter : counters) {
+					table.width(utils::DiagnosticCounterId::Max_Counter_Name_Size);
+					table << std::endl << counter.id().name() << " : " << counter.value();
+				}
+
+				CATAPULT_LOG(info) << table.str();
+				return thread::make_ready_future(thread::TaskResult::Continue);
+			});
+
+			task.StartDelay = Counters_Logging_Start_Delay;
+			task.NextDelay = thread::CreateUniformDelayGenerator(Counters_Logging_Repeat_Delay);
+			return task;
+		}
+
 		class DefaultBroker final : public Broker {
 		public:
 			explicit DefaultBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper)
@@ -65,6 +102,11 @@ namespace catapult { namespace local {
 				startIngestion();
 			}
 
+		public:
+			std::vector<utils::DiagnosticCounter> counters() const override {
+				return m_counters;
+			}
+
 		public:
 			void shutdown() override {
 				utils::StackLogger stackLogger("shutting down broker", utils::LogLevel::info);
@@ -76,30 +118,70 @@ namespace catapult { namespace local {
 			void startIngestion() {
 				using namespace catapult::subscribers;
 
+				// create all ingesters before the scheduler so that the scheduler is shutdown before their (isolated) pools
+				std::vector<thread::Task> tasks;
+				tasks.push_back(createIngestionTask({ "block_change", "BLK" }, *m_pBlockChangeSubscriber, ReadNextBlockChange));
+				tasks.push_back(createIngestionTask({ "unconfirmed_transactions_change", "UT" }, *m_pUtChangeSubscriber, ReadNextUtChange));
+				tasks.push_back(createIngestionTask({ "partial_transactions_change", "PT" }, *m_pPtChangeSubscriber, ReadNextPtChange));
+				tasks.push_back(createIngestionTask(
+						{ "transaction_status", "TXS" },
+						*m_pTransactionStatusSubscriber,
+						ReadNextTransactionStatus));
+				auto readNextStateChange = [&catapultCache = m_catapultCache](auto& inputStream, auto& subscriber) {
+					return ReadNextStateChange(inputStream, catapultCache.changesStorages(), subscriber);
+				};
+				tasks.push_back(createIngestionTask({ "state_change", "STATE" }, *m_pStateChangeSubscriber, readNextStateChange));
+
+				// add counters registered by extensions (e.g. mongo and zeromq) because the broker does not register any services
+				for (const auto& counter : m_pBootstrapper->extensionManager().diagnosticCounters())
+					m_counters.push_back(counter);
+
+				tasks.push_back(CreateCountersLoggingTask(m_counters));
+
 				auto pServiceGroup = m_pBootstrapper->pool().pushServiceGroup("scheduler");
 				auto pScheduler = pServiceGroup->pushService(thread::CreateScheduler);
-				pScheduler->addTask(createIngestionTask("block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange));
-				pScheduler->addTask(createIngestionTask("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange));
-				pScheduler->addTask(createIngestionTask("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange));
-				pScheduler->addTask(createIngestionTask("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus));
-				pScheduler->addTask(createIngestionTask("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
-						auto& inputStream,
-						auto& subscriber) {
-					return ReadNextStateChange(inputStream, catapultCache.changesStorages(), subscriber);
-				}));
+				for (const auto& task : tasks)
+					pScheduler->addTask(task);
 			}
 
 			template<typename TSubscriber, typename TMessageReader>
-			thread::Task createIngestionTask(const std::string& queueName, TSubscriber& subscriber, TMessageReader readNextMessage) {
+			thread::Task createIngestionTask(const QueueInfo& queueInfo, TSubscriber& subscriber, TMessageReader readNextMessage) {
+				// each queue is ingested on a dedicated thread with a second thread reading ahead
+				auto& ingestionPool = *m_pBootstrapper->pool().pushIsolatedPool(queueInfo.Name + " ingestion", 2);
+				auto queuePath = m_dataDirectory.spoolDir(queueInfo.Name).str();
+				auto pIngester = std::make_shared<MessageQueueIngester>(
+						subscribers::MessageQueueDescriptor{ queuePath, "index_broker_r.dat", "index.dat" },
+						Catch_Up_Options,
+						Polling_Options,
+						[&subscriber, readNextMessage](const auto& buffer) {
+							io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
+							while (!inputStream.eof())
+								readNextMessage(inputStream, subscriber);
+						},
+						[&subscriber]() { subscribers::detail::Flusher<TSubscriber>::Flush(subscriber); },
+						ingestionPool);
+
+				m_counters.emplace_back(utils::DiagnosticCounterId(queueInfo.CounterPrefix + " BACKLOG"), [pIngester]() {
+					return pIngester->numPendingMessages();
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId(queueInfo.CounterPrefix + " LAG"), [pIngester]() {
+					return pIngester->lagMillis();
+				});
+
 				thread::Task task;
 				task.StartDelay = utils::TimeSpan::FromMilliseconds(100);
-				task.NextDelay = thread::CreateUniformDelayGenerator(utils::TimeSpan::FromMilliseconds(500));
-				task.Name = queueName;
-
-				auto queuePath = m_dataDirectory.spoolDir(queueName).str();
-				task.Callback = [&subscriber, readNextMessage, queuePath]() {
-					subscribers::ReadAll({ queuePath, "index_broker_r.dat", "index.dat" }, subscriber, readNextMessage);
-					return thread::make_ready_future(thread::TaskResult::Continue);
+				task.NextDelay = [pIngester]() { return pIngester->nextPollDelay(); };
+				task.Name = queueInfo.Name;
+				task.Callback = [pIngester, &ingestionPool]() {
+					auto pPromise = std::make_shared<thread::promise<thread::TaskResult>>();
+					auto future = pPromise->get_future();
+					boost::asio::post(ingestionPool.ioContext(), [pIngester, pPromise]() {
+						// ingestion failures are not caught so that they terminate the broker instead of silently stopping ingestion
+						pIngester->ingest();
+						pPromise->set_value(thread::TaskResult::Continue);
+					});
+
+					return future;
 				};
 
 				return task;
@@ -121,6 +203,7 @@ namespace catapult { namespace local {
 			std::unique_ptr<subscribers::StateChangeSubscriber> m_pStateChangeSubscriber;
 
 			plugins::PluginManager& m_pluginManager;
+			std::vector<utils::DiagnosticCounter> m_counters;
 		};
 	}
 
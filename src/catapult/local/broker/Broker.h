@@ -20,14 +20,20 @@
 
 #pragma once
 #include "catapult/local/ProcessHost.h"
+#include "catapult/utils/DiagnosticCounter.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace extensions { class ProcessBootstrapper; } }
 
 namespace catapult { namespace local {
 
 	/// Represents a broker.
-	class Broker : public ProcessHost {};
+	class Broker : public ProcessHost {
+	public:
+		/// Gets the broker counters (per queue backlog and lag).
+		virtual std::vector<utils::DiagnosticCounter> counters() const = 0;
+	};
 
 	/// Creates and boots a broker around the specified bootstrapper (\a pBootstrapper).
 	std::unique_ptr<Broker> CreateBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper);
@@ -0,0 +1,167 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MessageQueueIngester.h"
+#include "catapult/io/FileQueue.h"
+#include "catapult/thread/Future.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/StackTimer.h"
+#include <boost/asio.hpp>
+
+namespace catapult { namespace local {
+
+	namespace {
+		using SharedBuffer = std::shared_ptr<std::vector<uint8_t>>;
+
+		thread::future<bool> ReadAhead(
+				thread::IoThreadPool& pool,
+				const std::shared_ptr<io::FileQueueReader>& pReader,
+				uint32_t offset,
+				const SharedBuffer& pBuffer) {
+			auto pPromise = std::make_shared<thread::promise<bool>>();
+			auto future = pPromise->get_future();
+
+			// reader and buffer are shared so that they outlive the ingestion loop if message processing fails
+			boost::asio::post(pool.ioContext(), [pReader, offset, pBuffer, pPromise]() {
+				try {
+					pPromise->set_value(pReader->tryPeekMessage(offset, *pBuffer));
+				} catch (...) {
+					pPromise->set_exception(std::current_exception());
+				}
+			});
+
+			return future;
+		}
+	}
+
+	MessageQueueIngester::MessageQueueIngester(
+			const subscribers::MessageQueueDescriptor& descriptor,
+			const MessageQueueCatchUpOptions& catchUpOptions,
+			const MessageQueuePollingOptions& pollingOptions,
+			const MessageConsumer& messageConsumer,
+			const action& flush,
+			thread::IoThreadPool& readAheadPool)
+			: m_queuePath(descriptor.QueuePath)
+			, m_catchUpOptions(catchUpOptions)
+			, m_pollingOptions(pollingOptions)
+			, m_messageConsumer(messageConsumer)
+			, m_flush(flush)
+			, m_readAheadPool(readAheadPool)
+			, m_pReader(std::make_shared<io::FileQueueReader>(
+					descriptor.QueuePath,
+					descriptor.IndexReaderFilename,
+					descriptor.IndexWriterFilename))
+			, m_numPendingMessages(0)
+			, m_lagMillis(0)
+			, m_numIngestedMessages(0)
+			, m_pollDelayMillis(pollingOptions.MinPollDelay.millis())
+	{}
+
+	size_t MessageQueueIngester::numPendingMessages() const {
+		return m_numPendingMessages;
+	}
+
+	uint64_t MessageQueueIngester::lagMillis() const {
+		return m_lagMillis;
+	}
+
+	uint64_t MessageQueueIngester::numIngestedMessages() const {
+		return m_numIngestedMessages;
+	}
+
+	utils::TimeSpan MessageQueueIngester::nextPollDelay() const {
+		return utils::TimeSpan::FromMilliseconds(m_pollDelayMillis);
+	}
+
+	size_t MessageQueueIngester::ingest() {
+		auto numPendingMessages = m_pReader->pending();
+		m_numPendingMessages = numPendingMessages;
+		if (0 == numPendingMessages) {
+			m_lagMillis = 0;
+			updatePollDelay(0);
+			return 0;
+		}
+
+		size_t maxMessagesPerFlush = 1;
+		if (numPendingMessages < m_catchUpOptions.MinPendingMessages || m_catchUpOptions.MaxMessagesPerFlush <= 1) {
+			CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << m_queuePath;
+		} else {
+			maxMessagesPerFlush = m_catchUpOptions.MaxMessagesPerFlush;
+			CATAPULT_LOG(info)
+					<< "catching up on " << numPendingMessages << " messages from " << m_queuePath
+					<< " (max messages per flush " << maxMessagesPerFlush << ")";
+		}
+
+		utils::StackTimer backlogTimer;
+		size_t numIngestedMessages = 0;
+		uint32_t numUnflushedMessages = 0;
+
+		// messages are only consumed (removed from the queue) after they have been flushed
+		// so that unflushed messages are redelivered when ingestion is interrupted
+		auto flushAndConsume = [this, &numUnflushedMessages]() {
+			m_flush();
+			m_pReader->skip(numUnflushedMessages);
+			numUnflushedMessages = 0;
+		};
+
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>();
+		auto hasMessage = m_pReader->tryPeekMessage(0, *pBuffer);
+		while (hasMessage) {
+			auto pNextBuffer = std::make_shared<std::vector<uint8_t>>();
+			auto nextMessageFuture = ReadAhead(m_readAheadPool, m_pReader, numUnflushedMessages + 1, pNextBuffer);
+
+			m_messageConsumer(*pBuffer);
+			++numUnflushedMessages;
+
+			// read ahead must complete before any message is consumed because its offset is relative to the reader index
+			hasMessage = nextMessageFuture.get();
+			if (numUnflushedMessages >= maxMessagesPerFlush)
+				flushAndConsume();
+
+			++numIngestedMessages;
+			++m_numIngestedMessages;
+			m_numPendingMessages = numIngestedMessages < numPendingMessages ? numPendingMessages - numIngestedMessages : 0;
+			m_lagMillis = backlogTimer.millis();
+			pBuffer = std::move(pNextBuffer);
+		}
+
+		if (0 != numUnflushedMessages)
+			flushAndConsume();
+
+		if (1 != maxMessagesPerFlush)
+			CATAPULT_LOG(info)
+					<< "caught up on " << numIngestedMessages << " messages from " << m_queuePath
+					<< " in " << backlogTimer.millis() << "ms";
+
+		m_numPendingMessages = 0;
+		m_lagMillis = 0;
+		updatePollDelay(numIngestedMessages);
+		return numIngestedMessages;
+	}
+
+	void MessageQueueIngester::updatePollDelay(size_t numIngestedMessages) {
+		if (0 != numIngestedMessages) {
+			m_pollDelayMillis = m_pollingOptions.MinPollDelay.millis();
+			return;
+		}
+
+		m_pollDelayMillis = std::min<uint64_t>(std::max<uint64_t>(1, 2 * m_pollDelayMillis), m_pollingOptions.MaxPollDelay.millis());
+	}
+}}
@@ -0,0 +1,109 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/subscribers/BrokerMessageReaders.h"
+#include "catapult/utils/TimeSpan.h"
+#include <atomic>
+#include <memory>
+
+namespace catapult {
+	namespace io { class FileQueueReader; }
+	namespace thread { class IoThreadPool; }
+}
+
+namespace catapult { namespace local {
+
+	/// Options for draining a message queue backlog.
+	struct MessageQueueCatchUpOptions {
+		/// Minimum number of pending messages that triggers catch-up mode.
+		size_t MinPendingMessages;
+
+		/// Maximum number of messages processed between flushes in catch-up mode.
+		size_t MaxMessagesPerFlush;
+	};
+
+	/// Options for polling a message queue.
+	struct MessageQueuePollingOptions {
+		/// Delay until the next poll after messages have been ingested.
+		utils::TimeSpan MinPollDelay;
+
+		/// Maximum delay until the next poll when the queue is idle.
+		/// \note The delay is doubled after every idle poll until this value is reached.
+		utils::TimeSpan MaxPollDelay;
+	};
+
+	/// Ingests messages from a file based message queue.
+	/// \note Reading of the next message is overlapped with the processing of the current message.
+	///       Messages are only removed from the queue after they have been flushed.
+	class MessageQueueIngester {
+	public:
+		/// Consumes a single message.
+		using MessageConsumer = consumer<const std::vector<uint8_t>&>;
+
+	public:
+		/// Creates an ingester around the queue described by \a descriptor that forwards messages to \a messageConsumer
+		/// and calls \a flush after every message or, when catching up according to \a catchUpOptions, after every batch of messages.
+		/// Messages are read ahead on \a readAheadPool and the queue is polled according to \a pollingOptions.
+		MessageQueueIngester(
+				const subscribers::MessageQueueDescriptor& descriptor,
+				const MessageQueueCatchUpOptions& catchUpOptions,
+				const MessageQueuePollingOptions& pollingOptions,
+				const MessageConsumer& messageConsumer,
+				const action& flush,
+				thread::IoThreadPool& readAheadPool);
+
+	public:
+		/// Gets the number of messages that were pending ingestion at the last poll minus the number of messages since ingested.
+		size_t numPendingMessages() const;
+
+		/// Gets the number of milliseconds the oldest pending message has (approximately) been waiting for ingestion.
+		/// \note This is measured from the first poll that observed a backlog and is \c 0 when the queue is drained.
+		uint64_t lagMillis() const;
+
+		/// Gets the total number of ingested messages.
+		uint64_t numIngestedMessages() const;
+
+		/// Gets the delay until the queue should be polled again.
+		utils::TimeSpan nextPollDelay() const;
+
+	public:
+		/// Ingests all pending messages (including messages written during ingestion) and returns the number of ingested messages.
+		/// \note This function is not reentrant.
+		size_t ingest();
+
+	private:
+		void updatePollDelay(size_t numIngestedMessages);
+
+	private:
+		std::string m_queuePath;
+		MessageQueueCatchUpOptions m_catchUpOptions;
+		MessageQueuePollingOptions m_pollingOptions;
+		MessageConsumer m_messageConsumer;
+		action m_flush;
+		thread::IoThreadPool& m_readAheadPool;
+		std::shared_ptr<io::FileQueueReader> m_pReader;
+
+		std::atomic<size_t> m_numPendingMessages;
+		std::atomic<uint64_t> m_lagMillis;
+		std::atomic<uint64_t> m_numIngestedMessages;
+		std::atomic<uint64_t> m_pollDelayMillis;
+	};
+}}
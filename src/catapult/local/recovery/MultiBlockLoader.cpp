@@ -30,7 +30,11 @@
 #include "catapult/model/Elements.h"
 #include "catapult/observers/NotificationObserverAdapter.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/Future.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/asio.hpp>
+#include <deque>
 
 namespace catapult { namespace local {
 
@@ -101,6 +105,72 @@ namespace catapult { namespace local {
 			const utils::StackTimer& m_stopwatch;
 			size_t m_numLogs;
 		};
+
+		using BlockElementPointer = std::shared_ptr<const model::BlockElement>;
+
+		// loads block elements from storage in order, optionally reading ahead on a thread pool
+		class BlockElementReader {
+		public:
+			BlockElementReader(const io::BlockStorageView& storage, Height startHeight, thread::IoThreadPool* pPool, uint32_t maxPrefetched)
+					: m_storage(storage)
+					, m_nextHeight(startHeight)
+					, m_chainHeight(storage.chainHeight())
+					, m_pPool(pPool)
+					, m_maxPrefetched(maxPrefetched)
+			{}
+
+			~BlockElementReader() {
+				// outstanding loads reference the storage view, so they must complete before it is released
+				for (auto& blockElementFuture : m_blockElementFutures) {
+					try {
+						blockElementFuture.get();
+					} catch (...) {
+						// ignore errors because the block elements will not be used
+					}
+				}
+			}
+
+		public:
+			BlockElementPointer next() {
+				if (!m_pPool || 0 == m_maxPrefetched) {
+					auto pBlockElement = m_storage.loadBlockElement(m_nextHeight);
+					m_nextHeight = m_nextHeight + Height(1);
+					return pBlockElement;
+				}
+
+				prefetch();
+				auto blockElementFuture = std::move(m_blockElementFutures.front());
+				m_blockElementFutures.pop_front();
+				prefetch();
+				return blockElementFuture.get();
+			}
+
+		private:
+			void prefetch() {
+				while (m_blockElementFutures.size() < m_maxPrefetched && m_chainHeight >= m_nextHeight) {
+					auto pPromise = std::make_shared<thread::promise<BlockElementPointer>>();
+					m_blockElementFutures.push_back(pPromise->get_future());
+
+					boost::asio::post(m_pPool->ioContext(), [&storage = m_storage, height = m_nextHeight, pPromise]() {
+						try {
+							pPromise->set_value(storage.loadBlockElement(height));
+						} catch (...) {
+							pPromise->set_exception(std::current_exception());
+						}
+					});
+
+					m_nextHeight = m_nextHeight + Height(1);
+				}
+			}
+
+		private:
+			const io::BlockStorageView& m_storage;
+			Height m_nextHeight;
+			Height m_chainHeight;
+			thread::IoThreadPool* m_pPool;
+			uint32_t m_maxPrefetched;
+			std::deque<thread::future<BlockElementPointer>> m_blockElementFutures;
+		};
 	}
 
 	class BlockChainLoader {
@@ -112,11 +182,15 @@ namespace catapult { namespace local {
 				const BlockDependentNotificationObserverFactory& observerFactory,
 				const plugins::PluginManager& pluginManager,
 				const extensions::LocalNodeStateRef& stateRef,
-				Height startHeight)
+				Height startHeight,
+				thread::IoThreadPool* pPrefetchPool,
+				uint32_t maxPrefetchedBlocks)
 				: m_observerFactory(observerFactory)
 				, m_pluginManager(pluginManager)
 				, m_stateRef(stateRef)
 				, m_startHeight(startHeight)
+				, m_pPrefetchPool(pPrefetchPool)
+				, m_maxPrefetchedBlocks(maxPrefetchedBlocks)
 		{}
 
 	public:
@@ -126,11 +200,14 @@ namespace catapult { namespace local {
 			auto height = m_startHeight;
 			auto pParentBlockElement = storage.loadBlockElement(height - Height(1));
 
+			// block loading (I/O and deserialization) is overlapped with execution when a prefetch pool is available
+			BlockElementReader reader(storage, height, m_pPrefetchPool, m_maxPrefetchedBlocks);
+
 			model::ChainScore score;
 			Hash256 stateHash;
 			auto chainHeight = storage.chainHeight();
 			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
+				auto pBlockElement = reader.next();
 				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
 
 				stateHash = execute(*pBlockElement);
@@ -173,18 +250,36 @@ namespace catapult { namespace local {
 		const plugins::PluginManager& m_pluginManager;
 		const extensions::LocalNodeStateRef& m_stateRef;
 		Height m_startHeight;
+		thread::IoThreadPool* m_pPrefetchPool;
+		uint32_t m_maxPrefetchedBlocks;
 	};
 
+	namespace {
+		model::ChainScore LoadBlockChain(BlockChainLoader& loader) {
+			utils::StackLogger logger("load block chain", utils::LogLevel::important);
+			utils::StackTimer stopwatch;
+			return loader.loadAll(AnalyzeProgressLogger(stopwatch));
+		}
+	}
+
 	model::ChainScore LoadBlockChain(
 			const BlockDependentNotificationObserverFactory& observerFactory,
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight) {
-		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight);
+		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight, nullptr, 0);
+		return LoadBlockChain(loader);
+	}
 
-		utils::StackLogger logger("load block chain", utils::LogLevel::important);
-		utils::StackTimer stopwatch;
-		return loader.loadAll(AnalyzeProgressLogger(stopwatch));
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			thread::IoThreadPool& prefetchPool,
+			uint32_t maxPrefetchedBlocks) {
+		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight, &prefetchPool, maxPrefetchedBlocks);
+		return LoadBlockChain(loader);
 	}
 
 	// endregion
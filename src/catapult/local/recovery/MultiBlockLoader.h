@@ -30,6 +30,7 @@ namespace catapult {
 		struct BlockChainConfiguration;
 	}
 	namespace plugins { class PluginManager; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace local {
@@ -57,4 +58,15 @@ namespace catapult { namespace local {
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight);
+
+	/// Loads a block chain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
+	/// and updating \a stateRef starting with the block at \a startHeight.
+	/// Up to \a maxPrefetchedBlocks blocks are loaded ahead of execution on \a prefetchPool.
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			thread::IoThreadPool& prefetchPool,
+			uint32_t maxPrefetchedBlocks);
 }}
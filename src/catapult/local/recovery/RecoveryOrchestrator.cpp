@@ -47,6 +47,8 @@
 namespace catapult { namespace local {
 
 	namespace {
+		constexpr uint32_t Max_Prefetched_Blocks = 16;
+
 		// region DualStateChangeSubscriber
 
 		class DualStateChangeSubscriber final : public subscribers::StateChangeSubscriber {
@@ -67,6 +69,11 @@ namespace catapult { namespace local {
 				m_subscriber2.notifyStateChange(stateChangeInfo);
 			}
 
+			void flush() override {
+				m_subscriber1.flush();
+				m_subscriber2.flush();
+			}
+
 		private:
 			subscribers::StateChangeSubscriber& m_subscriber1;
 			subscribers::StateChangeSubscriber& m_subscriber2;
@@ -182,7 +189,14 @@ namespace catapult { namespace local {
 				// discontinuities in block analysis (e.g. statistic cache expects consecutive blocks)
 				CATAPULT_LOG(info) << "loading state - block loading required";
 				auto observerFactory = [&pluginManager = m_pluginManager](const auto&) { return pluginManager.createObserver(); };
-				auto partialScore = LoadBlockChain(observerFactory, m_pluginManager, stateRef(), heights.Cache + Height(1));
+				auto& prefetchPool = *m_pBootstrapper->pool().pushIsolatedPool("block loader");
+				auto partialScore = LoadBlockChain(
+						observerFactory,
+						m_pluginManager,
+						stateRef(),
+						heights.Cache + Height(1),
+						prefetchPool,
+						Max_Prefetched_Blocks);
 				m_score += partialScore;
 			}
 
@@ -49,6 +49,10 @@ namespace catapult { namespace local {
 				m_cache.commit(stateChangeInfo.Height);
 			}
 
+			void flush() override {
+				// changes are committed immediately
+			}
+
 		private:
 			cache::CatapultCache& m_cache;
 			extensions::LocalNodeChainScore& m_localNodeScore;
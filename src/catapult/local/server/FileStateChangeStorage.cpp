@@ -34,49 +34,93 @@ namespace catapult { namespace local {
 			io::Write64(outputStream, rawChainScore[1]);
 		}
 
+		// forwards all writes to an underlying stream and tracks the number of bytes written since the last flush
+		class SizeTrackingOutputStream final : public io::OutputStream {
+		public:
+			explicit SizeTrackingOutputStream(std::unique_ptr<io::OutputStream>&& pOutputStream)
+					: m_pOutputStream(std::move(pOutputStream))
+					, m_size(0)
+			{}
+
+		public:
+			size_t size() const {
+				return m_size;
+			}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_pOutputStream->write(buffer);
+				m_size += buffer.Size;
+			}
+
+			void flush() override {
+				m_pOutputStream->flush();
+				m_size = 0;
+			}
+
+		private:
+			std::unique_ptr<io::OutputStream> m_pOutputStream;
+			size_t m_size;
+		};
+
 		class FileStateChangeStorage final : public subscribers::StateChangeSubscriber {
 		public:
 			FileStateChangeStorage(
 					std::unique_ptr<io::OutputStream>&& pOutputStream,
-					const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier)
-					: m_pOutputStream(std::move(pOutputStream))
+					const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier,
+					const consumer<size_t>& stateChangeSizeConsumer)
+					: m_outputStream(std::move(pOutputStream))
 					, m_cacheChangesStoragesSupplier(cacheChangesStoragesSupplier)
+					, m_stateChangeSizeConsumer(stateChangeSizeConsumer)
 			{}
 
 		public:
 			void notifyScoreChange(const model::ChainScore& chainScore) override {
 				write(subscribers::StateChangeOperationType::Score_Change);
 
-				WriteChainScore(*m_pOutputStream, chainScore);
-				m_pOutputStream->flush();
+				WriteChainScore(m_outputStream, chainScore);
+				m_outputStream.flush();
 			}
 
 			void notifyStateChange(const subscribers::StateChangeInfo& stateChangeInfo) override {
 				write(subscribers::StateChangeOperationType::State_Change);
 
-				WriteChainScore(*m_pOutputStream, stateChangeInfo.ScoreDelta);
-				io::Write(*m_pOutputStream, stateChangeInfo.Height);
+				WriteChainScore(m_outputStream, stateChangeInfo.ScoreDelta);
+				io::Write(m_outputStream, stateChangeInfo.Height);
 
 				for (const auto& pStorage : m_cacheChangesStoragesSupplier())
-					pStorage->saveAll(stateChangeInfo.CacheChanges, *m_pOutputStream);
+					pStorage->saveAll(stateChangeInfo.CacheChanges, m_outputStream);
 
-				m_pOutputStream->flush();
+				m_stateChangeSizeConsumer(m_outputStream.size());
+				m_outputStream.flush();
+			}
+
+			void flush() override {
+				// output stream is flushed after every change
 			}
 
 		private:
 			void write(subscribers::StateChangeOperationType operationType) {
-				io::Write8(*m_pOutputStream, utils::to_underlying_type(operationType));
+				io::Write8(m_outputStream, utils::to_underlying_type(operationType));
 			}
 
 		private:
-			std::unique_ptr<io::OutputStream> m_pOutputStream;
+			SizeTrackingOutputStream m_outputStream;
 			supplier<CacheChangesStorages> m_cacheChangesStoragesSupplier;
+			consumer<size_t> m_stateChangeSizeConsumer;
 		};
 	}
 
 	std::unique_ptr<subscribers::StateChangeSubscriber> CreateFileStateChangeStorage(
 			std::unique_ptr<io::OutputStream>&& pOutputStream,
 			const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier) {
-		return std::make_unique<FileStateChangeStorage>(std::move(pOutputStream), cacheChangesStoragesSupplier);
+		return CreateFileStateChangeStorage(std::move(pOutputStream), cacheChangesStoragesSupplier, [](auto) {});
+	}
+
+	std::unique_ptr<subscribers::StateChangeSubscriber> CreateFileStateChangeStorage(
+			std::unique_ptr<io::OutputStream>&& pOutputStream,
+			const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier,
+			const consumer<size_t>& stateChangeSizeConsumer) {
+		return std::make_unique<FileStateChangeStorage>(std::move(pOutputStream), cacheChangesStoragesSupplier, stateChangeSizeConsumer);
 	}
 }}
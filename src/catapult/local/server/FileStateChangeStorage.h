@@ -38,4 +38,11 @@ namespace catapult { namespace local {
 	std::unique_ptr<subscribers::StateChangeSubscriber> CreateFileStateChangeStorage(
 			std::unique_ptr<io::OutputStream>&& pOutputStream,
 			const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier);
+
+	/// Creates a state change storage around \a pOutputStream using \a cacheChangesStoragesSupplier for creating storages
+	/// used for serialization. The size (in bytes) of each spooled state change is forwarded to \a stateChangeSizeConsumer.
+	std::unique_ptr<subscribers::StateChangeSubscriber> CreateFileStateChangeStorage(
+			std::unique_ptr<io::OutputStream>&& pOutputStream,
+			const supplier<CacheChangesStorages>& cacheChangesStoragesSupplier,
+			const consumer<size_t>& stateChangeSizeConsumer);
 }}
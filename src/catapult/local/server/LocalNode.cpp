@@ -25,6 +25,7 @@
 #include "NodeContainerSubscriberAdapter.h"
 #include "NodeUtils.h"
 #include "StaticNodeRefreshService.h"
+#include "catapult/cache/SynchronizedCache.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/CommitStepHandler.h"
 #include "catapult/extensions/ConfigurationUtils.h"
@@ -39,6 +40,7 @@
 #include "catapult/ionet/NodeContainer.h"
 #include "catapult/local/HostUtils.h"
 #include "catapult/utils/StackLogger.h"
+#include <atomic>
 
 namespace catapult { namespace local {
 
@@ -52,10 +54,12 @@ namespace catapult { namespace local {
 		std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateChangeSubscriber(
 				subscribers::SubscriptionManager& subscriptionManager,
 				const cache::CatapultCache& catapultCache,
-				const config::CatapultDataDirectory& dataDirectory) {
+				const config::CatapultDataDirectory& dataDirectory,
+				std::atomic<size_t>& lastStateChangeSize) {
 			subscriptionManager.addStateChangeSubscriber(CreateFileStateChangeStorage(
 					std::make_unique<io::FileQueueWriter>(dataDirectory.spoolDir("state_change").str(), "index_server.dat"),
-					[&catapultCache]() { return catapultCache.changesStorages(); }));
+					[&catapultCache]() { return catapultCache.changesStorages(); },
+					[&lastStateChangeSize](auto size) { lastStateChangeSize = size; }));
 			return subscriptionManager.createStateChangeSubscriber();
 		}
 
@@ -104,10 +108,12 @@ namespace catapult { namespace local {
 							m_nodes,
 							m_config.Node.LocalNetworks,
 							m_bannedNodeIdentitySink))
+					, m_lastStateChangeSize(0)
 					, m_pStateChangeSubscriber(CreateStateChangeSubscriber(
 							m_pBootstrapper->subscriptionManager(),
 							m_catapultCache,
-							m_dataDirectory))
+							m_dataDirectory,
+							m_lastStateChangeSize))
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pluginManager(m_pBootstrapper->pluginManager())
 					, m_isBooted(false) {
@@ -175,12 +181,32 @@ namespace catapult { namespace local {
 					return catapultCache.createView().dependentState().NumTotalTransactions;
 				});
 
+				// cumulative (and maximum) time (in milliseconds) spent waiting for cache locks
+				m_counters.emplace_back(utils::DiagnosticCounterId("CACHE R WAIT"), [&catapultCache]() {
+					return catapultCache.lockWaitStatistics().ReaderWaitMicros / 1000;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("CACHE W WAIT"), [&catapultCache]() {
+					return catapultCache.lockWaitStatistics().WriterWaitMicros / 1000;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("CACHE W MAX"), [&catapultCache]() {
+					return catapultCache.lockWaitStatistics().MaxWriterWaitMicros / 1000;
+				});
+
 				m_pluginManager.addDiagnosticCounters(m_counters, m_catapultCache); // add cache counters
 				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE"), [&source = *m_pUtCache]() {
 					return source.view().size();
 				});
 
 				AddNodeCounters(m_counters, m_nodes);
+
+				// size (in bytes) of the state change spooled for the last block
+				m_counters.emplace_back(utils::DiagnosticCounterId("STATE SPOOL"), [&lastStateChangeSize = m_lastStateChangeSize]() {
+					return lastStateChangeSize.load();
+				});
+
+				// add counters registered by extensions
+				for (const auto& counter : m_pBootstrapper->extensionManager().diagnosticCounters())
+					m_counters.push_back(counter);
 			}
 
 			bool executeAndNotifyNemesis() {
@@ -282,6 +308,7 @@ namespace catapult { namespace local {
 
 			std::unique_ptr<subscribers::FinalizationSubscriber> m_pFinalizationSubscriber;
 			std::unique_ptr<subscribers::NodeSubscriber> m_pNodeSubscriber;
+			std::atomic<size_t> m_lastStateChangeSize;
 			std::unique_ptr<subscribers::StateChangeSubscriber> m_pStateChangeSubscriber;
 			std::unique_ptr<subscribers::TransactionStatusSubscriber> m_pTransactionStatusSubscriber;
 
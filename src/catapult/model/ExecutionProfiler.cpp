@@ -0,0 +1,202 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ExecutionProfiler.h"
+#include "catapult/utils/HexFormatter.h"
+#include "catapult/utils/Logging.h"
+#include <algorithm>
+#include <sstream>
+
+namespace catapult { namespace model {
+
+	namespace {
+		constexpr size_t Max_Slow_Block_Entries = 10;
+
+		std::atomic<uint64_t> g_nextProfilerId(1);
+
+		uint64_t ToKey(ExecutionProfiler::PluginId pluginId, NotificationType type) {
+			return static_cast<uint64_t>(pluginId) << 32 | utils::to_underlying_type(type);
+		}
+
+		void Merge(ExecutionStatistics& statistics, const ExecutionStatistics& other) {
+			statistics.NumCalls += other.NumCalls;
+			statistics.ElapsedNanoseconds += other.ElapsedNanoseconds;
+		}
+
+		template<typename TSamplesMap>
+		void MergeAll(TSamplesMap& samples, const TSamplesMap& other) {
+			for (const auto& pair : other)
+				Merge(samples[pair.first], pair.second);
+		}
+
+		void SortByElapsedTime(std::vector<ExecutionProfileEntry>& entries) {
+			std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+				return lhs.Statistics.ElapsedNanoseconds > rhs.Statistics.ElapsedNanoseconds;
+			});
+		}
+	}
+
+	// samples recorded by a single thread
+	// (recent samples are moved into totals by startBlock and completeBlock)
+	struct ExecutionProfiler::ThreadBucket {
+	public:
+		utils::SpinLock Lock;
+		SamplesMap Totals;
+		SamplesMap Recent;
+	};
+
+	ExecutionProfiler::ExecutionProfiler(const utils::TimeSpan& slowBlockThreshold)
+			: m_id(g_nextProfilerId++)
+			, m_slowBlockThreshold(slowBlockThreshold)
+			, m_numSlowBlocks(0)
+	{}
+
+	ExecutionProfiler::~ExecutionProfiler() = default;
+
+	utils::TimeSpan ExecutionProfiler::slowBlockThreshold() const {
+		return m_slowBlockThreshold;
+	}
+
+	uint64_t ExecutionProfiler::numSlowBlocks() const {
+		return m_numSlowBlocks;
+	}
+
+	ExecutionStatistics ExecutionProfiler::totals() const {
+		ExecutionStatistics statistics;
+		for (const auto& entry : entries())
+			Merge(statistics, entry.Statistics);
+
+		return statistics;
+	}
+
+	std::vector<ExecutionProfileEntry> ExecutionProfiler::entries() const {
+		std::vector<std::shared_ptr<ThreadBucket>> buckets;
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			buckets = m_buckets;
+		}
+
+		SamplesMap samples;
+		for (const auto& pBucket : buckets) {
+			utils::SpinLockGuard guard(pBucket->Lock);
+			MergeAll(samples, pBucket->Totals);
+			MergeAll(samples, pBucket->Recent);
+		}
+
+		return toEntries(samples);
+	}
+
+	ExecutionProfiler::PluginId ExecutionProfiler::registerPlugin(const std::string& name) {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto iter = m_pluginIds.find(name);
+		if (m_pluginIds.cend() != iter)
+			return iter->second;
+
+		auto pluginId = static_cast<PluginId>(m_pluginNames.size());
+		m_pluginIds.emplace(name, pluginId);
+		m_pluginNames.push_back(name);
+		return pluginId;
+	}
+
+	void ExecutionProfiler::record(PluginId pluginId, NotificationType type, uint64_t elapsedNanoseconds) {
+		auto& bucket = threadBucket();
+
+		utils::SpinLockGuard guard(bucket.Lock);
+		auto& statistics = bucket.Recent[ToKey(pluginId, type)];
+		++statistics.NumCalls;
+		statistics.ElapsedNanoseconds += elapsedNanoseconds;
+	}
+
+	void ExecutionProfiler::startBlock() {
+		// move samples recorded outside of block processing (e.g. by unconfirmed transactions) into totals
+		collectThreadSamples();
+	}
+
+	void ExecutionProfiler::completeBlock(Height height, uint64_t elapsedNanoseconds) {
+		auto samples = collectThreadSamples();
+		if (elapsedNanoseconds < m_slowBlockThreshold.millis() * 1'000'000)
+			return;
+
+		++m_numSlowBlocks;
+
+		auto entries = toEntries(samples);
+		std::ostringstream out;
+		out << "block at height " << height << " took " << elapsedNanoseconds / 1'000'000 << "ms";
+		for (auto i = 0u; i < std::min(entries.size(), Max_Slow_Block_Entries); ++i) {
+			const auto& entry = entries[i];
+			out
+					<< std::endl << " + " << entry.PluginName
+					<< " (type 0x" << utils::HexFormat(utils::to_underlying_type(entry.Type)) << ") "
+					<< entry.Statistics.NumCalls << " calls, " << entry.Statistics.ElapsedNanoseconds / 1000 << "us";
+		}
+
+		CATAPULT_LOG(warning) << out.str();
+	}
+
+	ExecutionProfiler::ThreadBucket& ExecutionProfiler::threadBucket() {
+		// each thread caches its buckets by profiler id because profilers can be destroyed and recreated at the same address
+		thread_local std::vector<std::pair<uint64_t, std::shared_ptr<ThreadBucket>>> threadBuckets;
+		for (const auto& pair : threadBuckets) {
+			if (m_id == pair.first)
+				return *pair.second;
+		}
+
+		// drop buckets of destroyed profilers, which are only referenced by this thread
+		threadBuckets.erase(std::remove_if(threadBuckets.begin(), threadBuckets.end(), [](const auto& pair) {
+			return 1 == pair.second.use_count();
+		}), threadBuckets.end());
+
+		auto pBucket = std::make_shared<ThreadBucket>();
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_buckets.push_back(pBucket);
+		}
+
+		threadBuckets.emplace_back(m_id, pBucket);
+		return *pBucket;
+	}
+
+	ExecutionProfiler::SamplesMap ExecutionProfiler::collectThreadSamples() {
+		auto& bucket = threadBucket();
+
+		utils::SpinLockGuard guard(bucket.Lock);
+		MergeAll(bucket.Totals, bucket.Recent);
+
+		SamplesMap samples;
+		samples.swap(bucket.Recent);
+		return samples;
+	}
+
+	std::vector<ExecutionProfileEntry> ExecutionProfiler::toEntries(const SamplesMap& samples) const {
+		std::vector<ExecutionProfileEntry> entries;
+		entries.reserve(samples.size());
+		{
+			std::lock_guard<std::mutex> guard(m_mutex);
+			for (const auto& pair : samples) {
+				auto pluginId = static_cast<PluginId>(pair.first >> 32);
+				auto type = static_cast<NotificationType>(pair.first & 0xFFFF'FFFF);
+				entries.push_back(ExecutionProfileEntry{ m_pluginNames[pluginId], type, pair.second });
+			}
+		}
+
+		SortByElapsedTime(entries);
+		return entries;
+	}
+}}
@@ -0,0 +1,148 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationType.h"
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/utils/TimeSpan.h"
+#include "catapult/types.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace model {
+
+	/// Cumulative execution statistics.
+	struct ExecutionStatistics {
+		/// Number of calls.
+		uint64_t NumCalls = 0;
+
+		/// Total elapsed nanoseconds.
+		uint64_t ElapsedNanoseconds = 0;
+	};
+
+	/// Execution statistics of a single plugin for a single notification type.
+	struct ExecutionProfileEntry {
+		/// Plugin name.
+		std::string PluginName;
+
+		/// Notification type.
+		NotificationType Type;
+
+		/// Execution statistics.
+		ExecutionStatistics Statistics;
+	};
+
+	/// Profiles the execution of (observer and validator) plugins by notification type.
+	/// \note Samples are aggregated in per thread buckets, so recording a sample never contends with other recording threads.
+	class ExecutionProfiler : public utils::NonCopyable {
+	public:
+		/// Identifier of a profiled plugin.
+		using PluginId = uint32_t;
+
+		/// Records the time spent in a scope.
+		class ScopedSample {
+		private:
+			using Clock = std::chrono::steady_clock;
+
+		public:
+			/// Creates a sample of plugin \a pluginId processing a notification of \a type that is recorded in \a profiler.
+			ScopedSample(ExecutionProfiler& profiler, PluginId pluginId, NotificationType type)
+					: m_profiler(profiler)
+					, m_pluginId(pluginId)
+					, m_type(type)
+					, m_start(Clock::now())
+			{}
+
+			/// Records the sample.
+			~ScopedSample() {
+				auto elapsedDuration = Clock::now() - m_start;
+				auto elapsedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsedDuration).count();
+				m_profiler.record(m_pluginId, m_type, static_cast<uint64_t>(elapsedNanoseconds));
+			}
+
+		private:
+			ExecutionProfiler& m_profiler;
+			PluginId m_pluginId;
+			NotificationType m_type;
+			Clock::time_point m_start;
+		};
+
+	private:
+		using SamplesMap = std::unordered_map<uint64_t, ExecutionStatistics>;
+		struct ThreadBucket;
+
+	public:
+		/// Creates a profiler that reports blocks taking longer than \a slowBlockThreshold.
+		explicit ExecutionProfiler(const utils::TimeSpan& slowBlockThreshold);
+
+		/// Destroys the profiler.
+		~ExecutionProfiler();
+
+	public:
+		/// Gets the slow block threshold.
+		utils::TimeSpan slowBlockThreshold() const;
+
+		/// Gets the number of slow blocks.
+		uint64_t numSlowBlocks() const;
+
+		/// Gets the cumulative statistics of all plugins.
+		ExecutionStatistics totals() const;
+
+		/// Gets the cumulative statistics of all plugins by notification type ordered by descending elapsed time.
+		std::vector<ExecutionProfileEntry> entries() const;
+
+	public:
+		/// Registers a plugin with \a name and returns its identifier.
+		/// \note Plugins with the same name share an identifier.
+		PluginId registerPlugin(const std::string& name);
+
+		/// Records a call to plugin \a pluginId with a notification of \a type that took \a elapsedNanoseconds.
+		void record(PluginId pluginId, NotificationType type, uint64_t elapsedNanoseconds);
+
+	public:
+		/// Starts profiling a block on the calling thread.
+		void startBlock();
+
+		/// Completes profiling a block at \a height on the calling thread that took \a elapsedNanoseconds
+		/// and logs the samples recorded since the matching startBlock call when the block is slow.
+		void completeBlock(Height height, uint64_t elapsedNanoseconds);
+
+	private:
+		ThreadBucket& threadBucket();
+		SamplesMap collectThreadSamples();
+		std::vector<ExecutionProfileEntry> toEntries(const SamplesMap& samples) const;
+
+	private:
+		uint64_t m_id;
+		utils::TimeSpan m_slowBlockThreshold;
+		std::atomic<uint64_t> m_numSlowBlocks;
+
+		mutable std::mutex m_mutex;
+		std::unordered_map<std::string, PluginId> m_pluginIds;
+		std::vector<std::string> m_pluginNames;
+		std::vector<std::shared_ptr<ThreadBucket>> m_buckets;
+	};
+}}
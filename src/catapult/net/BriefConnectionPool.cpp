@@ -0,0 +1,129 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "BriefConnectionPool.h"
+
+namespace catapult { namespace net {
+
+	namespace {
+		void CloseAll(const std::vector<ionet::PacketSocketInfo>& socketInfos) {
+			for (const auto& socketInfo : socketInfos)
+				socketInfo.socket()->close();
+		}
+	}
+
+	BriefConnectionPool::BriefConnectionPool(const utils::TimeSpan& timeToLive)
+			: m_timeToLiveMillis(timeToLive.millis())
+			, m_numHits(0)
+			, m_numMisses(0)
+	{}
+
+	BriefConnectionPool::~BriefConnectionPool() {
+		clear();
+	}
+
+	size_t BriefConnectionPool::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_connections.size();
+	}
+
+	size_t BriefConnectionPool::numHits() const {
+		return m_numHits;
+	}
+
+	size_t BriefConnectionPool::numMisses() const {
+		return m_numMisses;
+	}
+
+	ionet::PacketSocketInfo BriefConnectionPool::take(const Key& identityKey) {
+		ionet::PacketSocketInfo socketInfo;
+		std::vector<ionet::PacketSocketInfo> expiredSocketInfos;
+		{
+			utils::SpinLockGuard guard(m_lock);
+			expiredSocketInfos = pruneExpired();
+
+			auto iter = m_connections.find(identityKey);
+			if (m_connections.end() != iter) {
+				socketInfo = iter->second.SocketInfo;
+				m_connections.erase(iter);
+			}
+		}
+
+		CloseAll(expiredSocketInfos);
+		if (socketInfo)
+			++m_numHits;
+		else
+			++m_numMisses;
+
+		return socketInfo;
+	}
+
+	void BriefConnectionPool::give(const Key& identityKey, const ionet::PacketSocketInfo& socketInfo) {
+		if (!socketInfo)
+			return;
+
+		std::vector<ionet::PacketSocketInfo> expiredSocketInfos;
+		{
+			utils::SpinLockGuard guard(m_lock);
+			expiredSocketInfos = pruneExpired();
+
+			// keep the most recently used connection
+			auto iter = m_connections.find(identityKey);
+			if (m_connections.end() != iter) {
+				expiredSocketInfos.push_back(iter->second.SocketInfo);
+				m_connections.erase(iter);
+			}
+
+			m_connections.emplace(identityKey, IdleConnection{ socketInfo, utils::StackTimer() });
+		}
+
+		CloseAll(expiredSocketInfos);
+	}
+
+	void BriefConnectionPool::clear() {
+		std::vector<ionet::PacketSocketInfo> socketInfos;
+		{
+			utils::SpinLockGuard guard(m_lock);
+			for (const auto& pair : m_connections)
+				socketInfos.push_back(pair.second.SocketInfo);
+
+			m_connections.clear();
+		}
+
+		CloseAll(socketInfos);
+	}
+
+	bool BriefConnectionPool::isExpired(const IdleConnection& connection) const {
+		return connection.IdleTimer.millis() >= m_timeToLiveMillis;
+	}
+
+	std::vector<ionet::PacketSocketInfo> BriefConnectionPool::pruneExpired() {
+		std::vector<ionet::PacketSocketInfo> expiredSocketInfos;
+		for (auto iter = m_connections.begin(); m_connections.end() != iter;) {
+			if (isExpired(iter->second)) {
+				expiredSocketInfos.push_back(iter->second.SocketInfo);
+				iter = m_connections.erase(iter);
+			} else {
+				++iter;
+			}
+		}
+
+		return expiredSocketInfos;
+	}
+}}
@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#pragma once
+#include "catapult/ionet/PacketSocket.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/utils/StackTimer.h"
+#include "catapult/utils/TimeSpan.h"
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace net {
+
+	/// Pool of idle connections that were used for brief requests and can be reused within a time-to-live.
+	/// \note At most one idle connection is kept per node identity.
+	class BriefConnectionPool {
+	public:
+		/// Creates a pool that keeps idle connections alive for \a timeToLive.
+		explicit BriefConnectionPool(const utils::TimeSpan& timeToLive);
+
+		/// Destroys the pool and closes all idle connections.
+		~BriefConnectionPool();
+
+	public:
+		/// Gets the number of idle connections.
+		size_t size() const;
+
+		/// Gets the number of connections that were reused.
+		size_t numHits() const;
+
+		/// Gets the number of times no reusable connection was available.
+		size_t numMisses() const;
+
+	public:
+		/// Takes the idle connection to the node with \a identityKey.
+		/// \note An empty info is returned when there is no unexpired idle connection.
+		ionet::PacketSocketInfo take(const Key& identityKey);
+
+		/// Returns the connection represented by \a socketInfo to the node with \a identityKey to the pool.
+		void give(const Key& identityKey, const ionet::PacketSocketInfo& socketInfo);
+
+		/// Closes all idle connections.
+		void clear();
+
+	private:
+		struct IdleConnection {
+			ionet::PacketSocketInfo SocketInfo;
+			utils::StackTimer IdleTimer;
+		};
+
+		using IdleConnections = std::unordered_map<Key, IdleConnection, utils::ArrayHasher<Key>>;
+
+	private:
+		bool isExpired(const IdleConnection& connection) const;
+
+		std::vector<ionet::PacketSocketInfo> pruneExpired();
+
+	private:
+		uint64_t m_timeToLiveMillis;
+		IdleConnections m_connections;
+		mutable utils::SpinLock m_lock;
+
+		std::atomic<size_t> m_numHits;
+		std::atomic<size_t> m_numMisses;
+	};
+}}
@@ -19,11 +19,13 @@
 **/
 
 #pragma once
+#include "BriefConnectionPool.h"
 #include "NodeRequestResult.h"
 #include "PeerConnectCode.h"
 #include "ServerConnector.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/PacketSocket.h"
+#include "catapult/ionet/SslSessionCache.h"
 #include "catapult/thread/Future.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/TimedCallback.h"
@@ -97,28 +99,30 @@ namespace catapult { namespace net {
 				complete(result);
 			}
 
-			void complete(thread::future<ResponseType>&& responseFuture) {
+			NodeRequestResult complete(thread::future<ResponseType>&& responseFuture) {
 				try {
 					const auto& response = responseFuture.get();
 					if (!m_compatibilityChecker.isResponseCompatible(m_requestNode, response))
 						return complete(NodeRequestResult::Failure_Incompatible);
 
-					complete(response);
+					return complete(response);
 				} catch (const catapult_runtime_error& e) {
 					CATAPULT_LOG(warning)
 							<< "exception thrown during " << TRequestPolicy::Friendly_Name << " request to '"
 							<< m_requestNode << "': " << e.what();
-					complete(NodeRequestResult::Failure_Interaction);
+					return complete(NodeRequestResult::Failure_Interaction);
 				}
 			}
 
 		private:
-			void complete(NodeRequestResult result) {
+			NodeRequestResult complete(NodeRequestResult result) {
 				m_callback(result, ResponseType());
+				return result;
 			}
 
-			void complete(const ResponseType& response) {
+			NodeRequestResult complete(const ResponseType& response) {
 				m_callback(NodeRequestResult::Success, response);
+				return NodeRequestResult::Success;
 			}
 
 		private:
@@ -142,6 +146,10 @@ namespace catapult { namespace net {
 				, m_responseCompatibilityChecker(responseCompatibilityChecker)
 				, m_requestTimeout(settings.Timeout)
 				, m_pConnector(CreateServerConnector(pool, serverPublicKey, settings, TRequestPolicy::Friendly_Name))
+				, m_pConnectionPool(utils::TimeSpan() == settings.BriefConnectionReuseDuration
+						? nullptr
+						: std::make_shared<BriefConnectionPool>(settings.BriefConnectionReuseDuration))
+				, m_pSessionCache(settings.SslOptions.pSessionCache)
 				, m_numTotalRequests(0)
 				, m_numSuccessfulRequests(0)
 		{}
@@ -162,6 +170,21 @@ namespace catapult { namespace net {
 			return m_numSuccessfulRequests;
 		}
 
+		/// Gets the number of idle connections available for reuse.
+		size_t numPooledConnections() const {
+			return m_pConnectionPool ? m_pConnectionPool->size() : 0;
+		}
+
+		/// Gets the number of requests that reused an idle connection.
+		size_t numReusedConnections() const {
+			return m_pConnectionPool ? m_pConnectionPool->numHits() : 0;
+		}
+
+		/// Gets the tls handshake statistics.
+		ionet::SslHandshakeStatistics handshakeStatistics() const {
+			return m_pSessionCache ? m_pSessionCache->statistics() : ionet::SslHandshakeStatistics();
+		}
+
 	public:
 		/// Initiates a request for data from \a node and calls \a callback on completion.
 		void beginRequest(const ionet::Node& node, const CallbackType& callback) {
@@ -174,29 +197,52 @@ namespace catapult { namespace net {
 			};
 
 			auto pRequest = std::make_shared<NodeRequest>(m_ioContext, node, m_responseCompatibilityChecker, wrappedCallback);
-			m_pConnector->connect(node, [pRequest, requestTimeout = m_requestTimeout](auto connectCode, const auto& socketInfo) {
-				auto pSocket = socketInfo.socket();
-				pRequest->setTimeout(requestTimeout, pSocket);
+			const auto& identityKey = node.identity().PublicKey;
+			auto pooledSocketInfo = m_pConnectionPool ? m_pConnectionPool->take(identityKey) : ionet::PacketSocketInfo();
+			if (pooledSocketInfo)
+				return sendRequest(pRequest, identityKey, pooledSocketInfo);
 
-				if (PeerConnectCode::Accepted != connectCode)
+			m_pConnector->connect(node, [pThis = this->shared_from_this(), pRequest, identityKey](
+					auto connectCode,
+					const auto& socketInfo) {
+				if (PeerConnectCode::Accepted != connectCode) {
+					pRequest->setTimeout(pThis->m_requestTimeout, socketInfo.socket());
 					return pRequest->complete(connectCode);
+				}
 
-				TRequestPolicy::CreateFuture(*pSocket, socketInfo.host()).then([pSocket, pRequest](auto&& responseFuture) {
-					pRequest->complete(std::move(responseFuture));
-				});
+				pThis->sendRequest(pRequest, identityKey, socketInfo);
 			});
 		}
 
 		/// Shuts down all connections.
 		void shutdown() {
+			if (m_pConnectionPool)
+				m_pConnectionPool->clear();
+
 			m_pConnector->shutdown();
 		}
 
+	private:
+		void sendRequest(const std::shared_ptr<NodeRequest>& pRequest, const Key& identityKey, const ionet::PacketSocketInfo& socketInfo) {
+			auto pSocket = socketInfo.socket();
+			pRequest->setTimeout(m_requestTimeout, pSocket);
+
+			auto pConnectionPool = m_pConnectionPool;
+			TRequestPolicy::CreateFuture(*pSocket, socketInfo.host()).then([pConnectionPool, identityKey, socketInfo, pRequest](
+					auto&& responseFuture) {
+				// only reuse connections that completed a request successfully
+				if (NodeRequestResult::Success == pRequest->complete(std::move(responseFuture)) && pConnectionPool)
+					pConnectionPool->give(identityKey, socketInfo);
+			});
+		}
+
 	private:
 		boost::asio::io_context& m_ioContext;
 		TResponseCompatibilityChecker m_responseCompatibilityChecker;
 		utils::TimeSpan m_requestTimeout;
 		std::shared_ptr<ServerConnector> m_pConnector;
+		std::shared_ptr<BriefConnectionPool> m_pConnectionPool;
+		std::shared_ptr<ionet::SslSessionCache> m_pSessionCache;
 
 		std::atomic<size_t> m_numTotalRequests;
 		std::atomic<size_t> m_numSuccessfulRequests;
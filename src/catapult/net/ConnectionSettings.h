@@ -41,6 +41,7 @@ namespace catapult { namespace net {
 				, MaxPacketDataSize(utils::FileSize::FromBytes(Default_Max_Packet_Data_Size))
 				, AllowIncomingSelfConnections(true)
 				, AllowOutgoingSelfConnections(false)
+				, BriefConnectionReuseDuration(utils::TimeSpan::FromSeconds(0)) // connection reuse disabled
 		{}
 
 	public:
@@ -59,6 +60,9 @@ namespace catapult { namespace net {
 		/// Socket working buffer sensitivity.
 		size_t SocketWorkingBufferSensitivity;
 
+		/// Optional pool of socket working buffers shared across connections.
+		std::shared_ptr<ionet::WorkingBufferPool> pSocketWorkingBufferPool;
+
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
@@ -68,6 +72,10 @@ namespace catapult { namespace net {
 		/// Allows outgoing self connections when \c true.
 		bool AllowOutgoingSelfConnections;
 
+		/// Duration idle brief connections are kept alive for reuse by subsequent requests.
+		/// \note \c 0 will disable connection reuse.
+		utils::TimeSpan BriefConnectionReuseDuration;
+
 		/// Ssl options.
 		ionet::PacketSocketSslOptions SslOptions;
 
@@ -78,6 +86,7 @@ namespace catapult { namespace net {
 			options.AcceptHandshakeTimeout = Timeout;
 			options.WorkingBufferSize = SocketWorkingBufferSize.bytes();
 			options.WorkingBufferSensitivity = SocketWorkingBufferSensitivity;
+			options.pWorkingBufferPool = pSocketWorkingBufferPool;
 			options.MaxPacketDataSize = MaxPacketDataSize.bytes();
 			options.SslOptions = SslOptions;
 			return options;
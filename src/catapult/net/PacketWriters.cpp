@@ -24,21 +24,137 @@
 #include "catapult/ionet/PacketSocket.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/TimedCallback.h"
+#include "catapult/utils/Casting.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/utils/ModificationSafeIterableContainer.h"
 #include "catapult/utils/SpinLock.h"
 #include "catapult/utils/ThrottleLogger.h"
+#include <array>
+#include <deque>
 #include <list>
 
 namespace catapult { namespace net {
 
+	BroadcastLane GetBroadcastLane(ionet::PacketType type) {
+		switch (type) {
+		case ionet::PacketType::Push_Block:
+		case ionet::PacketType::Push_Finalization_Messages:
+			return BroadcastLane::High;
+
+		default:
+			return BroadcastLane::Normal;
+		}
+	}
+
 	namespace {
 		using SocketPointer = std::shared_ptr<ionet::PacketSocket>;
+		using SharedPacketPayload = std::shared_ptr<const ionet::PacketPayload>;
+
+		constexpr auto Num_Broadcast_Lanes = utils::to_underlying_type(BroadcastLane::Normal) + 1u;
+
+		// region BroadcastQueue
+
+		using BroadcastLaneCounters = std::array<std::atomic<size_t>, Num_Broadcast_Lanes>;
+
+		// queues broadcast payloads for a single writer and keeps at most one broadcast write outstanding
+		// so that high priority payloads can overtake normal priority payloads that have not yet been written
+		class BroadcastQueue : public std::enable_shared_from_this<BroadcastQueue> {
+		public:
+			BroadcastQueue(
+					const std::shared_ptr<ionet::PacketIo>& pIo,
+					const std::shared_ptr<BroadcastLaneCounters>& pCounters,
+					const action& errorHandler)
+					: m_pIo(pIo)
+					, m_pCounters(pCounters)
+					, m_errorHandler(errorHandler)
+					, m_isWriting(false)
+					, m_isFaulted(false)
+			{}
+
+			~BroadcastQueue() {
+				clear();
+			}
+
+		public:
+			void push(BroadcastLane lane, const SharedPacketPayload& pPayload) {
+				{
+					utils::SpinLockGuard guard(m_lock);
+					if (m_isFaulted)
+						return;
+
+					m_lanes[utils::to_underlying_type(lane)].push_back(pPayload);
+					++(*m_pCounters)[utils::to_underlying_type(lane)];
+					if (m_isWriting)
+						return;
+
+					m_isWriting = true;
+				}
+
+				next();
+			}
+
+		private:
+			void next() {
+				SharedPacketPayload pPayload;
+				{
+					utils::SpinLockGuard guard(m_lock);
+					for (auto i = 0u; i < Num_Broadcast_Lanes; ++i) {
+						if (m_lanes[i].empty())
+							continue;
+
+						pPayload = m_lanes[i].front();
+						m_lanes[i].pop_front();
+						--(*m_pCounters)[i];
+						break;
+					}
+
+					if (!pPayload) {
+						m_isWriting = false;
+						return;
+					}
+				}
+
+				m_pIo->writeShared(pPayload, [pThis = shared_from_this()](auto code) {
+					if (ionet::SocketOperationCode::Success == code)
+						return pThis->next();
+
+					CATAPULT_LOG(warning) << "closing socket due to broadcast write error (" << code << ")";
+					pThis->fault();
+					pThis->m_errorHandler();
+				});
+			}
+
+			void fault() {
+				utils::SpinLockGuard guard(m_lock);
+				m_isFaulted = true;
+				m_isWriting = false;
+				clear();
+			}
+
+			void clear() {
+				for (auto i = 0u; i < Num_Broadcast_Lanes; ++i) {
+					(*m_pCounters)[i] -= m_lanes[i].size();
+					m_lanes[i].clear();
+				}
+			}
+
+		private:
+			std::shared_ptr<ionet::PacketIo> m_pIo;
+			std::shared_ptr<BroadcastLaneCounters> m_pCounters;
+			action m_errorHandler;
+			std::array<std::deque<SharedPacketPayload>, Num_Broadcast_Lanes> m_lanes;
+			bool m_isWriting;
+			bool m_isFaulted;
+			utils::SpinLock m_lock;
+		};
+
+		// endregion
 
 		struct WriterState {
 			ionet::Node Node;
 			SocketPointer pSocket;
 			std::shared_ptr<ionet::PacketIo> pBufferedIo;
+			std::shared_ptr<BroadcastQueue> pBroadcastQueue;
 		};
 
 		struct WriterStateWithAvailability : public WriterState {
@@ -50,6 +166,7 @@ namespace catapult { namespace net {
 				Node = state.Node;
 				pSocket = state.pSocket;
 				pBufferedIo = state.pBufferedIo;
+				pBroadcastQueue = state.pBroadcastQueue;
 			}
 
 		public:
@@ -283,7 +400,11 @@ namespace catapult { namespace net {
 					, m_pClientConnector(CreateClientConnector(pool, serverPublicKey, settings, "writers"))
 					, m_pServerConnector(CreateServerConnector(pool, serverPublicKey, settings, "writers"))
 					, m_writers(settings.NodeIdentityEqualityStrategy)
-			{}
+					, m_pBroadcastLaneCounters(std::make_shared<BroadcastLaneCounters>())
+			{
+				for (auto& counter : *m_pBroadcastLaneCounters)
+					counter = 0;
+			}
 
 		public:
 			size_t numActiveConnections() const override {
@@ -300,20 +421,21 @@ namespace catapult { namespace net {
 				return m_writers.availableSize();
 			}
 
+			size_t numPendingBroadcasts(BroadcastLane lane) const override {
+				return (*m_pBroadcastLaneCounters)[utils::to_underlying_type(lane)];
+			}
+
 			model::NodeIdentitySet identities() const override {
 				return m_writers.identities();
 			}
 
 		public:
 			void broadcast(const ionet::PacketPayload& payload) override {
-				m_writers.forEach([pThis = shared_from_this(), payload](const auto& state) {
-					state.pBufferedIo->write(payload, [pThis, pSocket = state.pSocket](auto code) {
-						if (ionet::SocketOperationCode::Success == code)
-							return;
-
-						CATAPULT_LOG(warning) << "closing socket due to broadcast write error (" << code << ")";
-						pThis->removeWriter(pSocket);
-					});
+				// share a single copy of the payload across all writers
+				auto pPayload = std::make_shared<const ionet::PacketPayload>(payload);
+				auto lane = GetBroadcastLane(payload.header().Type);
+				m_writers.forEach([lane, &pPayload](const auto& state) {
+					state.pBroadcastQueue->push(lane, pPayload);
 				});
 			}
 
@@ -387,6 +509,17 @@ namespace catapult { namespace net {
 				state.Node = node;
 				state.pSocket = pSocket;
 				state.pBufferedIo = pSocket->buffered();
+
+				// capture a weak pointer to this in order to avoid a cycle (writers -> state -> queue -> writers)
+				state.pBroadcastQueue = std::make_shared<BroadcastQueue>(
+						state.pBufferedIo,
+						m_pBroadcastLaneCounters,
+						[pThisWeak = std::weak_ptr<DefaultPacketWriters>(shared_from_this()), pSocketWeak = std::weak_ptr(pSocket)]() {
+							auto pThis = pThisWeak.lock();
+							auto pSocketShared = pSocketWeak.lock();
+							if (pThis && pSocketShared)
+								pThis->removeWriter(pSocketShared);
+						});
 				m_writers.insert(state);
 			}
 
@@ -417,6 +550,7 @@ namespace catapult { namespace net {
 			std::shared_ptr<ClientConnector> m_pClientConnector;
 			std::shared_ptr<ServerConnector> m_pServerConnector;
 			WriterContainer m_writers;
+			std::shared_ptr<BroadcastLaneCounters> m_pBroadcastLaneCounters;
 		};
 	}
 
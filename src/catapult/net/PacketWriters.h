@@ -36,6 +36,18 @@ namespace catapult {
 
 namespace catapult { namespace net {
 
+	/// Broadcast priority lanes.
+	enum class BroadcastLane {
+		/// High priority lane (blocks and finalization messages).
+		High,
+
+		/// Normal priority lane (everything else, e.g. transactions).
+		Normal
+	};
+
+	/// Gets the broadcast lane used for payloads with packet \a type.
+	BroadcastLane GetBroadcastLane(ionet::PacketType type);
+
 	/// Manages a collection of connections that send data to external nodes.
 	class PacketWriters : public ConnectionContainer, public PacketIoPicker {
 	public:
@@ -49,8 +61,12 @@ namespace catapult { namespace net {
 		/// \note There will be fewer available writers than active writers when some writers are checked out.
 		virtual size_t numAvailableWriters() const = 0;
 
+		/// Gets the number of broadcast payloads queued in \a lane across all writers.
+		virtual size_t numPendingBroadcasts(BroadcastLane lane) const = 0;
+
 	public:
 		/// Broadcasts \a payload to all active connections.
+		/// \note Payload is shared (not copied) across connections and queued in a lane determined by its packet type.
 		virtual void broadcast(const ionet::PacketPayload& payload) = 0;
 
 	public:
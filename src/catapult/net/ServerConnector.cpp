@@ -70,14 +70,13 @@ namespace catapult { namespace net {
 
 				auto socketOptions = m_settings.toSocketOptions();
 				const auto& endpoint = node.endpoint();
-				auto cancel = ionet::Connect(m_ioContext, socketOptions, endpoint, [pThis = shared_from_this(), identityKey, pRequest](
-						auto result,
-						const auto& connectedSocketInfo) {
+				auto connectHandler = [pThis = shared_from_this(), identityKey, pRequest](auto result, const auto& connectedSocketInfo) {
 					if (ionet::ConnectResult::Connected != result)
 						return pRequest->callback(PeerConnectCode::Socket_Error, ionet::PacketSocketInfo());
 
 					pThis->verify(identityKey, connectedSocketInfo, pRequest);
-				});
+				};
+				auto cancel = ionet::Connect(m_ioContext, socketOptions, endpoint, identityKey, connectHandler);
 
 				pRequest->setTimeoutHandler([pThis = shared_from_this(), cancel]() {
 					cancel();
@@ -21,6 +21,7 @@
 #pragma once
 #include "AggregateObserverBuilder.h"
 #include "ObserverTypes.h"
+#include "catapult/model/ExecutionProfiler.h"
 #include <functional>
 #include <vector>
 
@@ -31,6 +32,15 @@ namespace catapult { namespace observers {
 	private:
 		using NotificationObserverPredicate = predicate<const model::Notification&>;
 
+	public:
+		/// Creates a builder.
+		DemuxObserverBuilder() : m_pProfiler(nullptr)
+		{}
+
+		/// Creates a builder that profiles all added observers with \a profiler.
+		explicit DemuxObserverBuilder(model::ExecutionProfiler& profiler) : m_pProfiler(&profiler)
+		{}
+
 	public:
 		/// Adds an observer (\a pObserver) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
@@ -38,7 +48,7 @@ namespace catapult { namespace observers {
 			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
 				return model::AreEqualExcludingChannel(type, notification.Type);
 			};
-			m_builder.add(std::make_unique<ConditionalObserver<TNotification>>(std::move(pObserver), predicate));
+			m_builder.add(std::make_unique<ConditionalObserver<TNotification>>(profile(std::move(pObserver)), predicate));
 			return *this;
 		}
 
@@ -48,6 +58,40 @@ namespace catapult { namespace observers {
 		}
 
 	private:
+		template<typename TNotification>
+		NotificationObserverPointerT<TNotification> profile(NotificationObserverPointerT<TNotification>&& pObserver) {
+			if (!m_pProfiler)
+				return std::move(pObserver);
+
+			return std::make_unique<ProfilingObserver<TNotification>>(std::move(pObserver), *m_pProfiler);
+		}
+
+	private:
+		template<typename TNotification>
+		class ProfilingObserver : public NotificationObserverT<TNotification> {
+		public:
+			ProfilingObserver(NotificationObserverPointerT<TNotification>&& pObserver, model::ExecutionProfiler& profiler)
+					: m_pObserver(std::move(pObserver))
+					, m_profiler(profiler)
+					, m_pluginId(m_profiler.registerPlugin(m_pObserver->name()))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pObserver->name();
+			}
+
+			void notify(const TNotification& notification, ObserverContext& context) const override {
+				model::ExecutionProfiler::ScopedSample sample(m_profiler, m_pluginId, notification.Type);
+				m_pObserver->notify(notification, context);
+			}
+
+		private:
+			NotificationObserverPointerT<TNotification> m_pObserver;
+			model::ExecutionProfiler& m_profiler;
+			model::ExecutionProfiler::PluginId m_pluginId;
+		};
+
 		template<typename TNotification>
 		class ConditionalObserver : public NotificationObserver {
 		public:
@@ -74,13 +118,14 @@ namespace catapult { namespace observers {
 		};
 
 	private:
+		model::ExecutionProfiler* m_pProfiler;
 		AggregateObserverBuilder<model::Notification> m_builder;
 	};
 
 	/// Adds an observer (\a pObserver) to the builder that is always invoked.
 	template<>
 	inline DemuxObserverBuilder& DemuxObserverBuilder::add(NotificationObserverPointerT<model::Notification>&& pObserver) {
-		m_builder.add(std::move(pObserver));
+		m_builder.add(profile(std::move(pObserver)));
 		return *this;
 	}
 }}
@@ -32,6 +32,7 @@ namespace catapult { namespace plugins {
 			, m_storageConfig(storageConfig)
 			, m_userConfig(userConfig)
 			, m_inflationConfig(inflationConfig)
+			, m_pWorkerPool(nullptr)
 	{}
 
 	// region config
@@ -95,12 +96,29 @@ namespace catapult { namespace plugins {
 				hook(builder, std::forward<TArgs>(args)...);
 		}
 
+		template<typename TBuilder>
+		TBuilder CreateBuilder(const std::shared_ptr<model::ExecutionProfiler>& pExecutionProfiler) {
+			return pExecutionProfiler ? TBuilder(*pExecutionProfiler) : TBuilder();
+		}
+
 		template<typename TBuilder, typename THooks, typename... TArgs>
-		static auto Build(const THooks& hooks, TArgs&&... args) {
-			TBuilder builder;
+		static auto Build(const std::shared_ptr<model::ExecutionProfiler>& pExecutionProfiler, const THooks& hooks, TArgs&&... args) {
+			auto builder = CreateBuilder<TBuilder>(pExecutionProfiler);
 			ApplyAll(builder, hooks);
 			return builder.build(std::forward<TArgs>(args)...);
 		}
+
+		void AddExecutionProfilerCounters(std::vector<utils::DiagnosticCounter>& counters, const model::ExecutionProfiler& profiler) {
+			counters.emplace_back(utils::DiagnosticCounterId("PROF CALLS"), [&profiler]() {
+				return profiler.totals().NumCalls;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("PROF MS"), [&profiler]() {
+				return profiler.totals().ElapsedNanoseconds / 1'000'000;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("PROF SLOW BLK"), [&profiler]() {
+				return profiler.numSlowBlocks();
+			});
+		}
 	}
 
 	// region handlers
@@ -131,6 +149,9 @@ namespace catapult { namespace plugins {
 
 	void PluginManager::addDiagnosticCounters(std::vector<utils::DiagnosticCounter>& counters, const cache::CatapultCache& cache) const {
 		ApplyAll(counters, m_diagnosticCounterHooks, cache);
+
+		if (m_pExecutionProfiler)
+			AddExecutionProfilerCounters(counters, *m_pExecutionProfiler);
 	}
 
 	// endregion
@@ -147,7 +168,7 @@ namespace catapult { namespace plugins {
 
 	PluginManager::StatelessValidatorPointer PluginManager::createStatelessValidator(
 			const validators::ValidationResultPredicate& isSuppressedFailure) const {
-		return Build<validators::stateless::DemuxValidatorBuilder>(m_statelessValidatorHooks, isSuppressedFailure);
+		return Build<validators::stateless::DemuxValidatorBuilder>(m_pExecutionProfiler, m_statelessValidatorHooks, isSuppressedFailure);
 	}
 
 	PluginManager::StatelessValidatorPointer PluginManager::createStatelessValidator() const {
@@ -156,7 +177,7 @@ namespace catapult { namespace plugins {
 
 	PluginManager::StatefulValidatorPointer PluginManager::createStatefulValidator(
 			const validators::ValidationResultPredicate& isSuppressedFailure) const {
-		return Build<validators::stateful::DemuxValidatorBuilder>(m_statefulValidatorHooks, isSuppressedFailure);
+		return Build<validators::stateful::DemuxValidatorBuilder>(m_pExecutionProfiler, m_statefulValidatorHooks, isSuppressedFailure);
 	}
 
 	PluginManager::StatefulValidatorPointer PluginManager::createStatefulValidator() const {
@@ -176,14 +197,38 @@ namespace catapult { namespace plugins {
 	}
 
 	PluginManager::ObserverPointer PluginManager::createObserver() const {
-		observers::DemuxObserverBuilder builder;
+		auto builder = CreateBuilder<observers::DemuxObserverBuilder>(m_pExecutionProfiler);
 		ApplyAll(builder, m_observerHooks);
 		ApplyAll(builder, m_transientObserverHooks);
 		return builder.build();
 	}
 
 	PluginManager::ObserverPointer PluginManager::createPermanentObserver() const {
-		return Build<observers::DemuxObserverBuilder>(m_observerHooks);
+		return Build<observers::DemuxObserverBuilder>(m_pExecutionProfiler, m_observerHooks);
+	}
+
+	// endregion
+
+	// region profiling
+
+	void PluginManager::enableExecutionProfiler(const utils::TimeSpan& slowBlockThreshold) {
+		m_pExecutionProfiler = std::make_shared<model::ExecutionProfiler>(slowBlockThreshold);
+	}
+
+	std::shared_ptr<model::ExecutionProfiler> PluginManager::executionProfiler() const {
+		return m_pExecutionProfiler;
+	}
+
+	// endregion
+
+	// region worker pool
+
+	void PluginManager::setWorkerPool(thread::IoThreadPool& pool) {
+		m_pWorkerPool = &pool;
+	}
+
+	thread::IoThreadPool* PluginManager::workerPool() const {
+		return m_pWorkerPool;
 	}
 
 	// endregion
@@ -25,6 +25,7 @@
 #include "catapult/config/UserConfiguration.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/ExecutionProfiler.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/model/TransactionPlugin.h"
 #include "catapult/observers/DemuxObserverBuilder.h"
@@ -34,6 +35,8 @@
 #include "catapult/validators/ValidatorTypes.h"
 #include "catapult/plugins.h"
 
+namespace catapult { namespace thread { class IoThreadPool; } }
+
 namespace catapult { namespace plugins {
 
 	/// Additional storage configuration.
@@ -191,6 +194,27 @@ namespace catapult { namespace plugins {
 
 		// endregion
 
+		// region profiling
+
+		/// Enables profiling of all validators and observers created after this call.
+		/// Blocks taking longer than \a slowBlockThreshold to process are logged.
+		void enableExecutionProfiler(const utils::TimeSpan& slowBlockThreshold);
+
+		/// Gets the execution profiler or \c nullptr when profiling is disabled.
+		std::shared_ptr<model::ExecutionProfiler> executionProfiler() const;
+
+		// endregion
+
+		// region worker pool
+
+		/// Sets the worker \a pool that plugins can use to parallelize expensive work.
+		void setWorkerPool(thread::IoThreadPool& pool);
+
+		/// Gets the worker pool or \c nullptr when all plugin work should be performed on the calling thread.
+		thread::IoThreadPool* workerPool() const;
+
+		// endregion
+
 		// region resolvers
 
 		/// Adds a mosaic \a resolver.
@@ -229,6 +253,9 @@ namespace catapult { namespace plugins {
 
 		std::vector<MosaicResolver> m_mosaicResolvers;
 		std::vector<AddressResolver> m_addressResolvers;
+
+		std::shared_ptr<model::ExecutionProfiler> m_pExecutionProfiler;
+		thread::IoThreadPool* m_pWorkerPool;
 	};
 }}
 
@@ -50,6 +50,10 @@ namespace catapult { namespace state {
 		return m_buckets.end();
 	}
 
+	size_t AccountActivityBuckets::allocatedSize() const {
+		return m_buckets.allocatedSize();
+	}
+
 	bool AccountActivityBuckets::tryUpdate(
 			model::ImportanceHeight height,
 			const consumer<HeightDetachedActivityBucket&>& consumer,
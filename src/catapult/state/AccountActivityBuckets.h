@@ -72,6 +72,9 @@ namespace catapult { namespace state {
 		/// Gets a const iterator to the element following the last element of the underlying container.
 		ActivityBucketStack::const_iterator end() const;
 
+		/// Gets the number of bytes allocated dynamically by the buckets.
+		size_t allocatedSize() const;
+
 	private:
 		bool tryUpdate(
 				model::ImportanceHeight height,
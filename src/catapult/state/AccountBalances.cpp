@@ -37,8 +37,7 @@ namespace catapult { namespace state {
 	AccountBalances::AccountBalances(AccountBalances&& accountBalances) = default;
 
 	AccountBalances& AccountBalances::operator=(const AccountBalances& accountBalances) {
-		m_optimizedMosaicId = accountBalances.optimizedMosaicId();
-		m_balances.optimize(m_optimizedMosaicId);
+		m_balances.optimize(accountBalances.optimizedMosaicId());
 		for (const auto& pair : accountBalances)
 			m_balances.insert(pair);
 
@@ -60,7 +59,11 @@ namespace catapult { namespace state {
 	}
 
 	MosaicId AccountBalances::optimizedMosaicId() const {
-		return m_optimizedMosaicId;
+		return m_balances.optimizedMosaicId();
+	}
+
+	size_t AccountBalances::allocatedSize() const {
+		return m_balances.allocatedSize();
 	}
 
 	Amount AccountBalances::get(MosaicId mosaicId) const {
@@ -105,6 +108,5 @@ namespace catapult { namespace state {
 
 	void AccountBalances::optimize(MosaicId id) {
 		m_balances.optimize(id);
-		m_optimizedMosaicId = id;
 	}
 }}
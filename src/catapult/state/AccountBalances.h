@@ -59,6 +59,9 @@ namespace catapult { namespace state {
 		/// Gets the optimized mosaic id.
 		MosaicId optimizedMosaicId() const;
 
+		/// Gets the (approximate) number of bytes allocated dynamically by the balances.
+		size_t allocatedSize() const;
+
 		/// Gets the balance of the given mosaic (\a mosaicId).
 		Amount get(MosaicId mosaicId) const;
 
@@ -74,6 +77,5 @@ namespace catapult { namespace state {
 
 	private:
 		CompactMosaicMap m_balances;
-		MosaicId m_optimizedMosaicId;
 	};
 }}
@@ -41,6 +41,12 @@ namespace catapult { namespace state {
 		});
 	}
 
+	bool AccountHistory::isPrunable(Height height) const {
+		return m_heightBalanceMap.isPrunable(height)
+				|| m_heightVrfPublicKeyMap.isPrunable(height)
+				|| m_heightVotingPublicKeysMap.isPrunable(height);
+	}
+
 	void AccountHistory::add(Height height, Amount balance) {
 		m_heightBalanceMap.add(height, balance);
 	}
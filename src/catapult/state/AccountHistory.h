@@ -41,6 +41,9 @@ namespace catapult { namespace state {
 		/// Returns \c true if any historical balance is at least \a minAmount.
 		bool anyAtLeast(Amount minAmount) const;
 
+		/// Returns \c true if pruning at \a height would change any history.
+		bool isPrunable(Height height) const;
+
 	public:
 		/// Adds \a balance at \a height.
 		void add(Height height, Amount balance);
@@ -61,4 +61,8 @@ namespace catapult { namespace state {
 	AccountImportanceSnapshots::SnapshotStack::const_iterator AccountImportanceSnapshots::end() const {
 		return m_snapshots.end();
 	}
+
+	size_t AccountImportanceSnapshots::allocatedSize() const {
+		return m_snapshots.allocatedSize();
+	}
 }}
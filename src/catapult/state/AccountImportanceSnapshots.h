@@ -63,6 +63,9 @@ namespace catapult { namespace state {
 		/// Gets a const iterator to the element following the last element of the underlying container.
 		SnapshotStack::const_iterator end() const;
 
+		/// Gets the number of bytes allocated dynamically by the snapshots.
+		size_t allocatedSize() const;
+
 	private:
 		SnapshotStack m_snapshots;
 	};
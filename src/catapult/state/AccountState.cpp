@@ -89,4 +89,33 @@ namespace catapult { namespace state {
 	Key GetVrfPublicKey(const AccountState& accountState) {
 		return accountState.SupplementalPublicKeys.vrf().get();
 	}
+
+	namespace {
+		// supplemental public keys are allocated via make_shared, which prepends a control block to each value
+		constexpr auto Shared_Control_Block_Size = 2 * sizeof(void*);
+
+		size_t GetAllocatedSize(const AccountPublicKeys& publicKeys) {
+			size_t size = 0;
+			for (const auto* pAccessor : { &publicKeys.linked(), &publicKeys.node(), &publicKeys.vrf() }) {
+				if (*pAccessor)
+					size += Shared_Control_Block_Size + sizeof(Key);
+			}
+
+			const auto& votingAccessor = publicKeys.voting();
+			if (0 != votingAccessor.size()) {
+				size += Shared_Control_Block_Size + sizeof(std::vector<model::PinnedVotingKey>);
+				size += votingAccessor.size() * sizeof(model::PinnedVotingKey);
+			}
+
+			return size;
+		}
+	}
+
+	size_t GetAccountStateMemorySize(const AccountState& accountState) {
+		return sizeof(AccountState)
+				+ GetAllocatedSize(accountState.SupplementalPublicKeys)
+				+ accountState.ImportanceSnapshots.allocatedSize()
+				+ accountState.ActivityBuckets.allocatedSize()
+				+ accountState.Balances.allocatedSize();
+	}
 }}
@@ -95,4 +95,7 @@ namespace catapult { namespace state {
 
 	/// Gets the vrf public key associated with \a accountState or a zero key.
 	Key GetVrfPublicKey(const AccountState& accountState);
+
+	/// Gets the (approximate) number of bytes used by \a accountState, including all dynamically allocated memory.
+	size_t GetAccountStateMemorySize(const AccountState& accountState);
 }}
@@ -22,12 +22,17 @@
 #include "catapult/constants.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
+#include <limits>
 
 namespace catapult { namespace state {
 
 	/// Compact array-based stack that allocates memory dynamically only when it is not empty.
+	/// \note The array is used as a ring buffer so that push and pop do not need to shift existing values.
 	template<typename T, size_t N>
 	class CompactArrayStack {
+	private:
+		static_assert(N <= std::numeric_limits<uint8_t>::max(), "stack indexes are stored as uint8_t");
+
 	public:
 		// region const_iterator
 
@@ -43,9 +48,10 @@ namespace catapult { namespace state {
 			using iterator_category = std::forward_iterator_tag;
 
 		public:
-			/// Creates an iterator around \a pArray with \a index current position.
-			const_iterator(const std::array<T, N>* pArray, size_t index)
+			/// Creates an iterator around \a pArray with top of stack at \a head and \a index current position.
+			const_iterator(const std::array<T, N>* pArray, size_t head, size_t index)
 					: m_pArray(pArray)
+					, m_head(head)
 					, m_index(index)
 			{}
 
@@ -88,7 +94,7 @@ namespace catapult { namespace state {
 				if (isEnd())
 					CATAPULT_THROW_OUT_OF_RANGE("cannot dereference at end");
 
-				return m_pArray ? &(*m_pArray)[m_index] : &m_defaultValue;
+				return m_pArray ? &(*m_pArray)[(m_head + m_index) % N] : &m_defaultValue;
 			}
 
 		private:
@@ -98,6 +104,7 @@ namespace catapult { namespace state {
 
 		private:
 			const std::array<T, N>* m_pArray;
+			size_t m_head;
 			size_t m_index;
 			T m_defaultValue;
 		};
@@ -106,7 +113,9 @@ namespace catapult { namespace state {
 
 	public:
 		/// Creates an empty stack.
-		CompactArrayStack() : m_size(0)
+		CompactArrayStack()
+				: m_head(0)
+				, m_size(0)
 		{}
 
 		/// Copy constructor that makes a deep copy of \a stack.
@@ -117,7 +126,9 @@ namespace catapult { namespace state {
 		/// Move constructor that move constructs a stack from \a stack.
 		CompactArrayStack(CompactArrayStack&& stack)
 				: m_pArray(std::move(stack.m_pArray))
+				, m_head(stack.m_head)
 				, m_size(stack.m_size) {
+			stack.m_head = 0;
 			stack.m_size = 0;
 		}
 
@@ -127,6 +138,7 @@ namespace catapult { namespace state {
 			if (stack.m_pArray)
 				m_pArray = std::make_unique<std::array<T, N>>(*stack.m_pArray);
 
+			m_head = stack.m_head;
 			m_size = stack.m_size;
 			return *this;
 		}
@@ -134,7 +146,9 @@ namespace catapult { namespace state {
 		/// Move assignment operator that assigns \a stack.
 		CompactArrayStack& operator=(CompactArrayStack&& stack) {
 			m_pArray = std::move(stack.m_pArray);
+			m_head = stack.m_head;
 			m_size = stack.m_size;
+			stack.m_head = 0;
 			stack.m_size = 0;
 			return *this;
 		}
@@ -145,15 +159,20 @@ namespace catapult { namespace state {
 			return m_size;
 		}
 
+		/// Gets the number of bytes allocated dynamically by the stack.
+		size_t allocatedSize() const {
+			return m_pArray ? sizeof(std::array<T, N>) : 0;
+		}
+
 	public:
 		/// Gets a const iterator to the first element of the underlying container.
 		const_iterator begin() const {
-			return const_iterator(m_pArray.get(), 0);
+			return const_iterator(m_pArray.get(), m_head, 0);
 		}
 
 		/// Gets a const iterator to the element following the last element of the underlying container.
 		const_iterator end() const {
-			return const_iterator(m_pArray.get(), N);
+			return const_iterator(m_pArray.get(), m_head, N);
 		}
 
 	public:
@@ -162,7 +181,7 @@ namespace catapult { namespace state {
 			if (0 == m_size)
 				CATAPULT_THROW_OUT_OF_RANGE("cannot peek when empty");
 
-			return m_pArray->front();
+			return (*m_pArray)[m_head];
 		}
 
 		/// Gets a reference to the element on the top of the stack.
@@ -170,53 +189,41 @@ namespace catapult { namespace state {
 			if (0 == m_size)
 				CATAPULT_THROW_OUT_OF_RANGE("cannot peek when empty");
 
-			return m_pArray->front();
+			return (*m_pArray)[m_head];
 		}
 
 	public:
 		/// Pushes \a value onto the stack.
 		void push(const T& value) {
-			shiftRight();
 			if (m_size < N)
 				++m_size;
 
 			if (!m_pArray)
 				m_pArray = std::make_unique<std::array<T, N>>();
 
-			m_pArray->front() = value;
+			// when the stack is full, the new top replaces the bottom value
+			m_head = static_cast<uint8_t>((m_head + N - 1) % N);
+			(*m_pArray)[m_head] = value;
 		}
 
 		/// Pops the top value from the stack.
 		void pop() {
-			shiftLeft();
-			m_pArray->back() = T();
-			--m_size;
-
-			if (0 == m_size)
-				m_pArray.reset();
-		}
-
-	private:
-		void shiftLeft() {
 			if (!m_pArray)
 				CATAPULT_THROW_OUT_OF_RANGE("cannot pop when empty");
 
-			auto& array = *m_pArray;
-			for (auto i = 0u; i < array.size() - 1; ++i)
-				array[i] = array[i + 1];
-		}
-
-		void shiftRight() {
-			if (!m_pArray)
-				return;
+			(*m_pArray)[m_head] = T();
+			m_head = static_cast<uint8_t>((m_head + 1) % N);
+			--m_size;
 
-			auto& array = *m_pArray;
-			for (auto i = array.size() - 1; i > 0; --i)
-				array[i] = array[i - 1];
+			if (0 == m_size) {
+				m_pArray.reset();
+				m_head = 0;
+			}
 		}
 
 	private:
 		std::unique_ptr<std::array<T, N>> m_pArray;
-		size_t m_size;
+		uint8_t m_head;
+		uint8_t m_size;
 	};
 }}
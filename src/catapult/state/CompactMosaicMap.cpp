@@ -25,8 +25,8 @@ namespace catapult { namespace state {
 
 	// region FirstLevelStorage
 
-	bool CompactMosaicMap::FirstLevelStorage::hasValue() const {
-		return MosaicId() != Value.ConstMosaic.first;
+	bool CompactMosaicMap::FirstLevelStorage::hasValue(size_t index) const {
+		return MosaicId() != Values[index].ConstMosaic.first;
 	}
 
 	bool CompactMosaicMap::FirstLevelStorage::hasArray() const {
@@ -49,6 +49,25 @@ namespace catapult { namespace state {
 		return *pNextStorage->pMapStorage;
 	}
 
+	size_t CompactMosaicMap::FirstLevelStorage::slotCount() const {
+		if (hasArray())
+			return Inline_Size + arraySize();
+
+		size_t count = 0;
+		while (count < Inline_Size && hasValue(count))
+			++count;
+
+		return count;
+	}
+
+	CompactMosaicMap::MosaicUnion& CompactMosaicMap::FirstLevelStorage::slot(size_t index) {
+		return const_cast<MosaicUnion&>(utils::as_const(*this).slot(index));
+	}
+
+	const CompactMosaicMap::MosaicUnion& CompactMosaicMap::FirstLevelStorage::slot(size_t index) const {
+		return index < Inline_Size ? Values[index] : array()[index - Inline_Size];
+	}
+
 	// endregion
 
 	// region basic_iterator
@@ -112,9 +131,13 @@ namespace catapult { namespace state {
 	void CompactMosaicMap::basic_iterator::advance() {
 		switch (m_stage) {
 		case Stage::Start:
-			return m_storage.hasValue() ? setValueMosaic() : setEnd();
+			m_arrayIndex = 0;
+			return m_storage.hasValue(0) ? setValueMosaic() : setEnd();
 
 		case Stage::Value:
+			if (++m_arrayIndex < Inline_Size && m_storage.hasValue(m_arrayIndex))
+				return setValueMosaic();
+
 			m_arrayIndex = 0;
 			return m_storage.hasArray() ? setArrayMosaic() : setEnd();
 
@@ -138,7 +161,7 @@ namespace catapult { namespace state {
 
 	void CompactMosaicMap::basic_iterator::setValueMosaic() {
 		m_stage = Stage::Value;
-		m_pCurrent = &m_storage.Value.ConstMosaic;
+		m_pCurrent = &m_storage.Values[m_arrayIndex].ConstMosaic;
 	}
 
 	void CompactMosaicMap::basic_iterator::setArrayMosaic() {
@@ -179,21 +202,11 @@ namespace catapult { namespace state {
 	}
 
 	bool CompactMosaicMap::empty() const {
-		return !m_storage.hasValue();
+		return !m_storage.hasValue(0);
 	}
 
 	size_t CompactMosaicMap::size() const {
-		if (empty())
-			return 0;
-
-		size_t count = 1;
-		if (m_storage.hasArray()) {
-			count += m_storage.arraySize();
-			if (m_storage.hasMap())
-				count += m_storage.map().size();
-		}
-
-		return count;
+		return m_storage.slotCount() + (m_storage.hasMap() ? m_storage.map().size() : 0);
 	}
 
 	CompactMosaicMap::const_iterator CompactMosaicMap::find(MosaicId id) const {
@@ -226,33 +239,20 @@ namespace catapult { namespace state {
 		if (end() != utils::as_const(*this).find(pair.first))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot insert mosaic already in map", pair.first);
 
-		if (empty()) {
-			m_storage.Value.Mosaic = pair;
-			return;
-		}
-
-		// use insertion sort to insert into array
-		if (!m_storage.hasArray())
-			m_storage.pNextStorage = std::make_unique<SecondLevelStorage>();
-
-		if (IsLessThan(m_optimizedMosaicId, pair.first, m_storage.Value.ConstMosaic.first)) {
-			insertIntoArray(0, m_storage.Value.ConstMosaic);
-			m_storage.Value.Mosaic = pair;
-			return;
-		}
-
-		auto arrayIndex = 0u;
-		for (; arrayIndex < m_storage.arraySize(); ++arrayIndex) {
-			if (pair.first < m_storage.array()[arrayIndex].ConstMosaic.first)
+		// use insertion sort to insert into slots
+		auto slotCount = m_storage.slotCount();
+		auto slotIndex = 0u;
+		for (; slotIndex < slotCount; ++slotIndex) {
+			if (IsLessThan(m_optimizedMosaicId, pair.first, m_storage.slot(slotIndex).ConstMosaic.first))
 				break;
 		}
 
-		if (arrayIndex < Array_Size) {
-			insertIntoArray(arrayIndex, pair);
+		if (slotIndex < Slot_Size) {
+			insertIntoSlots(slotIndex, pair);
 			return;
 		}
 
-		// if all array values are smaller, insert into map
+		// if all slot values are smaller, insert into map
 		insertIntoMap(pair);
 	}
 
@@ -263,16 +263,11 @@ namespace catapult { namespace state {
 
 		switch (location.Source) {
 		case MosaicSource::Value:
-			if (m_storage.hasArray()) {
-				m_storage.Value.Mosaic = m_storage.array()[0].ConstMosaic;
-				eraseFromArray(0);
-			} else {
-				m_storage.Value.Mosaic = MutableMosaic();
-			}
+			eraseFromSlots(location.ArrayIndex);
 			break;
 
 		case MosaicSource::Array:
-			eraseFromArray(location.ArrayIndex);
+			eraseFromSlots(Inline_Size + location.ArrayIndex);
 			break;
 
 		case MosaicSource::Map:
@@ -296,6 +291,10 @@ namespace catapult { namespace state {
 		}
 	}
 
+	MosaicId CompactMosaicMap::optimizedMosaicId() const {
+		return m_optimizedMosaicId;
+	}
+
 	void CompactMosaicMap::optimize(MosaicId id) {
 		if (id == m_optimizedMosaicId)
 			return;
@@ -307,22 +306,22 @@ namespace catapult { namespace state {
 		reinsert(*this, m_optimizedMosaicId);
 	}
 
-	bool CompactMosaicMap::find(MosaicId id, MosaicLocation& location) const {
-		if (empty())
-			return false;
+	size_t CompactMosaicMap::allocatedSize() const {
+		if (!m_storage.hasArray())
+			return 0;
 
-		if (id == m_storage.Value.ConstMosaic.first) {
-			location.Source = MosaicSource::Value;
-			return true;
-		}
+		// approximate each map node as a value and a red-black tree node header (color and three links)
+		constexpr auto Map_Node_Size = sizeof(MosaicMap::value_type) + 4 * sizeof(void*);
+		return sizeof(SecondLevelStorage) + (m_storage.hasMap() ? m_storage.map().size() * Map_Node_Size : 0);
+	}
 
-		if (m_storage.hasArray()) {
-			for (auto i = 0u; i < m_storage.arraySize(); ++i) {
-				if (id == m_storage.array()[i].ConstMosaic.first) {
-					location.Source = MosaicSource::Array;
-					location.ArrayIndex = i;
-					return true;
-				}
+	bool CompactMosaicMap::find(MosaicId id, MosaicLocation& location) const {
+		auto slotCount = m_storage.slotCount();
+		for (auto i = 0u; i < slotCount; ++i) {
+			if (id == m_storage.slot(i).ConstMosaic.first) {
+				location.Source = i < Inline_Size ? MosaicSource::Value : MosaicSource::Array;
+				location.ArrayIndex = i < Inline_Size ? i : i - Inline_Size;
+				return true;
 			}
 		}
 
@@ -338,17 +337,24 @@ namespace catapult { namespace state {
 		return false;
 	}
 
-	void CompactMosaicMap::insertIntoArray(size_t index, const Mosaic& pair) {
-		// move the last array value into the map
-		if (Array_Size == m_storage.arraySize())
-			insertIntoMap(m_storage.array().back().ConstMosaic);
-		else
-			++m_storage.arraySize();
+	void CompactMosaicMap::insertIntoSlots(size_t index, const Mosaic& pair) {
+		// move the last slot value into the map
+		auto slotCount = m_storage.slotCount();
+		if (Slot_Size == slotCount)
+			insertIntoMap(m_storage.slot(--slotCount).ConstMosaic);
 
-		for (auto i = m_storage.arraySize(); i > index + 1; --i)
-			m_storage.array()[i - 1].Mosaic = m_storage.array()[i - 2].ConstMosaic;
+		// allocate array storage only when inline values are exhausted
+		if (slotCount >= Inline_Size) {
+			if (!m_storage.hasArray())
+				m_storage.pNextStorage = std::make_unique<SecondLevelStorage>();
 
-		m_storage.array()[index].Mosaic = pair;
+			m_storage.arraySize() = static_cast<uint8_t>(slotCount + 1 - Inline_Size);
+		}
+
+		for (auto i = slotCount; i > index; --i)
+			m_storage.slot(i).Mosaic = m_storage.slot(i - 1).ConstMosaic;
+
+		m_storage.slot(index).Mosaic = pair;
 	}
 
 	void CompactMosaicMap::insertIntoMap(const Mosaic& pair) {
@@ -358,11 +364,15 @@ namespace catapult { namespace state {
 		m_storage.pNextStorage->pMapStorage->insert(pair);
 	}
 
-	void CompactMosaicMap::eraseFromArray(size_t index) {
-		for (auto i = index; i < m_storage.arraySize() - 1u; ++i)
-			m_storage.array()[i].Mosaic = m_storage.array()[i + 1].ConstMosaic;
+	void CompactMosaicMap::eraseFromSlots(size_t index) {
+		auto slotCount = m_storage.slotCount();
+		for (auto i = index; i < slotCount - 1; ++i)
+			m_storage.slot(i).Mosaic = m_storage.slot(i + 1).ConstMosaic;
 
-		--m_storage.arraySize();
+		if (slotCount > Inline_Size)
+			--m_storage.arraySize();
+		else
+			m_storage.Values[slotCount - 1].Mosaic = MutableMosaic();
 	}
 
 	void CompactMosaicMap::compact() {
@@ -28,11 +28,14 @@
 namespace catapult { namespace state {
 
 	/// Mosaic (ordered) map that is optimized for storage of a small number of elements.
+	/// \note The first two mosaics are stored inline, so the common one and two mosaic cases do not allocate.
 	/// \note This map assumes that MosaicId(0) is not a valid mosaic.
 	///       This is acceptable for mosaics stored in AccountBalances but not for a general purpose map.
 	class CompactMosaicMap : utils::MoveOnly {
 	private:
+		static constexpr auto Inline_Size = 2;
 		static constexpr auto Array_Size = 5;
+		static constexpr auto Slot_Size = Inline_Size + Array_Size;
 
 		// in order for this map to behave like std::unordered_map, the element type needs to be a pair, not model::Mosaic
 		using Mosaic = std::pair<const MosaicId, Amount>;
@@ -60,6 +63,7 @@ namespace catapult { namespace state {
 			};
 		};
 
+		using InlineMosaicArray = std::array<MosaicUnion, Inline_Size>;
 		using MosaicArray = std::array<MosaicUnion, Array_Size>;
 		using MosaicMap = std::map<MosaicId, Amount>;
 
@@ -72,11 +76,12 @@ namespace catapult { namespace state {
 
 		struct FirstLevelStorage {
 		public:
-			MosaicUnion Value;
+			// pointer is first so that the (empty) MoveOnly base of the map does not need padding
 			std::unique_ptr<SecondLevelStorage> pNextStorage;
+			InlineMosaicArray Values;
 
 		public:
-			bool hasValue() const;
+			bool hasValue(size_t index) const;
 
 			bool hasArray() const;
 
@@ -88,6 +93,14 @@ namespace catapult { namespace state {
 			MosaicArray& array() const;
 
 			MosaicMap& map() const;
+
+		public:
+			// slots are inline values followed by array values
+			size_t slotCount() const;
+
+			MosaicUnion& slot(size_t index);
+
+			const MosaicUnion& slot(size_t index) const;
 		};
 
 	private:
@@ -103,7 +116,10 @@ namespace catapult { namespace state {
 
 		public:
 			MosaicSource Source;
+
+			// index into inline values when Source is Value, otherwise index into array
 			size_t ArrayIndex;
+
 			MosaicMap::iterator MapIterator;
 		};
 
@@ -161,7 +177,7 @@ namespace catapult { namespace state {
 			Stage m_stage;
 			Mosaic* m_pCurrent;
 
-			// indexing into sub containers
+			// indexing into sub containers (m_arrayIndex is also used for inline values)
 			size_t m_arrayIndex;
 			MosaicMap::iterator m_mapIterator;
 		};
@@ -228,17 +244,23 @@ namespace catapult { namespace state {
 		/// Erases the mosaic with \a id.
 		void erase(MosaicId id);
 
+		/// Gets the optimized mosaic id.
+		MosaicId optimizedMosaicId() const;
+
 		/// Optimizes access of the mosaic with \a id.
 		void optimize(MosaicId id);
 
+		/// Gets the (approximate) number of bytes allocated dynamically by the map.
+		size_t allocatedSize() const;
+
 	private:
 		bool find(MosaicId id, MosaicLocation& location) const;
 
-		void insertIntoArray(size_t index, const Mosaic& pair);
+		void insertIntoSlots(size_t index, const Mosaic& pair);
 
 		void insertIntoMap(const Mosaic& pair);
 
-		void eraseFromArray(size_t index);
+		void eraseFromSlots(size_t index);
 
 		void compact();
 
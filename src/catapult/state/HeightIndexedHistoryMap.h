@@ -54,6 +54,16 @@ namespace catapult { namespace state {
 			return m_heightValueMap.cend() == iter ? TValue() : iter->second;
 		}
 
+		/// Returns \c true if pruning at \a height would change this map.
+		bool isPrunable(Height height) const {
+			auto iter = m_heightValueMap.lower_bound(height);
+			if (m_heightValueMap.cend() == iter)
+				return false;
+
+			// pruning is a no-op when the oldest value is already at \a height
+			return height != iter->first || m_heightValueMap.cend() != std::next(iter);
+		}
+
 		/// Returns \c true if \a predicate returns \c true for any historical value.
 		bool anyOf(const predicate<const TValue&>& predicate) const {
 			return std::any_of(m_heightValueMap.cbegin(), m_heightValueMap.cend(), [predicate](const auto& pair) {
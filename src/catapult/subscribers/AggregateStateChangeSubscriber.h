@@ -38,5 +38,9 @@ namespace catapult { namespace subscribers {
 		void notifyStateChange(const StateChangeInfo& stateChangeInfo) override {
 			this->forEach([&stateChangeInfo](auto& subscriber) { subscriber.notifyStateChange(stateChangeInfo); });
 		}
+
+		void flush() override {
+			this->forEach([](auto& subscriber) { subscriber.flush(); });
+		}
 	};
 }}
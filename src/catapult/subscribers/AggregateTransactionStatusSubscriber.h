@@ -37,6 +37,13 @@ namespace catapult { namespace subscribers {
 			this->forEach([&transaction, &hash, status](auto& subscriber) { subscriber.notifyStatus(transaction, hash, status); });
 		}
 
+		void notifySharedStatus(
+				const std::shared_ptr<const model::Transaction>& pTransaction,
+				const Hash256& hash,
+				uint32_t status) override {
+			this->forEach([&pTransaction, &hash, status](auto& subscriber) { subscriber.notifySharedStatus(pTransaction, hash, status); });
+		}
+
 		void flush() override {
 			this->forEach([](auto& subscriber) { subscriber.flush(); });
 		}
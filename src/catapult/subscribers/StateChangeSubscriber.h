@@ -39,5 +39,8 @@ namespace catapult { namespace subscribers {
 
 		/// Indicates state was changed with change information in \a stateChangeInfo.
 		virtual void notifyStateChange(const StateChangeInfo& stateChangeInfo) = 0;
+
+		/// Flushes all pending state changes.
+		virtual void flush() = 0;
 	};
 }}
@@ -30,7 +30,7 @@ namespace catapult { namespace subscribers {
 		Hash256 hash;
 		inputStream.read(hash);
 		auto status = io::Read32(inputStream);
-		auto pTransaction = io::ReadEntity<model::Transaction>(inputStream);
-		subscriber.notifyStatus(*pTransaction, hash, status);
+		std::shared_ptr<const model::Transaction> pTransaction = io::ReadEntity<model::Transaction>(inputStream);
+		subscriber.notifySharedStatus(pTransaction, hash, status);
 	}
 }}
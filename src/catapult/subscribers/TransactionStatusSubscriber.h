@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/plugins.h"
 #include "catapult/types.h"
+#include <memory>
 
 namespace catapult { namespace model { struct Transaction; } }
 
@@ -35,6 +36,15 @@ namespace catapult { namespace subscribers {
 		/// Indicates \a transaction with \a hash completed with \a status.
 		virtual void notifyStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status) = 0;
 
+		/// Indicates shared transaction (\a pTransaction) with \a hash completed with \a status.
+		/// \note Subscribers that retain the transaction can override this to share ownership instead of copying it.
+		virtual void notifySharedStatus(
+				const std::shared_ptr<const model::Transaction>& pTransaction,
+				const Hash256& hash,
+				uint32_t status) {
+			notifyStatus(*pTransaction, hash, status);
+		}
+
 		/// Flushes all queued data.
 		virtual void flush() = 0;
 	};
@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "LatencyHistogram.h"
+#include "IntegerMath.h"
+#include <algorithm>
+#include <cmath>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr uint32_t Sub_Bucket_Bits = 2;
+	}
+
+	LatencyHistogram::LatencyHistogram()
+			: m_count(0)
+			, m_sum(0)
+			, m_max(0) {
+		m_buckets.fill(0);
+	}
+
+	uint64_t LatencyHistogram::count() const {
+		return m_count;
+	}
+
+	uint64_t LatencyHistogram::sum() const {
+		return m_sum;
+	}
+
+	uint64_t LatencyHistogram::max() const {
+		return m_max;
+	}
+
+	uint64_t LatencyHistogram::valueAtPercentile(double percentile) const {
+		if (0 == m_count)
+			return 0;
+
+		auto clampedPercentile = std::clamp(percentile, 0.0, 100.0);
+		auto targetCount = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clampedPercentile * static_cast<double>(m_count) / 100)));
+
+		uint64_t cumulativeCount = 0;
+		for (auto i = 0u; i < Num_Buckets; ++i) {
+			cumulativeCount += m_buckets[i];
+			if (cumulativeCount >= targetCount)
+				return std::min(BucketLowerBound(i + 1) - 1, m_max);
+		}
+
+		return m_max;
+	}
+
+	void LatencyHistogram::add(uint64_t value) {
+		++m_buckets[BucketIndex(value)];
+		++m_count;
+		m_sum += value;
+		m_max = std::max(m_max, value);
+	}
+
+	void LatencyHistogram::merge(const LatencyHistogram& histogram) {
+		for (auto i = 0u; i < Num_Buckets; ++i)
+			m_buckets[i] += histogram.m_buckets[i];
+
+		m_count += histogram.m_count;
+		m_sum += histogram.m_sum;
+		m_max = std::max(m_max, histogram.m_max);
+	}
+
+	uint32_t LatencyHistogram::BucketIndex(uint64_t value) {
+		auto clampedValue = std::min(value, Max_Value);
+		if (clampedValue < Num_Sub_Buckets)
+			return static_cast<uint32_t>(clampedValue);
+
+		// bucket groups start at 2^Sub_Bucket_Bits and each is further divided into Num_Sub_Buckets linear sub-buckets
+		auto msb = static_cast<uint32_t>(Log2(clampedValue));
+		auto subBucket = static_cast<uint32_t>(clampedValue >> (msb - Sub_Bucket_Bits)) & (Num_Sub_Buckets - 1);
+		return (msb - Sub_Bucket_Bits + 1) * Num_Sub_Buckets + subBucket;
+	}
+
+	uint64_t LatencyHistogram::BucketLowerBound(uint32_t index) {
+		if (index < Num_Sub_Buckets)
+			return index;
+
+		auto msb = index / Num_Sub_Buckets + Sub_Bucket_Bits - 1;
+		auto subBucket = index % Num_Sub_Buckets;
+		return static_cast<uint64_t>(Num_Sub_Buckets + subBucket) << (msb - Sub_Bucket_Bits);
+	}
+}}
@@ -0,0 +1,77 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <array>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Histogram of latency values that uses logarithmic buckets with linear sub-buckets (similar to HDR histograms).
+	/// \note Each power of two range is split into four sub-buckets, so the relative bucket error is bounded by 25%.
+	class LatencyHistogram {
+	public:
+		/// Number of linear sub-buckets per power of two range.
+		static constexpr uint32_t Num_Sub_Buckets = 4;
+
+		/// Maximum trackable value (values above this are clamped).
+		static constexpr uint64_t Max_Value = (1ull << 40) - 1;
+
+		/// Number of buckets.
+		static constexpr uint32_t Num_Buckets = 40 * Num_Sub_Buckets;
+
+	public:
+		/// Creates an empty histogram.
+		LatencyHistogram();
+
+	public:
+		/// Gets the number of recorded values.
+		uint64_t count() const;
+
+		/// Gets the sum of all recorded values.
+		uint64_t sum() const;
+
+		/// Gets the maximum recorded value.
+		uint64_t max() const;
+
+		/// Gets the (upper bound of the) value below which \a percentile percent of all recorded values fall.
+		uint64_t valueAtPercentile(double percentile) const;
+
+	public:
+		/// Adds \a value to the histogram.
+		void add(uint64_t value);
+
+		/// Merges all values recorded in \a histogram into this histogram.
+		void merge(const LatencyHistogram& histogram);
+
+	public:
+		/// Gets the index of the bucket containing \a value.
+		static uint32_t BucketIndex(uint64_t value);
+
+		/// Gets the lowest value contained in the bucket with \a index.
+		static uint64_t BucketLowerBound(uint32_t index);
+
+	private:
+		std::array<uint64_t, Num_Buckets> m_buckets;
+		uint64_t m_count;
+		uint64_t m_sum;
+		uint64_t m_max;
+	};
+}}
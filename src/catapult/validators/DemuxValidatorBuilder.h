@@ -21,6 +21,7 @@
 #pragma once
 #include "AggregateValidatorBuilder.h"
 #include "ValidatorTypes.h"
+#include "catapult/model/ExecutionProfiler.h"
 #include <functional>
 #include <vector>
 
@@ -35,6 +36,15 @@ namespace catapult { namespace validators {
 		using NotificationValidatorPredicate = predicate<const model::Notification&>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<model::Notification, TArgs...>>;
 
+	public:
+		/// Creates a builder.
+		DemuxValidatorBuilderT() : m_pProfiler(nullptr)
+		{}
+
+		/// Creates a builder that profiles all added validators with \a profiler.
+		explicit DemuxValidatorBuilderT(model::ExecutionProfiler& profiler) : m_pProfiler(&profiler)
+		{}
+
 	public:
 		/// Adds a validator (\a pValidator) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
@@ -43,10 +53,10 @@ namespace catapult { namespace validators {
 				auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
 					return model::AreEqualExcludingChannel(type, notification.Type);
 				};
-				m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator), predicate));
+				m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(profile(std::move(pValidator)), predicate));
 				return *this;
 			} else {
-				m_builder.add(std::move(pValidator));
+				m_builder.add(profile(std::move(pValidator)));
 				return *this;
 			}
 		}
@@ -62,6 +72,40 @@ namespace catapult { namespace validators {
 		}
 
 	private:
+		template<typename TNotification>
+		NotificationValidatorPointerT<TNotification> profile(NotificationValidatorPointerT<TNotification>&& pValidator) {
+			if (!m_pProfiler)
+				return std::move(pValidator);
+
+			return std::make_unique<ProfilingValidator<TNotification>>(std::move(pValidator), *m_pProfiler);
+		}
+
+	private:
+		template<typename TNotification>
+		class ProfilingValidator : public NotificationValidatorT<TNotification, TArgs...> {
+		public:
+			ProfilingValidator(NotificationValidatorPointerT<TNotification>&& pValidator, model::ExecutionProfiler& profiler)
+					: m_pValidator(std::move(pValidator))
+					, m_profiler(profiler)
+					, m_pluginId(m_profiler.registerPlugin(m_pValidator->name()))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pValidator->name();
+			}
+
+			ValidationResult validate(const TNotification& notification, TArgs&&... args) const override {
+				model::ExecutionProfiler::ScopedSample sample(m_profiler, m_pluginId, notification.Type);
+				return m_pValidator->validate(notification, std::forward<TArgs>(args)...);
+			}
+
+		private:
+			NotificationValidatorPointerT<TNotification> m_pValidator;
+			model::ExecutionProfiler& m_profiler;
+			model::ExecutionProfiler::PluginId m_pluginId;
+		};
+
 		template<typename TNotification>
 		class ConditionalValidator : public NotificationValidatorT<model::Notification, TArgs...> {
 		public:
@@ -90,6 +134,7 @@ namespace catapult { namespace validators {
 		};
 
 	private:
+		model::ExecutionProfiler* m_pProfiler;
 		AggregateValidatorBuilder<model::Notification, TArgs...> m_builder;
 	};
 }}
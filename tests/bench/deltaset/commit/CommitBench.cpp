@@ -0,0 +1,114 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "catapult/deltaset/BaseSet.h"
+#include "catapult/deltaset/BaseSetDelta.h"
+#include "catapult/state/AccountState.h"
+#include "catapult/utils/Hashers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+
+namespace catapult { namespace deltaset {
+
+	namespace {
+		constexpr auto Num_Mosaics_Per_Account = 8u;
+
+		struct AccountStateToKeyConverter {
+			static const Address& ToKey(const state::AccountState& accountState) {
+				return accountState.Address;
+			}
+		};
+
+		using AccountStateMap = std::unordered_map<Address, state::AccountState, utils::ArrayHasher<Address>>;
+		using AccountStateBaseSet = BaseSet<
+			MutableTypeTraits<state::AccountState>,
+			MapStorageTraits<AccountStateMap, AccountStateToKeyConverter>>;
+
+		state::AccountState CreateAccountState() {
+			Address address;
+			bench::FillWithRandomData(address);
+			state::AccountState accountState(address, Height(1));
+			bench::FillWithRandomData(accountState.PublicKey);
+			accountState.PublicKeyHeight = Height(1);
+
+			// add enough mosaics, importances and activity buckets to resemble a well-used account
+			for (auto i = 0u; i < Num_Mosaics_Per_Account; ++i)
+				accountState.Balances.credit(MosaicId(i + 1), Amount(bench::Random() % 1'000'000 + 1));
+
+			for (auto i = 0u; i < Importance_History_Size; ++i) {
+				auto importanceHeight = model::ImportanceHeight(1 + i * 359);
+				accountState.ImportanceSnapshots.set(Importance(bench::Random() % 1'000'000 + 1), importanceHeight);
+				accountState.ActivityBuckets.update(importanceHeight, [](auto& bucket) {
+					bucket.BeneficiaryCount = 1;
+					bucket.TotalFeesPaid = Amount(bench::Random() % 1000);
+				});
+			}
+
+			return accountState;
+		}
+
+		void BenchmarkCommit(benchmark::State& state) {
+			// Arrange: seed the base set with accounts
+			auto numAccounts = static_cast<size_t>(state.range(0));
+			auto numModifiedAccounts = static_cast<size_t>(state.range(1));
+
+			AccountStateBaseSet set;
+			std::vector<Address> addresses;
+			{
+				auto pDelta = set.rebase();
+				for (auto i = 0u; i < numAccounts; ++i) {
+					auto accountState = CreateAccountState();
+					addresses.push_back(accountState.Address);
+					pDelta->insert(accountState);
+				}
+
+				set.commit();
+			}
+
+			for (auto _ : state) {
+				// - modify a subset of existing accounts and add the same number of new accounts
+				state.PauseTiming();
+				auto pDelta = set.rebase();
+				for (auto i = 0u; i < numModifiedAccounts; ++i) {
+					auto& accountState = *pDelta->find(addresses[bench::Random() % addresses.size()]).get();
+					accountState.Balances.credit(MosaicId(1), Amount(1));
+					pDelta->insert(CreateAccountState());
+				}
+
+				state.ResumeTiming();
+
+				// Act:
+				set.commit();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(2 * numModifiedAccounts * state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkCommit", catapult::deltaset::BenchmarkCommit)
+			->UseRealTime()
+			->Args({ 10'000, 100 })
+			->Args({ 10'000, 1'000 })
+			->Args({ 100'000, 1'000 })
+			->Args({ 100'000, 10'000 });
+}
@@ -0,0 +1,112 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/importance/ImportanceCalculator.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <thread>
+
+namespace catapult { namespace importance {
+
+	namespace {
+		constexpr MosaicId Currency_Mosaic_Id(1234);
+		constexpr MosaicId Harvesting_Mosaic_Id(9876);
+		constexpr Amount Min_Harvester_Balance(1'000'000);
+
+		model::BlockChainConfiguration CreateBlockChainConfiguration() {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.HarvestingMosaicId = Harvesting_Mosaic_Id;
+			config.ImportanceGrouping = 1;
+			config.TotalChainImportance = Importance(8'999'999'998'000'000);
+			config.ImportanceActivityPercentage = 5;
+			config.MinHarvesterBalance = Min_Harvester_Balance;
+			return config;
+		}
+
+		cache::AccountStateCacheTypes::Options CreateAccountStateCacheOptions() {
+			return {
+				model::NetworkIdentifier::Mijin_Test,
+				1,
+				1,
+				Min_Harvester_Balance,
+				Amount(std::numeric_limits<Amount::ValueType>::max()),
+				Amount(std::numeric_limits<Amount::ValueType>::max()),
+				Currency_Mosaic_Id,
+				Harvesting_Mosaic_Id
+			};
+		}
+
+		void SeedAccounts(cache::AccountStateCacheDelta& delta, size_t numAccounts) {
+			for (auto i = 0u; i < numAccounts; ++i) {
+				Address address;
+				bench::FillWithRandomData(address);
+				delta.addAccount(address, Height(1));
+
+				auto& accountState = delta.find(address).get();
+				accountState.Balances.credit(Harvesting_Mosaic_Id, Min_Harvester_Balance + Amount(bench::Random() % 1'000'000'000));
+				accountState.ActivityBuckets.update(model::ImportanceHeight(1), [](auto& bucket) {
+					bucket.TotalFeesPaid = Amount(bench::Random() % 10'000);
+					bucket.BeneficiaryCount = static_cast<uint32_t>(bench::Random() % 100);
+				});
+			}
+
+			delta.updateHighValueAccounts(Height(1));
+		}
+
+		void BenchmarkRecalculate(benchmark::State& state) {
+			// Arrange: seed the cache with high value accounts
+			auto numAccounts = static_cast<size_t>(state.range(0));
+			auto maxWorkerThreads = 0 == state.range(1) ? std::thread::hardware_concurrency() : static_cast<uint32_t>(state.range(1));
+
+			cache::AccountStateCache cache(cache::CacheConfiguration(), CreateAccountStateCacheOptions());
+			auto delta = cache.createDelta();
+			SeedAccounts(*delta, numAccounts);
+
+			auto pPool = thread::CreateIoThreadPool(maxWorkerThreads, "importance");
+			pPool->start();
+
+			auto pCalculator = CreateImportanceCalculator(CreateBlockChainConfiguration(), *pPool, 1024);
+			auto importanceHeight = model::ImportanceHeight(1);
+			for (auto _ : state) {
+				// Act: recalculate at consecutive importance heights because importances must be set with ascending heights
+				importanceHeight = importanceHeight + model::ImportanceHeight(1);
+				pCalculator->recalculate(importanceHeight, *delta);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numAccounts * state.iterations()));
+			pPool->join();
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	// second argument is the maximum number of worker threads (0 indicates hardware concurrency)
+	benchmark::RegisterBenchmark("BenchmarkRecalculate", catapult::importance::BenchmarkRecalculate)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Args({ 1'000'000, 1 })
+			->Args({ 1'000'000, 0 })
+			->Args({ 10'000'000, 1 })
+			->Args({ 10'000'000, 0 });
+}
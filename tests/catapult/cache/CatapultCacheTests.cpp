@@ -373,6 +373,51 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region lock wait statistics
+
+	TEST(TEST_CLASS, LockWaitStatisticsAreInitiallyZero) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+
+		// Act:
+		auto statistics = cache.lockWaitStatistics();
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.ReaderWaitMicros);
+		EXPECT_EQ(0u, statistics.WriterWaitMicros);
+		EXPECT_EQ(0u, statistics.MaxWriterWaitMicros);
+	}
+
+	TEST(TEST_CLASS, LockWaitStatisticsAreAggregatedAcrossSubCaches) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+		for (auto i = 0u; i < 3; ++i) {
+			CommitChangeToAllSubCaches(cache);
+			cache.createView();
+		}
+
+		// Act:
+		auto statistics = cache.lockWaitStatistics();
+
+		// Assert:
+		CacheLockWaitStatistics expectedStatistics{};
+		for (const auto& subStatistics : {
+			cache.sub<test::SimpleCacheT<2>>().lockWaitStatistics(),
+			cache.sub<test::SimpleCacheT<4>>().lockWaitStatistics(),
+			cache.sub<test::SimpleCacheT<6>>().lockWaitStatistics()
+		}) {
+			expectedStatistics.ReaderWaitMicros += subStatistics.ReaderWaitMicros;
+			expectedStatistics.WriterWaitMicros += subStatistics.WriterWaitMicros;
+			expectedStatistics.MaxWriterWaitMicros = std::max(expectedStatistics.MaxWriterWaitMicros, subStatistics.MaxWriterWaitMicros);
+		}
+
+		EXPECT_EQ(expectedStatistics.ReaderWaitMicros, statistics.ReaderWaitMicros);
+		EXPECT_EQ(expectedStatistics.WriterWaitMicros, statistics.WriterWaitMicros);
+		EXPECT_EQ(expectedStatistics.MaxWriterWaitMicros, statistics.MaxWriterWaitMicros);
+	}
+
+	// endregion
+
 	// region cache height
 
 	TEST(TEST_CLASS, CacheHeightIsInitiallyZero) {
@@ -22,6 +22,7 @@
 #include "catapult/thread/Future.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/nodeps/LockTestUtils.h"
+#include "tests/test/nodeps/Waits.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -575,6 +576,113 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region lock wait statistics
+
+	TEST(TEST_CLASS, LockWaitStatisticsAreInitiallyZero) {
+		// Arrange:
+		test::SimpleCache cache;
+
+		// Act:
+		auto statistics = cache.lockWaitStatistics();
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.ReaderWaitMicros);
+		EXPECT_EQ(0u, statistics.WriterWaitMicros);
+		EXPECT_EQ(0u, statistics.MaxWriterWaitMicros);
+	}
+
+	TEST(TEST_CLASS, UncontendedReadersDoNotIncreaseReaderWaitStatistics) {
+		// Arrange:
+		test::SimpleCache cache;
+
+		// Act:
+		for (auto i = 0u; i < 5; ++i) {
+			auto view = cache.createView();
+			auto detachedDelta = cache.createDetachedDelta();
+			auto lockedDetachedDelta = detachedDelta.tryLock();
+		}
+
+		{
+			auto delta = cache.createDelta();
+		}
+
+		auto statistics = cache.lockWaitStatistics();
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.ReaderWaitMicros);
+	}
+
+	TEST(TEST_CLASS, ViewBlockedByCommitIncreasesReaderWaitStatistics) {
+		// Arrange:
+		test::SimpleCache cache;
+		std::thread commitThread;
+		std::thread viewThread;
+		{
+			auto view = cache.createView();
+
+			// - commit on a separate thread while the view is held so that a writer is pending
+			commitThread = std::thread([&cache]() {
+				auto delta = cache.createDelta();
+				cache.commit();
+			});
+			test::Sleep(50);
+
+			// Act: create a view on a separate thread while the writer is pending
+			viewThread = std::thread([&cache]() {
+				auto view2 = cache.createView();
+			});
+			test::Sleep(50);
+		}
+
+		commitThread.join();
+		viewThread.join();
+		auto statistics = cache.lockWaitStatistics();
+
+		// Assert:
+		EXPECT_LT(0u, statistics.ReaderWaitMicros);
+	}
+
+	TEST(TEST_CLASS, CommitBlockedByViewIncreasesWriterWaitStatistics) {
+		// Arrange:
+		test::SimpleCache cache;
+		std::thread commitThread;
+		{
+			auto view = cache.createView();
+
+			// Act: commit on a separate thread while the view is held
+			commitThread = std::thread([&cache]() {
+				auto delta = cache.createDelta();
+				cache.commit();
+			});
+			test::Sleep(50);
+		}
+
+		commitThread.join();
+		auto statistics = cache.lockWaitStatistics();
+
+		// Assert: only a single commit was made, so total and maximum writer waits are equal
+		EXPECT_LT(0u, statistics.WriterWaitMicros);
+		EXPECT_EQ(statistics.WriterWaitMicros, statistics.MaxWriterWaitMicros);
+	}
+
+	TEST(TEST_CLASS, MaxWriterWaitStatisticIsNotGreaterThanTotalWriterWait) {
+		// Arrange:
+		test::SimpleCache cache;
+
+		// Act:
+		for (auto i = 0u; i < 5; ++i) {
+			auto delta = cache.createDelta();
+			cache.commit();
+		}
+
+		auto statistics = cache.lockWaitStatistics();
+
+		// Assert:
+		EXPECT_GE(statistics.WriterWaitMicros, statistics.MaxWriterWaitMicros);
+	}
+
+	// endregion
+
 	// region SynchronizedCacheWithInit
 
 	namespace {
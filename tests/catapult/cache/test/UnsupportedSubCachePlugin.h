@@ -116,6 +116,11 @@ namespace catapult { namespace test {
 			CATAPULT_THROW_RUNTIME_ERROR("commit is not supported");
 		}
 
+		[[noreturn]]
+		cache::CacheLockWaitStatistics lockWaitStatistics() const override {
+			CATAPULT_THROW_RUNTIME_ERROR("lockWaitStatistics is not supported");
+		}
+
 	public:
 		[[noreturn]]
 		const void* get() const override {
@@ -1394,6 +1394,31 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[2] }), delta->highValueAccounts().addresses());
 	}
 
+	TEST(TEST_CLASS, UpdateHighValueAccountsProcessesAccountsModifiedAcrossMultipleUpdates) {
+		// Arrange: set min balance to 1M
+		auto options = Default_Cache_Options;
+		options.MinHarvesterBalance = Amount(1'000'000);
+		AccountStateCache cache(CacheConfiguration(), options);
+
+		// - prepare delta with 2/3 accounts with sufficient balance
+		auto delta = cache.createDelta();
+		auto addresses = AddAccountsWithBalances(*delta, { Amount(1'100'000), Amount(900'000), Amount(1'000'000) });
+		delta->updateHighValueAccounts(Height(1));
+
+		// Act: modify accounts between updates
+		delta->find(addresses[1]).get().Balances.credit(Harvesting_Mosaic_Id, Amount(100'000));
+		delta->updateHighValueAccounts(Height(2));
+		auto highValueAddresses2 = delta->highValueAccounts().addresses();
+
+		delta->find(addresses[0]).get().Balances.debit(Harvesting_Mosaic_Id, Amount(100'001));
+		delta->updateHighValueAccounts(Height(3));
+		auto highValueAddresses3 = delta->highValueAccounts().addresses();
+
+		// Assert:
+		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[1], addresses[2] }), highValueAddresses2);
+		EXPECT_EQ(model::AddressSet({ addresses[1], addresses[2] }), highValueAddresses3);
+	}
+
 	TEST(TEST_CLASS, DetachHighValueAccountsIsDestructive) {
 		// Arrange: set min balance to 1M
 		auto options = Default_Cache_Options;
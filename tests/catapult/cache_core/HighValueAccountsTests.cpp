@@ -132,6 +132,16 @@ namespace catapult { namespace cache {
 		test::AssertEqual(accounts.accountHistories(), updater.accountHistories());
 	}
 
+	TEST(TEST_CLASS, Updater_SharesAccountsUntilModified) {
+		// Act:
+		auto accounts = HighValueAccounts(GenerateRandomAddresses(4), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Assert: no copies were made
+		EXPECT_EQ(&accounts.addresses(), &updater.addresses());
+		EXPECT_EQ(&accounts.accountHistories(), &updater.accountHistories());
+	}
+
 	// endregion
 
 	// region updater - setHeight
@@ -1061,6 +1071,92 @@ namespace catapult { namespace cache {
 		AssertPruneTerminal(Height(101));
 	}
 
+	TEST(TEST_CLASS, Updater_PruneDoesNotCopyAccountHistoriesWhenPruneHasNoEffect) {
+		// Arrange: all histories have at least min voter balance and start at or after height 2
+		auto accounts = HighValueAccounts(GenerateRandomAddresses(4), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.prune(Height(2));
+
+		// Assert: no copies were made
+		EXPECT_EQ(&accounts.accountHistories(), &updater.accountHistories());
+	}
+
+	TEST(TEST_CLASS, Updater_PruneCopiesAccountHistoriesWhenPruneHasEffect) {
+		// Arrange: first history starts at height 2
+		auto accounts = HighValueAccounts(GenerateRandomAddresses(4), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.prune(Height(3));
+
+		// Assert: a copy was made and the original histories are unchanged
+		EXPECT_NE(&accounts.accountHistories(), &updater.accountHistories());
+		test::AssertEqual(CreateThreeAccountHistories(), accounts.accountHistories());
+	}
+
+	// endregion
+
+	// region updater - update (modified filter)
+
+	TEST(TEST_CLASS, Updater_CanProcessOnlyModifiedAddresses) {
+		// Arrange:
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Added, GetHarvesterEligibleTestBalances());
+
+		auto accounts = CreateAccounts({});
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act: only accept a subset of the (high value) accounts
+		auto modifiedAddresses = Pick(addedAddresses, { 0, 1, 4 });
+		updater.update(deltas.deltas(), [&modifiedAddresses](const auto& address) {
+			return modifiedAddresses.cend() != modifiedAddresses.find(address);
+		});
+
+		// Assert: the only (voter eligible) account was not processed
+		EXPECT_EQ(Pick(addedAddresses, { 0, 4 }), updater.addresses());
+		EXPECT_TRUE(updater.removedAddresses().empty());
+
+		EXPECT_TRUE(updater.accountHistories().empty());
+	}
+
+	TEST(TEST_CLASS, Updater_DoesNotCopyAccountsWhenUpdateHasNoEffect) {
+		// Arrange: all accounts are already (harvester eligible) high value accounts
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Copied, { Min_Harvester_Balance, Min_Harvester_Balance + Amount(1) });
+
+		auto accounts = CreateAccounts(model::AddressSet(addedAddresses.cbegin(), addedAddresses.cend()));
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.update(deltas.deltas());
+
+		// Assert: no copies were made
+		EXPECT_EQ(&accounts.addresses(), &updater.addresses());
+		EXPECT_EQ(&accounts.accountHistories(), &updater.accountHistories());
+	}
+
+	TEST(TEST_CLASS, Updater_CopiesAccountsWhenUpdateHasEffect) {
+		// Arrange:
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Copied, { Min_Harvester_Balance - Amount(1), Min_Harvester_Balance });
+
+		auto accounts = CreateAccounts(model::AddressSet(addedAddresses.cbegin(), addedAddresses.cend()));
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.update(deltas.deltas());
+
+		// Assert: only addresses were copied and original accounts are unchanged
+		EXPECT_NE(&accounts.addresses(), &updater.addresses());
+		EXPECT_EQ(&accounts.accountHistories(), &updater.accountHistories());
+
+		EXPECT_EQ(Pick(addedAddresses, { 1 }), updater.addresses());
+		EXPECT_EQ(Pick(addedAddresses, { 0 }), updater.removedAddresses());
+		EXPECT_EQ(Pick(addedAddresses, { 0, 1 }), accounts.addresses());
+	}
+
 	// endregion
 
 	// region updater - detachAccounts
@@ -1095,5 +1191,24 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(updater.accountHistories().empty());
 	}
 
+	TEST(TEST_CLASS, Updater_DetachAccountsSharesUnmodifiedAccounts) {
+		// Arrange:
+		auto originalAccounts = HighValueAccounts(GenerateRandomAddresses(4), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), originalAccounts);
+
+		// Act:
+		auto accounts = updater.detachAccounts();
+
+		// Assert: no copies were made
+		EXPECT_EQ(&originalAccounts.addresses(), &accounts.addresses());
+		EXPECT_EQ(&originalAccounts.accountHistories(), &accounts.accountHistories());
+
+		// - updater is cleared
+		EXPECT_TRUE(updater.addresses().empty());
+		EXPECT_TRUE(updater.removedAddresses().empty());
+
+		EXPECT_TRUE(updater.accountHistories().empty());
+	}
+
 	// endregion
 }}
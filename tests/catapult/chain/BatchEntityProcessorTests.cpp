@@ -32,7 +32,11 @@ namespace catapult { namespace chain {
 	namespace {
 		class ProcessorTestContext {
 		public:
-			ProcessorTestContext() : m_processor(CreateBatchEntityProcessor(m_executionConfig.Config))
+			ProcessorTestContext() : ProcessorTestContext(nullptr)
+			{}
+
+			explicit ProcessorTestContext(const std::shared_ptr<model::ExecutionProfiler>& pExecutionProfiler)
+					: m_processor(createProcessor(pExecutionProfiler))
 			{}
 
 		public:
@@ -148,6 +152,12 @@ namespace catapult { namespace chain {
 				assertObserverEntities(entityInfos);
 			}
 
+		private:
+			BatchEntityProcessor createProcessor(const std::shared_ptr<model::ExecutionProfiler>& pExecutionProfiler) {
+				m_executionConfig.Config.pExecutionProfiler = pExecutionProfiler;
+				return CreateBatchEntityProcessor(m_executionConfig.Config);
+			}
+
 		private:
 			test::MockExecutionConfiguration m_executionConfig;
 			BatchEntityProcessor m_processor;
@@ -215,6 +225,25 @@ namespace catapult { namespace chain {
 		context.assertEntityInfos(entityInfos);
 	}
 
+	TEST(TEST_CLASS, ProcessorProfilesNonEmptyBlocksWhenExecutionProfilerIsSet) {
+		// Arrange: use a zero threshold so that all profiled blocks are slow
+		auto pProfiler = std::make_shared<model::ExecutionProfiler>(utils::TimeSpan());
+		ProcessorTestContext context(pProfiler);
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act:
+		auto result1 = context.process(Height(246), Timestamp(721), model::WeakEntityInfos());
+		auto result2 = context.process(Height(247), Timestamp(723), entityInfos);
+		auto result3 = context.process(Height(248), Timestamp(725), entityInfos);
+
+		// Assert: empty blocks are not profiled
+		EXPECT_EQ(ValidationResult::Neutral, result1);
+		EXPECT_EQ(ValidationResult::Success, result2);
+		EXPECT_EQ(ValidationResult::Success, result3);
+		EXPECT_EQ(2u, pProfiler->numSlowBlocks());
+	}
+
 	namespace {
 		void AssertValidatorContext(const validators::ValidatorContext& context, Height height, Timestamp blockTime) {
 			EXPECT_EQ(height, context.Height);
@@ -23,6 +23,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/model/EntityRange.h"
 #include "tests/catapult/chain/test/MockChainApi.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -44,6 +45,8 @@ namespace catapult { namespace chain {
 
 		// region test context
 
+		enum class VerifierMode { Verified, Unverified, Exception };
+
 		struct TestContext {
 		public:
 			TestContext(const ChainScore& localScore, const ChainScore& remoteScore)
@@ -65,7 +68,8 @@ namespace catapult { namespace chain {
 					, pIo(std::make_shared<MockPacketIo>())
 					, pChainApi(std::make_shared<MockChainApi>(remoteScore, std::move(pRemoteLastBlock)))
 					, BlockRangeConsumerCalls(0)
-					, Config(CreateConfiguration()) {
+					, Config(CreateConfiguration())
+					, RemoteFinalizedHeightVerifierMode(VerifierMode::Verified) {
 				pChainApi->setHashes(Last_Finalized_Height, remoteHashes);
 			}
 
@@ -90,8 +94,11 @@ namespace catapult { namespace chain {
 			std::shared_ptr<MockChainApi> pChainApi;
 			size_t BlockRangeConsumerCalls;
 			std::vector<model::NodeIdentity> BlockRangeSourceIdentities;
+			std::vector<Height> BlockRangeStartHeights;
 			ChainSynchronizerConfiguration Config;
 			disruptor::ProcessingCompleteFunc ProcessingComplete;
+			VerifierMode RemoteFinalizedHeightVerifierMode;
+			std::vector<Height> VerifiedRemoteFinalizedHeights;
 		};
 
 		// endregion
@@ -100,21 +107,41 @@ namespace catapult { namespace chain {
 
 		enum class ConsumerMode { Normal, Full };
 
-		RemoteNodeSynchronizer<api::RemoteChainApi> CreateSynchronizer(TestContext& context, ConsumerMode mode = ConsumerMode::Normal) {
+		ParallelRemoteNodeSynchronizer<api::RemoteChainApi> CreateParallelSynchronizer(
+				TestContext& context,
+				ConsumerMode mode = ConsumerMode::Normal) {
 			auto pVerifiableBlock = test::GenerateBlockWithTransactions(0, Default_Height);
 			auto pLocal = std::make_shared<MockChainApi>(context.LocalScore, std::move(pVerifiableBlock));
 			pLocal->setHashes(Last_Finalized_Height, context.LocalHashes);
 
 			auto finalizedHeightSupplier = []() { return Last_Finalized_Height; };
 
+			auto remoteFinalizedHeightVerifier = [&context](const auto&, auto height) {
+				context.VerifiedRemoteFinalizedHeights.push_back(height);
+				if (VerifierMode::Exception == context.RemoteFinalizedHeightVerifierMode)
+					return thread::make_exceptional_future<bool>(catapult_runtime_error("verification failed"));
+
+				return thread::make_ready_future(VerifierMode::Verified == context.RemoteFinalizedHeightVerifierMode);
+			};
+
 			auto blockRangeConsumer = [mode, &context](const auto& range, const auto& processingComplete) {
 				++context.BlockRangeConsumerCalls;
 				context.BlockRangeSourceIdentities.push_back(range.SourceIdentity);
+				context.BlockRangeStartHeights.push_back(range.Range.cbegin()->Height);
 				context.ProcessingComplete = processingComplete;
 				return ConsumerMode::Normal == mode ? context.BlockRangeConsumerCalls : 0;
 			};
 
-			return CreateChainSynchronizer(pLocal, context.Config, finalizedHeightSupplier, blockRangeConsumer);
+			return CreateParallelChainSynchronizer(
+					pLocal,
+					context.Config,
+					finalizedHeightSupplier,
+					remoteFinalizedHeightVerifier,
+					blockRangeConsumer);
+		}
+
+		RemoteNodeSynchronizer<api::RemoteChainApi> CreateSynchronizer(TestContext& context, ConsumerMode mode = ConsumerMode::Normal) {
+			return CreateParallelSynchronizer(context, mode).Synchronizer;
 		}
 
 		disruptor::ConsumerCompletionResult CreateContinueResult() {
@@ -384,6 +411,520 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region chain synchronization - streaming
+
+	namespace {
+		void AssertStreamingPullRequests(
+				const mocks::MockChainApi& chainApi,
+				const std::vector<std::pair<Height, uint32_t>>& expectedHeightNumBlocksPairs) {
+			// Assert:
+			ASSERT_EQ(expectedHeightNumBlocksPairs.size(), chainApi.blocksFromRequests().size());
+
+			auto i = 0u;
+			for (const auto& params : chainApi.blocksFromRequests()) {
+				EXPECT_EQ(expectedHeightNumBlocksPairs[i].first, params.first) << "height of request " << i;
+				EXPECT_EQ(expectedHeightNumBlocksPairs[i].second, params.second.NumBlocks) << "NumBlocks of request " << i;
+				EXPECT_EQ(17u, params.second.NumBytes) << "NumBytes of request " << i; // maxChainBytesPerSyncChunk
+				++i;
+			}
+		}
+
+		TestContext CreateStreamingTestContextWithHashes(size_t numLocalHashes, size_t numRemoteHashes, size_t forkDepth = 0) {
+			auto context = CreateTestContextWithHashes(numLocalHashes, numRemoteHashes, forkDepth);
+			context.Config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512).bytes32();
+			context.Config.MaxChainBytesPerSyncChunk = 17;
+			return context;
+		}
+	}
+
+	TEST(TEST_CLASS, StreamingForwardsEachChunkUntilAttemptBlockLimitIsReached) {
+		// Arrange: pulls 2 blocks at time: 3 chunks needed to pull 5 blocks
+		auto context = CreateStreamingTestContextWithHashes(9, 10);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: each chunk is forwarded as soon as it is received
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 3);
+		AssertStreamingPullRequests(*context.pChainApi, {
+			{ Default_Height, 5 },
+			{ Default_Height + Height(2), 3 },
+			{ Default_Height + Height(4), 1 }
+		});
+	}
+
+	TEST(TEST_CLASS, StreamingForwardsEachChunkUntilAttemptByteLimitIsReached) {
+		// Arrange: pulls 2 blocks at time: 2 chunks are needed to exceed 3 blocks worth of bytes
+		auto context = CreateStreamingTestContextWithHashes(9, 10);
+		context.Config.MaxChainBytesPerSyncAttempt = 3 * sizeof(BlockHeader);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 2);
+		AssertStreamingPullRequests(*context.pChainApi, {
+			{ Default_Height, 5 },
+			{ Default_Height + Height(2), 3 }
+		});
+	}
+
+	TEST(TEST_CLASS, StreamingAggregatesChunksUntilForkIsCovered) {
+		// Arrange:
+		// - common block has height 10 + 4 (fork depth 6)
+		// - pulls 2 blocks at time: 3 chunks are aggregated and forwarded together since they cover the fork
+		constexpr auto Common_Block_Height = Height(14);
+
+		auto context = CreateStreamingTestContextWithHashes(4, 10, 6);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: attempt block limit (5) is exceeded after the fork is covered, so no further chunks are requested
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 1);
+		AssertStreamingPullRequests(*context.pChainApi, {
+			{ Common_Block_Height + Height(1), 5 },
+			{ Common_Block_Height + Height(3), 5 },
+			{ Common_Block_Height + Height(5), 5 }
+		});
+	}
+
+	TEST(TEST_CLASS, StreamingStopsWhenRemoteRunsOutOfBlocks) {
+		// Arrange: second chunk returns no blocks
+		auto context = CreateStreamingTestContextWithHashes(9, 10);
+		context.pChainApi->setNumBlocksPerBlocksFromRequest({ 2, 0 });
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: first chunk was forwarded, so interaction is successful
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 1);
+		AssertStreamingPullRequests(*context.pChainApi, {
+			{ Default_Height, 5 },
+			{ Default_Height + Height(2), 3 }
+		});
+	}
+
+	TEST(TEST_CLASS, StreamingStopsWhenConsumerIsFull) {
+		// Arrange: simulate a full consumer
+		auto context = CreateStreamingTestContextWithHashes(9, 10);
+		auto synchronizer = CreateSynchronizer(context, ConsumerMode::Full);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: neutral because blocks could not be processed, so no further chunks are requested
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, code);
+		AssertSync(context, 1);
+		AssertStreamingPullRequests(*context.pChainApi, { { Default_Height, 5 } });
+	}
+
+	// endregion
+
+	// region chain synchronization - parallel ranges
+
+	namespace {
+		constexpr auto Remote_Finalized_Height = Default_Height + Height(17);
+
+		using Blocks = std::vector<std::shared_ptr<const Block>>;
+
+		Blocks GenerateLinkedBlocks(Height startHeight, size_t numBlocks) {
+			Blocks blocks;
+			auto previousBlockHash = test::GenerateRandomByteArray<Hash256>();
+			for (auto i = 0u; i < numBlocks; ++i) {
+				std::shared_ptr<Block> pBlock = test::GenerateBlockWithTransactions(0, startHeight + Height(i));
+				pBlock->PreviousBlockHash = previousBlockHash;
+				previousBlockHash = CalculateHash(*pBlock);
+				blocks.push_back(pBlock);
+			}
+
+			return blocks;
+		}
+
+		std::shared_ptr<MockChainApi> CreateParallelRemote(const Blocks& chainBlocks) {
+			auto pChainApi = std::make_shared<MockChainApi>(ChainScore(11), Default_Height);
+			pChainApi->setChainBlocks(chainBlocks);
+			pChainApi->setNumBlocksPerBlocksFromRequest({ 5 });
+			return pChainApi;
+		}
+
+		TestContext CreateParallelTestContext(const Blocks& chainBlocks, Height remoteFinalizedHeight = Remote_Finalized_Height) {
+			// common block has height 19, so blocks are pulled starting at Default_Height (20)
+			auto context = CreateTestContextWithHashes(9, 10);
+			context.Config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512).bytes32();
+			context.Config.MaxParallelSyncRanges = 2;
+			context.pChainApi->setFinalizedHeight(remoteFinalizedHeight);
+			context.pChainApi->setChainBlocks(chainBlocks);
+			context.pChainApi->setNumBlocksPerBlocksFromRequest({ 5 });
+			return context;
+		}
+
+		void AssertPullRequests(
+				const mocks::MockChainApi& chainApi,
+				const std::vector<std::pair<Height, uint32_t>>& expectedHeightNumBlocksPairs) {
+			// Assert:
+			ASSERT_EQ(expectedHeightNumBlocksPairs.size(), chainApi.blocksFromRequests().size());
+
+			auto i = 0u;
+			for (const auto& params : chainApi.blocksFromRequests()) {
+				EXPECT_EQ(expectedHeightNumBlocksPairs[i].first, params.first) << "height of request " << i;
+				EXPECT_EQ(expectedHeightNumBlocksPairs[i].second, params.second.NumBlocks) << "NumBlocks of request " << i;
+				EXPECT_EQ(utils::FileSize::FromKilobytes(8 * 512).bytes32(), params.second.NumBytes) << "NumBytes of request " << i;
+				++i;
+			}
+		}
+
+		std::vector<ionet::NodeInteractionResultCode> Synchronize(
+				RemoteNodeSynchronizer<api::RemoteChainApi>& synchronizer,
+				const std::vector<std::shared_ptr<MockChainApi>>& remotes) {
+			std::vector<ionet::NodeInteractionResultCode> interactionResultCodes;
+			for (const auto& pRemote : remotes)
+				interactionResultCodes.push_back(synchronizer(*pRemote).get());
+
+			return interactionResultCodes;
+		}
+
+		void AssertNoParallelSync(
+				uint32_t maxParallelSyncRanges,
+				Height remoteFinalizedHeight,
+				VerifierMode verifierMode,
+				const std::vector<Height>& expectedVerifiedHeights) {
+			// Arrange:
+			auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+			auto context = CreateParallelTestContext(chainBlocks, remoteFinalizedHeight);
+			context.Config.MaxParallelSyncRanges = maxParallelSyncRanges;
+			context.RemoteFinalizedHeightVerifierMode = verifierMode;
+			auto synchronizer = CreateSynchronizer(context);
+
+			// Act:
+			auto pRemote = context.pChainApi;
+			auto interactionResultCodes = Synchronize(synchronizer, { pRemote, pRemote, pRemote, pRemote });
+
+			// Assert: all blocks were pulled with regular sync attempts
+			EXPECT_EQ(std::vector<ionet::NodeInteractionResultCode>(4, ionet::NodeInteractionResultCode::Success), interactionResultCodes);
+			AssertSync(context, 4);
+			AssertPullRequests(*context.pChainApi, {
+				{ Default_Height, 5 },
+				{ Default_Height + Height(5), 5 },
+				{ Default_Height + Height(10), 5 },
+				{ Default_Height + Height(15), 5 }
+			});
+			EXPECT_EQ(expectedVerifiedHeights, context.VerifiedRemoteFinalizedHeights);
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsNotStartedWhenDisabled) {
+		AssertNoParallelSync(0, Remote_Finalized_Height, VerifierMode::Verified, {});
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsNotStartedWhenRemoteFinalizedHeightDoesNotSpanMultipleRanges) {
+		AssertNoParallelSync(2, Default_Height + Height(4), VerifierMode::Verified, {});
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsNotStartedWhenRemoteFinalizedHeightCannotBeVerified) {
+		AssertNoParallelSync(2, Remote_Finalized_Height, VerifierMode::Unverified, { Remote_Finalized_Height });
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenRemoteFinalizedHeightVerificationThrows) {
+		// Arrange:
+		auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+		auto context = CreateParallelTestContext(chainBlocks);
+		context.RemoteFinalizedHeightVerifierMode = VerifierMode::Exception;
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto pRemote = context.pChainApi;
+		auto interactionResultCodes = Synchronize(synchronizer, { pRemote, pRemote });
+
+		// Assert: no blocks were pulled and the second sync started over with a chain comparison
+		EXPECT_EQ(std::vector<ionet::NodeInteractionResultCode>(2, ionet::NodeInteractionResultCode::Failure), interactionResultCodes);
+		AssertSync(context, 0);
+		AssertPullRequests(*context.pChainApi, {});
+		EXPECT_EQ(2u, context.pChainApi->hashesFromRequests().size());
+		EXPECT_EQ(std::vector<Height>({ Remote_Finalized_Height, Remote_Finalized_Height }), context.VerifiedRemoteFinalizedHeights);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncPullsRangesUpToRemoteFinalizedHeightAndThenResumesRegularSync) {
+		// Arrange:
+		auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+		auto context = CreateParallelTestContext(chainBlocks);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto pRemote = context.pChainApi;
+		auto interactionResultCodes = Synchronize(synchronizer, { pRemote, pRemote, pRemote, pRemote, pRemote });
+
+		// Assert: last parallel range ends at the remote finalized height (37) and the last request is a regular sync attempt
+		EXPECT_EQ(std::vector<ionet::NodeInteractionResultCode>(5, ionet::NodeInteractionResultCode::Success), interactionResultCodes);
+		AssertSync(context, 5);
+		AssertPullRequests(*context.pChainApi, {
+			{ Default_Height, 5 },
+			{ Default_Height + Height(5), 5 },
+			{ Default_Height + Height(10), 5 },
+			{ Default_Height + Height(15), 3 },
+			{ Default_Height + Height(18), 5 }
+		});
+
+		EXPECT_EQ(
+				std::vector<Height>({ Height(20), Height(25), Height(30), Height(35), Height(38) }),
+				context.BlockRangeStartHeights);
+		EXPECT_EQ(std::vector<Height>({ Remote_Finalized_Height }), context.VerifiedRemoteFinalizedHeights);
+	}
+
+	TEST(TEST_CLASS, ParallelismIsMaxParallelSyncRangesOnlyWhileParallelSyncIsActive) {
+		// Arrange:
+		auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+		auto context = CreateParallelTestContext(chainBlocks);
+		auto synchronizer = CreateParallelSynchronizer(context);
+
+		// Act:
+		std::vector<size_t> parallelisms{ synchronizer.ParallelismSupplier() };
+		for (auto i = 0u; i < 5; ++i) {
+			synchronizer.Synchronizer(*context.pChainApi).get();
+			parallelisms.push_back(synchronizer.ParallelismSupplier());
+		}
+
+		// Assert: session is started by the first sync and completed by the fourth sync, which pulls up to the remote finalized height
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 2, 2, 1, 1 }), parallelisms);
+		EXPECT_EQ(std::vector<Height>({ Height(20), Height(25), Height(30), Height(35), Height(38) }), context.BlockRangeStartHeights);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncRequestsRemainderOfPartialRange) {
+		// Arrange: second request only returns two blocks
+		auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+		auto context = CreateParallelTestContext(chainBlocks);
+		context.pChainApi->setNumBlocksPerBlocksFromRequest({ 5, 2, 5 });
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto pRemote = context.pChainApi;
+		auto interactionResultCodes = Synchronize(synchronizer, { pRemote, pRemote, pRemote });
+
+		// Assert:
+		EXPECT_EQ(std::vector<ionet::NodeInteractionResultCode>(3, ionet::NodeInteractionResultCode::Success), interactionResultCodes);
+		AssertSync(context, 3);
+		AssertPullRequests(*context.pChainApi, {
+			{ Default_Height, 5 },
+			{ Default_Height + Height(5), 5 },
+			{ Default_Height + Height(7), 3 }
+		});
+
+		EXPECT_EQ(std::vector<Height>({ Height(20), Height(25), Height(27) }), context.BlockRangeStartHeights);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncRequestsRangeAgainAfterFailedPull) {
+		// Arrange:
+		auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+		auto context = CreateParallelTestContext(chainBlocks);
+		auto synchronizer = CreateSynchronizer(context);
+
+		auto pFailingRemote = CreateParallelRemote(chainBlocks);
+		pFailingRemote->setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act:
+		auto pRemote = context.pChainApi;
+		auto interactionResultCodes = Synchronize(synchronizer, { pRemote, pFailingRemote, pRemote });
+
+		// Assert:
+		std::vector<ionet::NodeInteractionResultCode> expectedInteractionResultCodes{
+			ionet::NodeInteractionResultCode::Success,
+			ionet::NodeInteractionResultCode::Failure,
+			ionet::NodeInteractionResultCode::Success
+		};
+		EXPECT_EQ(expectedInteractionResultCodes, interactionResultCodes);
+		AssertSync(context, 2);
+		AssertPullRequests(*pFailingRemote, { { Default_Height + Height(5), 5 } });
+		AssertPullRequests(*context.pChainApi, { { Default_Height, 5 }, { Default_Height + Height(5), 5 } });
+
+		EXPECT_EQ(std::vector<Height>({ Height(20), Height(25) }), context.BlockRangeStartHeights);
+	}
+
+	namespace {
+		void AssertRemoteReturningBadRangeIsPunished(const std::shared_ptr<MockChainApi>& pBadRemote, const Blocks& chainBlocks) {
+			// Arrange:
+			auto context = CreateParallelTestContext(chainBlocks);
+			auto synchronizer = CreateSynchronizer(context);
+
+			// Act:
+			auto pRemote = context.pChainApi;
+			auto interactionResultCodes = Synchronize(synchronizer, { pRemote, pBadRemote, pRemote });
+
+			// Assert: bad range was not forwarded and was pulled again from another remote
+			std::vector<ionet::NodeInteractionResultCode> expectedInteractionResultCodes{
+				ionet::NodeInteractionResultCode::Success,
+				ionet::NodeInteractionResultCode::Failure,
+				ionet::NodeInteractionResultCode::Success
+			};
+			EXPECT_EQ(expectedInteractionResultCodes, interactionResultCodes);
+			AssertSync(context, 2);
+			AssertPullRequests(*pBadRemote, { { Default_Height + Height(5), 5 } });
+			AssertPullRequests(*context.pChainApi, { { Default_Height, 5 }, { Default_Height + Height(5), 5 } });
+
+			EXPECT_EQ(std::vector<Height>({ Height(20), Height(25) }), context.BlockRangeStartHeights);
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelSyncRejectsRangeWithUnlinkedBlocks) {
+		// Arrange: bad remote returns random blocks that do not link to each other
+		auto pBadRemote = std::make_shared<MockChainApi>(ChainScore(11), Default_Height);
+		pBadRemote->setNumBlocksPerBlocksFromRequest({ 5 });
+
+		// Assert:
+		AssertRemoteReturningBadRangeIsPunished(pBadRemote, GenerateLinkedBlocks(Default_Height, 25));
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsStoppedWhenRangeDoesNotLinkToPreviousRange) {
+		// Arrange: bad remote returns linked blocks from a different chain
+		auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+		auto context = CreateParallelTestContext(chainBlocks);
+		auto synchronizer = CreateSynchronizer(context);
+
+		auto pBadRemote = CreateParallelRemote(GenerateLinkedBlocks(Default_Height, 25));
+
+		// Act: third sync resumes regular sync after the last forwarded block
+		auto pRemote = context.pChainApi;
+		auto interactionResultCodes = Synchronize(synchronizer, { pRemote, pBadRemote, pRemote });
+
+		// Assert: bad range was not forwarded and the remaining blocks were pulled with a regular sync attempt
+		std::vector<ionet::NodeInteractionResultCode> expectedInteractionResultCodes{
+			ionet::NodeInteractionResultCode::Success,
+			ionet::NodeInteractionResultCode::Failure,
+			ionet::NodeInteractionResultCode::Success
+		};
+		EXPECT_EQ(expectedInteractionResultCodes, interactionResultCodes);
+		AssertSync(context, 2);
+		AssertPullRequests(*pBadRemote, { { Default_Height + Height(5), 5 } });
+		AssertPullRequests(*context.pChainApi, { { Default_Height, 5 }, { Default_Height + Height(5), 5 } });
+
+		EXPECT_EQ(std::vector<Height>({ Height(20), Height(25) }), context.BlockRangeStartHeights);
+		EXPECT_EQ(1u, context.pChainApi->hashesFromRequests().size());
+		EXPECT_EQ(std::vector<Height>({ Remote_Finalized_Height }), context.VerifiedRemoteFinalizedHeights);
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsStoppedAfterTooManyFailedPulls) {
+		// Arrange:
+		auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+		auto context = CreateParallelTestContext(chainBlocks);
+		auto synchronizer = CreateSynchronizer(context);
+
+		auto pFailingRemote = CreateParallelRemote(chainBlocks);
+		pFailingRemote->setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act: last sync resumes regular sync after the last forwarded block
+		auto pRemote = context.pChainApi;
+		auto interactionResultCodes = Synchronize(synchronizer, {
+			pRemote, pFailingRemote, pFailingRemote, pFailingRemote, pFailingRemote, pRemote
+		});
+
+		// Assert:
+		std::vector<ionet::NodeInteractionResultCode> expectedInteractionResultCodes{
+			ionet::NodeInteractionResultCode::Success,
+			ionet::NodeInteractionResultCode::Failure,
+			ionet::NodeInteractionResultCode::Failure,
+			ionet::NodeInteractionResultCode::Failure,
+			ionet::NodeInteractionResultCode::Failure,
+			ionet::NodeInteractionResultCode::Success
+		};
+		EXPECT_EQ(expectedInteractionResultCodes, interactionResultCodes);
+		AssertSync(context, 2);
+		AssertPullRequests(*pFailingRemote, {
+			{ Default_Height + Height(5), 5 },
+			{ Default_Height + Height(5), 5 },
+			{ Default_Height + Height(5), 5 },
+			{ Default_Height + Height(5), 5 }
+		});
+		AssertPullRequests(*context.pChainApi, { { Default_Height, 5 }, { Default_Height + Height(5), 5 } });
+
+		EXPECT_EQ(std::vector<Height>({ Height(20), Height(25) }), context.BlockRangeStartHeights);
+		EXPECT_EQ(1u, context.pChainApi->hashesFromRequests().size());
+	}
+
+	TEST(TEST_CLASS, ParallelSyncIsStoppedWhenProcessingOfRangeIsAborted) {
+		// Arrange:
+		auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+		auto context = CreateParallelTestContext(chainBlocks);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// - pull the first range and abort its processing
+		auto pRemote = context.pChainApi;
+		auto interactionResultCodes = Synchronize(synchronizer, { pRemote });
+		context.ProcessingComplete(1, CreateAbortResult());
+
+		// Act: second sync stops the parallel sync and third sync starts over with a chain comparison
+		auto interactionResultCodes2 = Synchronize(synchronizer, { pRemote, pRemote });
+
+		// Assert:
+		interactionResultCodes.insert(interactionResultCodes.end(), interactionResultCodes2.cbegin(), interactionResultCodes2.cend());
+		std::vector<ionet::NodeInteractionResultCode> expectedInteractionResultCodes{
+			ionet::NodeInteractionResultCode::Success,
+			ionet::NodeInteractionResultCode::Neutral,
+			ionet::NodeInteractionResultCode::Success
+		};
+		EXPECT_EQ(expectedInteractionResultCodes, interactionResultCodes);
+		AssertSync(context, 2);
+		AssertPullRequests(*context.pChainApi, { { Default_Height, 5 }, { Default_Height, 5 } });
+		EXPECT_EQ(2u, context.pChainApi->hashesFromRequests().size());
+	}
+
+	TEST(TEST_CLASS, ParallelSyncForwardsRangesInOrderAndRequestsRangeBlockedBySlowRemoteAgain) {
+		// Arrange: non-deterministic because of dependency on delay
+		test::RunNonDeterministicTest("slow remote", [](auto i) {
+			auto chainBlocks = GenerateLinkedBlocks(Default_Height, 25);
+			auto context = CreateParallelTestContext(chainBlocks);
+			auto synchronizer = CreateSynchronizer(context);
+
+			auto pSlowRemote = CreateParallelRemote(chainBlocks);
+			pSlowRemote->setDelay(utils::TimeSpan::FromMilliseconds(50 * i));
+
+			// Act: pull the first range and start a slow pull of the second range
+			auto pRemote = context.pChainApi;
+			auto interactionResultCodes = Synchronize(synchronizer, { pRemote });
+			auto slowSyncFuture = synchronizer(*pSlowRemote);
+
+			// - pull the third and fourth ranges, which can't be forwarded before the second range
+			auto interactionResultCodes2 = Synchronize(synchronizer, { pRemote, pRemote });
+			auto numBlockRangeConsumerCalls = context.BlockRangeConsumerCalls;
+
+			// - request the second range again since it is blocking all other ranges
+			auto interactionResultCodes3 = Synchronize(synchronizer, { pRemote });
+
+			// - the slow pull must still be pending in order for this test to give a deterministic result
+			if (slowSyncFuture.is_ready())
+				return false;
+
+			auto slowInteractionResultCode = slowSyncFuture.get();
+
+			// Assert:
+			interactionResultCodes.insert(interactionResultCodes.end(), interactionResultCodes2.cbegin(), interactionResultCodes2.cend());
+			interactionResultCodes.insert(interactionResultCodes.end(), interactionResultCodes3.cbegin(), interactionResultCodes3.cend());
+			EXPECT_EQ(std::vector<ionet::NodeInteractionResultCode>(4, ionet::NodeInteractionResultCode::Success), interactionResultCodes);
+			EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, slowInteractionResultCode);
+
+			EXPECT_EQ(1u, numBlockRangeConsumerCalls);
+			AssertSync(context, 4);
+			AssertPullRequests(*pSlowRemote, { { Default_Height + Height(5), 5 } });
+			AssertPullRequests(*context.pChainApi, {
+				{ Default_Height, 5 },
+				{ Default_Height + Height(10), 5 },
+				{ Default_Height + Height(15), 3 },
+				{ Default_Height + Height(5), 5 }
+			});
+
+			EXPECT_EQ(std::vector<Height>({ Height(20), Height(25), Height(30), Height(35) }), context.BlockRangeStartHeights);
+			return true;
+		});
+	}
+
+	// endregion
+
 	// region unprocessed elements
 
 	namespace {
@@ -79,6 +79,7 @@ namespace catapult { namespace chain {
 			// Assert:
 			EXPECT_EQ(Height(static_cast<Height::ValueType>(-1)), result.CommonBlockHeight);
 			EXPECT_EQ(0u, result.ForkDepth);
+			EXPECT_EQ(Height(), result.RemoteFinalizedHeight);
 		}
 
 		// endregion
@@ -423,6 +424,28 @@ namespace catapult { namespace chain {
 		AssertRemoteIsNotSynced<MultiBatchTraits>(Height(7), 40, { { Height(7), 20 }, { Height(27), 20 }, { Height(47), 20 } });
 	}
 
+	TEST(TEST_CLASS, RemoteIsNotSyncedResultContainsRemoteFinalizedHeight) {
+		// Arrange: Local { A, B }, Remote { A, B, C }
+		auto remoteHashes = test::GenerateRandomHashes(3);
+		auto localHashes = test::GenerateRandomHashesSubset(remoteHashes, 2);
+
+		MockChainApi local(ChainScore(10), Height(2));
+		local.setHashes(Height(1), localHashes);
+
+		MockChainApi remote(ChainScore(11), Height(3));
+		remote.setHashes(Height(1), remoteHashes);
+		remote.setFinalizedHeight(Height(3));
+
+		// Act:
+		auto result = CompareChains(local, remote, CreateCompareChainsOptions(20, 1)).get();
+
+		// Assert:
+		EXPECT_EQ(ChainComparisonCode::Remote_Is_Not_Synced, result.Code);
+		EXPECT_EQ(Height(2), result.CommonBlockHeight);
+		EXPECT_EQ(0u, result.ForkDepth);
+		EXPECT_EQ(Height(3), result.RemoteFinalizedHeight);
+	}
+
 	// endregion
 
 	// region hash (one batch)
@@ -24,6 +24,7 @@
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/HashTestUtils.h"
+#include <algorithm>
 #include <map>
 #include <thread>
 
@@ -67,12 +68,23 @@ namespace catapult { namespace mocks {
 			m_apiDelay = delay;
 		}
 
+		/// Sets the finalized height reported by chain statistics to \a finalizedHeight.
+		void setFinalizedHeight(Height finalizedHeight) {
+			m_finalizedHeight = finalizedHeight;
+		}
+
 		/// Adds a block (\a pBlock) to the block map.
 		void addBlock(std::unique_ptr<model::Block>&& pBlock) {
 			auto height = pBlock->Height;
 			m_blocks.emplace(height, std::move(pBlock));
 		}
 
+		/// Sets the chain \a blocks that are returned by blocks-from requests instead of randomly generated blocks.
+		void setChainBlocks(const std::vector<std::shared_ptr<const model::Block>>& blocks) {
+			for (const auto& pBlock : blocks)
+				m_chainBlocks.emplace(pBlock->Height, pBlock);
+		}
+
 		/// Gets the vector of heights that were passed to the block-at requests.
 		const std::vector<Height>& blockAtRequests() const {
 			return m_blockAtRequests;
@@ -111,6 +123,7 @@ namespace catapult { namespace mocks {
 
 			auto chainStatistics = api::ChainStatistics();
 			chainStatistics.Height = chainHeight();
+			chainStatistics.FinalizedHeight = m_finalizedHeight;
 			chainStatistics.Score = m_score;
 			return CreateFutureResponse(std::move(chainStatistics));
 		}
@@ -162,6 +175,10 @@ namespace catapult { namespace mocks {
 			if (m_numBlocksPerBlocksFromRequest.size() > 1)
 				m_numBlocksPerBlocksFromRequest.pop_front();
 
+			// chain blocks are returned like a real remote, which never returns more blocks than requested
+			if (!m_chainBlocks.empty())
+				numBlocks = std::min(numBlocks, options.NumBlocks);
+
 			return CreateFutureResponse(createRange(height, numBlocks));
 		}
 
@@ -183,6 +200,13 @@ namespace catapult { namespace mocks {
 		model::BlockRange createRange(Height startHeight, size_t numBlocks) const {
 			std::vector<std::unique_ptr<const model::Block>> blocks;
 			std::vector<const model::Block*> rawBlocks;
+			if (!m_chainBlocks.empty()) {
+				for (auto iter = m_chainBlocks.find(startHeight); m_chainBlocks.cend() != iter && rawBlocks.size() < numBlocks; ++iter)
+					rawBlocks.push_back(iter->second.get());
+
+				return test::CreateEntityRange(rawBlocks);
+			}
+
 			for (auto i = 0u; i < numBlocks; ++i) {
 				blocks.push_back(test::GenerateBlockWithTransactions(0, startHeight + Height(i)));
 				rawBlocks.push_back(blocks[i].get());
@@ -209,9 +233,11 @@ namespace catapult { namespace mocks {
 
 	private:
 		model::ChainScore m_score;
+		Height m_finalizedHeight;
 		EntryPoint m_errorEntryPoint;
 		std::map<Height, model::HashRange> m_hashes;
 		std::map<Height, std::shared_ptr<model::Block>> m_blocks;
+		std::map<Height, std::shared_ptr<const model::Block>> m_chainBlocks;
 
 		mutable std::vector<Height> m_blockAtRequests;
 		mutable std::vector<std::pair<Height, uint32_t>> m_hashesFromRequests;
@@ -115,6 +115,8 @@ namespace catapult { namespace config {
 			EXPECT_EQ(84u, config.MaxHashesPerSyncAttempt);
 			EXPECT_EQ(42u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(10), config.MaxChainBytesPerSyncChunk);
+			EXPECT_EQ(4u, config.MaxParallelSyncRanges);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -128,9 +130,12 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
+			EXPECT_EQ(1'000u, config.MaxSslSessionCacheSize);
+			EXPECT_EQ(utils::TimeSpan::FromSeconds(0), config.BriefConnectionReuseDuration);
 
 			EXPECT_EQ(utils::FileSize::FromKilobytes(512), config.SocketWorkingBufferSize);
 			EXPECT_EQ(100u, config.SocketWorkingBufferSensitivity);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(64), config.MaxSocketWorkingBufferPoolSize);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(150), config.MaxPacketDataSize);
 
 			EXPECT_EQ(4096u, config.BlockDisruptorSize);
@@ -141,6 +146,9 @@ namespace catapult { namespace config {
 			EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 			EXPECT_TRUE(config.EnableDispatcherInputAuditing);
 
+			EXPECT_FALSE(config.EnableExecutionProfiling);
+			EXPECT_EQ(utils::TimeSpan::FromMilliseconds(500), config.SlowBlockExecutionThreshold);
+
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.MaxCacheDatabaseWriteBatchSize);
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
@@ -49,6 +49,8 @@ namespace catapult { namespace config {
 							{ "maxHashesPerSyncAttempt", "74" },
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxChainBytesPerSyncChunk", "512KB" },
+							{ "maxParallelSyncRanges", "6" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -62,9 +64,12 @@ namespace catapult { namespace config {
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
+							{ "maxSslSessionCacheSize", "321" },
+							{ "briefConnectionReuseDuration", "45s" },
 
 							{ "socketWorkingBufferSize", "128KB" },
 							{ "socketWorkingBufferSensitivity", "6225" },
+							{ "maxSocketWorkingBufferPoolSize", "23MB" },
 							{ "maxPacketDataSize", "10MB" },
 
 							{ "blockDisruptorSize", "1000" },
@@ -75,6 +80,9 @@ namespace catapult { namespace config {
 							{ "enableDispatcherAbortWhenFull", "true" },
 							{ "enableDispatcherInputAuditing", "true" },
 
+							{ "enableExecutionProfiling", "true" },
+							{ "slowBlockExecutionThreshold", "250ms" },
+
 							{ "maxCacheDatabaseWriteBatchSize", "17KB" },
 							{ "maxTrackedNodes", "222" },
 
@@ -146,6 +154,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncChunk);
+				EXPECT_EQ(0u, config.MaxParallelSyncRanges);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -159,9 +169,12 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
+				EXPECT_EQ(0u, config.MaxSslSessionCacheSize);
+				EXPECT_EQ(utils::TimeSpan::FromSeconds(0), config.BriefConnectionReuseDuration);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.SocketWorkingBufferSize);
 				EXPECT_EQ(0u, config.SocketWorkingBufferSensitivity);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxSocketWorkingBufferPoolSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxPacketDataSize);
 
 				EXPECT_EQ(0u, config.BlockDisruptorSize);
@@ -172,6 +185,9 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_FALSE(config.EnableDispatcherInputAuditing);
 
+				EXPECT_FALSE(config.EnableExecutionProfiling);
+				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SlowBlockExecutionThreshold);
+
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabaseWriteBatchSize);
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
@@ -220,6 +236,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(74u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(utils::FileSize::FromKilobytes(512), config.MaxChainBytesPerSyncChunk);
+				EXPECT_EQ(6u, config.MaxParallelSyncRanges);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -233,9 +251,12 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
+				EXPECT_EQ(321u, config.MaxSslSessionCacheSize);
+				EXPECT_EQ(utils::TimeSpan::FromSeconds(45), config.BriefConnectionReuseDuration);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(128), config.SocketWorkingBufferSize);
 				EXPECT_EQ(6225u, config.SocketWorkingBufferSensitivity);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(23), config.MaxSocketWorkingBufferPoolSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(10), config.MaxPacketDataSize);
 
 				EXPECT_EQ(1000u, config.BlockDisruptorSize);
@@ -246,6 +267,9 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_TRUE(config.EnableDispatcherInputAuditing);
 
+				EXPECT_TRUE(config.EnableExecutionProfiling);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(250), config.SlowBlockExecutionThreshold);
+
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.MaxCacheDatabaseWriteBatchSize);
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
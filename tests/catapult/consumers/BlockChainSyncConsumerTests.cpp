@@ -28,9 +28,12 @@
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryBlockStorage.h"
 #include "tests/test/nodeps/ParamsCapture.h"
 #include "tests/TestHarness.h"
+#include <mutex>
+#include <thread>
 
 using catapult::disruptor::ConsumerInput;
 using catapult::disruptor::InputSource;
@@ -366,7 +369,8 @@ namespace catapult { namespace consumers {
 			{}
 
 			ConsumerTestContext(std::unique_ptr<io::BlockStorage>&& pStorage, std::unique_ptr<io::PrunableBlockStorage>&& pStagingStorage)
-					: Cache(test::CreateCatapultCacheWithMarkerAccount())
+					: pCommitPool(test::CreateStartedIoThreadPool(1))
+					, Cache(test::CreateCatapultCacheWithMarkerAccount())
 					, Storage(std::move(pStorage), std::move(pStagingStorage))
 					, LastFinalizedHeight(Height(1)) {
 				{
@@ -401,10 +405,11 @@ namespace catapult { namespace consumers {
 					return CommitStep(step);
 				};
 
-				Consumer = CreateBlockChainSyncConsumer(Cache, Storage, handlers);
+				Consumer = CreateBlockChainSyncConsumer(Cache, Storage, *pCommitPool, handlers);
 			}
 
 		public:
+			std::unique_ptr<thread::IoThreadPool> pCommitPool;
 			cache::CatapultCache Cache;
 			io::BlockStorageCache Storage;
 			Height LastFinalizedHeight;
@@ -1152,6 +1157,26 @@ namespace catapult { namespace consumers {
 		EXPECT_EQ(0u, context.CommitStep.params().size());
 	}
 
+	TEST(TEST_CLASS, CommitStepsAreCorrectWhenWritingBlocksAndStateFails) {
+		// Arrange:
+		auto pBlockStorage = std::make_unique<ErrorAwareBlockStorage>();
+		auto* pBlockStorageRaw = pBlockStorage.get();
+
+		ConsumerTestContext context(std::make_unique<ErrorAwareBlockStorage>(), std::move(pBlockStorage));
+		context.seedStorage(Height(7));
+		auto input = CreateInput(Height(6), 4);
+
+		// - simulate block and state writing failures
+		pBlockStorageRaw->setError();
+		context.PreStateWritten.setError();
+
+		// Act:
+		EXPECT_THROW(context.Consumer(input), catapult_runtime_error);
+
+		// Assert:
+		EXPECT_EQ(0u, context.CommitStep.params().size());
+	}
+
 	TEST(TEST_CLASS, CommitStepsAreCorrectWhenWritingStateFails) {
 		// Arrange:
 		ConsumerTestContext context;
@@ -1192,6 +1217,62 @@ namespace catapult { namespace consumers {
 
 	// endregion
 
+	// region commit pool
+
+	namespace {
+		class ThreadAwareBlockStorage : public mocks::MockMemoryBlockStorage {
+		public:
+			std::set<std::thread::id> saveBlockThreadIds() const {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_saveBlockThreadIds;
+			}
+
+			void clearSaveBlockThreadIds() {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_saveBlockThreadIds.clear();
+			}
+
+		public:
+			void saveBlock(const model::BlockElement& blockElement) override {
+				MockMemoryBlockStorage::saveBlock(blockElement);
+
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_saveBlockThreadIds.insert(std::this_thread::get_id());
+			}
+
+		private:
+			mutable std::mutex m_mutex;
+			std::set<std::thread::id> m_saveBlockThreadIds;
+		};
+	}
+
+	TEST(TEST_CLASS, BlocksAreWrittenToStagingStorageOnCommitPool) {
+		// Arrange:
+		auto pBlockStorage = std::make_unique<ThreadAwareBlockStorage>();
+		auto* pBlockStorageRaw = pBlockStorage.get();
+
+		ConsumerTestContext context(std::make_unique<mocks::MockMemoryBlockStorage>(), std::move(pBlockStorage));
+		context.seedStorage(Height(7));
+		auto input = CreateInput(Height(8), 4);
+
+		// - ignore blocks saved when seeding storage
+		pBlockStorageRaw->clearSaveBlockThreadIds();
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert: all blocks were saved by the (single) commit pool thread
+		test::AssertContinued(result);
+		auto threadIds = pBlockStorageRaw->saveBlockThreadIds();
+		ASSERT_EQ(1u, threadIds.size());
+		EXPECT_NE(std::this_thread::get_id(), *threadIds.cbegin());
+
+		// - the chain was committed
+		context.assertStored(input, model::ChainScore(4 * (Base_Difficulty - 1)));
+	}
+
+	// endregion
+
 	// region pruning
 
 	TEST(TEST_CLASS, CommitAutomaticallyPrunesCache) {
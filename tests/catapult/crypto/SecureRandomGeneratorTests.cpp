@@ -21,10 +21,27 @@
 #include "catapult/crypto/SecureRandomGenerator.h"
 #include "tests/test/nodeps/RandomnessTestUtils.h"
 #include "tests/TestHarness.h"
+#include <array>
 
 namespace catapult { namespace crypto {
 
 #define TEST_CLASS SecureRandomGeneratorTests
 
 	DEFINE_RANDOMNESS_UINT64_TESTS(SecureRandomGenerator)
+
+	TEST(TEST_CLASS, SecureRandomFillerFillsBufferWithRandomBytes) {
+		// Arrange:
+		auto randomFiller = CreateSecureRandomFiller();
+		std::array<uint8_t, 32> buffer1{};
+		std::array<uint8_t, 32> buffer2{};
+
+		// Act:
+		randomFiller(buffer1.data(), buffer1.size());
+		randomFiller(buffer2.data(), buffer2.size());
+
+		// Assert:
+		EXPECT_NE((std::array<uint8_t, 32>()), buffer1);
+		EXPECT_NE((std::array<uint8_t, 32>()), buffer2);
+		EXPECT_NE(buffer1, buffer2);
+	}
 }}
@@ -284,6 +284,77 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region verify multi
+
+	namespace {
+		RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		template<typename TModifier>
+		void AssertVerifyMulti(const std::vector<bool>& expectedResults, TModifier modifier) {
+			// Arrange:
+			BreadcrumbTestContext context;
+			std::vector<OtsKeyIdentifier> keyIdentifiers{ { 8, 4 }, { 8, 5 }, { 9, 0 }, { 11, 0 }, { 13, 3 } };
+
+			std::vector<OtsTreeSignature> signatures;
+			for (const auto& keyIdentifier : keyIdentifiers)
+				signatures.push_back(context.sign(keyIdentifier));
+
+			modifier(signatures, keyIdentifiers);
+
+			std::vector<OtsTreeSignatureInput> inputs;
+			for (auto i = 0u; i < signatures.size(); ++i)
+				inputs.push_back({ signatures[i], keyIdentifiers[i], context.buffer() });
+
+			// Act:
+			auto resultPair = VerifyMulti(CreateRandomFiller(), inputs.data(), inputs.size());
+
+			// Assert:
+			auto expectedAggregateResult = std::all_of(expectedResults.cbegin(), expectedResults.cend(), [](auto result) {
+				return result;
+			});
+			EXPECT_EQ(expectedAggregateResult, resultPair.second);
+			EXPECT_EQ(expectedResults, resultPair.first);
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenThereAreNoSignatures) {
+		// Arrange:
+		std::vector<OtsTreeSignatureInput> inputs;
+
+		// Act:
+		auto resultPair = VerifyMulti(CreateRandomFiller(), inputs.data(), inputs.size());
+
+		// Assert:
+		EXPECT_TRUE(resultPair.second);
+		EXPECT_TRUE(resultPair.first.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		AssertVerifyMulti({ true, true, true, true, true }, [](const auto&, const auto&) {});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAnyComponentSignatureIsInvalid) {
+		AssertVerifyMulti({ true, false, true, false, false }, [](auto& signatures, const auto&) {
+			signatures[1].Root.Signature[0] ^= 0xFF;
+			signatures[3].Top.Signature[0] ^= 0xFF;
+			signatures[4].Bottom.Signature[0] ^= 0xFF;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenKeyIdentifierDoesNotMatchSignature) {
+		AssertVerifyMulti({ true, true, false, true, false }, [](const auto&, auto& keyIdentifiers) {
+			++keyIdentifiers[2].BatchId;
+			++keyIdentifiers[4].KeyId;
+		});
+	}
+
+	// endregion
+
 	namespace {
 		// region storage checker
 
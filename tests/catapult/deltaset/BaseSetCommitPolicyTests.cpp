@@ -62,4 +62,94 @@ namespace catapult { namespace deltaset {
 
 	DEFINE_UPDATE_SET_TESTS(MemoryStorageTraits)
 	DEFINE_MEMORY_ONLY_UPDATE_SET_TESTS(MemoryStorageTraits)
+
+	// region matching storage and memory sets
+
+	namespace {
+		using MemoryMapType = Types::MemoryMapType;
+		using KeyTraits = Types::StorageTraits::KeyTraits;
+
+		struct MatchingSetsTestContext : public test::DeltaElementsTestUtils::Wrapper<MemoryMapType> {
+		public:
+			MemoryMapType Set;
+
+		public:
+			MatchingSetsTestContext() {
+				// seed the set with a few elements
+				MemoryStorageTraits::AddElement(Set, "aaa", 1);
+				MemoryStorageTraits::AddElement(Set, "ccc", 3);
+				MemoryStorageTraits::AddElement(Set, "ddd", 2);
+			}
+		};
+
+		bool Contains(const MemoryMapType& map, const std::string& name, unsigned int value, size_t dummy = 0) {
+			auto iter = map.find(std::make_pair(name, value));
+			return map.cend() != iter && dummy == iter->second.Dummy;
+		}
+	}
+
+	TEST(TEST_CLASS, MatchingSets_AllDeltaChangesAreSplicedIntoOriginalSet) {
+		// Arrange:
+		MatchingSetsTestContext context;
+		MemoryStorageTraits::AddElement(context.Added, "bbb", 5);
+		MemoryStorageTraits::AddElement(context.Removed, "ccc", 3);
+		MemoryStorageTraits::AddElement(context.Copied, "aaa", 1, 10);
+
+		// Act:
+		UpdateSet<KeyTraits>(context.Set, context.movableDeltas());
+
+		// Assert:
+		EXPECT_EQ(3u, context.Set.size());
+		EXPECT_TRUE(Contains(context.Set, "aaa", 1, 10)); // copied
+		EXPECT_TRUE(Contains(context.Set, "ddd", 2)); // unchanged
+		EXPECT_TRUE(Contains(context.Set, "bbb", 5)); // added
+
+		EXPECT_FALSE(Contains(context.Set, "ccc", 3)); // removed
+
+		// - added and copied nodes were moved out of the delta
+		EXPECT_TRUE(context.Added.empty());
+		EXPECT_TRUE(context.Copied.empty());
+	}
+
+	TEST(TEST_CLASS, MatchingSets_DeltaRedundantAdditionsAreIgnored) {
+		// Arrange:
+		MatchingSetsTestContext context;
+		MemoryStorageTraits::AddElement(context.Added, "aaa", 1, 10);
+		MemoryStorageTraits::AddElement(context.Added, "bbb", 5);
+
+		// Act:
+		UpdateSet<KeyTraits>(context.Set, context.movableDeltas());
+
+		// Assert: original element was not replaced
+		EXPECT_EQ(4u, context.Set.size());
+		EXPECT_TRUE(Contains(context.Set, "aaa", 1));
+		EXPECT_TRUE(Contains(context.Set, "bbb", 5));
+		EXPECT_TRUE(Contains(context.Set, "ccc", 3));
+		EXPECT_TRUE(Contains(context.Set, "ddd", 2));
+	}
+
+	TEST(TEST_CLASS, MatchingSets_AddedAndCopiedElementIsCommittedAsCopied) {
+		// Arrange:
+		MatchingSetsTestContext context;
+		MemoryStorageTraits::AddElement(context.Added, "fff", 6);
+		MemoryStorageTraits::AddElement(context.Copied, "fff", 6, 11);
+
+		// Act:
+		UpdateSet<KeyTraits>(context.Set, context.movableDeltas());
+
+		// Assert:
+		EXPECT_EQ(4u, context.Set.size());
+		EXPECT_TRUE(Contains(context.Set, "fff", 6, 11));
+	}
+
+	TEST(TEST_CLASS, MatchingSets_DeltaUnknownCopiesAreNotSupported) {
+		// Arrange:
+		MatchingSetsTestContext context;
+		MemoryStorageTraits::AddElement(context.Copied, "eee", 7, 10);
+
+		// Act + Assert:
+		EXPECT_THROW(UpdateSet<KeyTraits>(context.Set, context.movableDeltas()), catapult_invalid_argument);
+	}
+
+	// endregion
 }}
@@ -180,7 +180,7 @@ namespace catapult { namespace deltaset {
 		TTraits::AddElement(wrapper.Added, "gamma", 7);
 
 		// Act:
-		container.update(wrapper.deltas());
+		container.update(wrapper.movableDeltas());
 
 		// Assert:
 		EXPECT_FALSE(container.empty());
@@ -199,7 +199,7 @@ namespace catapult { namespace deltaset {
 		TTraits::AddElement(wrapper.Added, "gamma", 7);
 
 		// Act:
-		UpdateSet(container, wrapper.deltas());
+		UpdateSet(container, wrapper.movableDeltas());
 
 		// Assert:
 		EXPECT_FALSE(container.empty());
@@ -216,7 +216,7 @@ namespace catapult { namespace deltaset {
 		typename TTraits::DeltaElementsWrapper wrapper;
 		TTraits::AddElement(wrapper.Added, "alpha", 5);
 		TTraits::AddElement(wrapper.Added, "gamma", 7);
-		container.update(wrapper.deltas());
+		container.update(wrapper.movableDeltas());
 
 		// Act:
 		auto iter = container.find(TTraits::MakeKey("gamma", 7));
@@ -234,7 +234,7 @@ namespace catapult { namespace deltaset {
 		typename TTraits::DeltaElementsWrapper wrapper;
 		TTraits::AddElement(wrapper.Added, "alpha", 5);
 		TTraits::AddElement(wrapper.Added, "gamma", 7);
-		container.update(wrapper.deltas());
+		container.update(wrapper.movableDeltas());
 
 		// Act:
 		auto iter1 = container.find(TTraits::MakeKey("alpha", 5));
@@ -259,7 +259,7 @@ namespace catapult { namespace deltaset {
 		typename TTraits::DeltaElementsWrapper wrapper;
 		TTraits::AddElement(wrapper.Added, "alpha", 5);
 		TTraits::AddElement(wrapper.Added, "gamma", 7);
-		container.update(wrapper.deltas());
+		container.update(wrapper.movableDeltas());
 
 		// Act:
 		auto iter = container.find(TTraits::MakeKey("zeta", 5));
@@ -288,7 +288,7 @@ namespace catapult { namespace deltaset {
 			TTraits::AddElement(wrapper.Added, "zeta", 100);
 			TTraits::AddElement(wrapper.Added, "beta", 6);
 			TTraits::AddElement(wrapper.Added, "gamma", 7);
-			container.update(wrapper.deltas());
+			container.update(wrapper.movableDeltas());
 
 			return container;
 		}
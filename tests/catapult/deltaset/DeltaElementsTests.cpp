@@ -20,6 +20,7 @@
 
 #include "catapult/deltaset/DeltaElements.h"
 #include "tests/TestHarness.h"
+#include <set>
 
 namespace catapult { namespace deltaset {
 
@@ -61,4 +62,44 @@ namespace catapult { namespace deltaset {
 	TEST(TEST_CLASS, HasChangesReturnsTrueWhenAllSetsHaveChanges) {
 		AssertHasChanges({ 1 }, { 1 }, { 1 });
 	}
+
+	// region MovableDeltaElements
+
+	TEST(TEST_CLASS, MovableHasChangesReturnsFalseWhenThereAreNoChanges) {
+		// Arrange:
+		std::set<int> empty;
+		MovableDeltaElements<std::set<int>> elements(empty, empty, empty);
+
+		// Assert:
+		EXPECT_FALSE(elements.HasChanges());
+	}
+
+	TEST(TEST_CLASS, MovableHasChangesReturnsTrueWhenAnySetHasChanges) {
+		// Arrange:
+		std::set<int> empty;
+		std::set<int> nonEmpty{ 1 };
+
+		// Assert:
+		EXPECT_TRUE(MovableDeltaElements<std::set<int>>(nonEmpty, empty, empty).HasChanges());
+		EXPECT_TRUE(MovableDeltaElements<std::set<int>>(empty, nonEmpty, empty).HasChanges());
+		EXPECT_TRUE(MovableDeltaElements<std::set<int>>(empty, empty, nonEmpty).HasChanges());
+	}
+
+	TEST(TEST_CLASS, MovableCanBeConvertedToDeltaElements) {
+		// Arrange:
+		std::set<int> added{ 1 };
+		std::set<int> removed{ 2 };
+		std::set<int> copied{ 3 };
+		MovableDeltaElements<std::set<int>> movableElements(added, removed, copied);
+
+		// Act:
+		Elements elements = movableElements;
+
+		// Assert: the same sets are referenced
+		EXPECT_EQ(&added, &elements.Added);
+		EXPECT_EQ(&removed, &elements.Removed);
+		EXPECT_EQ(&copied, &elements.Copied);
+	}
+
+	// endregion
 }}
@@ -114,6 +114,38 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region diagnostic counters
+
+	TEST(TEST_CLASS, DiagnosticCountersAreInitiallyEmpty) {
+		// Arrange:
+		ExtensionManager manager;
+
+		// Act:
+		const auto& counters = manager.diagnosticCounters();
+
+		// Assert:
+		EXPECT_TRUE(counters.empty());
+	}
+
+	TEST(TEST_CLASS, CanAddDiagnosticCounters) {
+		// Arrange:
+		ExtensionManager manager;
+
+		// Act:
+		manager.addDiagnosticCounter(utils::DiagnosticCounter(utils::DiagnosticCounterId("ALPHA"), []() { return 17u; }));
+		manager.addDiagnosticCounter(utils::DiagnosticCounter(utils::DiagnosticCounterId("BETA"), []() { return 22u; }));
+		const auto& counters = manager.diagnosticCounters();
+
+		// Assert:
+		ASSERT_EQ(2u, counters.size());
+		EXPECT_EQ("ALPHA", counters[0].id().name());
+		EXPECT_EQ(17u, counters[0].value());
+		EXPECT_EQ("BETA", counters[1].id().name());
+		EXPECT_EQ(22u, counters[1].value());
+	}
+
+	// endregion
+
 	// region services
 
 	namespace {
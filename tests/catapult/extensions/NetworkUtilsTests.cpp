@@ -20,11 +20,14 @@
 
 #include "catapult/extensions/NetworkUtils.h"
 #include "catapult/extensions/Results.h"
+#include "catapult/ionet/SslSessionCache.h"
+#include "catapult/ionet/WorkingBufferPool.h"
 #include "catapult/net/ConnectionContainer.h"
 #include "catapult/net/PeerConnectResult.h"
 #include "tests/test/core/PacketTestUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/crypto/CertificateTestUtils.h"
+#include "tests/test/local/ServiceLocatorTestContext.h"
 #include "tests/test/net/CertificateLocator.h"
 #include "tests/test/net/ClientSocket.h"
 #include "tests/test/nodeps/TimeSupplier.h"
@@ -51,6 +54,8 @@ namespace catapult { namespace extensions {
 			config.Node.SocketWorkingBufferSize = utils::FileSize::FromBytes(512);
 			config.Node.SocketWorkingBufferSensitivity = 987;
 			config.Node.MaxPacketDataSize = utils::FileSize::FromKilobytes(12);
+			config.Node.MaxSslSessionCacheSize = 0;
+			config.Node.BriefConnectionReuseDuration = utils::TimeSpan::FromSeconds(29);
 
 			config.Node.IncomingConnections.MaxConnections = 17;
 			config.Node.IncomingConnections.BacklogSize = 83;
@@ -126,13 +131,48 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(11), settings.Timeout);
 		EXPECT_EQ(utils::FileSize::FromBytes(512), settings.SocketWorkingBufferSize);
 		EXPECT_EQ(987u, settings.SocketWorkingBufferSensitivity);
+		EXPECT_FALSE(!!settings.pSocketWorkingBufferPool);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(12), settings.MaxPacketDataSize);
 
 		EXPECT_TRUE(settings.AllowIncomingSelfConnections);
 		EXPECT_FALSE(settings.AllowOutgoingSelfConnections);
+		EXPECT_EQ(utils::TimeSpan::FromSeconds(29), settings.BriefConnectionReuseDuration);
 
 		EXPECT_NO_THROW(settings.SslOptions.ContextSupplier());
 		EXPECT_FALSE(RunVerifyCallback(settings.SslOptions.VerifyCallbackSupplier()));
+		EXPECT_FALSE(!!settings.SslOptions.pSessionCache);
+	}
+
+	TEST(TEST_CLASS, CanExtractConnectionSettingsWithSslSessionCacheFromCatapultConfiguration) {
+		// Arrange:
+		test::MutableCatapultConfiguration config;
+		config.User.CertificateDirectory = test::GetDefaultCertificateDirectory();
+		config.Node.MaxSslSessionCacheSize = 10;
+
+		// Act:
+		auto settings = GetConnectionSettings(config.ToConst());
+
+		// Assert:
+		ASSERT_TRUE(!!settings.SslOptions.pSessionCache);
+		EXPECT_EQ(0u, settings.SslOptions.pSessionCache->size());
+	}
+
+	TEST(TEST_CLASS, CanExtractConnectionSettingsFromServiceState) {
+		// Arrange:
+		auto config = test::CreatePrototypicalCatapultConfiguration();
+		const_cast<utils::FileSize&>(config.Node.SocketWorkingBufferSize) = utils::FileSize::FromKilobytes(4);
+		const_cast<utils::FileSize&>(config.Node.MaxSocketWorkingBufferPoolSize) = utils::FileSize::FromKilobytes(100);
+		test::ServiceTestState testState(std::move(config));
+
+		// Act:
+		auto settings = GetConnectionSettings(testState.state());
+
+		// Assert: settings are extracted from config and share working buffer pool owned by state
+		EXPECT_EQ(utils::FileSize::FromKilobytes(4), settings.SocketWorkingBufferSize);
+		ASSERT_TRUE(!!settings.pSocketWorkingBufferPool);
+		EXPECT_EQ(testState.state().workingBufferPool(), settings.pSocketWorkingBufferPool);
+		EXPECT_EQ(4u * 1024, settings.pSocketWorkingBufferPool->minBufferSize());
+		EXPECT_EQ(100u * 1024, settings.pSocketWorkingBufferPool->maxPooledBytes());
 	}
 
 	TEST(TEST_CLASS, CanUpdateAsyncTcpServerSettingsFromCatapultConfiguration) {
@@ -258,7 +298,15 @@ namespace catapult { namespace extensions {
 				auto config = CreateCatapultConfiguration(enableReadRateMonitoring);
 				auto serviceId = ionet::ServiceIdentifier(123);
 				auto timeSupplier = test::CreateTimeSupplierFromMilliseconds({ 1 });
-				return BootServer(serviceGroup, test::GetLocalHostPort(), serviceId, config, timeSupplier, m_nodeSubscriber, m_acceptor);
+				return BootServer(
+						serviceGroup,
+						test::GetLocalHostPort(),
+						serviceId,
+						config,
+						nullptr,
+						timeSupplier,
+						m_nodeSubscriber,
+						m_acceptor);
 			}
 
 		private:
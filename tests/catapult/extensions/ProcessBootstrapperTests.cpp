@@ -57,8 +57,13 @@ namespace catapult { namespace extensions {
 		// - nodes should be empty
 		EXPECT_TRUE(bootstrapper.staticNodes().empty());
 
-		// - pool should have default number of threads
-		EXPECT_EQ(std::thread::hardware_concurrency(), bootstrapper.pool().numWorkerThreads());
+		// - pool should have default number of threads and an isolated plugin worker pool with default number of threads
+		EXPECT_EQ(2 * std::thread::hardware_concurrency(), bootstrapper.pool().numWorkerThreads());
+
+		auto* pWorkerPool = pluginManager.workerPool();
+		ASSERT_TRUE(!!pWorkerPool);
+		EXPECT_EQ(std::thread::hardware_concurrency(), pWorkerPool->numWorkerThreads());
+		EXPECT_EQ("plugin worker", pWorkerPool->name());
 
 		// - other managers should not throw
 		bootstrapper.extensionManager();
@@ -19,9 +19,12 @@
 **/
 
 #include "catapult/extensions/ServerHooks.h"
+#include "catapult/api/RemoteChainApi.h"
+#include "catapult/model/TransactionPlugin.h"
 #include "tests/test/cache/UtTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
 #include "tests/test/other/ConsumerHandlerTests.h"
 #include "tests/TestHarness.h"
 
@@ -344,6 +347,70 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region remoteFinalizedHeightVerifier
+
+	namespace {
+		auto CreateRemoteChainApi(ionet::PacketIo& io, const model::TransactionRegistry& registry) {
+			return api::CreateRemoteChainApi(io, model::NodeIdentity(), registry);
+		}
+	}
+
+	TEST(TEST_CLASS, UnsetRemoteFinalizedHeightVerifierDoesNotVerifyAnyHeight) {
+		// Arrange:
+		ServerHooks hooks;
+		mocks::MockPacketIo io;
+		model::TransactionRegistry registry;
+		auto pRemoteChainApi = CreateRemoteChainApi(io, registry);
+
+		// Act:
+		auto verifier = hooks.remoteFinalizedHeightVerifier();
+		ASSERT_TRUE(!!verifier);
+
+		auto isVerified = verifier(*pRemoteChainApi, Height(123)).get();
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+	}
+
+	TEST(TEST_CLASS, CanSetRemoteFinalizedHeightVerifierOnce) {
+		// Arrange:
+		std::vector<std::pair<const api::RemoteChainApi*, Height>> verifierParams;
+		ServerHooks hooks;
+		hooks.setRemoteFinalizedHeightVerifier([&verifierParams](const auto& remoteChainApi, auto height) {
+			verifierParams.emplace_back(&remoteChainApi, height);
+			return thread::make_ready_future(true);
+		});
+
+		mocks::MockPacketIo io;
+		model::TransactionRegistry registry;
+		auto pRemoteChainApi = CreateRemoteChainApi(io, registry);
+
+		// Act:
+		auto verifier = hooks.remoteFinalizedHeightVerifier();
+		ASSERT_TRUE(!!verifier);
+
+		auto isVerified = verifier(*pRemoteChainApi, Height(123)).get();
+
+		// Assert:
+		EXPECT_TRUE(isVerified);
+		ASSERT_EQ(1u, verifierParams.size());
+		EXPECT_EQ(pRemoteChainApi.get(), verifierParams[0].first);
+		EXPECT_EQ(Height(123), verifierParams[0].second);
+	}
+
+	TEST(TEST_CLASS, CannotSetRemoteFinalizedHeightVerifierMultipleTimes) {
+		// Arrange:
+		ServerHooks hooks;
+		hooks.setRemoteFinalizedHeightVerifier([](const auto&, auto) { return thread::make_ready_future(true); });
+
+		// Act + Assert:
+		EXPECT_THROW(
+				hooks.setRemoteFinalizedHeightVerifier([](const auto&, auto) { return thread::make_ready_future(true); }),
+				catapult_invalid_argument);
+	}
+
+	// endregion
+
 	// region knownHashPredicate
 
 	namespace {
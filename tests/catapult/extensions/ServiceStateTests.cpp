@@ -44,6 +44,8 @@ namespace catapult { namespace extensions {
 		// Arrange:
 		auto config = test::CreateUninitializedCatapultConfiguration();
 		const_cast<utils::FileSize&>(config.Node.MaxPacketDataSize) = utils::FileSize::FromKilobytes(1234);
+		const_cast<utils::FileSize&>(config.Node.SocketWorkingBufferSize) = utils::FileSize::FromKilobytes(4);
+		const_cast<utils::FileSize&>(config.Node.MaxSocketWorkingBufferPoolSize) = utils::FileSize::FromKilobytes(100);
 
 		ionet::NodeContainer nodes;
 		auto catapultCache = cache::CatapultCache({});
@@ -117,6 +119,24 @@ namespace catapult { namespace extensions {
 
 		EXPECT_TRUE(state.hooks().chainSyncedPredicate()); // just check that hooks is valid and default predicate can be called
 		EXPECT_TRUE(state.packetIoPickers().pickMatching(utils::TimeSpan::FromSeconds(1), ionet::NodeRoles::None).empty());
+
+		// - check working buffer pool (should be initialized from config)
+		ASSERT_TRUE(!!state.workingBufferPool());
+		EXPECT_EQ(4u * 1024, state.workingBufferPool()->minBufferSize());
+		EXPECT_EQ(100u * 1024, state.workingBufferPool()->maxPooledBytes());
+		EXPECT_EQ(0u, state.workingBufferPool()->numPooledBuffers());
+	}
+
+	TEST(TEST_CLASS, ServiceStateDoesNotCreateWorkingBufferPoolWhenPoolingIsDisabled) {
+		// Arrange:
+		auto config = test::CreatePrototypicalCatapultConfiguration();
+		const_cast<utils::FileSize&>(config.Node.MaxSocketWorkingBufferPoolSize) = utils::FileSize();
+
+		// Act:
+		test::ServiceTestState testState(std::move(config));
+
+		// Assert:
+		EXPECT_FALSE(!!testState.state().workingBufferPool());
 	}
 
 	// endregion
@@ -19,6 +19,9 @@
 **/
 
 #include "catapult/extensions/SynchronizerTaskCallbacks.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/Scheduler.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockPacketIo.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
 #include "tests/test/net/mocks/MockPacketWriters.h"
@@ -91,6 +94,16 @@ namespace catapult { namespace extensions {
 			}
 		};
 
+		struct ParallelCallbackTraits {
+			static constexpr auto Num_Expected_Chain_Synced_Calls = 0u;
+
+			template<typename... TArgs>
+			static auto CreateTask(chain::RemoteNodeSynchronizer<int>&& synchronizer, TArgs&&... args) {
+				auto parallelSynchronizer = chain::ParallelRemoteNodeSynchronizer<int>{ std::move(synchronizer), []() { return 1u; } };
+				return extensions::CreateParallelSynchronizerTaskCallback(std::move(parallelSynchronizer), std::forward<TArgs>(args)...);
+			}
+		};
+
 		template<typename TTraits>
 		void AssertActionIsSkippedWhenNoPeerIsAvailable() {
 			// Arrange: create an empty writers
@@ -198,6 +211,174 @@ namespace catapult { namespace extensions {
 		AssertCallbackCallsAction<ChainSyncAwareCallbackTraits>(true);
 	}
 
+	TEST(TEST_CLASS, ParallelCallback_ActionIsSkippedWhenNoPeerIsAvailable) {
+		AssertActionIsSkippedWhenNoPeerIsAvailable<ParallelCallbackTraits>();
+	}
+
+	TEST(TEST_CLASS, ParallelCallback_ActionIsCalledWhenPeerIsAvailableAndChainIsNotSynched) {
+		AssertCallbackCallsAction<ParallelCallbackTraits>(false);
+	}
+
+	TEST(TEST_CLASS, ParallelCallback_ActionIsCalledWhenPeerIsAvailableAndChainIsSynched) {
+		AssertCallbackCallsAction<ParallelCallbackTraits>(true);
+	}
+
+	// region parallel synchronization
+
+	namespace {
+		constexpr auto Num_Parallel_Syncs = 3u;
+
+		class DistinctPeersPacketIoPicker : public net::PacketIoPicker {
+		public:
+			explicit DistinctPeersPacketIoPicker(const std::vector<model::NodeIdentity>& identities)
+					: m_identities(identities)
+					, m_numPickOneCalls(0)
+			{}
+
+		public:
+			size_t numPickOneCalls() const {
+				return m_numPickOneCalls;
+			}
+
+		public:
+			ionet::NodePacketIoPair pickOne(const utils::TimeSpan&) override {
+				auto index = m_numPickOneCalls++;
+				if (index >= m_identities.size())
+					return ionet::NodePacketIoPair();
+
+				return ionet::NodePacketIoPair(ionet::Node(m_identities[index]), std::make_shared<mocks::MockPacketIo>());
+			}
+
+		private:
+			std::vector<model::NodeIdentity> m_identities;
+			std::atomic<size_t> m_numPickOneCalls;
+		};
+
+		class PendingSyncs {
+		public:
+			size_t size() const {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_promises.size();
+			}
+
+			std::set<Key> remotePublicKeys() const {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_remotePublicKeys;
+			}
+
+		public:
+			auto add(const model::NodeIdentity& identity) {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_remotePublicKeys.insert(identity.PublicKey);
+				m_promises.emplace_back();
+				return m_promises.back().get_future();
+			}
+
+			void completeAll(ionet::NodeInteractionResultCode code) {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				for (auto& promise : m_promises)
+					promise.set_value(ionet::NodeInteractionResultCode(code));
+			}
+
+		private:
+			std::set<Key> m_remotePublicKeys;
+			std::vector<thread::promise<ionet::NodeInteractionResultCode>> m_promises;
+			mutable std::mutex m_mutex;
+		};
+
+		auto CreateParallelSynchronizer(PendingSyncs& pendingSyncs, size_t parallelism) {
+			return chain::ParallelRemoteNodeSynchronizer<model::NodeIdentity>{
+				[&pendingSyncs](const auto& remoteIdentity) { return pendingSyncs.add(remoteIdentity); },
+				[parallelism]() { return parallelism; }
+			};
+		}
+
+		auto CreateIdentityRemoteApiFactory() {
+			return [](const auto&, const auto& remoteIdentity, const auto&) {
+				return std::make_unique<model::NodeIdentity>(remoteIdentity);
+			};
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelCallback_ActionIsCalledOncePerAvailablePeerUpToParallelism) {
+		// Arrange: only two peers are available
+		test::ServiceTestState testState;
+		DistinctPeersPacketIoPicker picker({
+			{ test::GenerateRandomByteArray<Key>(), "11.22.33.44" },
+			{ test::GenerateRandomByteArray<Key>(), "11.22.33.55" }
+		});
+
+		PendingSyncs pendingSyncs;
+		auto callback = extensions::CreateParallelSynchronizerTaskCallback(
+				CreateParallelSynchronizer(pendingSyncs, Num_Parallel_Syncs),
+				CreateIdentityRemoteApiFactory(),
+				picker,
+				testState.state(),
+				"test");
+
+		// Act:
+		auto resultFuture = callback();
+
+		// Assert: a peer was picked for every parallel sync but only the available peers were synced with
+		EXPECT_EQ(Num_Parallel_Syncs, picker.numPickOneCalls());
+		EXPECT_EQ(2u, pendingSyncs.size());
+		EXPECT_EQ(2u, pendingSyncs.remotePublicKeys().size());
+
+		// - the task is only completed when all syncs are completed
+		EXPECT_FALSE(resultFuture.is_ready());
+
+		pendingSyncs.completeAll(ionet::NodeInteractionResultCode::Success);
+		EXPECT_EQ(thread::TaskResult::Continue, resultFuture.get());
+	}
+
+	TEST(TEST_CLASS, ParallelCallback_MultipleSyncsWithDifferentPeersAreInFlightWhenScheduledTaskExecutes) {
+		// Arrange: add all peers to the node container so that their interactions are tracked
+		test::ServiceTestState testState;
+		std::vector<model::NodeIdentity> identities;
+		for (auto i = 0u; i < Num_Parallel_Syncs; ++i) {
+			identities.push_back({ test::GenerateRandomByteArray<Key>(), "11.22.33.44" });
+			testState.state().nodes().modifier().add(ionet::Node(identities.back()), ionet::NodeSource::Dynamic);
+		}
+
+		DistinctPeersPacketIoPicker picker(identities);
+
+		PendingSyncs pendingSyncs;
+		thread::Task task;
+		task.StartDelay = utils::TimeSpan::FromMilliseconds(1);
+		task.NextDelay = thread::CreateUniformDelayGenerator(utils::TimeSpan::FromHours(1));
+		task.Name = "parallel synchronizer task";
+		task.Callback = extensions::CreateParallelSynchronizerTaskCallback(
+				CreateParallelSynchronizer(pendingSyncs, Num_Parallel_Syncs),
+				CreateIdentityRemoteApiFactory(),
+				picker,
+				testState.state(),
+				task.Name);
+
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto pScheduler = thread::CreateScheduler(*pPool);
+
+		// Act: schedule the task and wait for all syncs to start
+		pScheduler->addTask(task);
+		WAIT_FOR_VALUE_EXPR(Num_Parallel_Syncs, pendingSyncs.size());
+
+		// Assert: a single task execution has all syncs in flight with different peers
+		EXPECT_EQ(1u, pScheduler->numExecutingTaskCallbacks());
+		EXPECT_EQ(Num_Parallel_Syncs, pendingSyncs.remotePublicKeys().size());
+
+		// Act: complete all syncs
+		pendingSyncs.completeAll(ionet::NodeInteractionResultCode::Success);
+		WAIT_FOR_ZERO_EXPR(pScheduler->numExecutingTaskCallbacks());
+
+		pScheduler->shutdown();
+		pPool->join();
+
+		// Assert: the interactions with all peers were recorded
+		for (const auto& identity : identities)
+			test::AssertNodeInteractions(1, 0, testState.state().nodes().view().getNodeInfo(identity).interactions(Timestamp()));
+	}
+
+	// endregion
+
 	namespace {
 		template<typename TAssert>
 		void AssertNodeInteractionResultIsInspected(ionet::NodeInteractionResultCode code, TAssert assertFunc) {
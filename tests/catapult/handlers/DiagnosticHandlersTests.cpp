@@ -23,6 +23,8 @@
 #include "catapult/ionet/NodeContainer.h"
 #include "catapult/ionet/NodeInteractionResult.h"
 #include "catapult/ionet/PackedNodeInfo.h"
+#include "catapult/ionet/PackedPacketStatistics.h"
+#include "catapult/ionet/PacketStatistics.h"
 #include "catapult/model/DiagnosticCounterValue.h"
 #include "catapult/utils/DiagnosticCounter.h"
 #include "tests/catapult/handlers/test/HeightRequestHandlerTests.h"
@@ -478,4 +480,94 @@ namespace catapult { namespace handlers {
 	}
 
 	// endregion
+
+	// region DiagnosticPacketStatisticsHandlers
+
+	TEST(TEST_CLASS, DiagnosticPacketStatisticsHandlers_DoNotRespondToMalformedRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		RegisterDiagnosticPacketStatisticsHandlers(handlers);
+
+		// Act + Assert:
+		AssertNoResponseWhenPacketIsMalformed(handlers, ionet::PacketType::Packet_Type_Statistics);
+		AssertNoResponseWhenPacketIsMalformed(handlers, ionet::PacketType::Peer_Packet_Statistics);
+	}
+
+	namespace {
+		template<typename TPackedValue>
+		const TPackedValue* ProcessStatisticsRequest(
+				const ionet::ServerPacketHandlers& handlers,
+				ionet::PacketType packetType,
+				size_t expectedNumValues,
+				ionet::ServerPacketHandlerContext& handlerContext) {
+			// Arrange:
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = packetType;
+
+			// Act:
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert: header is correct
+			auto expectedPacketSize = sizeof(ionet::PacketHeader) + expectedNumValues * sizeof(TPackedValue);
+			test::AssertPacketHeader(handlerContext, expectedPacketSize, packetType);
+			return reinterpret_cast<const TPackedValue*>(test::GetSingleBufferData(handlerContext));
+		}
+	}
+
+	TEST(TEST_CLASS, DiagnosticPacketStatisticsHandlers_WritePacketTypeStatisticsInResponseToValidRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		RegisterDiagnosticPacketStatisticsHandlers(handlers);
+
+		auto& statistics = *handlers.statistics();
+		statistics.addHandlerSample(ionet::PacketType::Pull_Blocks, 100, Key(), 10);
+		statistics.addHandlerSample(ionet::PacketType::Pull_Blocks, 200, Key(), 30);
+		statistics.addResponseSample(ionet::PacketType::Pull_Blocks, 50);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		const auto* pPackedStatistics = ProcessStatisticsRequest<ionet::PackedPacketTypeStatistics>(
+				handlers,
+				ionet::PacketType::Packet_Type_Statistics,
+				1,
+				handlerContext);
+
+		// Assert: statistics are written (the request itself is only recorded after the handler completes)
+		EXPECT_EQ(ionet::PacketType::Pull_Blocks, pPackedStatistics->Type);
+		EXPECT_EQ(2u, pPackedStatistics->NumPackets);
+		EXPECT_EQ(300u, pPackedStatistics->NumBytes);
+		EXPECT_EQ(11u, pPackedStatistics->HandlerMicrosP50);
+		EXPECT_EQ(30u, pPackedStatistics->HandlerMicrosP99);
+		EXPECT_EQ(30u, pPackedStatistics->HandlerMicrosMax);
+		EXPECT_EQ(50u, pPackedStatistics->ResponseMicrosP50);
+		EXPECT_EQ(50u, pPackedStatistics->ResponseMicrosP99);
+		EXPECT_EQ(50u, pPackedStatistics->ResponseMicrosMax);
+	}
+
+	TEST(TEST_CLASS, DiagnosticPacketStatisticsHandlers_WritePeerStatisticsInResponseToValidRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		RegisterDiagnosticPacketStatisticsHandlers(handlers);
+
+		auto key = test::GenerateRandomByteArray<Key>();
+		auto& statistics = *handlers.statistics();
+		statistics.addHandlerSample(ionet::PacketType::Pull_Blocks, 100, key, 10);
+		statistics.addHandlerSample(ionet::PacketType::Push_Block, 200, key, 30);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		const auto* pPackedStatistics = ProcessStatisticsRequest<ionet::PackedPeerPacketStatistics>(
+				handlers,
+				ionet::PacketType::Peer_Packet_Statistics,
+				1,
+				handlerContext);
+
+		// Assert:
+		EXPECT_EQ(key, pPackedStatistics->IdentityKey);
+		EXPECT_EQ(2u, pPackedStatistics->NumPackets);
+		EXPECT_EQ(300u, pPackedStatistics->NumBytes);
+		EXPECT_EQ(40u, pPackedStatistics->TotalHandlerMicros);
+	}
+
+	// endregion
 }}
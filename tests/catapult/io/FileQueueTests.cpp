@@ -636,6 +636,79 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region FileQueueReader - peek
+
+	namespace {
+		template<typename TTraits>
+		void AssertCannotPeekWithIndexValues(uint64_t indexWriterValue, uint64_t indexReaderValue, uint32_t offset) {
+			// Arrange:
+			ReaderTestContext<TTraits> context;
+			context.setIndexes(indexWriterValue, indexReaderValue);
+
+			// Act:
+			std::vector<uint8_t> buffer;
+			auto result = context.reader().tryPeekMessage(offset, buffer);
+
+			// Assert:
+			EXPECT_FALSE(result);
+			EXPECT_TRUE(buffer.empty());
+
+			EXPECT_EQ(2u, context.countFiles());
+			AssertIndexFiles(context, indexWriterValue, indexReaderValue);
+		}
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotPeekWhenReaderIndexIsNotLessThanWriterIndex) {
+		AssertCannotPeekWithIndexValues<TTraits>(120, 121, 0);
+		AssertCannotPeekWithIndexValues<TTraits>(120, 120, 0);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotPeekPastWriterIndex) {
+		AssertCannotPeekWithIndexValues<TTraits>(120, 118, 2);
+		AssertCannotPeekWithIndexValues<TTraits>(120, 118, 5);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotPeekWhenMessageAtOffsetDoesNotExist) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 118);
+
+		// Act + Assert:
+		std::vector<uint8_t> buffer;
+		EXPECT_THROW(context.reader().tryPeekMessage(1, buffer), catapult_runtime_error);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanPeekMessagesWithoutConsumingThem) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 118);
+
+		constexpr auto Message1_Filename = "0000000000000076.dat"; // 118 == 0x76
+		constexpr auto Message2_Filename = "0000000000000077.dat"; // 119 == 0x77
+		auto writeBuffer1 = test::GenerateRandomVector(21);
+		auto writeBuffer2 = test::GenerateRandomVector(17);
+		context.write(Message1_Filename, writeBuffer1);
+		context.write(Message2_Filename, writeBuffer2);
+
+		// Act:
+		std::vector<uint8_t> readBuffer1;
+		std::vector<uint8_t> readBuffer2;
+		auto result1 = context.reader().tryPeekMessage(0, readBuffer1);
+		auto result2 = context.reader().tryPeekMessage(1, readBuffer2);
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_TRUE(result2);
+		EXPECT_EQ(writeBuffer1, readBuffer1);
+		EXPECT_EQ(writeBuffer2, readBuffer2);
+
+		// - no data files should have been deleted
+		EXPECT_EQ(4u, context.countFiles());
+		AssertIndexFiles(context, 120, 118);
+	}
+
+	// endregion
+
 	// region FileQueueReader - skip
 
 	namespace {
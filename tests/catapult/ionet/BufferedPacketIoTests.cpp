@@ -20,6 +20,7 @@
 
 #include "catapult/ionet/BufferedPacketIo.h"
 #include "catapult/ionet/PacketSocket.h"
+#include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/net/SocketTestUtils.h"
 
 namespace catapult { namespace ionet {
@@ -40,6 +41,82 @@ namespace catapult { namespace ionet {
 		test::AssertWriteCanWriteMultipleSimultaneousPayloadsWithoutInterleaving(Transform);
 	}
 
+	// region writeShared
+
+	namespace {
+		class SharedPayloadCapturingPacketIo : public PacketIo {
+		public:
+			void write(const PacketPayload&, const WriteCallback& callback) override {
+				callback(SocketOperationCode::Write_Error);
+			}
+
+			void writeShared(const std::shared_ptr<const PacketPayload>& pPayload, const WriteCallback& callback) override {
+				Payloads.push_back(pPayload);
+				callback(SocketOperationCode::Success);
+			}
+
+			void read(const ReadCallback& callback) override {
+				callback(SocketOperationCode::Read_Error, nullptr);
+			}
+
+		public:
+			std::vector<std::shared_ptr<const PacketPayload>> Payloads;
+		};
+
+		std::shared_ptr<const PacketPayload> CreateSharedPayload() {
+			return std::make_shared<const PacketPayload>(test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(50)));
+		}
+
+		template<typename TWrite>
+		std::shared_ptr<const PacketPayload> WriteThroughBufferedIo(const std::shared_ptr<const PacketPayload>& pPayload, TWrite write) {
+			// Arrange:
+			boost::asio::io_context ioContext;
+			boost::asio::io_context::strand strand(ioContext);
+			auto pIo = std::make_shared<SharedPayloadCapturingPacketIo>();
+			auto pBufferedIo = CreateBufferedPacketIo(pIo, strand);
+
+			// Act:
+			std::vector<SocketOperationCode> codes;
+			write(*pBufferedIo, pPayload, [&codes](auto code) { codes.push_back(code); });
+			ioContext.run();
+
+			// Assert:
+			EXPECT_EQ(std::vector<SocketOperationCode>({ SocketOperationCode::Success }), codes);
+			EXPECT_EQ(1u, pIo->Payloads.size());
+			return pIo->Payloads.empty() ? nullptr : pIo->Payloads[0];
+		}
+	}
+
+	TEST(TEST_CLASS, WriteForwardsCopyOfPayload) {
+		// Arrange:
+		auto pPayload = CreateSharedPayload();
+
+		// Act:
+		auto pWrittenPayload = WriteThroughBufferedIo(pPayload, [](auto& io, const auto& pPayloadToWrite, const auto& callback) {
+			io.write(*pPayloadToWrite, callback);
+		});
+
+		// Assert:
+		ASSERT_TRUE(!!pWrittenPayload);
+		EXPECT_NE(pPayload.get(), pWrittenPayload.get());
+		test::AssertEqualPayload(*pPayload, *pWrittenPayload);
+	}
+
+	TEST(TEST_CLASS, WriteSharedForwardsSharedPayloadWithoutCopying) {
+		// Arrange:
+		auto pPayload = CreateSharedPayload();
+
+		// Act:
+		auto pWrittenPayload = WriteThroughBufferedIo(pPayload, [](auto& io, const auto& pPayloadToWrite, const auto& callback) {
+			io.writeShared(pPayloadToWrite, callback);
+		});
+
+		// Assert:
+		EXPECT_EQ(pPayload.get(), pWrittenPayload.get());
+	}
+
+	// endregion
+
 	TEST(TEST_CLASS, ReadCanReadMultipleConsecutivePayloads) {
 		test::AssertReadCanReadMultipleConsecutivePayloads(Transform);
 	}
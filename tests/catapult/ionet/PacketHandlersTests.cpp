@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/ionet/PacketHandlers.h"
+#include "catapult/ionet/PacketStatistics.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/TestHarness.h"
 #include <memory>
@@ -392,6 +393,65 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region process + statistics
+
+	TEST(TEST_CLASS, ProcessAddsHandlerSampleToStatistics) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		auto host = std::string("alice.com");
+		PacketHandlers handlers;
+		RegisterHandler(handlers, 3);
+
+		Packet packet;
+		packet.Size = sizeof(Packet);
+		packet.Type = static_cast<PacketType>(3);
+		ServerPacketHandlerContext handlerContext(key, host);
+
+		// Act:
+		handlers.process(packet, handlerContext);
+		handlers.process(packet, handlerContext);
+
+		// Assert:
+		auto packetTypeStatistics = handlers.statistics()->packetTypeStatistics();
+		ASSERT_EQ(1u, packetTypeStatistics.size());
+		EXPECT_EQ(2u, packetTypeStatistics.at(packet.Type).NumPackets);
+		EXPECT_EQ(2 * sizeof(Packet), packetTypeStatistics.at(packet.Type).NumBytes);
+		EXPECT_EQ(2u, packetTypeStatistics.at(packet.Type).HandlerLatencies.count());
+
+		auto peerStatistics = handlers.statistics()->peerStatistics();
+		ASSERT_EQ(1u, peerStatistics.size());
+		EXPECT_EQ(2u, peerStatistics.at(key).NumPackets);
+	}
+
+	TEST(TEST_CLASS, ProcessDoesNotAddSampleToStatisticsWhenPacketIsNotProcessed) {
+		// Arrange:
+		PacketHandlers handlers;
+		RegisterHandler(handlers, 3);
+
+		// Act:
+		ProcessPacket(handlers, 4);
+
+		// Assert:
+		EXPECT_TRUE(handlers.statistics()->packetTypeStatistics().empty());
+		EXPECT_TRUE(handlers.statistics()->peerStatistics().empty());
+	}
+
+	TEST(TEST_CLASS, StatisticsAreSharedByCopies) {
+		// Arrange:
+		PacketHandlers handlers;
+		RegisterHandler(handlers, 3);
+		auto handlersCopy = handlers;
+
+		// Act:
+		ProcessPacket(handlersCopy, 3);
+
+		// Assert:
+		EXPECT_EQ(handlers.statistics(), handlersCopy.statistics());
+		EXPECT_EQ(1u, handlers.statistics()->packetTypeStatistics().size());
+	}
+
+	// endregion
+
 	// region process + setAllowedHosts
 
 	namespace {
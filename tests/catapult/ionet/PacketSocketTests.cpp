@@ -121,6 +121,31 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes);
 	}
 
+	TEST(TEST_CLASS, WriteSharedSucceedsWhenSocketWriteSucceeds) {
+		// Arrange: set up payloads
+		auto packetBytes = test::GenerateRandomPacketBuffer(50);
+		auto pPayload = std::make_shared<const PacketPayload>(test::BufferToPacketPayload(packetBytes));
+
+		ByteBuffer receiveBuffer(packetBytes.size());
+		SocketOperationCode writeCode;
+
+		// Act: "server" - writes a shared payload to the socket
+		//      "client" - reads a payload from the socket
+		auto pPool = test::CreateStartedIoThreadPool();
+		test::SpawnPacketServerWork(pPool->ioContext(), [&pPayload, &writeCode](const auto& pServerSocket) {
+			pServerSocket->writeShared(pPayload, [&writeCode](auto code) {
+				writeCode = code;
+			});
+		});
+		auto pClientSocket = test::AddClientReadBufferTask(pPool->ioContext(), receiveBuffer);
+		pPool->join();
+
+		// Assert: the write succeeded, all data was read from the socket and the payload was released
+		EXPECT_EQ(SocketOperationCode::Success, writeCode);
+		EXPECT_EQUAL_BUFFERS(packetBytes, 0, packetBytes.size(), receiveBuffer);
+		EXPECT_EQ(1, pPayload.use_count());
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenSocketWriteFails) {
 		// Arrange: set up payloads
 		auto payload = CreateSmallWritePayload();
@@ -0,0 +1,168 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketStatistics.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS PacketStatisticsTests
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyEmpty) {
+		// Act:
+		PacketStatistics statistics;
+
+		// Assert:
+		EXPECT_TRUE(statistics.packetTypeStatistics().empty());
+		EXPECT_TRUE(statistics.peerStatistics().empty());
+	}
+
+	TEST(TEST_CLASS, CanAddHandlerSamples) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(2);
+		PacketStatistics statistics;
+
+		// Act:
+		statistics.addHandlerSample(PacketType::Pull_Blocks, 100, keys[0], 10);
+		statistics.addHandlerSample(PacketType::Push_Block, 200, keys[1], 20);
+		statistics.addHandlerSample(PacketType::Pull_Blocks, 300, keys[1], 30);
+
+		// Assert:
+		auto packetTypeStatistics = statistics.packetTypeStatistics();
+		ASSERT_EQ(2u, packetTypeStatistics.size());
+
+		const auto& pullBlocksStatistics = packetTypeStatistics.at(PacketType::Pull_Blocks);
+		EXPECT_EQ(2u, pullBlocksStatistics.NumPackets);
+		EXPECT_EQ(400u, pullBlocksStatistics.NumBytes);
+		EXPECT_EQ(2u, pullBlocksStatistics.HandlerLatencies.count());
+		EXPECT_EQ(40u, pullBlocksStatistics.HandlerLatencies.sum());
+		EXPECT_EQ(0u, pullBlocksStatistics.ResponseLatencies.count());
+
+		const auto& pushBlockStatistics = packetTypeStatistics.at(PacketType::Push_Block);
+		EXPECT_EQ(1u, pushBlockStatistics.NumPackets);
+		EXPECT_EQ(200u, pushBlockStatistics.NumBytes);
+		EXPECT_EQ(1u, pushBlockStatistics.HandlerLatencies.count());
+		EXPECT_EQ(20u, pushBlockStatistics.HandlerLatencies.sum());
+
+		auto peerStatistics = statistics.peerStatistics();
+		ASSERT_EQ(2u, peerStatistics.size());
+
+		EXPECT_EQ(1u, peerStatistics.at(keys[0]).NumPackets);
+		EXPECT_EQ(100u, peerStatistics.at(keys[0]).NumBytes);
+		EXPECT_EQ(10u, peerStatistics.at(keys[0]).TotalHandlerMicros);
+
+		EXPECT_EQ(2u, peerStatistics.at(keys[1]).NumPackets);
+		EXPECT_EQ(500u, peerStatistics.at(keys[1]).NumBytes);
+		EXPECT_EQ(50u, peerStatistics.at(keys[1]).TotalHandlerMicros);
+	}
+
+	TEST(TEST_CLASS, CanAddResponseSamples) {
+		// Arrange:
+		PacketStatistics statistics;
+
+		// Act:
+		statistics.addResponseSample(PacketType::Pull_Blocks, 15);
+		statistics.addResponseSample(PacketType::Pull_Blocks, 25);
+
+		// Assert: response samples do not contribute to packet counts or peer statistics
+		auto packetTypeStatistics = statistics.packetTypeStatistics();
+		ASSERT_EQ(1u, packetTypeStatistics.size());
+
+		const auto& pullBlocksStatistics = packetTypeStatistics.at(PacketType::Pull_Blocks);
+		EXPECT_EQ(0u, pullBlocksStatistics.NumPackets);
+		EXPECT_EQ(0u, pullBlocksStatistics.HandlerLatencies.count());
+		EXPECT_EQ(2u, pullBlocksStatistics.ResponseLatencies.count());
+		EXPECT_EQ(40u, pullBlocksStatistics.ResponseLatencies.sum());
+
+		EXPECT_TRUE(statistics.peerStatistics().empty());
+	}
+
+	TEST(TEST_CLASS, PeerStatisticsAreBoundedByMaxPeers) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(5);
+		PacketStatistics statistics(3);
+
+		// Act: all samples are added from the same thread (shard)
+		for (const auto& key : keys)
+			statistics.addHandlerSample(PacketType::Pull_Blocks, 100, key, 10);
+
+		// Assert: least recently active peers were evicted
+		auto peerStatistics = statistics.peerStatistics();
+		ASSERT_EQ(3u, peerStatistics.size());
+		EXPECT_EQ(0u, peerStatistics.count(keys[0]));
+		EXPECT_EQ(0u, peerStatistics.count(keys[1]));
+		for (auto i = 2u; i < keys.size(); ++i)
+			EXPECT_EQ(1u, peerStatistics.count(keys[i])) << i;
+
+		// - packet type statistics are not affected by peer eviction
+		EXPECT_EQ(5u, statistics.packetTypeStatistics().at(PacketType::Pull_Blocks).NumPackets);
+	}
+
+	TEST(TEST_CLASS, PeerActivityDelaysEviction) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(4);
+		PacketStatistics statistics(3);
+		for (auto i = 0u; i < 3; ++i)
+			statistics.addHandlerSample(PacketType::Pull_Blocks, 100, keys[i], 10);
+
+		// Act: refresh first peer and then add a new peer
+		statistics.addHandlerSample(PacketType::Pull_Blocks, 100, keys[0], 10);
+		statistics.addHandlerSample(PacketType::Pull_Blocks, 100, keys[3], 10);
+
+		// Assert: second peer was least recently active
+		auto peerStatistics = statistics.peerStatistics();
+		ASSERT_EQ(3u, peerStatistics.size());
+		EXPECT_EQ(2u, peerStatistics.at(keys[0]).NumPackets);
+		EXPECT_EQ(0u, peerStatistics.count(keys[1]));
+		EXPECT_EQ(1u, peerStatistics.at(keys[2]).NumPackets);
+		EXPECT_EQ(1u, peerStatistics.at(keys[3]).NumPackets);
+	}
+
+	TEST(TEST_CLASS, SamplesFromMultipleThreadsAreMerged) {
+		// Arrange:
+		constexpr auto Num_Threads = 20u;
+		constexpr auto Num_Samples_Per_Thread = 100u;
+		auto key = test::GenerateRandomByteArray<Key>();
+		PacketStatistics statistics;
+
+		// Act:
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.emplace_back([&statistics, &key]() {
+				for (auto j = 0u; j < Num_Samples_Per_Thread; ++j)
+					statistics.addHandlerSample(PacketType::Push_Transactions, 10, key, 1);
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		auto packetTypeStatistics = statistics.packetTypeStatistics();
+		ASSERT_EQ(1u, packetTypeStatistics.size());
+		EXPECT_EQ(Num_Threads * Num_Samples_Per_Thread, packetTypeStatistics.at(PacketType::Push_Transactions).NumPackets);
+
+		auto peerStatistics = statistics.peerStatistics();
+		ASSERT_EQ(1u, peerStatistics.size());
+		EXPECT_EQ(Num_Threads * Num_Samples_Per_Thread, peerStatistics.at(key).NumPackets);
+		EXPECT_EQ(Num_Threads * Num_Samples_Per_Thread * 10, peerStatistics.at(key).NumBytes);
+	}
+}}
@@ -22,6 +22,7 @@
 #include "catapult/ionet/BufferedPacketIo.h"
 #include "catapult/ionet/IoTypes.h"
 #include "catapult/ionet/PacketSocket.h"
+#include "catapult/ionet/PacketStatistics.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/net/ClientSocket.h"
@@ -294,6 +295,12 @@ namespace catapult { namespace ionet {
 			0x03, 0x14, 0x11, 0x32 // payload
 		};
 		EXPECT_EQ(expectedClientBytes, responseBytes);
+
+		// - handler and response samples were recorded for all packets
+		auto packetTypeStatistics = handlers.statistics()->packetTypeStatistics();
+		ASSERT_EQ(1u, packetTypeStatistics.size());
+		EXPECT_EQ(3u, packetTypeStatistics.at(test::Default_Packet_Type).HandlerLatencies.count());
+		EXPECT_EQ(3u, packetTypeStatistics.at(test::Default_Packet_Type).ResponseLatencies.count());
 	}
 
 	TEST(TEST_CLASS, ReadFailsOnReadError) {
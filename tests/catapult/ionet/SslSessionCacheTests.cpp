@@ -0,0 +1,238 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "catapult/ionet/SslSessionCache.h"
+#include "tests/TestHarness.h"
+#include <openssl/ssl.h>
+#include <ctime>
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS SslSessionCacheTests
+
+	namespace {
+		constexpr long Default_Timeout = 1000;
+
+		long Now() {
+			return static_cast<long>(std::time(nullptr));
+		}
+
+		SslSessionCache::SessionPointer CreateSession(long time, long timeout = Default_Timeout) {
+			auto pSession = SslSessionCache::SessionPointer(SSL_SESSION_new(), SSL_SESSION_free);
+			SSL_SESSION_set_time(pSession.get(), time);
+			SSL_SESSION_set_timeout(pSession.get(), timeout);
+			return pSession;
+		}
+
+		void AssertStatistics(
+				const SslHandshakeStatistics& expected,
+				const SslHandshakeStatistics& actual,
+				const std::string& message = "") {
+			EXPECT_EQ(expected.NumFullHandshakes, actual.NumFullHandshakes) << message;
+			EXPECT_EQ(expected.NumResumedHandshakes, actual.NumResumedHandshakes) << message;
+			EXPECT_EQ(expected.NumFailedHandshakes, actual.NumFailedHandshakes) << message;
+			EXPECT_EQ(expected.TotalFullHandshakeMicros, actual.TotalFullHandshakeMicros) << message;
+			EXPECT_EQ(expected.TotalResumedHandshakeMicros, actual.TotalResumedHandshakeMicros) << message;
+		}
+	}
+
+	// region CalculateAverageHandshakeMicros
+
+	TEST(TEST_CLASS, CalculateAverageHandshakeMicrosReturnsZeroWhenThereAreNoHandshakes) {
+		// Arrange:
+		SslHandshakeStatistics statistics;
+		statistics.NumFailedHandshakes = 5;
+
+		// Act + Assert:
+		EXPECT_EQ(0u, CalculateAverageHandshakeMicros(statistics));
+	}
+
+	TEST(TEST_CLASS, CalculateAverageHandshakeMicrosAveragesFullAndResumedHandshakes) {
+		// Arrange:
+		SslHandshakeStatistics statistics;
+		statistics.NumFullHandshakes = 3;
+		statistics.NumResumedHandshakes = 5;
+		statistics.TotalFullHandshakeMicros = 1200;
+		statistics.TotalResumedHandshakeMicros = 400;
+
+		// Act + Assert:
+		EXPECT_EQ(200u, CalculateAverageHandshakeMicros(statistics));
+	}
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		SslSessionCache cache(10);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		AssertStatistics(SslHandshakeStatistics(), cache.statistics());
+	}
+
+	// endregion
+
+	// region add / find / remove
+
+	TEST(TEST_CLASS, CanAddAndFindSession) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(2);
+		auto pSession1 = CreateSession(Now());
+		auto pSession2 = CreateSession(Now());
+		SslSessionCache cache(10);
+
+		// Act:
+		cache.add(keys[0], pSession1);
+		cache.add(keys[1], pSession2);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_EQ(pSession1, cache.find(keys[0]));
+		EXPECT_EQ(pSession2, cache.find(keys[1]));
+	}
+
+	TEST(TEST_CLASS, FindReturnsNullptrWhenSessionIsUnknown) {
+		// Arrange:
+		SslSessionCache cache(10);
+		cache.add(test::GenerateRandomByteArray<Key>(), CreateSession(Now()));
+
+		// Act + Assert:
+		EXPECT_FALSE(!!cache.find(test::GenerateRandomByteArray<Key>()));
+	}
+
+	TEST(TEST_CLASS, FindReturnsNullptrWhenSessionIsExpired) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		SslSessionCache cache(10);
+		cache.add(key, CreateSession(Now() - 100, 50));
+
+		// Act + Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_FALSE(!!cache.find(key));
+	}
+
+	TEST(TEST_CLASS, AddReplacesExistingSession) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		auto pSession1 = CreateSession(Now());
+		auto pSession2 = CreateSession(Now());
+		SslSessionCache cache(10);
+		cache.add(key, pSession1);
+
+		// Act:
+		cache.add(key, pSession2);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(pSession2, cache.find(key));
+	}
+
+	TEST(TEST_CLASS, AddIsBypassedWhenMaxSizeIsZero) {
+		// Arrange:
+		SslSessionCache cache(0);
+
+		// Act:
+		cache.add(test::GenerateRandomByteArray<Key>(), CreateSession(Now()));
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+	}
+
+	TEST(TEST_CLASS, AddPrunesExpiredSessionsWhenFull) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(4);
+		SslSessionCache cache(3);
+		cache.add(keys[0], CreateSession(Now() - 100, 50));
+		cache.add(keys[1], CreateSession(Now()));
+		cache.add(keys[2], CreateSession(Now() - 200, 50));
+
+		// Act:
+		cache.add(keys[3], CreateSession(Now()));
+
+		// Assert: both expired sessions were pruned
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_TRUE(!!cache.find(keys[1]));
+		EXPECT_TRUE(!!cache.find(keys[3]));
+	}
+
+	TEST(TEST_CLASS, AddEvictsOldestSessionWhenFullAndNoSessionsAreExpired) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(4);
+		SslSessionCache cache(3);
+		cache.add(keys[0], CreateSession(Now() - 10));
+		cache.add(keys[1], CreateSession(Now() - 30));
+		cache.add(keys[2], CreateSession(Now() - 20));
+
+		// Act:
+		cache.add(keys[3], CreateSession(Now()));
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_TRUE(!!cache.find(keys[0]));
+		EXPECT_FALSE(!!cache.find(keys[1]));
+		EXPECT_TRUE(!!cache.find(keys[2]));
+		EXPECT_TRUE(!!cache.find(keys[3]));
+	}
+
+	TEST(TEST_CLASS, CanRemoveSession) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(2);
+		SslSessionCache cache(10);
+		cache.add(keys[0], CreateSession(Now()));
+		cache.add(keys[1], CreateSession(Now()));
+
+		// Act:
+		cache.remove(keys[0]);
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_FALSE(!!cache.find(keys[0]));
+		EXPECT_TRUE(!!cache.find(keys[1]));
+	}
+
+	// endregion
+
+	// region statistics
+
+	TEST(TEST_CLASS, CanAddHandshakeSamples) {
+		// Arrange:
+		SslSessionCache cache(10);
+
+		// Act:
+		cache.addHandshakeSample(false, 1000);
+		cache.addHandshakeSample(true, 100);
+		cache.addHandshakeSample(false, 3000);
+		cache.addFailedHandshakeSample();
+		cache.addHandshakeSample(true, 300);
+		cache.addHandshakeSample(true, 200);
+
+		// Assert:
+		SslHandshakeStatistics expected;
+		expected.NumFullHandshakes = 2;
+		expected.NumResumedHandshakes = 3;
+		expected.NumFailedHandshakes = 1;
+		expected.TotalFullHandshakeMicros = 4000;
+		expected.TotalResumedHandshakeMicros = 600;
+		AssertStatistics(expected, cache.statistics());
+	}
+
+	// endregion
+}}
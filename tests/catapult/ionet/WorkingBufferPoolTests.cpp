@@ -0,0 +1,168 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "catapult/ionet/WorkingBufferPool.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS WorkingBufferPoolTests
+
+	namespace {
+		constexpr size_t Min_Buffer_Size = 1024;
+
+		ByteBuffer CreateBuffer(size_t capacity) {
+			ByteBuffer buffer;
+			buffer.reserve(capacity);
+			return buffer;
+		}
+
+		void AssertStatistics(const WorkingBufferPool& pool, size_t numPooledBuffers, size_t pooledBytes, size_t numHits, size_t numMisses) {
+			EXPECT_EQ(numPooledBuffers, pool.numPooledBuffers());
+			EXPECT_EQ(pooledBytes, pool.pooledBytes());
+			EXPECT_EQ(numHits, pool.numHits());
+			EXPECT_EQ(numMisses, pool.numMisses());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreatePool) {
+		// Act:
+		WorkingBufferPool pool(Min_Buffer_Size, 10 * Min_Buffer_Size);
+
+		// Assert:
+		EXPECT_EQ(Min_Buffer_Size, pool.minBufferSize());
+		EXPECT_EQ(10 * Min_Buffer_Size, pool.maxPooledBytes());
+		AssertStatistics(pool, 0, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CannotCreatePoolWithZeroMinBufferSize) {
+		EXPECT_THROW(WorkingBufferPool(0, 10 * Min_Buffer_Size), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region calculateBufferCapacity
+
+	TEST(TEST_CLASS, CanCalculateBufferCapacity) {
+		// Arrange:
+		WorkingBufferPool pool(Min_Buffer_Size, 10 * Min_Buffer_Size);
+
+		// Act + Assert: capacities are power of two multiples of min buffer size
+		EXPECT_EQ(Min_Buffer_Size, pool.calculateBufferCapacity(0));
+		EXPECT_EQ(Min_Buffer_Size, pool.calculateBufferCapacity(1));
+		EXPECT_EQ(Min_Buffer_Size, pool.calculateBufferCapacity(Min_Buffer_Size));
+		EXPECT_EQ(2 * Min_Buffer_Size, pool.calculateBufferCapacity(Min_Buffer_Size + 1));
+		EXPECT_EQ(4 * Min_Buffer_Size, pool.calculateBufferCapacity(3 * Min_Buffer_Size));
+		EXPECT_EQ(16 * Min_Buffer_Size, pool.calculateBufferCapacity(9 * Min_Buffer_Size));
+	}
+
+	// endregion
+
+	// region acquire / release
+
+	TEST(TEST_CLASS, AcquireAllocatesBufferWhenPoolIsEmpty) {
+		// Arrange:
+		WorkingBufferPool pool(Min_Buffer_Size, 10 * Min_Buffer_Size);
+
+		// Act:
+		auto buffer = pool.acquire(3 * Min_Buffer_Size);
+
+		// Assert:
+		EXPECT_TRUE(buffer.empty());
+		EXPECT_EQ(4 * Min_Buffer_Size, buffer.capacity());
+		AssertStatistics(pool, 0, 0, 0, 1);
+	}
+
+	TEST(TEST_CLASS, ReleasedBufferIsRetained) {
+		// Arrange:
+		WorkingBufferPool pool(Min_Buffer_Size, 10 * Min_Buffer_Size);
+		auto buffer = pool.acquire(3 * Min_Buffer_Size);
+		buffer.resize(123);
+
+		// Act:
+		pool.release(std::move(buffer));
+
+		// Assert:
+		AssertStatistics(pool, 1, 4 * Min_Buffer_Size, 0, 1);
+	}
+
+	TEST(TEST_CLASS, AcquireReusesReleasedBufferOfSameSizeClass) {
+		// Arrange:
+		WorkingBufferPool pool(Min_Buffer_Size, 10 * Min_Buffer_Size);
+		auto buffer = pool.acquire(3 * Min_Buffer_Size);
+		buffer.resize(123);
+		const auto* pBufferData = buffer.data();
+		pool.release(std::move(buffer));
+
+		// Act:
+		auto reusedBuffer = pool.acquire(4 * Min_Buffer_Size);
+
+		// Assert:
+		EXPECT_TRUE(reusedBuffer.empty());
+		EXPECT_EQ(4 * Min_Buffer_Size, reusedBuffer.capacity());
+		EXPECT_EQ(pBufferData, reusedBuffer.data());
+		AssertStatistics(pool, 0, 0, 1, 1);
+	}
+
+	TEST(TEST_CLASS, AcquireDoesNotReuseReleasedBufferOfDifferentSizeClass) {
+		// Arrange:
+		WorkingBufferPool pool(Min_Buffer_Size, 10 * Min_Buffer_Size);
+		pool.release(CreateBuffer(2 * Min_Buffer_Size));
+
+		// Act:
+		auto buffer1 = pool.acquire(Min_Buffer_Size);
+		auto buffer2 = pool.acquire(4 * Min_Buffer_Size);
+
+		// Assert:
+		EXPECT_EQ(Min_Buffer_Size, buffer1.capacity());
+		EXPECT_EQ(4 * Min_Buffer_Size, buffer2.capacity());
+		AssertStatistics(pool, 1, 2 * Min_Buffer_Size, 0, 2);
+	}
+
+	TEST(TEST_CLASS, ReleasedBufferNotMatchingSizeClassIsFreed) {
+		// Arrange:
+		WorkingBufferPool pool(Min_Buffer_Size, 10 * Min_Buffer_Size);
+
+		// Act:
+		pool.release(CreateBuffer(0));
+		pool.release(CreateBuffer(Min_Buffer_Size - 1));
+		pool.release(CreateBuffer(3 * Min_Buffer_Size));
+
+		// Assert:
+		AssertStatistics(pool, 0, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, ReleasedBufferIsFreedWhenPoolIsFull) {
+		// Arrange:
+		WorkingBufferPool pool(Min_Buffer_Size, 10 * Min_Buffer_Size);
+		pool.release(CreateBuffer(8 * Min_Buffer_Size));
+		pool.release(CreateBuffer(Min_Buffer_Size));
+
+		// Act:
+		pool.release(CreateBuffer(2 * Min_Buffer_Size));
+		pool.release(CreateBuffer(Min_Buffer_Size));
+
+		// Assert: only the last buffer fits
+		AssertStatistics(pool, 3, 10 * Min_Buffer_Size, 0, 0);
+	}
+
+	// endregion
+}}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/ionet/WorkingBuffer.h"
+#include "catapult/ionet/WorkingBufferPool.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace ionet {
@@ -325,4 +326,137 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region pooled memory management
+
+	namespace {
+		constexpr auto Default_Packet_Size = Default_Capacity * 3;
+
+		WorkingBuffer CreatePooledWorkingBuffer(const std::shared_ptr<WorkingBufferPool>& pPool, size_t sensitivity) {
+			PacketSocketOptions options;
+			options.WorkingBufferSize = Default_Capacity;
+			options.WorkingBufferSensitivity = sensitivity;
+			options.MaxPacketDataSize = 15 * 1024;
+			options.pWorkingBufferPool = pPool;
+			return WorkingBuffer(options);
+		}
+
+		std::vector<size_t> AppendLargePacket(WorkingBuffer& buffer) {
+			// append a large packet in small chunks and record all distinct capacities
+			std::vector<size_t> capacities{ buffer.capacity() };
+			for (auto i = 0u; i < Default_Packet_Size / (Default_Capacity / 4); ++i) {
+				AppendRandomBuffer<Default_Capacity / 4>(buffer);
+				if (0 == i)
+					SetPacketSize(buffer, Default_Packet_Size);
+
+				if (buffer.capacity() != capacities.back())
+					capacities.push_back(buffer.capacity());
+			}
+
+			return capacities;
+		}
+	}
+
+	TEST(TEST_CLASS, PooledBufferIsAcquiredFromPool) {
+		// Arrange:
+		auto pPool = std::make_shared<WorkingBufferPool>(Default_Capacity, 100 * Default_Capacity);
+
+		// Act:
+		auto buffer = CreatePooledWorkingBuffer(pPool, 0);
+
+		// Assert:
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+		EXPECT_EQ(1u, pPool->numMisses());
+	}
+
+	TEST(TEST_CLASS, PooledBufferIsReleasedToPoolOnDestruction) {
+		// Arrange:
+		auto pPool = std::make_shared<WorkingBufferPool>(Default_Capacity, 100 * Default_Capacity);
+
+		// Act:
+		{
+			auto buffer = CreatePooledWorkingBuffer(pPool, 0);
+			AppendRandomBuffer<100>(buffer);
+		}
+
+		// Assert:
+		EXPECT_EQ(1u, pPool->numPooledBuffers());
+		EXPECT_EQ(Default_Capacity, pPool->pooledBytes());
+	}
+
+	TEST(TEST_CLASS, PooledBufferGrowsIncrementallyWithReceivedData) {
+		// Arrange:
+		auto pPool = std::make_shared<WorkingBufferPool>(Default_Capacity, 100 * Default_Capacity);
+		auto buffer = CreatePooledWorkingBuffer(pPool, 0);
+
+		// Act:
+		auto capacities = AppendLargePacket(buffer);
+
+		// Assert: buffer grew by (at most) a single append size at a time (rounded up to the next size class)
+		EXPECT_EQ(std::vector<size_t>({ Default_Capacity, 2 * Default_Capacity, 4 * Default_Capacity }), capacities);
+		EXPECT_EQ(Default_Packet_Size, buffer.size());
+
+		// - previous buffers were released to the pool
+		EXPECT_EQ(2u, pPool->numPooledBuffers());
+		EXPECT_EQ(3 * Default_Capacity, pPool->pooledBytes());
+
+		// - packet can be extracted
+		const Packet* pPacket;
+		auto extractor = buffer.preparePacketExtractor();
+		EXPECT_EQ(PacketExtractResult::Success, extractor.tryExtractNextPacket(pPacket));
+		EXPECT_EQ(Default_Packet_Size, pPacket->Size);
+	}
+
+	TEST(TEST_CLASS, PooledBufferDoesNotGrowBasedOnPendingPacketSize) {
+		// Arrange:
+		auto pPool = std::make_shared<WorkingBufferPool>(Default_Capacity, 100 * Default_Capacity);
+		auto buffer = CreatePooledWorkingBuffer(pPool, 0);
+
+		// Act: append a header announcing a large (but valid) packet followed by a small amount of data
+		AppendRandomBuffer<Default_Capacity / 4>(buffer);
+		SetPacketSize(buffer, 15 * 1024);
+		AppendRandomBuffer<Default_Capacity / 4>(buffer);
+
+		// Assert: buffer did not grow
+		EXPECT_EQ(Default_Capacity / 2, buffer.size());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+		EXPECT_EQ(1u, pPool->numMisses());
+	}
+
+	TEST(TEST_CLASS, PooledBufferIsShrunkToReclaimMemoryByReleasingLargerBufferToPool) {
+		// Arrange:
+		auto pPool = std::make_shared<WorkingBufferPool>(Default_Capacity, 100 * Default_Capacity);
+		auto buffer = CreatePooledWorkingBuffer(pPool, 20);
+
+		// - append and consume a large packet
+		AppendLargePacket(buffer);
+		{
+			auto extractor = buffer.preparePacketExtractor();
+			const Packet* pPacket;
+			extractor.tryExtractNextPacket(pPacket);
+			extractor.consume();
+		}
+
+		// Sanity:
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(4 * Default_Capacity, buffer.capacity());
+
+		// Act: append small data (second reclamation attempt will only have small samples)
+		std::vector<uint8_t> allData;
+		for (auto i = 0u; i < 30; ++i) {
+			auto appendBuffer = AppendRandomBuffer<10>(buffer);
+			allData.insert(allData.end(), appendBuffer.cbegin(), appendBuffer.cend());
+		}
+
+		// Assert: capacity is reduced and larger buffer is retained by pool
+		EXPECT_EQ(300u, buffer.size());
+		EXPECT_EQ(2 * Default_Capacity, buffer.capacity());
+		AssertEqual(allData, buffer);
+
+		EXPECT_EQ(2u, pPool->numPooledBuffers());
+		EXPECT_EQ(5 * Default_Capacity, pPool->pooledBytes());
+	}
+
+	// endregion
 }}
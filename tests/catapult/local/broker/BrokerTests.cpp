@@ -40,12 +40,17 @@ namespace catapult { namespace local {
 
 	public:
 		void boot() {
+			boot([](const auto&) {});
+		}
+
+		void boot(const consumer<extensions::ProcessBootstrapper&>& configure) {
 			auto config = test::CreatePrototypicalCatapultConfiguration(dataDirectory().rootDir().str());
 			auto pBootstrapper = std::make_unique<extensions::ProcessBootstrapper>(
 					std::move(config),
 					resourcesDirectory(),
 					extensions::ProcessDisposition::Production,
 					"BrokerTests");
+			configure(*pBootstrapper);
 
 			m_pBroker = CreateBroker(std::move(pBootstrapper));
 		}
@@ -79,6 +84,49 @@ namespace catapult { namespace local {
 		context.broker().shutdown();
 	}
 
+	TEST(TEST_CLASS, BrokerExposesQueueCounters) {
+		// Arrange:
+		BrokerTestContext context;
+		context.boot();
+
+		// Act:
+		auto counters = context.broker().counters();
+
+		// Assert:
+		std::vector<std::string> counterNames;
+		for (const auto& counter : counters) {
+			counterNames.push_back(counter.id().name());
+			EXPECT_EQ(0u, counter.value()) << counter.id().name();
+		}
+
+		EXPECT_EQ(
+				std::vector<std::string>({
+					"BLK BACKLOG", "BLK LAG", "UT BACKLOG", "UT LAG", "PT BACKLOG", "PT LAG",
+					"TXS BACKLOG", "TXS LAG", "STATE BACKLOG", "STATE LAG"
+				}),
+				counterNames);
+	}
+
+	TEST(TEST_CLASS, BrokerExposesExtensionCounters) {
+		// Arrange:
+		BrokerTestContext context;
+		context.boot([](auto& bootstrapper) {
+			auto& extensionManager = bootstrapper.extensionManager();
+			extensionManager.addDiagnosticCounter(utils::DiagnosticCounter(utils::DiagnosticCounterId("ALPHA"), []() { return 17u; }));
+			extensionManager.addDiagnosticCounter(utils::DiagnosticCounter(utils::DiagnosticCounterId("BETA"), []() { return 22u; }));
+		});
+
+		// Act:
+		auto counters = context.broker().counters();
+
+		// Assert: extension counters follow queue counters
+		ASSERT_EQ(12u, counters.size());
+		EXPECT_EQ("ALPHA", counters[10].id().name());
+		EXPECT_EQ(17u, counters[10].value());
+		EXPECT_EQ("BETA", counters[11].id().name());
+		EXPECT_EQ(22u, counters[11].value());
+	}
+
 	// endregion
 
 	// region ingestion - traits
@@ -0,0 +1,304 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/local/broker/MessageQueueIngester.h"
+#include "catapult/io/FileQueue.h"
+#include "catapult/io/IndexFile.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace local {
+
+#define TEST_CLASS MessageQueueIngesterTests
+
+	namespace {
+		constexpr MessageQueueCatchUpOptions Default_Catch_Up_Options{ 10, 4 };
+
+		MessageQueuePollingOptions CreatePollingOptions() {
+			return { utils::TimeSpan::FromMilliseconds(2), utils::TimeSpan::FromMilliseconds(20) };
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(
+					const MessageQueueCatchUpOptions& catchUpOptions = Default_Catch_Up_Options,
+					size_t failingMessageIndex = std::numeric_limits<size_t>::max())
+					: m_queuePath((boost::filesystem::path(m_tempDir.name()) / "q").generic_string())
+					, m_pPool(test::CreateStartedIoThreadPool(1))
+					, m_failingMessageIndex(failingMessageIndex)
+					, m_ingester(
+							{ m_queuePath, "index_broker_r.dat", "index.dat" },
+							catchUpOptions,
+							CreatePollingOptions(),
+							[this](const auto& buffer) {
+								if (m_failingMessageIndex == m_messages.size())
+									CATAPULT_THROW_RUNTIME_ERROR("message consumer failed");
+
+								m_messages.push_back(buffer);
+								m_pendingMessageCounts.push_back(m_ingester.numPendingMessages());
+							},
+							[this]() {
+								m_flushMessageCounts.push_back(m_messages.size());
+								m_flushReaderIndexes.push_back(readIndexReaderFile());
+							},
+							*m_pPool)
+			{}
+
+		public:
+			auto& ingester() {
+				return m_ingester;
+			}
+
+			const auto& messages() const {
+				return m_messages;
+			}
+
+			const auto& pendingMessageCounts() const {
+				return m_pendingMessageCounts;
+			}
+
+			const auto& flushMessageCounts() const {
+				return m_flushMessageCounts;
+			}
+
+			const auto& flushReaderIndexes() const {
+				return m_flushReaderIndexes;
+			}
+
+		public:
+			std::vector<std::vector<uint8_t>> writeMessages(size_t numMessages) {
+				std::vector<std::vector<uint8_t>> messages;
+				io::FileQueueWriter writer(m_queuePath);
+				for (auto i = 0u; i < numMessages; ++i) {
+					messages.push_back(test::GenerateRandomVector(10 + i));
+					writer.write(messages.back());
+					writer.flush();
+				}
+
+				return messages;
+			}
+
+			size_t countMessageFiles() const {
+				auto begin = boost::filesystem::directory_iterator(m_queuePath);
+				auto end = boost::filesystem::directory_iterator();
+				return static_cast<size_t>(std::distance(begin, end)) - 2; // subtract index files
+			}
+
+			uint64_t readIndexReaderFile() const {
+				return io::IndexFile((boost::filesystem::path(m_queuePath) / "index_broker_r.dat").generic_string()).get();
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDir;
+			std::string m_queuePath;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			size_t m_failingMessageIndex;
+			MessageQueueIngester m_ingester;
+
+			std::vector<std::vector<uint8_t>> m_messages;
+			std::vector<size_t> m_pendingMessageCounts;
+			std::vector<size_t> m_flushMessageCounts;
+			std::vector<uint64_t> m_flushReaderIndexes;
+		};
+
+		void AssertDrained(TestContext& context, uint64_t expectedNumIngestedMessages) {
+			EXPECT_EQ(0u, context.ingester().numPendingMessages());
+			EXPECT_EQ(0u, context.ingester().lagMillis());
+			EXPECT_EQ(expectedNumIngestedMessages, context.ingester().numIngestedMessages());
+			EXPECT_EQ(utils::TimeSpan::FromMilliseconds(2), context.ingester().nextPollDelay());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateIngester) {
+		// Act:
+		TestContext context;
+
+		// Assert:
+		EXPECT_EQ(0u, context.ingester().numPendingMessages());
+		EXPECT_EQ(0u, context.ingester().lagMillis());
+		EXPECT_EQ(0u, context.ingester().numIngestedMessages());
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(2), context.ingester().nextPollDelay());
+	}
+
+	// endregion
+
+	// region ingest
+
+	TEST(TEST_CLASS, IngestHasNoEffectWhenQueueIsEmpty) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto numIngestedMessages = context.ingester().ingest();
+
+		// Assert:
+		EXPECT_EQ(0u, numIngestedMessages);
+		EXPECT_TRUE(context.messages().empty());
+		EXPECT_TRUE(context.flushMessageCounts().empty());
+
+		EXPECT_EQ(0u, context.ingester().numPendingMessages());
+		EXPECT_EQ(0u, context.ingester().numIngestedMessages());
+	}
+
+	TEST(TEST_CLASS, CanIngestAllPendingMessagesInOrder) {
+		// Arrange:
+		TestContext context;
+		auto expectedMessages = context.writeMessages(5);
+
+		// Act:
+		auto numIngestedMessages = context.ingester().ingest();
+
+		// Assert:
+		EXPECT_EQ(5u, numIngestedMessages);
+		EXPECT_EQ(expectedMessages, context.messages());
+		EXPECT_EQ(0u, context.countMessageFiles());
+		EXPECT_EQ(5u, context.readIndexReaderFile());
+		AssertDrained(context, 5);
+	}
+
+	TEST(TEST_CLASS, CanIngestMessagesAcrossMultipleCalls) {
+		// Arrange:
+		TestContext context;
+		auto expectedMessages = context.writeMessages(3);
+		context.ingester().ingest();
+
+		auto expectedMessages2 = context.writeMessages(4);
+		expectedMessages.insert(expectedMessages.end(), expectedMessages2.cbegin(), expectedMessages2.cend());
+
+		// Act:
+		auto numIngestedMessages = context.ingester().ingest();
+
+		// Assert:
+		EXPECT_EQ(4u, numIngestedMessages);
+		EXPECT_EQ(expectedMessages, context.messages());
+		EXPECT_EQ(0u, context.countMessageFiles());
+		EXPECT_EQ(7u, context.readIndexReaderFile());
+		AssertDrained(context, 7);
+	}
+
+	TEST(TEST_CLASS, IngestUpdatesPendingMessagesDuringIngestion) {
+		// Arrange:
+		TestContext context;
+		context.writeMessages(5);
+
+		// Act:
+		context.ingester().ingest();
+
+		// Assert: pending count is captured while each message is processed
+		EXPECT_EQ(std::vector<size_t>({ 5, 4, 3, 2, 1 }), context.pendingMessageCounts());
+	}
+
+	TEST(TEST_CLASS, IngestFlushesEachMessageBeforeConsumingItWhenNotCatchingUp) {
+		// Arrange:
+		TestContext context;
+		context.writeMessages(5);
+
+		// Act:
+		context.ingester().ingest();
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 3, 4, 5 }), context.flushMessageCounts());
+		EXPECT_EQ(std::vector<uint64_t>({ 0, 1, 2, 3, 4 }), context.flushReaderIndexes());
+	}
+
+	TEST(TEST_CLASS, IngestBatchesFlushesWhenCatchingUp) {
+		// Arrange:
+		TestContext context;
+		auto expectedMessages = context.writeMessages(10);
+
+		// Act:
+		auto numIngestedMessages = context.ingester().ingest();
+
+		// Assert:
+		EXPECT_EQ(10u, numIngestedMessages);
+		EXPECT_EQ(expectedMessages, context.messages());
+		EXPECT_EQ(std::vector<size_t>({ 4, 8, 10 }), context.flushMessageCounts());
+		EXPECT_EQ(std::vector<uint64_t>({ 0, 4, 8 }), context.flushReaderIndexes());
+		EXPECT_EQ(10u, context.readIndexReaderFile());
+		EXPECT_EQ(0u, context.countMessageFiles());
+		AssertDrained(context, 10);
+	}
+
+	TEST(TEST_CLASS, IngestDoesNotConsumeUnflushedMessagesWhenMessageConsumerFails) {
+		// Arrange: fail when consuming the seventh message
+		TestContext context({ 1, 4 }, 6);
+		auto expectedMessages = context.writeMessages(8);
+
+		// Act:
+		EXPECT_THROW(context.ingester().ingest(), catapult_runtime_error);
+
+		// Assert: only the first (flushed) batch was consumed
+		EXPECT_EQ(6u, context.messages().size());
+		EXPECT_EQ(std::vector<size_t>({ 4 }), context.flushMessageCounts());
+		EXPECT_EQ(4u, context.readIndexReaderFile());
+		EXPECT_EQ(4u, context.countMessageFiles());
+	}
+
+	TEST(TEST_CLASS, IngestDoesNotBatchFlushesWhenMaxMessagesPerFlushIsOne) {
+		// Arrange:
+		TestContext context({ 1, 1 });
+		context.writeMessages(3);
+
+		// Act:
+		context.ingester().ingest();
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 3 }), context.flushMessageCounts());
+		EXPECT_EQ(std::vector<uint64_t>({ 0, 1, 2 }), context.flushReaderIndexes());
+	}
+
+	// endregion
+
+	// region nextPollDelay
+
+	TEST(TEST_CLASS, PollDelayBacksOffExponentiallyWhenQueueIsIdle) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		for (auto expectedDelayMillis : { 4u, 8u, 16u, 20u, 20u }) {
+			context.ingester().ingest();
+			EXPECT_EQ(utils::TimeSpan::FromMilliseconds(expectedDelayMillis), context.ingester().nextPollDelay());
+		}
+	}
+
+	TEST(TEST_CLASS, PollDelayIsResetWhenMessagesAreIngested) {
+		// Arrange:
+		TestContext context;
+		for (auto i = 0u; i < 5; ++i)
+			context.ingester().ingest();
+
+		context.writeMessages(1);
+
+		// Act:
+		context.ingester().ingest();
+
+		// Assert:
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(2), context.ingester().nextPollDelay());
+	}
+
+	// endregion
+}}
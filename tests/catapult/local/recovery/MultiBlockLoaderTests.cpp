@@ -24,9 +24,11 @@
 #include "catapult/extensions/PluginUtils.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "tests/catapult/local/recovery/test/FilechainTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/ResolverTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryBlockStorage.h"
 #include "tests/test/local/BlockStateHash.h"
 #include "tests/test/local/LocalNodeTestState.h"
@@ -173,12 +175,20 @@ namespace catapult { namespace local {
 			}
 
 			model::ChainScore load(Height startHeight) {
-				auto observerFactory = [this](const auto& block) {
+				return LoadBlockChain(createObserverFactory(), m_pluginManager, m_state.ref(), startHeight);
+			}
+
+			model::ChainScore load(Height startHeight, uint32_t maxPrefetchedBlocks) {
+				auto pPool = test::CreateStartedIoThreadPool(2);
+				return LoadBlockChain(createObserverFactory(), m_pluginManager, m_state.ref(), startHeight, *pPool, maxPrefetchedBlocks);
+			}
+
+		private:
+			BlockDependentNotificationObserverFactory createObserverFactory() {
+				return [this](const auto& block) {
 					this->m_factoryHeights.push_back(block.Height);
 					return std::make_unique<mocks::MockBlockHeightCapturingNotificationObserver>(this->m_observerBlockHeights);
 				};
-
-				return LoadBlockChain(observerFactory, m_pluginManager, m_state.ref(), startHeight);
 			}
 
 		private:
@@ -264,6 +274,57 @@ namespace catapult { namespace local {
 
 	// endregion
 
+	// region LoadBlockChain - prefetch
+
+	namespace {
+		void AssertCanLoadBlocksWithPrefetch(Height startHeight, uint32_t maxPrefetchedBlocks) {
+			// Arrange: create a storage with 7 blocks
+			LoadBlockChainTestContext context;
+			context.setStorageChainHeight(Height(7));
+
+			// Act:
+			auto score = context.load(startHeight, maxPrefetchedBlocks);
+
+			// Assert: blocks are executed in order
+			std::vector<Height> expectedHeights;
+			for (auto height = startHeight; Height(7) >= height; height = height + Height(1))
+				expectedHeights.push_back(height);
+
+			auto expectedScore = CalculateExpectedScore(7);
+			if (Height(2) != startHeight)
+				expectedScore -= CalculateExpectedScore(startHeight.unwrap() - 1);
+
+			EXPECT_EQ(model::ChainScore(expectedScore), score) << "max prefetched blocks " << maxPrefetchedBlocks;
+			EXPECT_EQ(expectedHeights, context.observerBlockHeights()) << "max prefetched blocks " << maxPrefetchedBlocks;
+			EXPECT_EQ(expectedHeights, context.factoryHeights()) << "max prefetched blocks " << maxPrefetchedBlocks;
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainWithPrefetchLoadsZeroBlocksWhenStorageHeightIsOne) {
+		// Arrange:
+		LoadBlockChainTestContext context;
+
+		// Act:
+		auto score = context.load(Height(2), 4);
+
+		// Assert:
+		EXPECT_EQ(model::ChainScore(), score);
+		EXPECT_EQ(0u, context.observerBlockHeights().size());
+		EXPECT_EQ(0u, context.factoryHeights().size());
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainWithPrefetchLoadsMultipleBlocks) {
+		for (auto maxPrefetchedBlocks : { 0u, 1u, 3u, 6u, 100u })
+			AssertCanLoadBlocksWithPrefetch(Height(2), maxPrefetchedBlocks);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainWithPrefetchLoadsMultipleBlocksStartingAtArbitraryHeight) {
+		for (auto maxPrefetchedBlocks : { 0u, 1u, 3u, 100u })
+			AssertCanLoadBlocksWithPrefetch(Height(4), maxPrefetchedBlocks);
+	}
+
+	// endregion
+
 	// region LoadBlockChain - state enabled
 
 	namespace {
@@ -138,4 +138,28 @@ namespace catapult { namespace local {
 			EXPECT_EQ(expectedCacheChangesPointerValue, reader.read<uintptr_t>()) << reader.position();
 		}
 	}
+
+	TEST(TEST_CLASS, NotifyStateChangeForwardsStateChangeSizeToConsumer) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		std::vector<size_t> stateChangeSizes;
+		auto pStorage = CreateFileStateChangeStorage(
+				std::make_unique<mocks::MockMemoryStream>(buffer),
+				[]() {
+					CacheChangesStorages cacheChangesStorages;
+					cacheChangesStorages.emplace_back(std::make_unique<MockCacheChangesStorageWriter>(123));
+					return cacheChangesStorages;
+				},
+				[&stateChangeSizes](auto size) { stateChangeSizes.push_back(size); });
+
+		// Act: score changes are not forwarded and do not contribute to the size of the next state change
+		pStorage->notifyScoreChange(model::ChainScore(1));
+		pStorage->notifyStateChange(subscribers::StateChangeInfo(cache::CacheChanges({}), model::ChainScore(2), Height(3)));
+		pStorage->notifyStateChange(subscribers::StateChangeInfo(cache::CacheChanges({}), model::ChainScore(4), Height(5)));
+
+		// Assert:
+		auto expectedSize = 1u + 3 * sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uintptr_t);
+		EXPECT_EQ(std::vector<size_t>({ expectedSize, expectedSize }), stateChangeSizes);
+		EXPECT_EQ(1u + 2 * sizeof(uint64_t) + 2 * expectedSize, buffer.size());
+	}
 }}
@@ -0,0 +1,208 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/ExecutionProfiler.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS ExecutionProfilerTests
+
+	namespace {
+		constexpr auto Type_A = static_cast<NotificationType>(0x0001'4000);
+		constexpr auto Type_B = static_cast<NotificationType>(0x0002'4000);
+
+		void AssertEntry(
+				const ExecutionProfileEntry& entry,
+				const std::string& pluginName,
+				NotificationType type,
+				uint64_t numCalls,
+				uint64_t elapsedNanoseconds) {
+			auto message = pluginName + " " + std::to_string(utils::to_underlying_type(type));
+			EXPECT_EQ(pluginName, entry.PluginName) << message;
+			EXPECT_EQ(type, entry.Type) << message;
+			EXPECT_EQ(numCalls, entry.Statistics.NumCalls) << message;
+			EXPECT_EQ(elapsedNanoseconds, entry.Statistics.ElapsedNanoseconds) << message;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateProfiler) {
+		// Act:
+		ExecutionProfiler profiler(utils::TimeSpan::FromMilliseconds(123));
+
+		// Assert:
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(123), profiler.slowBlockThreshold());
+		EXPECT_EQ(0u, profiler.numSlowBlocks());
+		EXPECT_EQ(0u, profiler.totals().NumCalls);
+		EXPECT_EQ(0u, profiler.totals().ElapsedNanoseconds);
+		EXPECT_TRUE(profiler.entries().empty());
+	}
+
+	// endregion
+
+	// region registerPlugin
+
+	TEST(TEST_CLASS, RegisterPluginAssignsIdentifiersByName) {
+		// Arrange:
+		ExecutionProfiler profiler(utils::TimeSpan::FromMilliseconds(10));
+
+		// Act:
+		auto id1 = profiler.registerPlugin("alpha");
+		auto id2 = profiler.registerPlugin("beta");
+		auto id3 = profiler.registerPlugin("alpha");
+
+		// Assert:
+		EXPECT_NE(id1, id2);
+		EXPECT_EQ(id1, id3);
+	}
+
+	// endregion
+
+	// region record
+
+	TEST(TEST_CLASS, CanRecordSamplesByPluginAndNotificationType) {
+		// Arrange:
+		ExecutionProfiler profiler(utils::TimeSpan::FromMilliseconds(10));
+		auto alphaId = profiler.registerPlugin("alpha");
+		auto betaId = profiler.registerPlugin("beta");
+
+		// Act:
+		profiler.record(alphaId, Type_A, 100);
+		profiler.record(betaId, Type_A, 700);
+		profiler.record(alphaId, Type_B, 50);
+		profiler.record(alphaId, Type_A, 300);
+
+		// Assert: entries are ordered by descending elapsed time
+		auto entries = profiler.entries();
+		ASSERT_EQ(3u, entries.size());
+		AssertEntry(entries[0], "beta", Type_A, 1, 700);
+		AssertEntry(entries[1], "alpha", Type_A, 2, 400);
+		AssertEntry(entries[2], "alpha", Type_B, 1, 50);
+
+		EXPECT_EQ(4u, profiler.totals().NumCalls);
+		EXPECT_EQ(1150u, profiler.totals().ElapsedNanoseconds);
+	}
+
+	TEST(TEST_CLASS, CanRecordSamplesFromMultipleThreads) {
+		// Arrange:
+		ExecutionProfiler profiler(utils::TimeSpan::FromMilliseconds(10));
+		auto alphaId = profiler.registerPlugin("alpha");
+
+		// Act: record samples from threads that exit before the profiler is queried
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < 4; ++i) {
+			threads.emplace_back([&profiler, alphaId, i]() {
+				for (auto j = 0u; j < 100; ++j)
+					profiler.record(alphaId, 0 == i % 2 ? Type_A : Type_B, i + 1);
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		auto entries = profiler.entries();
+		ASSERT_EQ(2u, entries.size());
+		AssertEntry(entries[0], "alpha", Type_B, 200, (2 + 4) * 100);
+		AssertEntry(entries[1], "alpha", Type_A, 200, (1 + 3) * 100);
+	}
+
+	TEST(TEST_CLASS, ScopedSampleRecordsSample) {
+		// Arrange:
+		ExecutionProfiler profiler(utils::TimeSpan::FromMilliseconds(10));
+		auto alphaId = profiler.registerPlugin("alpha");
+
+		// Act:
+		{
+			ExecutionProfiler::ScopedSample sample(profiler, alphaId, Type_B);
+			test::Sleep(5);
+		}
+
+		// Assert:
+		auto entries = profiler.entries();
+		ASSERT_EQ(1u, entries.size());
+		EXPECT_EQ("alpha", entries[0].PluginName);
+		EXPECT_EQ(Type_B, entries[0].Type);
+		EXPECT_EQ(1u, entries[0].Statistics.NumCalls);
+		EXPECT_LE(5'000'000u, entries[0].Statistics.ElapsedNanoseconds);
+	}
+
+	// endregion
+
+	// region startBlock / completeBlock
+
+	TEST(TEST_CLASS, CompleteBlockDoesNotCountFastBlocks) {
+		// Arrange:
+		ExecutionProfiler profiler(utils::TimeSpan::FromMilliseconds(10));
+		auto alphaId = profiler.registerPlugin("alpha");
+
+		// Act:
+		profiler.startBlock();
+		profiler.record(alphaId, Type_A, 100);
+		profiler.completeBlock(Height(123), 9'999'999);
+
+		// Assert:
+		EXPECT_EQ(0u, profiler.numSlowBlocks());
+		EXPECT_EQ(1u, profiler.totals().NumCalls);
+	}
+
+	TEST(TEST_CLASS, CompleteBlockCountsSlowBlocks) {
+		// Arrange:
+		ExecutionProfiler profiler(utils::TimeSpan::FromMilliseconds(10));
+		auto alphaId = profiler.registerPlugin("alpha");
+
+		// Act:
+		for (auto elapsedNanoseconds : std::initializer_list<uint64_t>{ 10'000'000, 5, 12'000'000 }) {
+			profiler.startBlock();
+			profiler.record(alphaId, Type_A, 100);
+			profiler.completeBlock(Height(123), elapsedNanoseconds);
+		}
+
+		// Assert:
+		EXPECT_EQ(2u, profiler.numSlowBlocks());
+		EXPECT_EQ(3u, profiler.totals().NumCalls);
+	}
+
+	TEST(TEST_CLASS, BlockProfilingPreservesAllSamples) {
+		// Arrange:
+		ExecutionProfiler profiler(utils::TimeSpan::FromMilliseconds(10));
+		auto alphaId = profiler.registerPlugin("alpha");
+		auto betaId = profiler.registerPlugin("beta");
+
+		// Act: record samples before, during and after a block
+		profiler.record(alphaId, Type_A, 100);
+		profiler.startBlock();
+		profiler.record(betaId, Type_A, 200);
+		profiler.completeBlock(Height(123), 20'000'000);
+		profiler.record(alphaId, Type_A, 400);
+
+		// Assert:
+		auto entries = profiler.entries();
+		ASSERT_EQ(2u, entries.size());
+		AssertEntry(entries[0], "alpha", Type_A, 2, 500);
+		AssertEntry(entries[1], "beta", Type_A, 1, 200);
+		EXPECT_EQ(1u, profiler.numSlowBlocks());
+	}
+
+	// endregion
+}}
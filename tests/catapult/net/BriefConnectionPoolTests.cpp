@@ -0,0 +1,198 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+#include "catapult/net/BriefConnectionPool.h"
+#include "tests/test/core/mocks/MockPacketSocket.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace net {
+
+#define TEST_CLASS BriefConnectionPoolTests
+
+	namespace {
+		constexpr auto Default_Time_To_Live = utils::TimeSpan::FromMinutes(1);
+
+		struct SocketInfoWithMock {
+			ionet::PacketSocketInfo SocketInfo;
+			std::shared_ptr<mocks::MockPacketSocket> pMockSocket;
+		};
+
+		SocketInfoWithMock CreateSocketInfo(const Key& key) {
+			auto pMockSocket = std::make_shared<mocks::MockPacketSocket>();
+			return { ionet::PacketSocketInfo("127.0.0.1", key, pMockSocket), pMockSocket };
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, PoolIsInitiallyEmpty) {
+		// Act:
+		BriefConnectionPool pool(Default_Time_To_Live);
+
+		// Assert:
+		EXPECT_EQ(0u, pool.size());
+		EXPECT_EQ(0u, pool.numHits());
+		EXPECT_EQ(0u, pool.numMisses());
+	}
+
+	// endregion
+
+	// region give / take
+
+	TEST(TEST_CLASS, TakeReturnsEmptyInfoWhenNoConnectionIsPooled) {
+		// Arrange:
+		BriefConnectionPool pool(Default_Time_To_Live);
+
+		// Act:
+		auto socketInfo = pool.take(test::GenerateRandomByteArray<Key>());
+
+		// Assert:
+		EXPECT_FALSE(!!socketInfo);
+		EXPECT_EQ(0u, pool.numHits());
+		EXPECT_EQ(1u, pool.numMisses());
+	}
+
+	TEST(TEST_CLASS, GiveIgnoresEmptyInfo) {
+		// Arrange:
+		BriefConnectionPool pool(Default_Time_To_Live);
+
+		// Act:
+		pool.give(test::GenerateRandomByteArray<Key>(), ionet::PacketSocketInfo());
+
+		// Assert:
+		EXPECT_EQ(0u, pool.size());
+	}
+
+	TEST(TEST_CLASS, CanTakeGivenConnection) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(2);
+		auto socketInfo1 = CreateSocketInfo(keys[0]);
+		auto socketInfo2 = CreateSocketInfo(keys[1]);
+		BriefConnectionPool pool(Default_Time_To_Live);
+		pool.give(keys[0], socketInfo1.SocketInfo);
+		pool.give(keys[1], socketInfo2.SocketInfo);
+
+		// Act:
+		auto socketInfo = pool.take(keys[1]);
+
+		// Assert:
+		EXPECT_EQ(socketInfo2.pMockSocket, socketInfo.socket());
+		EXPECT_EQ(1u, pool.size());
+		EXPECT_EQ(1u, pool.numHits());
+		EXPECT_EQ(0u, pool.numMisses());
+		EXPECT_EQ(0u, socketInfo2.pMockSocket->numCloseCalls());
+	}
+
+	TEST(TEST_CLASS, CannotTakeConnectionMoreThanOnce) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		BriefConnectionPool pool(Default_Time_To_Live);
+		pool.give(key, CreateSocketInfo(key).SocketInfo);
+
+		// Act:
+		auto socketInfo1 = pool.take(key);
+		auto socketInfo2 = pool.take(key);
+
+		// Assert:
+		EXPECT_TRUE(!!socketInfo1);
+		EXPECT_FALSE(!!socketInfo2);
+		EXPECT_EQ(0u, pool.size());
+		EXPECT_EQ(1u, pool.numHits());
+		EXPECT_EQ(1u, pool.numMisses());
+	}
+
+	TEST(TEST_CLASS, GiveReplacesAndClosesPreviouslyPooledConnection) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		auto socketInfo1 = CreateSocketInfo(key);
+		auto socketInfo2 = CreateSocketInfo(key);
+		BriefConnectionPool pool(Default_Time_To_Live);
+		pool.give(key, socketInfo1.SocketInfo);
+
+		// Act:
+		pool.give(key, socketInfo2.SocketInfo);
+		auto socketInfo = pool.take(key);
+
+		// Assert:
+		EXPECT_EQ(socketInfo2.pMockSocket, socketInfo.socket());
+		EXPECT_EQ(1u, socketInfo1.pMockSocket->numCloseCalls());
+		EXPECT_EQ(0u, socketInfo2.pMockSocket->numCloseCalls());
+	}
+
+	TEST(TEST_CLASS, ExpiredConnectionsAreClosedAndCannotBeTaken) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(2);
+		auto socketInfo1 = CreateSocketInfo(keys[0]);
+		auto socketInfo2 = CreateSocketInfo(keys[1]);
+		BriefConnectionPool pool(utils::TimeSpan::FromMilliseconds(20));
+		pool.give(keys[0], socketInfo1.SocketInfo);
+		pool.give(keys[1], socketInfo2.SocketInfo);
+
+		// Act:
+		test::Sleep(50);
+		auto socketInfo = pool.take(keys[0]);
+
+		// Assert: all expired connections are closed
+		EXPECT_FALSE(!!socketInfo);
+		EXPECT_EQ(0u, pool.size());
+		EXPECT_EQ(1u, socketInfo1.pMockSocket->numCloseCalls());
+		EXPECT_EQ(1u, socketInfo2.pMockSocket->numCloseCalls());
+	}
+
+	// endregion
+
+	// region clear / destructor
+
+	TEST(TEST_CLASS, ClearClosesAllConnections) {
+		// Arrange:
+		auto keys = test::GenerateRandomDataVector<Key>(2);
+		auto socketInfo1 = CreateSocketInfo(keys[0]);
+		auto socketInfo2 = CreateSocketInfo(keys[1]);
+		BriefConnectionPool pool(Default_Time_To_Live);
+		pool.give(keys[0], socketInfo1.SocketInfo);
+		pool.give(keys[1], socketInfo2.SocketInfo);
+
+		// Act:
+		pool.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, pool.size());
+		EXPECT_EQ(1u, socketInfo1.pMockSocket->numCloseCalls());
+		EXPECT_EQ(1u, socketInfo2.pMockSocket->numCloseCalls());
+	}
+
+	TEST(TEST_CLASS, DestructorClosesAllConnections) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		auto socketInfo = CreateSocketInfo(key);
+		{
+			BriefConnectionPool pool(Default_Time_To_Live);
+			pool.give(key, socketInfo.SocketInfo);
+
+			// Sanity:
+			EXPECT_EQ(0u, socketInfo.pMockSocket->numCloseCalls());
+		}
+
+		// Assert:
+		EXPECT_EQ(1u, socketInfo.pMockSocket->numCloseCalls());
+	}
+
+	// endregion
+}}
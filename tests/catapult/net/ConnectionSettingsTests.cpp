@@ -19,6 +19,8 @@
 **/
 
 #include "catapult/net/ConnectionSettings.h"
+#include "catapult/ionet/SslSessionCache.h"
+#include "catapult/ionet/WorkingBufferPool.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace net {
@@ -35,10 +37,12 @@ namespace catapult { namespace net {
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(10), settings.Timeout);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(4), settings.SocketWorkingBufferSize);
 		EXPECT_EQ(0u, settings.SocketWorkingBufferSensitivity);
+		EXPECT_FALSE(!!settings.pSocketWorkingBufferPool);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(100), settings.MaxPacketDataSize);
 
 		EXPECT_TRUE(settings.AllowIncomingSelfConnections);
 		EXPECT_FALSE(settings.AllowOutgoingSelfConnections);
+		EXPECT_EQ(utils::TimeSpan::FromSeconds(0), settings.BriefConnectionReuseDuration);
 	}
 
 	TEST(TEST_CLASS, CanConvertToPacketSocketOptions) {
@@ -83,4 +87,28 @@ namespace catapult { namespace net {
 		EXPECT_TRUE(options.SslOptions.VerifyCallbackSupplier()(verifyContext));
 		EXPECT_EQ(0x0101u, callbackMask);
 	}
+
+	TEST(TEST_CLASS, CanConvertToPacketSocketOptions_SslSessionCache) {
+		// Arrange:
+		auto settings = ConnectionSettings();
+		settings.SslOptions.pSessionCache = std::make_shared<ionet::SslSessionCache>(10);
+
+		// Act:
+		auto options = settings.toSocketOptions();
+
+		// Assert: cache is shared
+		EXPECT_EQ(settings.SslOptions.pSessionCache, options.SslOptions.pSessionCache);
+	}
+
+	TEST(TEST_CLASS, CanConvertToPacketSocketOptions_WorkingBufferPool) {
+		// Arrange:
+		auto settings = ConnectionSettings();
+		settings.pSocketWorkingBufferPool = std::make_shared<ionet::WorkingBufferPool>(1024, 10 * 1024);
+
+		// Act:
+		auto options = settings.toSocketOptions();
+
+		// Assert: pool is shared
+		EXPECT_EQ(settings.pSocketWorkingBufferPool, options.pWorkingBufferPool);
+	}
 }}
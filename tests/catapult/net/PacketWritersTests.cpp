@@ -241,6 +241,21 @@ namespace catapult { namespace net {
 
 	// endregion
 
+	// region GetBroadcastLane
+
+	TEST(TEST_CLASS, GetBroadcastLaneReturnsHighLaneForBlocksAndFinalizationMessages) {
+		EXPECT_EQ(BroadcastLane::High, GetBroadcastLane(ionet::PacketType::Push_Block));
+		EXPECT_EQ(BroadcastLane::High, GetBroadcastLane(ionet::PacketType::Push_Finalization_Messages));
+	}
+
+	TEST(TEST_CLASS, GetBroadcastLaneReturnsNormalLaneForOtherPackets) {
+		EXPECT_EQ(BroadcastLane::Normal, GetBroadcastLane(ionet::PacketType::Push_Transactions));
+		EXPECT_EQ(BroadcastLane::Normal, GetBroadcastLane(ionet::PacketType::Push_Partial_Transactions));
+		EXPECT_EQ(BroadcastLane::Normal, GetBroadcastLane(ionet::PacketType::Undefined));
+	}
+
+	// endregion
+
 	// region connect failure
 
 	namespace {
@@ -256,6 +271,8 @@ namespace catapult { namespace net {
 
 		// Assert:
 		EXPECT_NUM_ACTIVE_WRITERS(0u, *pWriters);
+		EXPECT_EQ(0u, pWriters->numPendingBroadcasts(BroadcastLane::High));
+		EXPECT_EQ(0u, pWriters->numPendingBroadcasts(BroadcastLane::Normal));
 	}
 
 	TEST(TEST_CLASS, ConnectFailsOnConnectError) {
@@ -504,6 +521,40 @@ namespace catapult { namespace net {
 		EXPECT_NUM_ACTIVE_WRITERS(3u, *context.pWriters);
 	}
 
+	TEST(TEST_CLASS, CanBroadcastMultiplePacketsInDifferentLanesToAllPeers) {
+		// Arrange: establish multiple connections
+		constexpr auto Num_Connections = 3u;
+		PacketWritersTestContext context(Num_Connections);
+		auto state = SetupMultiConnectionTest(context);
+		MultiConnectionStateGuard stateGuard(*context.pWriters, state);
+
+		// Act: broadcast a normal priority packet followed by a high priority packet
+		auto buffer1 = test::GenerateRandomPacketBuffer(95);
+		auto buffer2 = test::GenerateRandomPacketBuffer(95);
+		reinterpret_cast<ionet::Packet&>(buffer2[0]).Type = ionet::PacketType::Push_Block;
+		context.pWriters->broadcast(test::BufferToPacketPayload(buffer1));
+		context.pWriters->broadcast(test::BufferToPacketPayload(buffer2));
+
+		// Assert: both packets were sent to all connected sockets (the first write is never preempted)
+		auto numReads = std::atomic<size_t>(0);
+		for (const auto& pSocket : state.ServerSockets) {
+			pSocket->read([&numReads, &pSocket, buffer1, buffer2](auto code, const auto* pPacket) {
+				EXPECT_EQ(ionet::SocketOperationCode::Success, code);
+				EXPECT_EQ(buffer1, test::CopyPacketToBuffer(*pPacket));
+				++numReads;
+
+				pSocket->read(HandleSocketReadInSendTests(numReads, buffer2));
+			});
+		}
+
+		WAIT_FOR_VALUE(2 * Num_Connections, numReads);
+
+		// - all connections are still open and all queues are drained
+		EXPECT_NUM_ACTIVE_WRITERS(Num_Connections, *context.pWriters);
+		EXPECT_EQ(0u, context.pWriters->numPendingBroadcasts(BroadcastLane::High));
+		EXPECT_EQ(0u, context.pWriters->numPendingBroadcasts(BroadcastLane::Normal));
+	}
+
 	// endregion
 
 	// region pickOne
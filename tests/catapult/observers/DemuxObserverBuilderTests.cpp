@@ -245,4 +245,87 @@ namespace catapult { namespace observers {
 	}
 
 	// endregion
+
+	// region profiling
+
+	namespace {
+		void AssertProfiledCalls(
+				const model::ExecutionProfiler& profiler,
+				const std::string& pluginName,
+				model::NotificationType type,
+				uint64_t expectedNumCalls) {
+			for (const auto& entry : profiler.entries()) {
+				if (pluginName == entry.PluginName && type == entry.Type) {
+					EXPECT_EQ(expectedNumCalls, entry.Statistics.NumCalls) << pluginName;
+					return;
+				}
+			}
+
+			EXPECT_EQ(0u, expectedNumCalls) << pluginName;
+		}
+	}
+
+	TEST(TEST_CLASS, ProfilerRecordsOnlyMatchingObserverCalls) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		model::ExecutionProfiler profiler(utils::TimeSpan::FromSeconds(1));
+		DemuxObserverBuilder builder(profiler);
+
+		cache::CatapultCache cache({});
+		auto cacheDelta = cache.createDelta();
+		auto context = test::CreateObserverContext(cacheDelta, Height(123), NotifyMode::Commit);
+
+		builder
+			.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+			.add(CreateBreadcrumbObserver<model::AccountAddressNotification>(breadcrumbs, "OMEGA"))
+			.add(CreateBreadcrumbObserver(breadcrumbs, "zEtA"));
+		auto pObserver = builder.build();
+
+		// Act:
+		auto notification = model::AccountPublicKeyNotification(Key());
+		test::ObserveNotification<model::Notification>(*pObserver, notification, context);
+		test::ObserveNotification<model::Notification>(*pObserver, notification, context);
+
+		// Assert: profiling does not change observer names or behavior
+		Breadcrumbs expectedNames{ "alpha", "OMEGA", "zEtA" };
+		EXPECT_EQ(expectedNames, pObserver->names());
+
+		Breadcrumbs expectedSelectedNames{ "alpha", "zEtA", "alpha", "zEtA" };
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+
+		// - only calls to matching observers are recorded
+		EXPECT_EQ(2u, profiler.entries().size());
+		EXPECT_EQ(4u, profiler.totals().NumCalls);
+		AssertProfiledCalls(profiler, "alpha", notification.Type, 2);
+		AssertProfiledCalls(profiler, "OMEGA", model::AccountAddressNotification::Notification_Type, 0);
+		AssertProfiledCalls(profiler, "zEtA", notification.Type, 2);
+	}
+
+	TEST(TEST_CLASS, ProfilerRecordsObserverCallsByNotificationType) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		model::ExecutionProfiler profiler(utils::TimeSpan::FromSeconds(1));
+		DemuxObserverBuilder builder(profiler);
+
+		cache::CatapultCache cache({});
+		auto cacheDelta = cache.createDelta();
+		auto context = test::CreateObserverContext(cacheDelta, Height(123), NotifyMode::Commit);
+
+		builder.add(CreateBreadcrumbObserver(breadcrumbs, "zEtA"));
+		auto pObserver = builder.build();
+
+		// Act:
+		auto notification1 = model::AccountPublicKeyNotification(Key());
+		auto notification2 = model::AccountAddressNotification(UnresolvedAddress());
+		test::ObserveNotification<model::Notification>(*pObserver, notification1, context);
+		test::ObserveNotification<model::Notification>(*pObserver, notification2, context);
+		test::ObserveNotification<model::Notification>(*pObserver, notification2, context);
+
+		// Assert:
+		EXPECT_EQ(2u, profiler.entries().size());
+		AssertProfiledCalls(profiler, "zEtA", notification1.Type, 1);
+		AssertProfiledCalls(profiler, "zEtA", notification2.Type, 2);
+	}
+
+	// endregion
 }}
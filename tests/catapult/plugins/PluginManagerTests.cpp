@@ -23,6 +23,7 @@
 #include "catapult/cache/CatapultCache.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/nodeps/NumericTestUtils.h"
 #include "tests/test/plugins/PluginManagerFactory.h"
@@ -511,6 +512,104 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region profiling
+
+	TEST(TEST_CLASS, ExecutionProfilerIsInitiallyDisabled) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+
+		// Act:
+		std::vector<utils::DiagnosticCounter> counters;
+		manager.addDiagnosticCounters(counters, manager.createCache());
+
+		// Assert:
+		EXPECT_FALSE(!!manager.executionProfiler());
+		EXPECT_TRUE(counters.empty());
+	}
+
+	TEST(TEST_CLASS, CanEnableExecutionProfiler) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+
+		// Act:
+		manager.enableExecutionProfiler(utils::TimeSpan::FromMilliseconds(250));
+
+		std::vector<utils::DiagnosticCounter> counters;
+		manager.addDiagnosticCounters(counters, manager.createCache());
+
+		// Assert:
+		auto pProfiler = manager.executionProfiler();
+		ASSERT_TRUE(!!pProfiler);
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(250), pProfiler->slowBlockThreshold());
+
+		ASSERT_EQ(3u, counters.size());
+		EXPECT_EQ("PROF CALLS", counters[0].id().name());
+		EXPECT_EQ("PROF MS", counters[1].id().name());
+		EXPECT_EQ("PROF SLOW BLK", counters[2].id().name());
+	}
+
+	TEST(TEST_CLASS, ValidatorsAndObserversAreProfiledWhenExecutionProfilerIsEnabled) {
+		// Arrange:
+		RunObserverTest([](auto& manager) {
+			manager.addStatelessValidatorHook([](auto& builder) {
+				builder.add(CreateNamedStatelessValidator("alpha"));
+				builder.add(CreateNamedStatelessValidator("beta"));
+			});
+			manager.enableExecutionProfiler(utils::TimeSpan::FromMilliseconds(250));
+
+			// Act:
+			auto pObserver = manager.createObserver();
+			auto pValidator = manager.createStatelessValidator();
+			auto notification = model::AccountPublicKeyNotification(test::GenerateRandomByteArray<Key>());
+			auto result = pValidator->validate(notification);
+
+			std::vector<utils::DiagnosticCounter> counters;
+			manager.addDiagnosticCounters(counters, manager.createCache());
+
+			// Assert: profiling does not change names
+			auto expectedNames = std::vector<std::string>{ "alpha", "beta", "gamma", "zeta", "omega" };
+			EXPECT_EQ(expectedNames, pObserver->names());
+
+			// - validation short circuits after first failure, so only alpha is called
+			EXPECT_EQ(validators::ValidationResult::Failure, result);
+
+			auto entries = manager.executionProfiler()->entries();
+			ASSERT_EQ(1u, entries.size());
+			EXPECT_EQ("alpha", entries[0].PluginName);
+			EXPECT_EQ(notification.Type, entries[0].Type);
+			EXPECT_EQ(1u, entries[0].Statistics.NumCalls);
+
+			ASSERT_EQ(3u, counters.size());
+			EXPECT_EQ(1u, counters[0].value());
+		});
+	}
+
+	// endregion
+
+	// region worker pool
+
+	TEST(TEST_CLASS, WorkerPoolIsInitiallyUnset) {
+		// Act:
+		auto manager = test::CreatePluginManager();
+
+		// Assert:
+		EXPECT_FALSE(!!manager.workerPool());
+	}
+
+	TEST(TEST_CLASS, CanSetWorkerPool) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		auto pPool = test::CreateStartedIoThreadPool(2);
+
+		// Act:
+		manager.setWorkerPool(*pPool);
+
+		// Assert:
+		EXPECT_EQ(pPool.get(), manager.workerPool());
+	}
+
+	// endregion
+
 	// region resolvers
 
 	namespace {
@@ -246,6 +246,34 @@ namespace catapult { namespace state {
 		});
 	}
 
+	HISTORY_VALUE_TEST(IsPrunableReturnsCorrectValue) {
+		// Arrange:
+		AccountHistory history;
+		history.add(Height(11), TTraits::ToValue(12));
+		history.add(Height(22), TTraits::ToValue(98));
+
+		// Act + Assert:
+		EXPECT_FALSE(history.isPrunable(Height(7)));
+		EXPECT_FALSE(history.isPrunable(Height(11)));
+		EXPECT_TRUE(history.isPrunable(Height(12)));
+		EXPECT_TRUE(history.isPrunable(Height(22)));
+		EXPECT_TRUE(history.isPrunable(Height(23)));
+	}
+
+	TEST(TEST_CLASS, IsPrunableReturnsTrueWhenAnyHistoryIsPrunable) {
+		// Arrange:
+		AccountHistory history;
+		history.add(Height(11), Amount(12));
+		history.add(Height(33), Key{ { 100 } });
+		history.add(Height(22), VotingPublicKeysTraits::ToValue(75));
+
+		// Act + Assert: only balance history is prunable at height 12
+		EXPECT_FALSE(history.isPrunable(Height(11)));
+		EXPECT_TRUE(history.isPrunable(Height(12)));
+		EXPECT_TRUE(history.isPrunable(Height(22)));
+		EXPECT_TRUE(history.isPrunable(Height(33)));
+	}
+
 	TEST(TEST_CLASS, CanPruneHeterogenousValues) {
 		// Arrange:
 		AccountHistory history;
@@ -238,4 +238,70 @@ namespace catapult { namespace state {
 	}
 
 	// endregion
+
+	// region size
+
+	TEST(TEST_CLASS, AccountStateComponentsHaveExpectedSizes) {
+		// Assert: inline balances and ring buffer indexes do not increase the size of account state
+		EXPECT_EQ(16u, sizeof(AccountImportanceSnapshots));
+		EXPECT_EQ(16u, sizeof(AccountActivityBuckets));
+		EXPECT_EQ(48u, sizeof(AccountBalances));
+		EXPECT_EQ(224u, sizeof(AccountState));
+	}
+
+	// endregion
+
+	// region GetAccountStateMemorySize
+
+	TEST(TEST_CLASS, GetAccountStateMemorySize_ReturnsStructSizeWhenNothingIsAllocated) {
+		// Arrange:
+		AccountState accountState(test::GenerateRandomAddress(), Height(123));
+
+		// Act + Assert:
+		EXPECT_EQ(sizeof(AccountState), GetAccountStateMemorySize(accountState));
+	}
+
+	TEST(TEST_CLASS, GetAccountStateMemorySize_DoesNotIncreaseForInlineBalances) {
+		// Arrange:
+		AccountState accountState(test::GenerateRandomAddress(), Height(123));
+
+		// Act:
+		accountState.Balances.credit(MosaicId(111), Amount(1));
+		accountState.Balances.credit(MosaicId(222), Amount(2));
+
+		// Assert:
+		EXPECT_EQ(sizeof(AccountState), GetAccountStateMemorySize(accountState));
+	}
+
+	TEST(TEST_CLASS, GetAccountStateMemorySize_IncludesAllocatedMemory) {
+		// Arrange:
+		AccountState accountState(test::GenerateRandomAddress(), Height(123));
+		accountState.Balances.credit(MosaicId(111), Amount(1));
+		accountState.Balances.credit(MosaicId(222), Amount(2));
+		accountState.Balances.credit(MosaicId(333), Amount(3));
+		accountState.ImportanceSnapshots.set(Importance(123), model::ImportanceHeight(1));
+		accountState.ActivityBuckets.update(model::ImportanceHeight(1), [](auto& bucket) {
+			bucket.BeneficiaryCount = 1;
+		});
+		accountState.SupplementalPublicKeys.linked().set(test::GenerateRandomByteArray<Key>());
+		accountState.SupplementalPublicKeys.voting().add({ { { 0x44 } }, FinalizationPoint(100), FinalizationPoint(149) });
+
+		// Act:
+		auto memorySize = GetAccountStateMemorySize(accountState);
+
+		// Assert:
+		auto expectedMinimumMemorySize = sizeof(AccountState)
+				+ sizeof(Key) + sizeof(model::PinnedVotingKey)
+				+ accountState.Balances.allocatedSize()
+				+ accountState.ImportanceSnapshots.allocatedSize()
+				+ accountState.ActivityBuckets.allocatedSize();
+		EXPECT_LT(expectedMinimumMemorySize, memorySize);
+
+		// Sanity:
+		EXPECT_NE(0u, accountState.Balances.allocatedSize());
+		EXPECT_NE(0u, accountState.ImportanceSnapshots.allocatedSize());
+		EXPECT_NE(0u, accountState.ActivityBuckets.allocatedSize());
+	}
+
+	// endregion
 }}
@@ -288,6 +288,20 @@ namespace catapult { namespace state {
 		AssertHistoricalValues(stack, { { std::make_pair(332, 888), std::make_pair(111, 789), std::make_pair(222, 444) } });
 	}
 
+	TEST(TEST_CLASS, PushingMoreThanMaxValuesRollsOverMultipleTimes) {
+		// Arrange:
+		ValuePairStack stack;
+
+		// Act: wrap around the underlying storage more than once
+		for (auto i = 1u; i <= 8; ++i)
+			stack.push({ i, i * 10 });
+
+		// Assert:
+		EXPECT_EQ(3u, stack.size());
+		EXPECT_EQ(8u, stack.peek().Value1);
+		AssertHistoricalValues(stack, { { std::make_pair(8, 80), std::make_pair(7, 70), std::make_pair(6, 60) } });
+	}
+
 	// endregion
 
 	// region pop
@@ -352,6 +366,59 @@ namespace catapult { namespace state {
 		EXPECT_THROW(stack.pop(), catapult_out_of_range);
 	}
 
+	TEST(TEST_CLASS, CanPopAfterRollOver) {
+		// Arrange:
+		ValuePairStack stack;
+		for (auto i = 1u; i <= 5; ++i)
+			stack.push({ i, i * 10 });
+
+		// Act:
+		stack.pop();
+		stack.pop();
+		stack.push({ 9, 90 });
+
+		// Assert:
+		EXPECT_EQ(2u, stack.size());
+		AssertHistoricalValues(stack, { { std::make_pair(9, 90), std::make_pair(3, 30), std::make_pair(0, 0) } });
+	}
+
+	// endregion
+
+	// region allocatedSize
+
+	TEST(TEST_CLASS, AllocatedSizeIsZeroWhenEmpty) {
+		// Act:
+		ValuePairStack stack;
+
+		// Assert:
+		EXPECT_EQ(0u, stack.allocatedSize());
+	}
+
+	TEST(TEST_CLASS, AllocatedSizeIncludesFullArrayWhenNotEmpty) {
+		// Arrange:
+		ValuePairStack stack;
+
+		// Act:
+		stack.push({ 123, 234 });
+
+		// Assert:
+		EXPECT_EQ(3 * sizeof(ValuePair), stack.allocatedSize());
+	}
+
+	TEST(TEST_CLASS, AllocatedSizeIsZeroAfterPoppingAllValues) {
+		// Arrange:
+		ValuePairStack stack;
+		stack.push({ 123, 234 });
+		stack.push({ 222, 444 });
+
+		// Act:
+		stack.pop();
+		stack.pop();
+
+		// Assert:
+		EXPECT_EQ(0u, stack.allocatedSize());
+	}
+
 	// endregion
 
 	// region iterators
@@ -135,6 +135,7 @@ namespace catapult { namespace state {
 		void AssertContents(CompactMosaicMap& map, MosaicId optimizedMosaicId, const MosaicMap& expectedMosaics) {
 			// Assert:
 			EXPECT_FALSE(map.empty());
+			EXPECT_EQ(optimizedMosaicId, map.optimizedMosaicId());
 
 			// - check that all mosaics are accessible via find
 			AssertContents(expectedMosaics, utils::as_const(map), "via find (const)");
@@ -192,7 +193,7 @@ namespace catapult { namespace state {
 		});
 	}
 
-	TEST(TEST_CLASS, CanInsertMultipleMosaics_ValueAndPartialArray) {
+	TEST(TEST_CLASS, CanInsertMultipleMosaics_Values) {
 		// Arrange:
 		CompactMosaicMap map;
 
@@ -206,12 +207,27 @@ namespace catapult { namespace state {
 		});
 	}
 
-	TEST(TEST_CLASS, CanInsertMultipleMosaics_ValueAndFullArray) {
+	TEST(TEST_CLASS, CanInsertMultipleMosaics_ValuesAndPartialArray) {
 		// Arrange:
 		CompactMosaicMap map;
 
 		// Act:
-		InsertMany(map, 6);
+		InsertMany(map, 3);
+
+		// Assert:
+		AssertContents(map, {
+			{ MosaicId(1), Amount(1) },
+			{ MosaicId(102), Amount(4) },
+			{ MosaicId(3), Amount(9) }
+		});
+	}
+
+	TEST(TEST_CLASS, CanInsertMultipleMosaics_ValuesAndFullArray) {
+		// Arrange:
+		CompactMosaicMap map;
+
+		// Act:
+		InsertMany(map, 7);
 
 		// Assert:
 		AssertContents(map, {
@@ -220,16 +236,17 @@ namespace catapult { namespace state {
 			{ MosaicId(3), Amount(9) },
 			{ MosaicId(104), Amount(16) },
 			{ MosaicId(5), Amount(25) },
-			{ MosaicId(106), Amount(36) }
+			{ MosaicId(106), Amount(36) },
+			{ MosaicId(7), Amount(49) }
 		});
 	}
 
-	TEST(TEST_CLASS, CanInsertMultipleMosaics_ValueAndFullArrayAndMap) {
+	TEST(TEST_CLASS, CanInsertMultipleMosaics_ValuesAndFullArrayAndMap) {
 		// Arrange:
 		CompactMosaicMap map;
 
 		// Act:
-		InsertMany(map, 7);
+		InsertMany(map, 8);
 
 		// Assert:
 		AssertContents(map, {
@@ -239,10 +256,31 @@ namespace catapult { namespace state {
 			{ MosaicId(104), Amount(16) },
 			{ MosaicId(5), Amount(25) },
 			{ MosaicId(106), Amount(36) },
-			{ MosaicId(7), Amount(49) }
+			{ MosaicId(7), Amount(49) },
+			{ MosaicId(108), Amount(64) }
 		});
 	}
 
+	TEST(TEST_CLASS, CanInsertMosaicWithSmallerValueIntoFullValues) {
+		// Arrange:
+		CompactMosaicMap map;
+		map.insert(std::make_pair(MosaicId(100), Amount(333)));
+		map.insert(std::make_pair(MosaicId(123), Amount(245)));
+
+		// Act: new smallest mosaic shifts both inline values
+		map.insert(std::make_pair(MosaicId(50), Amount(111)));
+
+		// Assert:
+		AssertContents(map, {
+			{ MosaicId(50), Amount(111) },
+			{ MosaicId(100), Amount(333) },
+			{ MosaicId(123), Amount(245) }
+		});
+
+		// Sanity:
+		EXPECT_EQ(MosaicId(50), map.begin()->first);
+	}
+
 	TEST(TEST_CLASS, CanInsertMultipleMosaics_Many) {
 		// Arrange:
 		CompactMosaicMap map;
@@ -305,7 +343,7 @@ namespace catapult { namespace state {
 	// region insert + optimize
 
 	namespace {
-		MosaicMap GetSevenExpectedMosaicsForOptimizeTests() {
+		MosaicMap GetEightExpectedMosaicsForOptimizeTests() {
 			return {
 				{ MosaicId(29), Amount(876) },
 				{ MosaicId(85), Amount(111) },
@@ -313,13 +351,15 @@ namespace catapult { namespace state {
 				{ MosaicId(101), Amount(10) },
 				{ MosaicId(102), Amount(20) },
 				{ MosaicId(104), Amount(40) },
-				{ MosaicId(303), Amount(30) }
+				{ MosaicId(303), Amount(30) },
+				{ MosaicId(405), Amount(50) }
 			};
 		}
 
-		void InsertSevenForOptimizeTests(CompactMosaicMap& map) {
+		void InsertEightForOptimizeTests(CompactMosaicMap& map) {
 			map.insert(std::make_pair(MosaicId(100), Amount(333)));
 			map.insert(std::make_pair(MosaicId(29), Amount(876)));
+			map.insert(std::make_pair(MosaicId(405), Amount(50)));
 			map.insert(std::make_pair(MosaicId(85), Amount(111)));
 			map.insert(std::make_pair(MosaicId(104), Amount(40)));
 			map.insert(std::make_pair(MosaicId(303), Amount(30)));
@@ -334,17 +374,17 @@ namespace catapult { namespace state {
 		map.optimize(MosaicId(85));
 
 		// Act: insert after optimize
-		InsertSevenForOptimizeTests(map);
+		InsertEightForOptimizeTests(map);
 
 		// Assert: optimized mosaic id should be treated as smallest value
-		AssertContents(map, MosaicId(85), GetSevenExpectedMosaicsForOptimizeTests());
+		AssertContents(map, MosaicId(85), GetEightExpectedMosaicsForOptimizeTests());
 	}
 
 	namespace {
 		void AssertCanInsertAndThenOptimize(MosaicId optimizedMosaicId) {
 			// Arrange:
 			CompactMosaicMap map;
-			InsertSevenForOptimizeTests(map);
+			InsertEightForOptimizeTests(map);
 
 			// Sanity:
 			EXPECT_EQ(MosaicId(29), map.begin()->first);
@@ -353,19 +393,23 @@ namespace catapult { namespace state {
 			map.optimize(optimizedMosaicId);
 
 			// Assert: optimized mosaic id should be treated as smallest value
-			AssertContents(map, optimizedMosaicId, GetSevenExpectedMosaicsForOptimizeTests());
+			AssertContents(map, optimizedMosaicId, GetEightExpectedMosaicsForOptimizeTests());
 
 			// Sanity:
 			EXPECT_EQ(optimizedMosaicId, map.begin()->first);
 		}
 	}
 
+	TEST(TEST_CLASS, CanInsertAndThenOptimizeMosaicFromValues) {
+		AssertCanInsertAndThenOptimize(MosaicId(85));
+	}
+
 	TEST(TEST_CLASS, CanInsertAndThenOptimizeMosaicFromArray) {
 		AssertCanInsertAndThenOptimize(MosaicId(101));
 	}
 
 	TEST(TEST_CLASS, CanInsertAndThenOptimizeMosaicFromMap) {
-		AssertCanInsertAndThenOptimize(MosaicId(303));
+		AssertCanInsertAndThenOptimize(MosaicId(405));
 	}
 
 	TEST(TEST_CLASS, CanReoptimizeWithSameMosaic) {
@@ -375,12 +419,12 @@ namespace catapult { namespace state {
 		// Act: optimize, insert, optimize (note that optimize must be called with same id)
 		map.optimize(MosaicId(85));
 		map.optimize(MosaicId(85));
-		InsertSevenForOptimizeTests(map);
+		InsertEightForOptimizeTests(map);
 		map.optimize(MosaicId(85));
 		map.optimize(MosaicId(85));
 
 		// Assert: optimized mosaic id should be treated as smallest value
-		AssertContents(map, MosaicId(85), GetSevenExpectedMosaicsForOptimizeTests());
+		AssertContents(map, MosaicId(85), GetEightExpectedMosaicsForOptimizeTests());
 	}
 
 	TEST(TEST_CLASS, CanDeoptimizeWhenUnoptimized) {
@@ -390,16 +434,16 @@ namespace catapult { namespace state {
 		// Act: first optimize is noop
 		map.optimize(MosaicId(0));
 		map.optimize(MosaicId(85));
-		InsertSevenForOptimizeTests(map);
+		InsertEightForOptimizeTests(map);
 
 		// Assert: optimized mosaic id should be treated as smallest value
-		AssertContents(map, MosaicId(85), GetSevenExpectedMosaicsForOptimizeTests());
+		AssertContents(map, MosaicId(85), GetEightExpectedMosaicsForOptimizeTests());
 	}
 
 	TEST(TEST_CLASS, CanReoptimizeWithDifferentMosaic) {
 		// Arrange: insert and optimize
 		CompactMosaicMap map;
-		InsertSevenForOptimizeTests(map);
+		InsertEightForOptimizeTests(map);
 		map.optimize(MosaicId(102));
 
 		// Sanity:
@@ -409,7 +453,7 @@ namespace catapult { namespace state {
 		map.optimize(MosaicId(85));
 
 		// Assert: optimized mosaic id should be treated as smallest value
-		AssertContents(map, MosaicId(85), GetSevenExpectedMosaicsForOptimizeTests());
+		AssertContents(map, MosaicId(85), GetEightExpectedMosaicsForOptimizeTests());
 
 		// Sanity:
 		EXPECT_EQ(MosaicId(85), map.begin()->first);
@@ -418,7 +462,7 @@ namespace catapult { namespace state {
 	TEST(TEST_CLASS, CanDeoptimizeWhenOptimized) {
 		// Arrange: insert and optimize
 		CompactMosaicMap map;
-		InsertSevenForOptimizeTests(map);
+		InsertEightForOptimizeTests(map);
 		map.optimize(MosaicId(102));
 
 		// Sanity:
@@ -428,7 +472,7 @@ namespace catapult { namespace state {
 		map.optimize(MosaicId(0));
 
 		// Assert:
-		AssertContents(map, GetSevenExpectedMosaicsForOptimizeTests());
+		AssertContents(map, GetEightExpectedMosaicsForOptimizeTests());
 
 		// Sanity:
 		EXPECT_EQ(MosaicId(29), map.begin()->first);
@@ -455,7 +499,7 @@ namespace catapult { namespace state {
 		});
 	}
 
-	TEST(TEST_CLASS, CanEraseMosaic_Array) {
+	TEST(TEST_CLASS, CanEraseMosaic_SecondValue) {
 		// Arrange:
 		CompactMosaicMap map;
 		InsertMany(map, 5);
@@ -472,6 +516,44 @@ namespace catapult { namespace state {
 		});
 	}
 
+	TEST(TEST_CLASS, CanEraseMosaic_Array) {
+		// Arrange:
+		CompactMosaicMap map;
+		InsertMany(map, 5);
+
+		// Act:
+		map.erase(MosaicId(102));
+
+		// Assert:
+		AssertContents(map, {
+			{ MosaicId(1), Amount(1) },
+			{ MosaicId(3), Amount(9) },
+			{ MosaicId(104), Amount(16) },
+			{ MosaicId(5), Amount(25) }
+		});
+	}
+
+	TEST(TEST_CLASS, CanEraseMosaic_Map) {
+		// Arrange:
+		CompactMosaicMap map;
+		InsertMany(map, 9);
+
+		// Act:
+		map.erase(MosaicId(108));
+
+		// Assert:
+		AssertContents(map, {
+			{ MosaicId(1), Amount(1) },
+			{ MosaicId(102), Amount(4) },
+			{ MosaicId(3), Amount(9) },
+			{ MosaicId(104), Amount(16) },
+			{ MosaicId(5), Amount(25) },
+			{ MosaicId(106), Amount(36) },
+			{ MosaicId(7), Amount(49) },
+			{ MosaicId(9), Amount(81) }
+		});
+	}
+
 	TEST(TEST_CLASS, CanEraseMultipleMosaics_Odd) {
 		// Arrange:
 		CompactMosaicMap map;
@@ -752,4 +834,71 @@ namespace catapult { namespace state {
 	}
 
 	// endregion
+
+	// region allocatedSize
+
+	TEST(TEST_CLASS, AllocatedSizeIsZeroWhenEmpty) {
+		// Act:
+		CompactMosaicMap map;
+
+		// Assert:
+		EXPECT_EQ(0u, map.allocatedSize());
+	}
+
+	TEST(TEST_CLASS, AllocatedSizeIsZeroWhenAllMosaicsAreInline) {
+		// Arrange:
+		CompactMosaicMap map;
+
+		// Act:
+		InsertMany(map, 2);
+
+		// Assert:
+		EXPECT_EQ(0u, map.allocatedSize());
+	}
+
+	TEST(TEST_CLASS, AllocatedSizeIsConstantWhenMosaicsFitInArray) {
+		// Arrange:
+		CompactMosaicMap map1;
+		CompactMosaicMap map2;
+
+		// Act:
+		InsertMany(map1, 3);
+		InsertMany(map2, 7);
+
+		// Assert:
+		EXPECT_LT(0u, map1.allocatedSize());
+		EXPECT_EQ(map1.allocatedSize(), map2.allocatedSize());
+	}
+
+	TEST(TEST_CLASS, AllocatedSizeGrowsWithMapSize) {
+		// Arrange:
+		CompactMosaicMap map1;
+		CompactMosaicMap map2;
+		CompactMosaicMap map3;
+
+		// Act:
+		InsertMany(map1, 7);
+		InsertMany(map2, 8);
+		InsertMany(map3, 9);
+
+		// Assert:
+		EXPECT_LT(map1.allocatedSize(), map2.allocatedSize());
+		EXPECT_EQ(map2.allocatedSize() - map1.allocatedSize(), map3.allocatedSize() - map2.allocatedSize());
+	}
+
+	TEST(TEST_CLASS, AllocatedSizeIsZeroAfterErasingAllButInlineMosaics) {
+		// Arrange:
+		CompactMosaicMap map;
+		InsertMany(map, 10);
+
+		// Act:
+		for (auto i = 3u; i <= 10; ++i)
+			map.erase(GetMosaicId(i));
+
+		// Assert:
+		EXPECT_EQ(2u, map.size());
+		EXPECT_EQ(0u, map.allocatedSize());
+	}
+
+	// endregion
 }}
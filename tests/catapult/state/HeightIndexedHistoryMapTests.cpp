@@ -370,5 +370,50 @@ namespace catapult { namespace state {
 		});
 	}
 
+	TEST(TEST_CLASS, IsPrunableReturnsFalseWhenHistoryIsEmpty) {
+		// Arrange:
+		HistoryMap history;
+
+		// Act + Assert:
+		EXPECT_FALSE(history.isPrunable(Height(1)));
+		EXPECT_FALSE(history.isPrunable(Height(22)));
+	}
+
+	TEST(TEST_CLASS, IsPrunableReturnsFalseWhenPruneHasNoEffect) {
+		// Arrange:
+		HistoryMap history;
+		history.add(Height(11), Timestamp(12));
+		history.add(Height(22), Timestamp(98));
+		history.add(Height(33), Timestamp(67));
+
+		// Act + Assert:
+		EXPECT_FALSE(history.isPrunable(Height(7)));
+		EXPECT_FALSE(history.isPrunable(Height(11)));
+	}
+
+	TEST(TEST_CLASS, IsPrunableReturnsTrueWhenPruneHasEffect) {
+		// Arrange:
+		HistoryMap history;
+		history.add(Height(11), Timestamp(12));
+		history.add(Height(22), Timestamp(98));
+		history.add(Height(33), Timestamp(67));
+
+		// Act + Assert:
+		EXPECT_TRUE(history.isPrunable(Height(12)));
+		EXPECT_TRUE(history.isPrunable(Height(22)));
+		EXPECT_TRUE(history.isPrunable(Height(23)));
+		EXPECT_TRUE(history.isPrunable(Height(98)));
+	}
+
+	TEST(TEST_CLASS, IsPrunableReturnsFalseWhenSingleValueIsAtPruneHeight) {
+		// Arrange:
+		HistoryMap history;
+		history.add(Height(33), Timestamp(67));
+
+		// Act + Assert:
+		EXPECT_FALSE(history.isPrunable(Height(33)));
+		EXPECT_TRUE(history.isPrunable(Height(34)));
+	}
+
 	// endregion
 }}
@@ -101,4 +101,32 @@ namespace catapult { namespace subscribers {
 			EXPECT_EQ(&stateChangeInfo, pSubscriber->StateChangeInfos[0]) << message;
 		}
 	}
+
+	TEST(TEST_CLASS, FlushForwardsToAllSubscribers) {
+		// Arrange:
+		class MockStateChangeSubscriber : public UnsupportedStateChangeSubscriber {
+		public:
+			size_t NumFlushes = 0;
+
+		public:
+			void flush() override {
+				++NumFlushes;
+			}
+		};
+
+		TestContext<MockStateChangeSubscriber> context;
+
+		// Sanity:
+		EXPECT_EQ(3u, context.subscribers().size());
+
+		// Act:
+		context.aggregate().flush();
+
+		// Assert:
+		auto i = 0u;
+		for (const auto* pSubscriber : context.subscribers()) {
+			auto message = "subscriber at " + std::to_string(i++);
+			EXPECT_EQ(1u, pSubscriber->NumFlushes) << message;
+		}
+	}
 }}
@@ -60,6 +60,30 @@ namespace catapult { namespace subscribers {
 		}
 	}
 
+	TEST(TEST_CLASS, NotifySharedStatusForwardsToAllSubscribers) {
+		// Arrange:
+		TestContext<mocks::MockTransactionStatusSubscriber> context;
+		std::shared_ptr<const model::Transaction> pTransaction = test::GenerateRandomTransaction();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Sanity:
+		EXPECT_EQ(3u, context.subscribers().size());
+
+		// Act:
+		context.aggregate().notifySharedStatus(pTransaction, hash, 123);
+
+		// Assert:
+		auto i = 0u;
+		for (const auto* pSubscriber : context.subscribers()) {
+			auto message = "subscriber at " + std::to_string(i++);
+			const auto& capturedParams = pSubscriber->params();
+			ASSERT_EQ(1u, capturedParams.size()) << message;
+			EXPECT_EQ(pTransaction.get(), &capturedParams[0].Transaction) << message;
+			EXPECT_EQ(hash, capturedParams[0].Hash) << message;
+			EXPECT_EQ(123u, capturedParams[0].Status) << message;
+		}
+	}
+
 	TEST(TEST_CLASS, FlushForwardsToAllSubscribers) {
 		// Arrange:
 		TestContext<mocks::MockTransactionStatusSubscriber> context;
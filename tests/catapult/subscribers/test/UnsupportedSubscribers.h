@@ -38,6 +38,10 @@ namespace catapult { namespace test {
 		void notifyDropBlocksAfter(Height) override {
 			CATAPULT_THROW_RUNTIME_ERROR("notifyDropBlocksAfter - not supported in mock");
 		}
+
+		void flush() override {
+			CATAPULT_THROW_RUNTIME_ERROR("flush - not supported in mock");
+		}
 	};
 
 	/// Unsupported finalization subscriber.
@@ -74,6 +78,10 @@ namespace catapult { namespace test {
 		void notifyStateChange(const subscribers::StateChangeInfo&) override {
 			CATAPULT_THROW_RUNTIME_ERROR("notifyStateChange - not supported in mock");
 		}
+
+		void flush() override {
+			CATAPULT_THROW_RUNTIME_ERROR("flush - not supported in mock");
+		}
 	};
 
 	/// Unsupported transaction status subscriber.
@@ -0,0 +1,162 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/LatencyHistogram.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS LatencyHistogramTests
+
+	// region bucket mapping
+
+	TEST(TEST_CLASS, SmallValuesHaveDedicatedBuckets) {
+		for (auto i = 0u; i < LatencyHistogram::Num_Sub_Buckets; ++i) {
+			EXPECT_EQ(i, LatencyHistogram::BucketIndex(i)) << i;
+			EXPECT_EQ(i, LatencyHistogram::BucketLowerBound(i)) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, LargerValuesAreMappedToLinearSubBuckets) {
+		// Assert: [4, 8) has bucket size 1, [8, 16) has bucket size 2, [16, 32) has bucket size 4
+		EXPECT_EQ(4u, LatencyHistogram::BucketIndex(4));
+		EXPECT_EQ(7u, LatencyHistogram::BucketIndex(7));
+		EXPECT_EQ(8u, LatencyHistogram::BucketIndex(8));
+		EXPECT_EQ(8u, LatencyHistogram::BucketIndex(9));
+		EXPECT_EQ(9u, LatencyHistogram::BucketIndex(10));
+		EXPECT_EQ(11u, LatencyHistogram::BucketIndex(15));
+		EXPECT_EQ(12u, LatencyHistogram::BucketIndex(16));
+		EXPECT_EQ(12u, LatencyHistogram::BucketIndex(19));
+		EXPECT_EQ(13u, LatencyHistogram::BucketIndex(20));
+	}
+
+	TEST(TEST_CLASS, BucketLowerBoundIsInverseOfBucketIndex) {
+		for (auto i = 0u; i < LatencyHistogram::Num_Buckets; ++i) {
+			auto lowerBound = LatencyHistogram::BucketLowerBound(i);
+			if (lowerBound > LatencyHistogram::Max_Value)
+				break;
+
+			EXPECT_EQ(i, LatencyHistogram::BucketIndex(lowerBound)) << i;
+			if (0 < lowerBound)
+				EXPECT_EQ(i - 1, LatencyHistogram::BucketIndex(lowerBound - 1)) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, ValuesAboveMaxValueAreClamped) {
+		auto maxIndex = LatencyHistogram::BucketIndex(LatencyHistogram::Max_Value);
+		EXPECT_GT(LatencyHistogram::Num_Buckets, maxIndex);
+		EXPECT_EQ(maxIndex, LatencyHistogram::BucketIndex(LatencyHistogram::Max_Value + 1));
+		EXPECT_EQ(maxIndex, LatencyHistogram::BucketIndex(std::numeric_limits<uint64_t>::max()));
+	}
+
+	// endregion
+
+	// region add / merge
+
+	TEST(TEST_CLASS, HistogramIsInitiallyEmpty) {
+		// Act:
+		LatencyHistogram histogram;
+
+		// Assert:
+		EXPECT_EQ(0u, histogram.count());
+		EXPECT_EQ(0u, histogram.sum());
+		EXPECT_EQ(0u, histogram.max());
+		EXPECT_EQ(0u, histogram.valueAtPercentile(50));
+	}
+
+	TEST(TEST_CLASS, CanAddValues) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		for (auto value : { 3u, 100u, 17u, 5u })
+			histogram.add(value);
+
+		// Assert:
+		EXPECT_EQ(4u, histogram.count());
+		EXPECT_EQ(125u, histogram.sum());
+		EXPECT_EQ(100u, histogram.max());
+	}
+
+	TEST(TEST_CLASS, CanMergeHistograms) {
+		// Arrange:
+		LatencyHistogram histogram1;
+		LatencyHistogram histogram2;
+		for (auto value : { 3u, 100u })
+			histogram1.add(value);
+
+		for (auto value : { 17u, 5u, 250u })
+			histogram2.add(value);
+
+		// Act:
+		histogram1.merge(histogram2);
+
+		// Assert:
+		EXPECT_EQ(5u, histogram1.count());
+		EXPECT_EQ(375u, histogram1.sum());
+		EXPECT_EQ(250u, histogram1.max());
+		EXPECT_EQ(250u, histogram1.valueAtPercentile(100));
+	}
+
+	// endregion
+
+	// region valueAtPercentile
+
+	TEST(TEST_CLASS, ValueAtPercentileReturnsExactValuesForSmallValues) {
+		// Arrange:
+		LatencyHistogram histogram;
+		for (auto value : { 0u, 1u, 2u, 3u })
+			histogram.add(value);
+
+		// Act + Assert:
+		EXPECT_EQ(0u, histogram.valueAtPercentile(0));
+		EXPECT_EQ(0u, histogram.valueAtPercentile(25));
+		EXPECT_EQ(1u, histogram.valueAtPercentile(50));
+		EXPECT_EQ(2u, histogram.valueAtPercentile(75));
+		EXPECT_EQ(3u, histogram.valueAtPercentile(100));
+	}
+
+	TEST(TEST_CLASS, ValueAtPercentileReturnsBucketUpperBoundForLargeValues) {
+		// Arrange: 1000 is in bucket [896, 1023]
+		LatencyHistogram histogram;
+		for (auto i = 0u; i < 99; ++i)
+			histogram.add(10);
+
+		histogram.add(1000);
+		histogram.add(1000);
+
+		// Act + Assert:
+		EXPECT_EQ(11u, histogram.valueAtPercentile(50));
+		EXPECT_EQ(1000u, histogram.valueAtPercentile(99)); // capped at max
+		EXPECT_EQ(1000u, histogram.valueAtPercentile(100));
+	}
+
+	TEST(TEST_CLASS, ValueAtPercentileIsBoundedByMax) {
+		// Arrange:
+		LatencyHistogram histogram;
+		histogram.add(9);
+
+		// Act + Assert: bucket upper bound is 9, which is equal to max
+		EXPECT_EQ(9u, histogram.valueAtPercentile(50));
+		EXPECT_EQ(9u, histogram.valueAtPercentile(150));
+	}
+
+	// endregion
+}}
@@ -54,6 +54,21 @@ namespace catapult { namespace utils {
 		EXPECT_LE(elapsedMillis1, elapsedMillis2);
 	}
 
+	TEST(TEST_CLASS, ElapsedMicrosIncreasesOverTime) {
+		// Arrange:
+		StackTimer stackTimer;
+
+		// Act:
+		test::Sleep(5);
+		auto elapsedMicros1 = stackTimer.micros();
+		test::Sleep(10);
+		auto elapsedMicros2 = stackTimer.micros();
+
+		// Assert:
+		EXPECT_LE(5'000u, elapsedMicros1);
+		EXPECT_LE(elapsedMicros1, elapsedMicros2);
+	}
+
 	namespace {
 		constexpr auto Sleep_Millis = 5u;
 		constexpr auto Epsilon_Millis = 1u;
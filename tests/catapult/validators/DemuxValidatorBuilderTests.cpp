@@ -250,4 +250,49 @@ namespace catapult { namespace validators {
 	}
 
 	// endregion
+
+	// region profiling
+
+	TEST(TEST_CLASS, ProfilerRecordsOnlyMatchingValidatorCalls) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		model::ExecutionProfiler profiler(utils::TimeSpan::FromSeconds(1));
+		stateful::DemuxValidatorBuilder builder(profiler);
+
+		auto cache = test::CreateEmptyCatapultCache();
+
+		builder
+			.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+			.add(CreateBreadcrumbValidator<model::AccountAddressNotification>(breadcrumbs, "OMEGA"))
+			.add(CreateBreadcrumbValidator(breadcrumbs, "zEtA"));
+		auto pValidator = builder.build([](auto) { return false; });
+
+		// Act:
+		auto notification = model::AccountPublicKeyNotification(Key());
+		auto result = test::ValidateNotification<model::Notification>(*pValidator, notification, cache);
+
+		// Assert: profiling does not change validator names or behavior
+		EXPECT_EQ(ValidationResult::Success, result);
+
+		Breadcrumbs expectedNames{ "alpha", "OMEGA", "zEtA" };
+		EXPECT_EQ(expectedNames, pValidator->names());
+
+		Breadcrumbs expectedSelectedNames{ "alpha", "zEtA" };
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+
+		// - only calls to matching validators are recorded
+		auto entries = profiler.entries();
+		ASSERT_EQ(2u, entries.size());
+
+		std::set<std::string> profiledNames;
+		for (const auto& entry : entries) {
+			profiledNames.insert(entry.PluginName);
+			EXPECT_EQ(notification.Type, entry.Type) << entry.PluginName;
+			EXPECT_EQ(1u, entry.Statistics.NumCalls) << entry.PluginName;
+		}
+
+		EXPECT_EQ(std::set<std::string>({ "alpha", "zEtA" }), profiledNames);
+	}
+
+	// endregion
 }}
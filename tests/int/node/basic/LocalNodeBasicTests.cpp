@@ -73,6 +73,10 @@ namespace catapult { namespace local {
 		EXPECT_TRUE(test::HasCounter(counters, "UNLKED ACCTS")) << "peer local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "TOT CONF TXES")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "STATE SPOOL")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "CACHE R WAIT")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "CACHE W WAIT")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "CACHE W MAX")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "MEM CUR RSS")) << "memory counters";
 		EXPECT_TRUE(test::HasCounter(counters, "NODES")) << "node container counters";
 		EXPECT_TRUE(test::HasCounter(counters, "BAN ACT")) << "banned nodes container counters";
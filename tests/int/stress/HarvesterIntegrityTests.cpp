@@ -31,6 +31,7 @@
 #include "catapult/observers/NotificationObserverAdapter.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/local/LocalTestUtils.h"
 #include "tests/test/local/RealTransactionFactory.h"
 #include "tests/test/nodeps/Filesystem.h"
@@ -89,14 +90,22 @@ namespace catapult { namespace harvesting {
 					, m_config(test::CreatePrototypicalCatapultConfiguration(CreateConfiguration(), ""))
 					, m_transactionsCache(cache::MemoryCacheOptions(1024, GetNumIterations() * 2))
 					, m_cache(CreateCatapultCache(m_dbDirGuard.name()))
-					, m_unlockedAccounts(100, [](const auto&) { return 0; }) {
+					, m_unlockedAccounts(100, [](const auto&) { return 0; })
+					, m_pPool(test::CreateStartedIoThreadPool())
+					, m_hitTable(m_config.BlockChain, *m_pPool) {
 				// create the harvester
 				auto executionConfig = extensions::CreateExecutionConfiguration(*m_pPluginManager);
 				HarvestingUtFacadeFactory utFacadeFactory(m_cache, CreateConfiguration(), executionConfig);
 
 				auto strategy = model::TransactionSelectionStrategy::Oldest;
 				auto blockGenerator = CreateHarvesterBlockGenerator(strategy, utFacadeFactory, m_transactionsCache);
-				m_pHarvester = std::make_unique<Harvester>(m_cache, m_config.BlockChain, Address(), m_unlockedAccounts, blockGenerator);
+				m_pHarvester = std::make_unique<Harvester>(
+						m_cache,
+						m_config.BlockChain,
+						Address(),
+						m_unlockedAccounts,
+						m_hitTable,
+						blockGenerator);
 			}
 
 		public:
@@ -190,6 +199,8 @@ namespace catapult { namespace harvesting {
 			cache::MemoryUtCache m_transactionsCache;
 			cache::CatapultCache m_cache;
 			UnlockedAccounts m_unlockedAccounts;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			HarvesterHitTable m_hitTable;
 			std::unique_ptr<Harvester> m_pHarvester;
 		};
 
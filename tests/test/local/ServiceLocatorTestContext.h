@@ -51,7 +51,17 @@ namespace catapult { namespace test {
 
 		/// Creates the test state around \a cache and \a timeSupplier.
 		ServiceTestState(cache::CatapultCache&& cache, const supplier<Timestamp>& timeSupplier)
-				: m_config(CreatePrototypicalCatapultConfiguration())
+				: ServiceTestState(CreatePrototypicalCatapultConfiguration(), std::move(cache), timeSupplier)
+		{}
+
+		/// Creates the test state around \a config.
+		explicit ServiceTestState(config::CatapultConfiguration&& config)
+				: ServiceTestState(std::move(config), cache::CatapultCache({}), CreateDefaultNetworkTimeSupplier())
+		{}
+
+		/// Creates the test state around \a config, \a cache and \a timeSupplier.
+		ServiceTestState(config::CatapultConfiguration&& config, cache::CatapultCache&& cache, const supplier<Timestamp>& timeSupplier)
+				: m_config(std::move(config))
 				, m_nodes(
 						std::numeric_limits<size_t>::max(),
 						model::NodeIdentityEqualityStrategy::Key_And_Host,
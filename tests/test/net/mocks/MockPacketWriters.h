@@ -101,6 +101,10 @@ namespace catapult { namespace mocks {
 			CATAPULT_THROW_RUNTIME_ERROR("not implemented in mock");
 		}
 
+		size_t numPendingBroadcasts(net::BroadcastLane) const override {
+			CATAPULT_THROW_RUNTIME_ERROR("not implemented in mock");
+		}
+
 		void broadcast(const ionet::PacketPayload&) override {
 			CATAPULT_THROW_RUNTIME_ERROR("not implemented in mock");
 		}
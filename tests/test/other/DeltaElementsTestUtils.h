@@ -65,6 +65,11 @@ namespace catapult { namespace test {
 			auto deltas() const {
 				return deltaset::DeltaElements<SetType>(Added, Removed, Copied);
 			}
+
+			/// Gets a movable delta elements around the sub sets.
+			auto movableDeltas() {
+				return deltaset::MovableDeltaElements<SetType>(Added, Removed, Copied);
+			}
 		};
 
 		/// Mixin that provides generational change emulation.
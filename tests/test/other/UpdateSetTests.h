@@ -34,7 +34,7 @@ namespace catapult { namespace test {
 			typename TTraits::TestContext context;
 
 			// Act:
-			TTraits::CommitPolicy::Update(context.Set, context.deltas());
+			TTraits::CommitPolicy::Update(context.Set, context.movableDeltas());
 
 			// Assert:
 			EXPECT_EQ(3u, context.Set.size());
@@ -54,7 +54,7 @@ namespace catapult { namespace test {
 			TTraits::AddElement(context.Added, "bbb", 5);
 
 			// Act:
-			TTraits::CommitPolicy::Update(context.Set, context.deltas());
+			TTraits::CommitPolicy::Update(context.Set, context.movableDeltas());
 
 			// Assert:
 			EXPECT_EQ(5u, context.Set.size());
@@ -72,7 +72,7 @@ namespace catapult { namespace test {
 			TTraits::AddElement(context.Removed, "ccc", 3);
 
 			// Act:
-			TTraits::CommitPolicy::Update(context.Set, context.deltas());
+			TTraits::CommitPolicy::Update(context.Set, context.movableDeltas());
 
 			// Assert:
 			EXPECT_EQ(1u, context.Set.size());
@@ -89,7 +89,7 @@ namespace catapult { namespace test {
 			TTraits::AddElement(context.Copied, "ccc", 3, 11);
 
 			// Act:
-			TTraits::CommitPolicy::Update(context.Set, context.deltas());
+			TTraits::CommitPolicy::Update(context.Set, context.movableDeltas());
 
 			// Assert:
 			EXPECT_EQ(3u, context.Set.size());
@@ -115,7 +115,7 @@ namespace catapult { namespace test {
 			TTraits::AddElement(context.Added, "ddd", 2);
 
 			// Act:
-			TTraits::CommitPolicy::Update(context.Set, context.deltas());
+			TTraits::CommitPolicy::Update(context.Set, context.movableDeltas());
 
 			// Assert:
 			EXPECT_EQ(5u, context.Set.size());
@@ -135,7 +135,7 @@ namespace catapult { namespace test {
 			TTraits::AddElement(context.Removed, "bbb", 5);
 
 			// Act:
-			TTraits::CommitPolicy::Update(context.Set, context.deltas());
+			TTraits::CommitPolicy::Update(context.Set, context.movableDeltas());
 
 			// Assert:
 			EXPECT_EQ(1u, context.Set.size());
@@ -151,7 +151,7 @@ namespace catapult { namespace test {
 			TTraits::AddElement(context.Copied, "eee", 7, 10);
 
 			// Act:
-			EXPECT_THROW(TTraits::CommitPolicy::Update(context.Set, context.deltas()), catapult_invalid_argument);
+			EXPECT_THROW(TTraits::CommitPolicy::Update(context.Set, context.movableDeltas()), catapult_invalid_argument);
 		}
 
 		// endregion
@@ -166,7 +166,7 @@ namespace catapult { namespace test {
 			TTraits::AddElement(context.Copied, "aaa", 1, 10);
 
 			// Act:
-			TTraits::CommitPolicy::Update(context.Set, context.deltas());
+			TTraits::CommitPolicy::Update(context.Set, context.movableDeltas());
 
 			// Assert:
 			EXPECT_EQ(3u, context.Set.size());
@@ -193,7 +193,7 @@ namespace catapult { namespace test {
 			TTraits::AddElement(context.Added, "zzz", 7);
 
 			// Act:
-			TTraits::CommitPolicy::Update(context.Set, context.deltas());
+			TTraits::CommitPolicy::Update(context.Set, context.movableDeltas());
 
 			// Assert:
 			EXPECT_EQ(4u, context.Set.size());
@@ -31,6 +31,7 @@ namespace catapult { namespace mocks {
 		MockStateChangeSubscriber()
 				: m_numScoreChanges(0)
 				, m_numStateChanges(0)
+				, m_numFlushes(0)
 		{}
 
 	public:
@@ -44,6 +45,11 @@ namespace catapult { namespace mocks {
 			return m_numStateChanges;
 		}
 
+		/// Gets the number of flush calls.
+		size_t numFlushes() const {
+			return m_numFlushes;
+		}
+
 		/// Gets the last chain score.
 		const model::ChainScore& lastChainScore() const {
 			return m_lastChainScore;
@@ -79,9 +85,14 @@ namespace catapult { namespace mocks {
 					stateChangeInfo.Height);
 		}
 
+		void flush() override {
+			++m_numFlushes;
+		}
+
 	private:
 		size_t m_numScoreChanges;
 		size_t m_numStateChanges;
+		size_t m_numFlushes;
 		model::ChainScore m_lastChainScore;
 		std::unique_ptr<subscribers::StateChangeInfo> m_pLastStateChangeInfo;
 		consumer<const cache::CacheChanges&> m_cacheChangesConsumer;